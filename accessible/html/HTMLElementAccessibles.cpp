@@ -67,7 +67,7 @@ void HTMLLabelAccessible::DOMAttributeChanged(int32_t aNameSpaceID,
 
   if (aAttribute == nsGkAtoms::_for) {
     mDoc->QueueCacheUpdate(this, CacheDomain::Relations);
-    SendCache(CacheDomain::Actions, CacheUpdateType::Update);
+    mDoc->QueueCacheUpdate(this, CacheDomain::Actions);
   }
 }
 
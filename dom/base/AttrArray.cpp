@@ -34,27 +34,98 @@ AttrArray::Impl::~Impl() {
   NS_IF_RELEASE(mMappedAttrs);
 }
 
-const nsAttrValue* AttrArray::GetAttr(const nsAtom* aLocalName,
-                                      int32_t aNamespaceID) const {
+void AttrArray::Impl::AddToIndex(uint32_t aPos) {
+  MOZ_ASSERT(aPos < mAttrCount);
+
+  // Keep the table at most half full.
+  if (!mIndex || mAttrCount * 2 > mIndex->mMask + 1) {
+    RebuildIndex();
+    return;
+  }
+
+  const uint32_t mask = mIndex->mMask;
+  uint32_t slot = mBuffer[aPos].mName.LocalName()->hash() & mask;
+  while (mIndex->mSlots[slot]) {
+    slot = (slot + 1) & mask;
+  }
+  mIndex->mSlots[slot] = aPos + 1;
+}
+
+void AttrArray::Impl::RebuildIndex() {
+  if (mAttrCount < kIndexThreshold) {
+    mIndex = nullptr;
+    return;
+  }
+
+  const uint32_t size = mozilla::RoundUpPow2(mAttrCount * 4);
+  mIndex.reset(static_cast<Index*>(
+      calloc(1, sizeof(Index) + size * sizeof(uint32_t))));
+  if (!mIndex) {
+    // Lookups fall back to scanning the attributes.
+    return;
+  }
+  const uint32_t mask = size - 1;
+  mIndex->mMask = mask;
+
+  for (uint32_t i = 0; i < mAttrCount; ++i) {
+    uint32_t slot = mBuffer[i].mName.LocalName()->hash() & mask;
+    while (mIndex->mSlots[slot]) {
+      slot = (slot + 1) & mask;
+    }
+    mIndex->mSlots[slot] = i + 1;
+  }
+}
+
+int32_t AttrArray::IndexOfNonMappedAttr(const nsAtom* aLocalName,
+                                        int32_t aNamespaceID) const {
+  if (!mImpl) {
+    return -1;
+  }
+
+  if (const Impl::Index* index = mImpl->mIndex.get()) {
+    const uint32_t mask = index->mMask;
+    for (uint32_t slot = aLocalName->hash() & mask; index->mSlots[slot];
+         slot = (slot + 1) & mask) {
+      const uint32_t pos = index->mSlots[slot] - 1;
+      if (mImpl->mBuffer[pos].mName.Equals(aLocalName, aNamespaceID)) {
+        return pos;
+      }
+    }
+    return -1;
+  }
+
+  uint32_t i = 0;
   if (aNamespaceID == kNameSpaceID_None) {
     // This should be the common case so lets make an optimized loop
     for (const InternalAttr& attr : NonMappedAttrs()) {
       if (attr.mName.Equals(aLocalName)) {
-        return &attr.mValue;
+        return i;
       }
-    }
-
-    if (mImpl && mImpl->mMappedAttrs) {
-      return mImpl->mMappedAttrs->GetAttr(aLocalName);
+      ++i;
     }
   } else {
     for (const InternalAttr& attr : NonMappedAttrs()) {
       if (attr.mName.Equals(aLocalName, aNamespaceID)) {
-        return &attr.mValue;
+        return i;
       }
+      ++i;
     }
   }
 
+  return -1;
+}
+
+const nsAttrValue* AttrArray::GetAttr(const nsAtom* aLocalName,
+                                      int32_t aNamespaceID) const {
+  const int32_t pos = IndexOfNonMappedAttr(aLocalName, aNamespaceID);
+  if (pos >= 0) {
+    return &mImpl->mBuffer[pos].mValue;
+  }
+
+  if (aNamespaceID == kNameSpaceID_None && mImpl && mImpl->mMappedAttrs) {
+    return mImpl->mMappedAttrs->GetAttr(aLocalName);
+  }
+
   return nullptr;
 }
 
@@ -122,6 +193,10 @@ inline nsresult AttrArray::AddNewAttribute(Name* aName, nsAttrValue& aValue) {
   new (&attr.mName) nsAttrName(aName);
   new (&attr.mValue) nsAttrValue();
   attr.mValue.SwapValueWith(aValue);
+
+  if (mImpl->mAttrCount >= Impl::kIndexThreshold) {
+    mImpl->AddToIndex(mImpl->mAttrCount - 1);
+  }
   return NS_OK;
 }
 
@@ -129,12 +204,11 @@ nsresult AttrArray::SetAndSwapAttr(nsAtom* aLocalName, nsAttrValue& aValue,
                                    bool* aHadValue) {
   *aHadValue = false;
 
-  for (InternalAttr& attr : NonMappedAttrs()) {
-    if (attr.mName.Equals(aLocalName)) {
-      attr.mValue.SwapValueWith(aValue);
-      *aHadValue = true;
-      return NS_OK;
-    }
+  const int32_t pos = IndexOfNonMappedAttr(aLocalName, kNameSpaceID_None);
+  if (pos >= 0) {
+    mImpl->mBuffer[pos].mValue.SwapValueWith(aValue);
+    *aHadValue = true;
+    return NS_OK;
   }
 
   return AddNewAttribute(aLocalName, aValue);
@@ -149,13 +223,13 @@ nsresult AttrArray::SetAndSwapAttr(mozilla::dom::NodeInfo* aName,
   }
 
   *aHadValue = false;
-  for (InternalAttr& attr : NonMappedAttrs()) {
-    if (attr.mName.Equals(localName, namespaceID)) {
-      attr.mName.SetTo(aName);
-      attr.mValue.SwapValueWith(aValue);
-      *aHadValue = true;
-      return NS_OK;
-    }
+  const int32_t pos = IndexOfNonMappedAttr(localName, namespaceID);
+  if (pos >= 0) {
+    InternalAttr& attr = mImpl->mBuffer[pos];
+    attr.mName.SetTo(aName);
+    attr.mValue.SwapValueWith(aValue);
+    *aHadValue = true;
+    return NS_OK;
   }
 
   return AddNewAttribute(aName, aValue);
@@ -174,6 +248,10 @@ nsresult AttrArray::RemoveAttrAt(uint32_t aPos, nsAttrValue& aValue) {
 
     --mImpl->mAttrCount;
 
+    if (mImpl->mIndex) {
+      mImpl->RebuildIndex();
+    }
+
     return NS_OK;
   }
 
@@ -260,30 +338,7 @@ int32_t AttrArray::IndexOfAttr(const nsAtom* aLocalName,
     }
   }
 
-  uint32_t i = 0;
-  if (aNamespaceID == kNameSpaceID_None) {
-    // This should be the common case so lets make an optimized loop
-    // Note that here we don't check for AttrSlotIsTaken() in the loop
-    // condition for the sake of performance because comparing aLocalName
-    // against null would fail in the loop body (since Equals() just compares
-    // the raw pointer value of aLocalName to what AttrSlotIsTaken() would be
-    // checking.
-    for (const InternalAttr& attr : NonMappedAttrs()) {
-      if (attr.mName.Equals(aLocalName)) {
-        return i;
-      }
-      ++i;
-    }
-  } else {
-    for (const InternalAttr& attr : NonMappedAttrs()) {
-      if (attr.mName.Equals(aLocalName, aNamespaceID)) {
-        return i;
-      }
-      ++i;
-    }
-  }
-
-  return -1;
+  return IndexOfNonMappedAttr(aLocalName, aNamespaceID);
 }
 
 nsresult AttrArray::SetAndSwapMappedAttr(nsAtom* aLocalName,
@@ -442,6 +497,7 @@ nsresult AttrArray::EnsureCapacityToClone(const AttrArray& aOther) {
   NS_ENSURE_TRUE(mImpl, NS_ERROR_OUT_OF_MEMORY);
 
   mImpl->mMappedAttrs = nullptr;
+  new (&mImpl->mIndex) decltype(mImpl->mIndex)();
   mImpl->mCapacity = attrCount;
   mImpl->mAttrCount = 0;
 
@@ -498,6 +554,7 @@ bool AttrArray::GrowBy(uint32_t aGrowSize) {
   // Set initial counts if we didn't have a buffer before
   if (needToInitialize) {
     mImpl->mMappedAttrs = nullptr;
+    new (&mImpl->mIndex) decltype(mImpl->mIndex)();
     mImpl->mAttrCount = 0;
   }
 
@@ -512,6 +569,7 @@ size_t AttrArray::SizeOfExcludingThis(
     // Don't add the size taken by *mMappedAttrs because it's shared.
 
     n += aMallocSizeOf(mImpl.get());
+    n += aMallocSizeOf(mImpl->mIndex.get());
 
     for (const InternalAttr& attr : NonMappedAttrs()) {
       n += attr.mValue.SizeOfExcludingThis(aMallocSizeOf);
@@ -14,6 +14,7 @@
 #include "mozilla/Attributes.h"
 #include "mozilla/MemoryReporting.h"
 #include "mozilla/UniquePtr.h"
+#include "mozilla/UniquePtrExtensions.h"
 #include "mozilla/Span.h"
 #include "mozilla/dom/BorrowedAttrInfo.h"
 
@@ -146,6 +147,10 @@ class AttrArray {
 
   bool GrowBy(uint32_t aGrowSize);
 
+  // Returns the position of the given non-mapped attribute, or -1.
+  int32_t IndexOfNonMappedAttr(const nsAtom* aLocalName,
+                               int32_t aNamespaceID) const;
+
   // Tries to create an attribute, growing the buffer if needed, with the given
   // name and value.
   //
@@ -190,12 +195,33 @@ class AttrArray {
     Impl(Impl&&) = delete;
     ~Impl();
 
+    // Elements with at least this many non-mapped attributes get mIndex.
+    static constexpr uint32_t kIndexThreshold = 16;
+
+    // Updates mIndex after the attribute at aPos was appended.
+    void AddToIndex(uint32_t aPos);
+    // Rebuilds (or drops) mIndex after attributes were moved or removed.
+    void RebuildIndex();
+
     uint32_t mAttrCount;
     uint32_t mCapacity;  // In number of InternalAttrs
 
     // Manually refcounted.
     nsMappedAttributes* mMappedAttrs;
 
+    // Open-addressed hash table keyed by the local name atom's hash, mapping
+    // to the position of each non-mapped attribute plus one (zero marks an
+    // empty slot). It is only modified while attributes are being set or
+    // removed, so lookups never write to it.
+    struct Index {
+      uint32_t mMask;
+      uint32_t mSlots[0];
+    };
+
+    // Allocated out of line, and null below kIndexThreshold, so that it costs
+    // other elements a single pointer.
+    mozilla::UniquePtr<Index, mozilla::FreePolicy<Index>> mIndex;
+
     // Allocated in the same buffer as `Impl`.
     InternalAttr mBuffer[0];
   };
@@ -6,11 +6,13 @@
 
 #include "BodyStream.h"
 #include "js/GCAPI.h"
+#include "js/experimental/TypedData.h"
 #include "mozilla/CycleCollectedJSContext.h"
 #include "mozilla/dom/AutoEntryScript.h"
 #include "mozilla/dom/DOMException.h"
 #include "mozilla/dom/ReadableStream.h"
 #include "mozilla/dom/ReadableByteStreamController.h"
+#include "mozilla/dom/ReadableStreamBYOBRequest.h"
 #include "mozilla/dom/ScriptSettings.h"
 #include "mozilla/dom/WorkerCommon.h"
 #include "mozilla/dom/WorkerPrivate.h"
@@ -390,6 +392,40 @@ void BodyStream::EnqueueChunkWithSizeIntoStream(JSContext* aCx,
   uint32_t ableToRead =
       std::min(static_cast<uint64_t>(256 * 1024 * 1024), aAvailableData);
 
+  MOZ_ASSERT(aStream->Controller()->IsByte());
+  RefPtr<ReadableByteStreamController> byteStreamController =
+      aStream->Controller()->AsByte();
+
+  // If a BYOB read is pending, read straight into its view. Enqueueing a new
+  // chunk would only have it copied into that view right away.
+  RefPtr<ReadableStreamBYOBRequest> byobRequest =
+      ReadableByteStreamControllerGetBYOBRequest(aCx, byteStreamController,
+                                                 aRv);
+  if (aRv.Failed()) {
+    return;
+  }
+  if (byobRequest) {
+    JS::Rooted<JSObject*> view(aCx, byobRequest->View());
+    size_t viewLength = JS_GetArrayBufferViewByteLength(view);
+    if (viewLength) {
+      uint32_t bytesWritten = 0;
+      WriteIntoReadRequestBuffer(
+          aCx, aStream, view,
+          std::min(static_cast<uint64_t>(ableToRead),
+                   static_cast<uint64_t>(viewLength)),
+          &bytesWritten);
+
+      // The stream has been closed.
+      if (bytesWritten == 0) {
+        return;
+      }
+
+      ReadableByteStreamControllerRespond(aCx, byteStreamController,
+                                          bytesWritten, aRv);
+      return;
+    }
+  }
+
   // Create Chunk
   aRv.MightThrowJSException();
   JS::Rooted<JSObject*> chunk(aCx, JS_NewUint8Array(aCx, ableToRead));
@@ -415,10 +451,6 @@ void BodyStream::EnqueueChunkWithSizeIntoStream(JSContext* aCx,
     MOZ_DIAGNOSTIC_ASSERT((ableToRead - bytesWritten) == 0);
   }
 
-  MOZ_ASSERT(aStream->Controller()->IsByte());
-  RefPtr<ReadableByteStreamController> byteStreamController =
-      aStream->Controller()->AsByte();
-
   ReadableByteStreamControllerEnqueue(aCx, byteStreamController, chunk, aRv);
   if (aRv.Failed()) {
     return;
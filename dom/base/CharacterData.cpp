@@ -117,8 +117,7 @@ void CharacterData::GetNodeValueInternal(nsAString& aNodeValue) {
 
 void CharacterData::SetNodeValueInternal(const nsAString& aNodeValue,
                                          ErrorResult& aError) {
-  aError = SetTextInternal(0, mText.GetLength(), aNodeValue.BeginReading(),
-                           aNodeValue.Length(), true);
+  aError = SetTextInternal(0, mText.GetLength(), aNodeValue, true);
 }
 
 //----------------------------------------------------------------------
@@ -152,8 +151,7 @@ void CharacterData::GetData(nsAString& aData) const {
 }
 
 void CharacterData::SetData(const nsAString& aData, ErrorResult& aRv) {
-  nsresult rv = SetTextInternal(0, mText.GetLength(), aData.BeginReading(),
-                                aData.Length(), true);
+  nsresult rv = SetTextInternal(0, mText.GetLength(), aData, true);
   if (NS_FAILED(rv)) {
     aRv.Throw(rv);
   }
@@ -223,6 +221,16 @@ nsresult CharacterData::SetTextInternal(
     CharacterDataChangeInfo::Details* aDetails) {
   MOZ_ASSERT(aBuffer || !aLength, "Null buffer passed to SetTextInternal!");
 
+  return SetTextInternal(aOffset, aCount, Substring(aBuffer, aLength), aNotify,
+                         aDetails);
+}
+
+nsresult CharacterData::SetTextInternal(
+    uint32_t aOffset, uint32_t aCount, const nsAString& aData, bool aNotify,
+    CharacterDataChangeInfo::Details* aDetails) {
+  const char16_t* buffer = aData.BeginReading();
+  uint32_t length = aData.Length();
+
   // sanitize arguments
   uint32_t textLength = mText.GetLength();
   if (aOffset > textLength) {
@@ -236,7 +244,7 @@ nsresult CharacterData::SetTextInternal(
   uint32_t endOffset = aOffset + aCount;
 
   // Make sure the text fragment can hold the new data.
-  if (aLength > aCount && !mText.CanGrowBy(aLength - aCount)) {
+  if (length > aCount && !mText.CanGrowBy(length - aCount)) {
     return NS_ERROR_OUT_OF_MEMORY;
   }
 
@@ -254,7 +262,7 @@ nsresult CharacterData::SetTextInternal(
 
   if (aNotify) {
     CharacterDataChangeInfo info = {aOffset == textLength, aOffset, endOffset,
-                                    aLength, aDetails};
+                                    length, aDetails};
     MutationObservers::NotifyCharacterDataWillChange(this, info);
   }
 
@@ -268,21 +276,25 @@ nsresult CharacterData::SetTextInternal(
     // Replacing whole text or old text was empty.
     // If this is marked as "maybe modified frequently", the text should be
     // stored as char16_t since converting char* to char16_t* is expensive.
-    bool ok = mText.SetTo(aBuffer, aLength, true,
-                          HasFlag(NS_MAYBE_MODIFIED_FREQUENTLY));
+    bool ok = mText.SetTo(aData, true, HasFlag(NS_MAYBE_MODIFIED_FREQUENTLY));
     NS_ENSURE_TRUE(ok, NS_ERROR_OUT_OF_MEMORY);
   } else if (aOffset == textLength) {
     // Appending to existing.
-    bool ok = mText.Append(aBuffer, aLength, !mText.IsBidi(),
+    bool ok = mText.Append(buffer, length, !mText.IsBidi(),
                            HasFlag(NS_MAYBE_MODIFIED_FREQUENTLY));
     NS_ENSURE_TRUE(ok, NS_ERROR_OUT_OF_MEMORY);
+  } else if (mText.Is2b()) {
+    // Splicing into 2-byte text, which is what editor-owned text nodes use.
+    // This avoids copying the whole string into a new buffer per keystroke.
+    bool ok = mText.Replace(aOffset, aCount, buffer, length, !mText.IsBidi());
+    NS_ENSURE_TRUE(ok, NS_ERROR_OUT_OF_MEMORY);
   } else {
     // Merging old and new
 
     bool bidi = mText.IsBidi();
 
     // Allocate new buffer
-    const uint32_t newLength = textLength - aCount + aLength;
+    const uint32_t newLength = textLength - aCount + length;
     // Use nsString and not nsAutoString so that we get a nsStringBuffer which
     // can be just AddRefed in nsTextFragment.
     nsString to;
@@ -292,10 +304,10 @@ nsresult CharacterData::SetTextInternal(
     if (aOffset) {
       mText.AppendTo(to, 0, aOffset);
     }
-    if (aLength) {
-      to.Append(aBuffer, aLength);
+    if (length) {
+      to.Append(buffer, length);
       if (!bidi) {
-        bidi = HasRTLChars(Span(aBuffer, aLength));
+        bidi = HasRTLChars(Span(buffer, length));
       }
     }
     if (endOffset != textLength) {
@@ -330,14 +342,14 @@ nsresult CharacterData::SetTextInternal(
   // Notify observers
   if (aNotify) {
     CharacterDataChangeInfo info = {aOffset == textLength, aOffset, endOffset,
-                                    aLength, aDetails};
+                                    length, aDetails};
     MutationObservers::NotifyCharacterDataChanged(this, info);
 
     if (haveMutationListeners) {
       InternalMutationEvent mutation(true, eLegacyCharacterDataModified);
 
       mutation.mPrevAttrValue = oldValue;
-      if (aLength > 0) {
+      if (length > 0) {
         nsAutoString val;
         mText.AppendTo(val);
         mutation.mNewAttrValue = NS_Atomize(val);
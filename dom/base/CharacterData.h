@@ -128,7 +128,7 @@ class CharacterData : public nsIContent {
    * the document is notified of the content change.
    */
   nsresult SetText(const nsAString& aStr, bool aNotify) {
-    return SetText(aStr.BeginReading(), aStr.Length(), aNotify);
+    return SetTextInternal(0, mText.GetLength(), aStr, aNotify);
   }
 
   /**
@@ -210,6 +210,14 @@ class CharacterData : public nsIContent {
       uint32_t aLength, bool aNotify,
       CharacterDataChangeInfo::Details* aDetails = nullptr);
 
+  /**
+   * Like the buffer version, but lets mText share the string buffer of aData
+   * instead of copying it when the whole text is replaced.
+   */
+  nsresult SetTextInternal(
+      uint32_t aOffset, uint32_t aCount, const nsAString& aData, bool aNotify,
+      CharacterDataChangeInfo::Details* aDetails = nullptr);
+
   /**
    * Method to clone this node. This needs to be overriden by all derived
    * classes. If aCloneText is true the text content will be cloned too.
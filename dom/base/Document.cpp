@@ -1288,6 +1288,53 @@ void Document::SelectorCache::NotifyExpired(SelectorCacheKey* aSelector) {
   delete aSelector;
 }
 
+// Enough for the handful of selectors a framework polls in a loop, while
+// bounding how many stale elements we keep alive until the next lookup.
+static constexpr size_t kMaxQuerySelectorAllResults = 8;
+
+const Document::QuerySelectorAllResult*
+Document::GetCachedQuerySelectorAllResult(nsINode& aRoot,
+                                          const nsACString& aSelector) {
+  MOZ_ASSERT(aRoot.OwnerDoc() == this);
+  if (mQuerySelectorAllResults.IsEmpty()) {
+    return nullptr;
+  }
+  if (mQuerySelectorAllResultsGuard.Mutated(0)) {
+    mQuerySelectorAllResults.Clear();
+    return nullptr;
+  }
+  for (size_t i = 0; i < mQuerySelectorAllResults.Length(); ++i) {
+    QuerySelectorAllResult& result = mQuerySelectorAllResults[i];
+    if (result.mRoot != &aRoot || !result.mSelector.Equals(aSelector)) {
+      continue;
+    }
+    if (i) {
+      QuerySelectorAllResult hit = std::move(result);
+      mQuerySelectorAllResults.RemoveElementAt(i);
+      mQuerySelectorAllResults.InsertElementAt(0, std::move(hit));
+    }
+    return &mQuerySelectorAllResults[0];
+  }
+  return nullptr;
+}
+
+void Document::CacheQuerySelectorAllResult(
+    nsINode& aRoot, const nsACString& aSelector,
+    nsTArray<nsCOMPtr<nsIContent>>&& aElements) {
+  MOZ_ASSERT(aRoot.OwnerDoc() == this);
+  if (mQuerySelectorAllResults.IsEmpty() ||
+      mQuerySelectorAllResultsGuard.Mutated(0)) {
+    mQuerySelectorAllResults.Clear();
+    mQuerySelectorAllResultsGuard = nsMutationGuard();
+  }
+  if (mQuerySelectorAllResults.Length() == kMaxQuerySelectorAllResults) {
+    mQuerySelectorAllResults.RemoveLastElement();
+  }
+  mQuerySelectorAllResults.InsertElementAt(
+      0, QuerySelectorAllResult{&aRoot, nsCString(aSelector),
+                                std::move(aElements)});
+}
+
 Document::PendingFrameStaticClone::~PendingFrameStaticClone() = default;
 
 // ==================================================================
@@ -2565,6 +2612,11 @@ NS_IMPL_CYCLE_COLLECTION_TRAVERSE_BEGIN_INTERNAL(Document)
     NS_IMPL_CYCLE_COLLECTION_TRAVERSE(
         mPendingFrameStaticClones[i].mStaticCloneOf);
   }
+
+  for (size_t i = 0; i < tmp->mQuerySelectorAllResults.Length(); ++i) {
+    NS_IMPL_CYCLE_COLLECTION_TRAVERSE(mQuerySelectorAllResults[i].mRoot);
+    NS_IMPL_CYCLE_COLLECTION_TRAVERSE(mQuerySelectorAllResults[i].mElements);
+  }
 NS_IMPL_CYCLE_COLLECTION_TRAVERSE_END
 
 NS_IMPL_CYCLE_COLLECTION_CLASS(Document)
@@ -2709,6 +2761,7 @@ NS_IMPL_CYCLE_COLLECTION_UNLINK_BEGIN(Document)
   }
 
   tmp->mPendingFrameStaticClones.Clear();
+  tmp->mQuerySelectorAllResults.Clear();
 
   tmp->mInUnlinkOrDeletion = false;
 
@@ -2837,6 +2890,7 @@ void Document::DisconnectNodeTree() {
     // Invalidate cached array of child nodes
     InvalidateChildNodes();
 
+    DropQuerySelectorAllResults();
     while (HasChildren()) {
       nsMutationGuard::DidMutate();
       nsCOMPtr<nsIContent> content = GetLastChild();
@@ -1660,6 +1660,24 @@ class Document : public nsINode,
     }
     return *mSelectorCache;
   }
+
+  // The results of the last few querySelectorAll calls on nodes owned by this
+  // document, most recently used first. They are only valid until the next
+  // DOM mutation anywhere, as counted by nsMutationGuard, so only selectors
+  // that match on the tree and attributes alone may be cached. Mutations of
+  // nodes owned by this document drop them right away with
+  // DropQuerySelectorAllResults, so they don't keep removed nodes alive.
+  struct QuerySelectorAllResult {
+    nsCOMPtr<nsINode> mRoot;
+    nsCString mSelector;
+    nsTArray<nsCOMPtr<nsIContent>> mElements;
+  };
+
+  const QuerySelectorAllResult* GetCachedQuerySelectorAllResult(
+      nsINode& aRoot, const nsACString& aSelector);
+  void CacheQuerySelectorAllResult(nsINode& aRoot, const nsACString& aSelector,
+                                   nsTArray<nsCOMPtr<nsIContent>>&& aElements);
+  void DropQuerySelectorAllResults() { mQuerySelectorAllResults.Clear(); }
   // Get the root <html> element, or return null if there isn't one (e.g.
   // if the root isn't <html>)
   Element* GetHtmlElement() const;
@@ -4328,6 +4346,8 @@ class Document : public nsINode,
   // Lazy-initialization to have mDocGroup initialized in prior to the
   // SelectorCaches.
   UniquePtr<SelectorCache> mSelectorCache;
+  nsTArray<QuerySelectorAllResult> mQuerySelectorAllResults;
+  nsMutationGuard mQuerySelectorAllResultsGuard;
   UniquePtr<ServoStyleSet> mStyleSet;
 
  protected:
@@ -21,6 +21,7 @@
 #include "nsGkAtoms.h"
 #include "mozilla/dom/HTMLCollectionBinding.h"
 #include "mozilla/dom/NodeListBinding.h"
+#include "mozilla/BinarySearch.h"
 #include "mozilla/Likely.h"
 #include "nsGenericHTMLElement.h"
 #include "jsfriendapi.h"
@@ -638,12 +639,17 @@ void nsContentList::AttributeChanged(Element* aElement, int32_t aNameSpaceID,
     return;
   }
 
+  if (aElement == mRootNode) {
+    // We never contain our root, whether or not it matches.
+    return;
+  }
+
   if (Match(aElement)) {
     if (mElements.IndexOf(aElement) == mElements.NoIndex) {
-      // We match aElement now, and it's not in our list already.  Just dirty
-      // ourselves; this is simpler than trying to figure out where to insert
-      // aElement.
-      SetDirty();
+      // We match aElement now, and it's not in our list already.
+      AutoTArray<nsIContent*, 1> matches;
+      matches.AppendElement(aElement);
+      InsertMatches(matches);
     }
   } else {
     // We no longer match aElement.  Remove it from our list.  If it's
@@ -700,16 +706,13 @@ void nsContentList::ContentAppended(nsIContent* aFirstNewContent) {
   }();
 
   if (!appendingToList) {
-    // The new stuff is somewhere in the middle of our list; check
-    // whether we need to invalidate
+    // The new stuff is somewhere in the middle of our list. The appended
+    // subtrees are contiguous in tree order, so splice their matches in.
+    AutoTArray<nsIContent*, 8> matches;
     for (nsIContent* cur = aFirstNewContent; cur; cur = cur->GetNextSibling()) {
-      if (MatchSelf(cur)) {
-        // Uh-oh.  We're gonna have to add elements into the middle
-        // of our list. That's not worth the effort.
-        SetDirty();
-        break;
-      }
+      CollectMatches(cur, matches);
     }
+    InsertMatches(matches);
 
     ASSERT_IN_SYNC;
     return;
@@ -755,9 +758,18 @@ void nsContentList::ContentInserted(nsIContent* aChild) {
   // with that.
   if (mState != State::Dirty &&
       MayContainRelevantNodes(aChild->GetParentNode()) &&
-      nsContentUtils::IsInSameAnonymousTree(mRootNode, aChild) &&
-      MatchSelf(aChild)) {
-    SetDirty();
+      nsContentUtils::IsInSameAnonymousTree(mRootNode, aChild)) {
+    if (mState == State::Lazy &&
+        (mElements.IsEmpty() ||
+         !nsContentUtils::PositionIsBefore(aChild, mElements.LastElement()))) {
+      // We haven't looked this far yet, PopulateSelf will find the new
+      // content later. Don't walk its subtree now.
+      return;
+    }
+
+    AutoTArray<nsIContent*, 8> matches;
+    CollectMatches(aChild, matches);
+    InsertMatches(matches);
   }
 
   ASSERT_IN_SYNC;
@@ -765,13 +777,53 @@ void nsContentList::ContentInserted(nsIContent* aChild) {
 
 void nsContentList::ContentRemoved(nsIContent* aChild,
                                    nsIContent* aPreviousSibling) {
-  if (mState != State::Dirty &&
-      MayContainRelevantNodes(aChild->GetParentNode()) &&
-      nsContentUtils::IsInSameAnonymousTree(mRootNode, aChild) &&
-      MatchSelf(aChild)) {
-    SetDirty();
+  if (mState == State::Dirty || mElements.IsEmpty() ||
+      !MayContainRelevantNodes(aChild->GetParentNode()) ||
+      !nsContentUtils::IsInSameAnonymousTree(mRootNode, aChild)) {
+    return;
   }
 
+  // Look for the first element we match in the removed subtree. Like
+  // MatchSelf, this stops as soon as it finds one.
+  nsIContent* first = nullptr;
+  if (aChild->IsElement() && Match(aChild->AsElement())) {
+    first = aChild;
+  } else if (mDeep) {
+    for (nsIContent* cur = aChild->GetFirstChild(); cur;
+         cur = cur->GetNextNode(aChild)) {
+      if (cur->IsElement() && Match(cur->AsElement())) {
+        first = cur;
+        break;
+      }
+    }
+  }
+  if (!first) {
+    return;
+  }
+
+  // The matches of the removed subtree are a contiguous run in our list, or
+  // are past its end if we are lazy and haven't got to them yet.
+  size_t index = mElements.IndexOf(first);
+  if (index == mElements.NoIndex) {
+    if (mState == State::UpToDate) {
+      SetDirty();
+    }
+    ASSERT_IN_SYNC;
+    return;
+  }
+
+  size_t end = index + 1;
+  if (mDeep) {
+    while (end < mElements.Length() &&
+           mElements[end]->IsInclusiveDescendantOf(aChild)) {
+      ++end;
+    }
+  }
+  for (size_t i = index; i < end; ++i) {
+    InvalidateNamedItemsCacheForDeletion(*mElements[i]->AsElement());
+  }
+  mElements.RemoveElementsAt(index, end - index);
+
   ASSERT_IN_SYNC;
 }
 
@@ -830,6 +882,62 @@ bool nsContentList::MatchSelf(nsIContent* aContent) {
   return false;
 }
 
+void nsContentList::CollectMatches(nsIContent* aContent,
+                                   nsTArray<nsIContent*>& aMatches) {
+  if (!mDeep) {
+    if (aContent->IsElement() && Match(aContent->AsElement())) {
+      aMatches.AppendElement(aContent);
+    }
+    return;
+  }
+
+  for (nsIContent* cur = aContent; cur; cur = cur->GetNextNode(aContent)) {
+    if (cur->IsElement() && Match(cur->AsElement())) {
+      aMatches.AppendElement(cur);
+    }
+  }
+}
+
+void nsContentList::InsertMatches(const nsTArray<nsIContent*>& aMatches) {
+  MOZ_ASSERT(mState != State::Dirty);
+  if (aMatches.IsEmpty()) {
+    return;
+  }
+
+  // mElements is in tree order, so find the first element that comes after
+  // the new ones.
+  nsIContent* first = aMatches[0];
+  size_t index;
+  BinarySearchIf(
+      mElements, 0, mElements.Length(),
+      [&](const nsCOMPtr<nsIContent>& aElement) {
+        return nsContentUtils::PositionIsBefore(first, aElement) ? -1 : 1;
+      },
+      &index);
+
+  if (index && mElements[index - 1] == first) {
+    // PopulateSelf already picked these up before we were notified.
+    return;
+  }
+
+  if (index == mElements.Length() && mState == State::Lazy) {
+    // We haven't looked this far yet, PopulateSelf will find them later.
+    return;
+  }
+
+  const bool appending = index == mElements.Length();
+  mElements.InsertElementsAt(index, aMatches.Elements(), aMatches.Length());
+  for (nsIContent* match : aMatches) {
+    if (appending) {
+      InvalidateNamedItemsCacheForInsertion(*match->AsElement());
+    } else {
+      // The named items cache keeps the first element for each name, which
+      // may now be one of ours.
+      InvalidateNamedItemsCacheForDeletion(*match->AsElement());
+    }
+  }
+}
+
 void nsContentList::PopulateSelf(uint32_t aNeededLength,
                                  uint32_t aExpectedElementsIfDirty) {
   if (!mRootNode) {
@@ -385,6 +385,19 @@ class nsContentList : public nsBaseContentList,
    */
   bool MatchSelf(nsIContent* aContent);
 
+  /**
+   * Append to aMatches, in tree order, the elements we match in the subtree
+   * rooted at aContent (or just aContent itself if we're not deep).
+   */
+  void CollectMatches(nsIContent* aContent, nsTArray<nsIContent*>& aMatches);
+
+  /**
+   * Insert aMatches, which must be all the elements we now match in a
+   * contiguous range of the tree, at their position in mElements. Elements
+   * past the end of a lazily populated list are left to PopulateSelf.
+   */
+  void InsertMatches(const nsTArray<nsIContent*>& aMatches);
+
   /**
    * Populate our list.  Stop once we have at least aNeededLength
    * elements.  At the end of PopulateSelf running, either the last
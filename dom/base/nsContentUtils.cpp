@@ -96,6 +96,7 @@
 #include "mozilla/ManualNAC.h"
 #include "mozilla/Maybe.h"
 #include "mozilla/MouseEvents.h"
+#include "mozilla/MruCache.h"
 #include "mozilla/NotNull.h"
 #include "mozilla/NullPrincipal.h"
 #include "mozilla/OriginAttributes.h"
@@ -601,6 +602,82 @@ static PLDHashTable* sEventListenerManagersHash;
 static nsRefPtrHashtable<nsPtrHashKey<const nsINode>, mozilla::dom::DOMArena>*
     sDOMArenaHashtable;
 
+// Recently resolved http(s) URIs, keyed on the base URI, the spec and the
+// charset. Documents tend to link to the same targets over and over, and
+// since URIs are immutable those elements can all share one nsIURI instead
+// of parsing it again each time.
+struct NewURICacheKey {
+  nsIURI* mBaseURI;
+  const Encoding* mEncoding;
+  const nsAString& mSpec;
+};
+
+struct NewURICacheEntry {
+  nsCOMPtr<nsIURI> mBaseURI;
+  const Encoding* mEncoding = nullptr;
+  nsString mSpec;
+  nsCOMPtr<nsIURI> mURI;
+};
+
+struct NewURICache
+    : public MruCache<NewURICacheKey, NewURICacheEntry, NewURICache, 61> {
+  static HashNumber Hash(const NewURICacheKey& aKey) {
+    return AddToHash(HashString(aKey.mSpec.BeginReading(), aKey.mSpec.Length()),
+                     aKey.mBaseURI, aKey.mEncoding);
+  }
+  static bool Match(const NewURICacheKey& aKey, const NewURICacheEntry& aVal) {
+    return aVal.mURI && aVal.mBaseURI == aKey.mBaseURI &&
+           aVal.mEncoding == aKey.mEncoding && aVal.mSpec.Equals(aKey.mSpec);
+  }
+};
+
+// Longer specs are rarely repeated and not worth keeping alive.
+static const uint32_t kMaxCachedNewURISpecLength = 512;
+
+static NewURICache* sNewURICache;
+
+// Set at XPCOM shutdown, after which URIs are no longer cached.
+static bool sNewURICacheShutDown = false;
+
+// Drops the cached URIs, and everything they keep alive, on memory pressure
+// and at XPCOM shutdown rather than holding them until layout shuts down.
+class NewURICacheObserver final : public nsIObserver {
+  ~NewURICacheObserver() = default;
+
+ public:
+  NS_DECL_ISUPPORTS
+
+  void Init() {
+    nsCOMPtr<nsIObserverService> obs = mozilla::services::GetObserverService();
+    if (obs) {
+      obs->AddObserver(this, "memory-pressure", false);
+      obs->AddObserver(this, NS_XPCOM_SHUTDOWN_OBSERVER_ID, false);
+    }
+  }
+
+  void Shutdown() {
+    nsCOMPtr<nsIObserverService> obs = mozilla::services::GetObserverService();
+    if (obs) {
+      obs->RemoveObserver(this, "memory-pressure");
+      obs->RemoveObserver(this, NS_XPCOM_SHUTDOWN_OBSERVER_ID);
+    }
+  }
+
+  NS_IMETHOD Observe(nsISupports* aSubject, const char* aTopic,
+                     const char16_t* aData) override {
+    if (!strcmp(aTopic, NS_XPCOM_SHUTDOWN_OBSERVER_ID)) {
+      sNewURICacheShutDown = true;
+    }
+    delete sNewURICache;
+    sNewURICache = nullptr;
+    return NS_OK;
+  }
+};
+
+NS_IMPL_ISUPPORTS(NewURICacheObserver, nsIObserver)
+
+static NewURICacheObserver* sNewURICacheObserver;
+
 class DOMEventListenerManagersHashReporter final : public nsIMemoryReporter {
   MOZ_DEFINE_MALLOC_SIZE_OF(MallocSizeOf)
 
@@ -802,6 +879,10 @@ nsresult nsContentUtils::Init() {
   uio->Init();
   uio.forget(&sUserInteractionObserver);
 
+  RefPtr<NewURICacheObserver> nuco = new NewURICacheObserver();
+  nuco->Init();
+  nuco.forget(&sNewURICacheObserver);
+
   sInitialized = true;
 
   return NS_OK;
@@ -1873,6 +1954,14 @@ void nsContentUtils::Shutdown() {
   delete sUserDefinedEvents;
   sUserDefinedEvents = nullptr;
 
+  delete sNewURICache;
+  sNewURICache = nullptr;
+
+  if (sNewURICacheObserver) {
+    sNewURICacheObserver->Shutdown();
+    NS_RELEASE(sNewURICacheObserver);
+  }
+
   if (sEventListenerManagersHash) {
     NS_ASSERTION(sEventListenerManagersHash->EntryCount() == 0,
                  "Event listener manager hash not empty at shutdown!");
@@ -3373,11 +3462,43 @@ nsresult nsContentUtils::NewURIWithDocumentCharset(nsIURI** aResult,
                                                    const nsAString& aSpec,
                                                    Document* aDocument,
                                                    nsIURI* aBaseURI) {
-  if (aDocument) {
-    return NS_NewURI(aResult, aSpec, aDocument->GetDocumentCharacterSet(),
-                     aBaseURI);
+  if (!sInitialized || sNewURICacheShutDown || !NS_IsMainThread() ||
+      aSpec.Length() > kMaxCachedNewURISpecLength) {
+    if (aDocument) {
+      return NS_NewURI(aResult, aSpec, aDocument->GetDocumentCharacterSet(),
+                       aBaseURI);
+    }
+    return NS_NewURI(aResult, aSpec, nullptr, aBaseURI);
   }
-  return NS_NewURI(aResult, aSpec, nullptr, aBaseURI);
+
+  const Encoding* encoding =
+      aDocument ? aDocument->GetDocumentCharacterSet().get() : nullptr;
+  if (!sNewURICache) {
+    sNewURICache = new NewURICache();
+  }
+  auto entry = sNewURICache->Lookup(NewURICacheKey{aBaseURI, encoding, aSpec});
+  if (entry) {
+    nsCOMPtr<nsIURI> uri = entry.Data().mURI;
+    uri.forget(aResult);
+    return NS_OK;
+  }
+
+  nsCOMPtr<nsIURI> uri;
+  nsresult rv = aDocument ? NS_NewURI(getter_AddRefs(uri), aSpec,
+                                      aDocument->GetDocumentCharacterSet(),
+                                      aBaseURI)
+                          : NS_NewURI(getter_AddRefs(uri), aSpec, nullptr,
+                                      aBaseURI);
+  NS_ENSURE_SUCCESS(rv, rv);
+
+  // Other schemes, like blob:, can carry state which changes after the URI is
+  // created, so only share the ones which are plain strings.
+  if (uri->SchemeIs("http") || uri->SchemeIs("https")) {
+    entry.Set(NewURICacheEntry{aBaseURI, encoding, nsString(aSpec), uri});
+  }
+
+  uri.forget(aResult);
+  return NS_OK;
 }
 
 // static
@@ -851,7 +851,8 @@ class nsContentUtils {
   /**
    * Create a new nsIURI from aSpec, using aBaseURI as the base.  The
    * origin charset of the new nsIURI will be the document charset of
-   * aDocument.
+   * aDocument. Recently created http(s) URIs are cached on the main thread,
+   * so the result may be shared with other callers.
    */
   static nsresult NewURIWithDocumentCharset(nsIURI** aResult,
                                             const nsAString& aSpec,
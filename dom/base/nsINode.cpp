@@ -50,6 +50,7 @@
 #include "mozilla/dom/ScriptSettings.h"
 #include "mozilla/dom/L10nOverlays.h"
 #include "mozilla/ProfilerLabels.h"
+#include "mozilla/StaticPrefs_dom.h"
 #include "mozilla/StaticPrefs_layout.h"
 #include "nsAttrValueOrString.h"
 #include "nsCCUncollectableMarker.h"
@@ -1561,6 +1562,7 @@ void nsINode::InsertChildBefore(nsIContent* aKid, nsIContent* aBeforeThis,
   // The id-handling code, and in the future possibly other code, need to
   // react to unexpected attribute changes.
   nsMutationGuard::DidMutate();
+  OwnerDoc()->DropQuerySelectorAllResults();
 
   // Do this before checking the child-count since this could cause mutations
   mozAutoDocUpdate updateBatch(GetComposedDoc(), aNotify);
@@ -2167,6 +2169,7 @@ void nsINode::RemoveChildNode(nsIContent* aKid, bool aNotify) {
   MOZ_ASSERT(!IsAttr());
 
   nsMutationGuard::DidMutate();
+  OwnerDoc()->DropQuerySelectorAllResults();
   mozAutoDocUpdate updateBatch(GetComposedDoc(), aNotify);
 
   nsIContent* previousSibling = aKid->GetPreviousSibling();
@@ -3020,6 +3023,25 @@ already_AddRefed<nsINodeList> nsINode::QuerySelectorAll(
                                         LAYOUT_SelectorQuery, aSelector);
 
   RefPtr<nsSimpleContentList> contentList = new nsSimpleContentList(this);
+
+  // Without pseudo-classes the result only depends on the tree and the
+  // attributes, all of whose changes bump the nsMutationGuard generation, so
+  // it can be reused until the next mutation.
+  Document* doc = OwnerDoc();
+  const bool cacheable =
+      StaticPrefs::dom_querySelectorAll_result_cache_enabled() &&
+      aSelector.FindChar(':') == kNotFound;
+  if (cacheable) {
+    if (const Document::QuerySelectorAllResult* cached =
+            doc->GetCachedQuerySelectorAllResult(*this, aSelector)) {
+      contentList->SetCapacity(cached->mElements.Length());
+      for (nsIContent* element : cached->mElements) {
+        contentList->AppendElement(element);
+      }
+      return contentList.forget();
+    }
+  }
+
   const RawServoSelectorList* list = ParseSelectorList(aSelector, aResult);
   if (!list) {
     return contentList.forget();
@@ -3027,6 +3049,15 @@ already_AddRefed<nsINodeList> nsINode::QuerySelectorAll(
 
   const bool useInvalidation = false;
   Servo_SelectorList_QueryAll(this, list, contentList.get(), useInvalidation);
+
+  if (cacheable) {
+    uint32_t length = contentList->Length();
+    nsTArray<nsCOMPtr<nsIContent>> elements(length);
+    for (uint32_t i = 0; i < length; ++i) {
+      elements.AppendElement(contentList->Item(i));
+    }
+    doc->CacheQuerySelectorAllResult(*this, aSelector, std::move(elements));
+  }
   return contentList.forget();
 }
 
@@ -3494,6 +3525,7 @@ void nsINode::Adopt(nsNodeInfoManager* aNewNodeInfoManager,
                                          aReparentScope, nullptr, aError);
 
   nsMutationGuard::DidMutate();
+  OwnerDoc()->DropQuerySelectorAllResults();
 }
 
 already_AddRefed<nsINode> nsINode::Clone(bool aDeep,
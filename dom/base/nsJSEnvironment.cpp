@@ -2054,6 +2054,11 @@ void nsJSContext::EnsureStatics() {
       "javascript.options.mem.incremental_weakmap",
       (void*)JSGC_INCREMENTAL_WEAKMAP_ENABLED);
 
+  Preferences::RegisterCallbackAndCall(
+      SetMemoryPrefChangedCallbackBool,
+      "javascript.options.mem.gc_parallel_minor_sweeping",
+      (void*)JSGC_PARALLEL_MINOR_GC_SWEEPING_ENABLED);
+
   Preferences::RegisterCallbackAndCall(
       SetMemoryPrefChangedCallbackInt,
       "javascript.options.mem.gc_high_frequency_time_limit_ms",
@@ -2084,6 +2089,11 @@ void nsJSContext::EnsureStatics() {
       "javascript.options.mem.gc_heap_growth_factor",
       (void*)JSGC_HEAP_GROWTH_FACTOR);
 
+  Preferences::RegisterCallbackAndCall(
+      SetMemoryPrefChangedCallbackInt,
+      "javascript.options.mem.gc_target_overhead_percent",
+      (void*)JSGC_TARGET_GC_OVERHEAD_PERCENT);
+
   Preferences::RegisterCallbackAndCall(
       SetMemoryPrefChangedCallbackInt,
       "javascript.options.mem.gc_small_heap_size_max_mb",
@@ -347,6 +347,100 @@ void nsTextFragment::CopyTo(char16_t* aDest, uint32_t aOffset,
   }
 }
 
+bool nsTextFragment::SetTo(const nsAString& aString, bool aUpdateBidi,
+                           bool aForce2b) {
+  if (MOZ_UNLIKELY(aString.Length() > NS_MAX_TEXT_FRAGMENT_LENGTH)) {
+    return false;
+  }
+
+  nsStringBuffer* buffer = nsStringBuffer::FromString(aString);
+  if (!buffer) {
+    return SetTo(aString.BeginReading(), aString.Length(), aUpdateBidi,
+                 aForce2b);
+  }
+
+  const char16_t* start = aString.BeginReading();
+  const char16_t* end = start + aString.Length();
+  int32_t first16bit = aForce2b ? 0 : FirstNon8Bit(start, end);
+  if (first16bit == -1) {
+    // Latin1 text is cheaper to keep as a 1-byte copy.
+    return SetTo(start, aString.Length(), aUpdateBidi, aForce2b);
+  }
+
+  // Take the new reference before dropping the old one, which may be the
+  // same buffer.
+  NS_ADDREF(buffer);
+  ReleaseText();
+  m2b = buffer;
+  mState.mInHeap = true;
+  mState.mIs2b = true;
+  mState.mLength = aString.Length();
+  if (aUpdateBidi) {
+    UpdateBidiFlag(start + first16bit, aString.Length() - first16bit);
+  }
+  return true;
+}
+
+bool nsTextFragment::Replace(uint32_t aOffset, uint32_t aCount,
+                             const char16_t* aBuffer, uint32_t aLength,
+                             bool aUpdateBidi) {
+  MOZ_ASSERT(mState.mIs2b);
+  MOZ_ASSERT(aOffset + aCount <= mState.mLength);
+
+  if (NS_MAX_TEXT_FRAGMENT_LENGTH - (mState.mLength - aCount) < aLength) {
+    return false;  // Would be overflown if we'd keep handling.
+  }
+
+  const uint32_t tailOffset = aOffset + aCount;
+  const uint32_t tailLength = mState.mLength - tailOffset;
+  const uint32_t newLength = mState.mLength - aCount + aLength;
+  size_t size = size_t(newLength) + 1;
+  if (SIZE_MAX / sizeof(char16_t) < size) {
+    return false;  // Would be overflown if we'd keep handling.
+  }
+  size *= sizeof(char16_t);
+
+  char16_t* data;
+  if (m2b->IsReadonly()) {
+    // Someone else holds on to the buffer, so build the result in a new one.
+    // The prefix and the tail go straight to their final places.
+    nsStringBuffer* buff = nsStringBuffer::Alloc(size).take();
+    if (!buff) {
+      return false;
+    }
+    data = static_cast<char16_t*>(buff->Data());
+    const char16_t* old = Get2b();
+    memcpy(data, old, aOffset * sizeof(char16_t));
+    memcpy(data + aOffset + aLength, old + tailOffset,
+           tailLength * sizeof(char16_t));
+    m2b->Release();
+    m2b = buff;
+  } else {
+    if (newLength > mState.mLength) {
+      nsStringBuffer* buff = nsStringBuffer::Realloc(m2b, size);
+      if (!buff) {
+        return false;
+      }
+      m2b = buff;
+    }
+    data = static_cast<char16_t*>(m2b->Data());
+    if (aLength != aCount) {
+      memmove(data + aOffset + aLength, data + tailOffset,
+              tailLength * sizeof(char16_t));
+    }
+  }
+
+  memcpy(data + aOffset, aBuffer, aLength * sizeof(char16_t));
+  mState.mLength = newLength;
+  data[newLength] = char16_t(0);
+
+  if (aUpdateBidi) {
+    UpdateBidiFlag(aBuffer, aLength);
+  }
+
+  return true;
+}
+
 bool nsTextFragment::Append(const char16_t* aBuffer, uint32_t aLength,
                             bool aUpdateBidi, bool aForce2b) {
   if (!aLength) {
@@ -107,24 +107,12 @@ class nsTextFragment final {
   bool SetTo(const char16_t* aBuffer, uint32_t aLength, bool aUpdateBidi,
              bool aForce2b);
 
-  bool SetTo(const nsString& aString, bool aUpdateBidi, bool aForce2b) {
-    if (MOZ_UNLIKELY(aString.Length() > NS_MAX_TEXT_FRAGMENT_LENGTH)) {
-      return false;
-    }
-    ReleaseText();
-    if (aForce2b && !aUpdateBidi) {
-      nsStringBuffer* buffer = nsStringBuffer::FromString(aString);
-      if (buffer) {
-        NS_ADDREF(m2b = buffer);
-        mState.mInHeap = true;
-        mState.mIs2b = true;
-        mState.mLength = aString.Length();
-        return true;
-      }
-    }
-
-    return SetTo(aString.get(), aString.Length(), aUpdateBidi, aForce2b);
-  }
+  /**
+   * Like the buffer version of SetTo, but when the text is going to be stored
+   * as char16_t anyway the string buffer of aString, if it has one, is shared
+   * instead of copied.
+   */
+  bool SetTo(const nsAString& aString, bool aUpdateBidi, bool aForce2b);
 
   /**
    * Append aData to the end of this fragment. If aUpdateBidi is true, contents
@@ -137,6 +125,17 @@ class nsTextFragment final {
   bool Append(const char16_t* aBuffer, uint32_t aLength, bool aUpdateBidi,
               bool aForce2b);
 
+  /**
+   * Replace aCount characters starting at aOffset with aBuffer. This must
+   * only be called on a 2-byte fragment. When the string buffer is not
+   * shared, the edit happens in place, so only the characters after the
+   * change are moved and no new buffer is allocated. If aUpdateBidi is true,
+   * aBuffer will be scanned, and mState.mIsBidi will be turned on if it
+   * includes any Bidi characters.
+   */
+  bool Replace(uint32_t aOffset, uint32_t aCount, const char16_t* aBuffer,
+               uint32_t aLength, bool aUpdateBidi);
+
   /**
    * Append the contents of this string fragment to aString
    */
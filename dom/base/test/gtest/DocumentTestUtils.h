@@ -0,0 +1,51 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/* vim: set ts=8 sts=2 et sw=2 tw=80: */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef mozilla_dom_gtest_DocumentTestUtils_h
+#define mozilla_dom_gtest_DocumentTestUtils_h
+
+#include "mozilla/NullPrincipal.h"
+#include "mozilla/dom/Document.h"
+#include "mozilla/dom/Element.h"
+#include "nsGkAtoms.h"
+#include "nsNetUtil.h"
+
+namespace mozilla::dom {
+
+// Creates an empty about:blank HTML document.
+inline already_AddRefed<Document> SetUpDocument() {
+  nsCOMPtr<nsIURI> uri;
+  NS_NewURI(getter_AddRefs(uri), "about:blank");
+  nsCOMPtr<nsIPrincipal> principal =
+      NullPrincipal::CreateWithoutOriginAttributes();
+  nsCOMPtr<Document> document;
+  nsresult rv = NS_NewDOMDocument(getter_AddRefs(document),
+                                  u""_ns,   // aNamespaceURI
+                                  u""_ns,   // aQualifiedName
+                                  nullptr,  // aDoctype
+                                  uri, uri, principal,
+                                  false,    // aLoadedAsData
+                                  nullptr,  // aEventObject
+                                  DocumentFlavorHTML);
+  if (NS_WARN_IF(NS_FAILED(rv))) {
+    return nullptr;
+  }
+  return document.forget();
+}
+
+// Creates a <div>, with class="x" if aMatching is true.
+inline already_AddRefed<Element> CreateDiv(Document* aDoc,
+                                           bool aMatching = false) {
+  RefPtr<Element> div = aDoc->CreateHTMLElement(nsGkAtoms::div);
+  if (aMatching) {
+    div->SetAttr(kNameSpaceID_None, nsGkAtoms::_class, u"x"_ns, true);
+  }
+  return div.forget();
+}
+
+}  // namespace mozilla::dom
+
+#endif  // mozilla_dom_gtest_DocumentTestUtils_h
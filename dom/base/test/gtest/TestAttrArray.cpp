@@ -0,0 +1,151 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/* vim: set ts=8 sts=2 et sw=2 tw=80: */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "gtest/gtest.h"
+
+#include "mozilla/dom/Document.h"
+#include "mozilla/dom/Element.h"
+#include "nsAtom.h"
+#include "nsGkAtoms.h"
+#include "nsPrintfCString.h"
+#include "DocumentTestUtils.h"
+
+using namespace mozilla;
+using namespace mozilla::dom;
+
+// AttrArray indexes the non-mapped attributes once an element has
+// Impl::kIndexThreshold of them. Go well past it in both directions.
+static const uint32_t kMaxAttrs = 40;
+
+static RefPtr<nsAtom> AttrName(uint32_t aIndex) {
+  return NS_Atomize(nsPrintfCString("data-attr%u", aIndex));
+}
+
+static nsAutoString AttrValue(uint32_t aIndex) {
+  nsAutoString value;
+  value.AppendInt(aIndex);
+  return value;
+}
+
+// Checks that exactly the attributes in [aBegin, aEnd) are set, with their
+// expected values, and that the ones around them aren't.
+static void ExpectAttrs(Element* aElement, uint32_t aBegin, uint32_t aEnd) {
+  EXPECT_EQ(aElement->GetAttrCount(), aEnd - aBegin);
+  for (uint32_t i = 0; i < kMaxAttrs; ++i) {
+    RefPtr<nsAtom> name = AttrName(i);
+    nsAutoString value;
+    bool has = aElement->GetAttr(kNameSpaceID_None, name, value);
+    if (i >= aBegin && i < aEnd) {
+      EXPECT_TRUE(has) << "attribute " << i;
+      EXPECT_TRUE(value.Equals(AttrValue(i))) << "attribute " << i;
+    } else {
+      EXPECT_FALSE(has) << "attribute " << i;
+    }
+  }
+}
+
+TEST(DOM_Base_AttrArray, GrowAcrossIndexThreshold)
+{
+  nsCOMPtr<Document> doc = SetUpDocument();
+  ASSERT_TRUE(doc);
+  RefPtr<Element> div = CreateDiv(doc);
+
+  for (uint32_t i = 0; i < kMaxAttrs; ++i) {
+    RefPtr<nsAtom> name = AttrName(i);
+    ASSERT_TRUE(NS_SUCCEEDED(
+        div->SetAttr(kNameSpaceID_None, name, AttrValue(i), false)));
+    ExpectAttrs(div, 0, i + 1);
+  }
+
+  // Overwriting an existing attribute finds it rather than adding another.
+  RefPtr<nsAtom> name = AttrName(kMaxAttrs / 2);
+  ASSERT_TRUE(
+      NS_SUCCEEDED(div->SetAttr(kNameSpaceID_None, name, u"new"_ns, false)));
+  EXPECT_EQ(div->GetAttrCount(), kMaxAttrs);
+  nsAutoString value;
+  EXPECT_TRUE(div->GetAttr(kNameSpaceID_None, name, value));
+  EXPECT_TRUE(value.EqualsLiteral("new"));
+}
+
+TEST(DOM_Base_AttrArray, RemoveBelowIndexThreshold)
+{
+  nsCOMPtr<Document> doc = SetUpDocument();
+  ASSERT_TRUE(doc);
+  RefPtr<Element> div = CreateDiv(doc);
+
+  for (uint32_t i = 0; i < kMaxAttrs; ++i) {
+    RefPtr<nsAtom> name = AttrName(i);
+    ASSERT_TRUE(NS_SUCCEEDED(
+        div->SetAttr(kNameSpaceID_None, name, AttrValue(i), false)));
+  }
+
+  // Removing from the front shifts the positions of every other attribute,
+  // so the index has to be rebuilt each time, and is dropped once the count
+  // goes below the threshold.
+  for (uint32_t i = 0; i < kMaxAttrs; ++i) {
+    RefPtr<nsAtom> name = AttrName(i);
+    ASSERT_TRUE(NS_SUCCEEDED(div->UnsetAttr(kNameSpaceID_None, name, false)));
+    ExpectAttrs(div, i + 1, kMaxAttrs);
+  }
+
+  // And it's built again when growing back.
+  for (uint32_t i = 0; i < kMaxAttrs; ++i) {
+    RefPtr<nsAtom> name = AttrName(i);
+    ASSERT_TRUE(NS_SUCCEEDED(
+        div->SetAttr(kNameSpaceID_None, name, AttrValue(i), false)));
+  }
+  ExpectAttrs(div, 0, kMaxAttrs);
+}
+
+TEST(DOM_Base_AttrArray, NamespacedAttributesShareLocalName)
+{
+  nsCOMPtr<Document> doc = SetUpDocument();
+  ASSERT_TRUE(doc);
+  RefPtr<Element> div = CreateDiv(doc);
+
+  for (uint32_t i = 0; i < kMaxAttrs; ++i) {
+    RefPtr<nsAtom> name = AttrName(i);
+    ASSERT_TRUE(NS_SUCCEEDED(
+        div->SetAttr(kNameSpaceID_None, name, AttrValue(i), false)));
+  }
+
+  // Three attributes with the same local name, so the same hash, in
+  // different namespaces.
+  ASSERT_TRUE(NS_SUCCEEDED(
+      div->SetAttr(kNameSpaceID_None, nsGkAtoms::href, u"none"_ns, false)));
+  ASSERT_TRUE(NS_SUCCEEDED(div->SetAttr(kNameSpaceID_XLink, nsGkAtoms::href,
+                                        nullptr, u"xlink"_ns, false)));
+  ASSERT_TRUE(NS_SUCCEEDED(div->SetAttr(kNameSpaceID_XML, nsGkAtoms::href,
+                                        nsGkAtoms::xml, u"xml"_ns, false)));
+  EXPECT_EQ(div->GetAttrCount(), kMaxAttrs + 3);
+
+  auto expectHref = [&](int32_t aNamespaceID, const char* aExpected) {
+    nsAutoString value;
+    bool has = div->GetAttr(aNamespaceID, nsGkAtoms::href, value);
+    if (aExpected) {
+      EXPECT_TRUE(has) << "namespace " << aNamespaceID;
+      EXPECT_TRUE(value.EqualsASCII(aExpected)) << "namespace " << aNamespaceID;
+    } else {
+      EXPECT_FALSE(has) << "namespace " << aNamespaceID;
+    }
+  };
+  expectHref(kNameSpaceID_None, "none");
+  expectHref(kNameSpaceID_XLink, "xlink");
+  expectHref(kNameSpaceID_XML, "xml");
+  expectHref(kNameSpaceID_SVG, nullptr);
+
+  ASSERT_TRUE(
+      NS_SUCCEEDED(div->UnsetAttr(kNameSpaceID_XLink, nsGkAtoms::href, false)));
+  expectHref(kNameSpaceID_None, "none");
+  expectHref(kNameSpaceID_XLink, nullptr);
+  expectHref(kNameSpaceID_XML, "xml");
+
+  ASSERT_TRUE(
+      NS_SUCCEEDED(div->UnsetAttr(kNameSpaceID_None, nsGkAtoms::href, false)));
+  expectHref(kNameSpaceID_None, nullptr);
+  expectHref(kNameSpaceID_XML, "xml");
+  ExpectAttrs(div, 0, kMaxAttrs);
+}
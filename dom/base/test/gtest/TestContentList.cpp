@@ -0,0 +1,213 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/* vim: set ts=8 sts=2 et sw=2 tw=80: */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "gtest/gtest.h"
+
+#include <initializer_list>
+
+#include "mozilla/ErrorResult.h"
+#include "mozilla/dom/Document.h"
+#include "mozilla/dom/DocumentFragment.h"
+#include "mozilla/dom/Element.h"
+#include "nsGkAtoms.h"
+#include "nsIHTMLCollection.h"
+#include "DocumentTestUtils.h"
+
+using namespace mozilla;
+using namespace mozilla::dom;
+
+static void SetMatching(Element* aElement, bool aMatching) {
+  if (aMatching) {
+    aElement->SetAttr(kNameSpaceID_None, nsGkAtoms::_class, u"x"_ns, true);
+  } else {
+    aElement->UnsetAttr(kNameSpaceID_None, nsGkAtoms::_class, true);
+  }
+}
+
+// Checks the list against the expected elements, in order. Length() and
+// Item() only walk the DOM again if the list got dirty, so this checks the
+// result of the incremental updates when the list was up to date before.
+static void ExpectList(nsIHTMLCollection* aList,
+                       std::initializer_list<Element*> aExpected) {
+  ASSERT_EQ(aList->Length(), aExpected.size());
+  uint32_t i = 0;
+  for (Element* expected : aExpected) {
+    EXPECT_EQ(aList->Item(i), expected) << "at index " << i;
+    ++i;
+  }
+}
+
+TEST(DOM_Base_ContentList, AttributeChanged)
+{
+  nsCOMPtr<Document> doc = SetUpDocument();
+  ASSERT_TRUE(doc);
+
+  RefPtr<Element> root = CreateDiv(doc);
+  RefPtr<Element> a = CreateDiv(doc);
+  RefPtr<Element> b = CreateDiv(doc);
+  RefPtr<Element> c = CreateDiv(doc);
+  RefPtr<Element> bChild = CreateDiv(doc);
+  IgnoredErrorResult rv;
+  root->AppendChild(*a, rv);
+  root->AppendChild(*b, rv);
+  root->AppendChild(*c, rv);
+  b->AppendChild(*bChild, rv);
+  ASSERT_FALSE(rv.Failed());
+
+  nsCOMPtr<nsIHTMLCollection> list = root->GetElementsByClassName(u"x"_ns);
+  ExpectList(list, {});
+
+  SetMatching(b, true);
+  ExpectList(list, {b});
+
+  // Before, after and nested in an existing match.
+  SetMatching(a, true);
+  ExpectList(list, {a, b});
+  SetMatching(c, true);
+  ExpectList(list, {a, b, c});
+  SetMatching(bChild, true);
+  ExpectList(list, {a, b, bChild, c});
+
+  SetMatching(b, false);
+  ExpectList(list, {a, bChild, c});
+  SetMatching(a, false);
+  SetMatching(c, false);
+  ExpectList(list, {bChild});
+
+  // Setting an attribute which doesn't change the match leaves it alone.
+  bChild->SetAttr(kNameSpaceID_None, nsGkAtoms::id, u"child"_ns, true);
+  ExpectList(list, {bChild});
+}
+
+TEST(DOM_Base_ContentList, AttributeChangedOnRoot)
+{
+  nsCOMPtr<Document> doc = SetUpDocument();
+  ASSERT_TRUE(doc);
+
+  RefPtr<Element> root = CreateDiv(doc);
+  RefPtr<Element> a = CreateDiv(doc, true);
+  IgnoredErrorResult rv;
+  root->AppendChild(*a, rv);
+  ASSERT_FALSE(rv.Failed());
+
+  nsCOMPtr<nsIHTMLCollection> list = root->GetElementsByClassName(u"x"_ns);
+  ExpectList(list, {a});
+
+  // The root is never part of its own list, even when it matches.
+  SetMatching(root, true);
+  ExpectList(list, {a});
+  SetMatching(root, false);
+  ExpectList(list, {a});
+}
+
+TEST(DOM_Base_ContentList, ContentInsertedAndAppended)
+{
+  nsCOMPtr<Document> doc = SetUpDocument();
+  ASSERT_TRUE(doc);
+
+  RefPtr<Element> root = CreateDiv(doc);
+  RefPtr<Element> a = CreateDiv(doc, true);
+  RefPtr<Element> c = CreateDiv(doc, true);
+  IgnoredErrorResult rv;
+  root->AppendChild(*a, rv);
+  root->AppendChild(*c, rv);
+  ASSERT_FALSE(rv.Failed());
+
+  nsCOMPtr<nsIHTMLCollection> list = root->GetElementsByClassName(u"x"_ns);
+  ExpectList(list, {a, c});
+
+  // Insert a subtree with a match nested in a non-matching element, between
+  // the two matches.
+  RefPtr<Element> b = CreateDiv(doc);
+  RefPtr<Element> bChild = CreateDiv(doc, true);
+  b->AppendChild(*bChild, rv);
+  root->InsertBefore(*b, c, rv);
+  ASSERT_FALSE(rv.Failed());
+  ExpectList(list, {a, bChild, c});
+
+  // Insert before the first match.
+  RefPtr<Element> first = CreateDiv(doc, true);
+  root->InsertBefore(*first, a, rv);
+  ASSERT_FALSE(rv.Failed());
+  ExpectList(list, {first, a, bChild, c});
+
+  // Append several nodes in the middle of the list at once.
+  RefPtr<DocumentFragment> fragment = doc->CreateDocumentFragment();
+  RefPtr<Element> a1 = CreateDiv(doc, true);
+  RefPtr<Element> a2 = CreateDiv(doc);
+  RefPtr<Element> a3 = CreateDiv(doc, true);
+  fragment->AppendChild(*a1, rv);
+  fragment->AppendChild(*a2, rv);
+  fragment->AppendChild(*a3, rv);
+  a->AppendChild(*fragment, rv);
+  ASSERT_FALSE(rv.Failed());
+  ExpectList(list, {first, a, a1, a3, bChild, c});
+
+  // And at the end of it.
+  RefPtr<Element> last = CreateDiv(doc, true);
+  root->AppendChild(*last, rv);
+  ASSERT_FALSE(rv.Failed());
+  ExpectList(list, {first, a, a1, a3, bChild, c, last});
+}
+
+TEST(DOM_Base_ContentList, ContentRemoved)
+{
+  nsCOMPtr<Document> doc = SetUpDocument();
+  ASSERT_TRUE(doc);
+
+  // <root>
+  //   <a class=x><a1 class=x/><a2/><a3 class=x/></a>
+  //   <b><b1 class=x/><b2 class=x/></b>
+  //   <c class=x/>
+  // </root>
+  RefPtr<Element> root = CreateDiv(doc);
+  RefPtr<Element> a = CreateDiv(doc, true);
+  RefPtr<Element> a1 = CreateDiv(doc, true);
+  RefPtr<Element> a2 = CreateDiv(doc);
+  RefPtr<Element> a3 = CreateDiv(doc, true);
+  RefPtr<Element> b = CreateDiv(doc);
+  RefPtr<Element> b1 = CreateDiv(doc, true);
+  RefPtr<Element> b2 = CreateDiv(doc, true);
+  RefPtr<Element> c = CreateDiv(doc, true);
+  IgnoredErrorResult rv;
+  a->AppendChild(*a1, rv);
+  a->AppendChild(*a2, rv);
+  a->AppendChild(*a3, rv);
+  b->AppendChild(*b1, rv);
+  b->AppendChild(*b2, rv);
+  root->AppendChild(*a, rv);
+  root->AppendChild(*b, rv);
+  root->AppendChild(*c, rv);
+  ASSERT_FALSE(rv.Failed());
+
+  nsCOMPtr<nsIHTMLCollection> list = root->GetElementsByClassName(u"x"_ns);
+  ExpectList(list, {a, a1, a3, b1, b2, c});
+
+  // A node which doesn't match.
+  a->RemoveChild(*a2, rv);
+  ASSERT_FALSE(rv.Failed());
+  ExpectList(list, {a, a1, a3, b1, b2, c});
+
+  // A non-matching node with matching descendants.
+  root->RemoveChild(*b, rv);
+  ASSERT_FALSE(rv.Failed());
+  ExpectList(list, {a, a1, a3, c});
+
+  // A matching leaf.
+  a->RemoveChild(*a1, rv);
+  ASSERT_FALSE(rv.Failed());
+  ExpectList(list, {a, a3, c});
+
+  // A matching node with matching descendants.
+  root->RemoveChild(*a, rv);
+  ASSERT_FALSE(rv.Failed());
+  ExpectList(list, {c});
+
+  // Putting a removed subtree back in front.
+  root->InsertBefore(*b, c, rv);
+  ASSERT_FALSE(rv.Failed());
+  ExpectList(list, {b1, b2, c});
+}
@@ -0,0 +1,104 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/* vim: set ts=8 sts=2 et sw=2 tw=80: */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "gtest/gtest.h"
+
+#include "mozilla/ErrorResult.h"
+#include "mozilla/dom/DOMParser.h"
+#include "mozilla/dom/Document.h"
+#include "nsGenericHTMLElement.h"
+#include "nsHtml5Tokenizer.h"
+#include "nsString.h"
+
+using namespace mozilla;
+using namespace mozilla::dom;
+
+// The data state scans from the code unit after aPos: with aPos == 0 the SIMD
+// path checks [1, 9) and [9, 17), and [17, aEndPos) is left to the scalar loop
+// when aEndPos is 20. Offsets 15 and 16 are in the last full block, 16 being
+// its last lane, and 17 is the first code unit of the remainder.
+static const int32_t kEndPos = 20;
+static const int32_t kOffsets[] = {15, 16, 17};
+static const char16_t kSpecialChars[] = {u'<', u'&', u'\r', u'\n', u'\0'};
+
+TEST(Html5Tokenizer, LastOrdinaryDataChar)
+{
+  for (char16_t special : kSpecialChars) {
+    for (int32_t offset : kOffsets) {
+      char16_t buf[kEndPos];
+      for (char16_t& c : buf) {
+        c = u'a';
+      }
+      buf[offset] = special;
+      EXPECT_EQ(nsHtml5Tokenizer::LastOrdinaryDataChar(buf, 0, kEndPos),
+                offset - 1)
+          << "for U+" << std::hex << uint32_t(special) << std::dec
+          << " at offset " << offset;
+
+      // A special code unit past aEndPos is never looked at.
+      EXPECT_EQ(nsHtml5Tokenizer::LastOrdinaryDataChar(buf, 0, offset),
+                offset - 1);
+    }
+  }
+
+  // Without a special code unit the scan ends at the last code unit, whether
+  // that is the end of a block or in the remainder.
+  char16_t buf[kEndPos];
+  for (char16_t& c : buf) {
+    c = u'a';
+  }
+  EXPECT_EQ(nsHtml5Tokenizer::LastOrdinaryDataChar(buf, 0, 17), 16);
+  EXPECT_EQ(nsHtml5Tokenizer::LastOrdinaryDataChar(buf, 0, kEndPos),
+            kEndPos - 1);
+  EXPECT_EQ(nsHtml5Tokenizer::LastOrdinaryDataChar(buf, kEndPos - 1, kEndPos),
+            kEndPos - 1);
+}
+
+static void ExpectBodyHTML(const nsAString& aBodySource,
+                           const nsAString& aExpected) {
+  IgnoredErrorResult rv;
+  RefPtr<DOMParser> parser = DOMParser::CreateWithoutGlobal(rv);
+  ASSERT_FALSE(rv.Failed());
+  nsAutoString source(u"<body>"_ns);
+  source.Append(aBodySource);
+  nsCOMPtr<Document> doc =
+      parser->ParseFromString(source, SupportedType::Text_html, rv);
+  ASSERT_FALSE(rv.Failed());
+  nsGenericHTMLElement* body = doc->GetBody();
+  ASSERT_TRUE(body);
+  nsAutoString html;
+  body->GetInnerHTML(html, rv);
+  ASSERT_FALSE(rv.Failed());
+  EXPECT_TRUE(html.Equals(aExpected))
+      << NS_ConvertUTF16toUTF8(html).get() << " != "
+      << NS_ConvertUTF16toUTF8(aExpected).get();
+}
+
+// The same boundaries through the whole tokenizer: text runs skipped by the
+// fast path must still end at markup, character references and newlines.
+TEST(Html5Tokenizer, DataStateBlockBoundaries)
+{
+  for (int32_t offset : kOffsets) {
+    // "<body>" is six code units, so the text starts at offset 6 of the
+    // buffer; pad it so the special code unit lands at the given offset.
+    nsAutoString text;
+    for (int32_t i = 6; i < offset; i++) {
+      text.Append(u'a');
+    }
+    const nsAutoString tail(u"bbbbbbbbbbbbbbbbbbbb"_ns);
+
+    ExpectBodyHTML(text + u"<i>x</i>"_ns + tail,
+                   text + u"<i>x</i>"_ns + tail);
+    ExpectBodyHTML(text + u"&lt;"_ns + tail, text + u"&lt;"_ns + tail);
+    ExpectBodyHTML(text + u"\r\n"_ns + tail, text + u"\n"_ns + tail);
+    ExpectBodyHTML(text + u"\r"_ns + tail, text + u"\n"_ns + tail);
+    // U+0000 in the data state is dropped by the tree builder.
+    nsAutoString withNul(text);
+    withNul.Append(char16_t(0));
+    withNul.Append(tail);
+    ExpectBodyHTML(withNul, text + tail);
+  }
+}
@@ -0,0 +1,174 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/* vim: set ts=8 sts=2 et sw=2 tw=80: */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "gtest/gtest.h"
+
+#include <initializer_list>
+
+#include "mozilla/ErrorResult.h"
+#include "mozilla/SMILAttr.h"
+#include "mozilla/SMILValue.h"
+#include "mozilla/dom/Document.h"
+#include "mozilla/dom/Element.h"
+#include "mozilla/dom/SVGElement.h"
+#include "nsGkAtoms.h"
+#include "nsINodeList.h"
+#include "DocumentTestUtils.h"
+
+using namespace mozilla;
+using namespace mozilla::dom;
+
+// Runs the query twice, so the second run is answered from the cache, and
+// checks both results against the expected elements, in order.
+static void ExpectQuery(nsINode* aRoot, const nsACString& aSelector,
+                        std::initializer_list<Element*> aExpected) {
+  for (int run = 0; run < 2; ++run) {
+    IgnoredErrorResult rv;
+    nsCOMPtr<nsINodeList> list = aRoot->QuerySelectorAll(aSelector, rv);
+    ASSERT_FALSE(rv.Failed());
+    ASSERT_EQ(list->Length(), aExpected.size()) << "in run " << run;
+    uint32_t i = 0;
+    for (Element* expected : aExpected) {
+      EXPECT_EQ(list->Item(i), expected)
+          << "at index " << i << " in run " << run;
+      ++i;
+    }
+  }
+}
+
+TEST(DOM_Base_QuerySelectorAllCache, ChildInsertedAndRemoved)
+{
+  nsCOMPtr<Document> doc = SetUpDocument();
+  ASSERT_TRUE(doc);
+
+  RefPtr<Element> root = CreateDiv(doc);
+  RefPtr<Element> a = CreateDiv(doc, true);
+  RefPtr<Element> b = CreateDiv(doc);
+  IgnoredErrorResult rv;
+  root->AppendChild(*a, rv);
+  root->AppendChild(*b, rv);
+  ASSERT_FALSE(rv.Failed());
+
+  ExpectQuery(root, ".x"_ns, {a});
+
+  RefPtr<Element> bChild = CreateDiv(doc, true);
+  b->AppendChild(*bChild, rv);
+  ASSERT_FALSE(rv.Failed());
+  ExpectQuery(root, ".x"_ns, {a, bChild});
+
+  RefPtr<Element> first = CreateDiv(doc, true);
+  root->InsertBefore(*first, a, rv);
+  ASSERT_FALSE(rv.Failed());
+  ExpectQuery(root, ".x"_ns, {first, a, bChild});
+
+  root->RemoveChild(*a, rv);
+  ASSERT_FALSE(rv.Failed());
+  ExpectQuery(root, ".x"_ns, {first, bChild});
+
+  root->RemoveChild(*b, rv);
+  ASSERT_FALSE(rv.Failed());
+  ExpectQuery(root, ".x"_ns, {first});
+
+  // A removed subtree keeps its own results apart from the old root's.
+  ExpectQuery(b, ".x"_ns, {bChild});
+  ExpectQuery(root, ".x"_ns, {first});
+}
+
+TEST(DOM_Base_QuerySelectorAllCache, AttributeChanged)
+{
+  nsCOMPtr<Document> doc = SetUpDocument();
+  ASSERT_TRUE(doc);
+
+  RefPtr<Element> root = CreateDiv(doc);
+  RefPtr<Element> a = CreateDiv(doc, true);
+  RefPtr<Element> b = CreateDiv(doc);
+  IgnoredErrorResult rv;
+  root->AppendChild(*a, rv);
+  root->AppendChild(*b, rv);
+  ASSERT_FALSE(rv.Failed());
+
+  ExpectQuery(root, ".x"_ns, {a});
+  ExpectQuery(root, "[title]"_ns, {});
+
+  b->SetAttr(kNameSpaceID_None, nsGkAtoms::_class, u"x"_ns, true);
+  ExpectQuery(root, ".x"_ns, {a, b});
+
+  a->UnsetAttr(kNameSpaceID_None, nsGkAtoms::_class, true);
+  ExpectQuery(root, ".x"_ns, {b});
+
+  // Attributes other than class and id are covered as well.
+  a->SetAttr(kNameSpaceID_None, nsGkAtoms::title, u"t"_ns, true);
+  ExpectQuery(root, "[title]"_ns, {a});
+  a->SetAttr(kNameSpaceID_None, nsGkAtoms::title, u"u"_ns, true);
+  ExpectQuery(root, "[title=t]"_ns, {});
+  ExpectQuery(root, "[title=u]"_ns, {a});
+}
+
+TEST(DOM_Base_QuerySelectorAllCache, SVGAnimatedClassChanged)
+{
+  nsCOMPtr<Document> doc = SetUpDocument();
+  ASSERT_TRUE(doc);
+
+  RefPtr<Element> root = CreateDiv(doc);
+  RefPtr<Element> rect = doc->CreateElem(
+      nsDependentAtomString(nsGkAtoms::rect), nullptr, kNameSpaceID_SVG);
+  ASSERT_TRUE(rect && rect->IsSVGElement());
+  IgnoredErrorResult rv;
+  root->AppendChild(*rect, rv);
+  ASSERT_FALSE(rv.Failed());
+
+  ExpectQuery(root, ".x"_ns, {});
+
+  // Drive the animated class the way SMIL compositing does, which changes
+  // what class selectors match without touching the class attribute.
+  auto* svg = static_cast<SVGElement*>(rect.get());
+  UniquePtr<SMILAttr> classAttr =
+      svg->GetAnimatedAttr(kNameSpaceID_None, nsGkAtoms::_class);
+  ASSERT_TRUE(classAttr);
+  SMILValue value;
+  bool preventCachingOfSandwich = false;
+  ASSERT_TRUE(NS_SUCCEEDED(classAttr->ValueFromString(
+      u"x"_ns, nullptr, value, preventCachingOfSandwich)));
+  ASSERT_TRUE(NS_SUCCEEDED(classAttr->SetAnimValue(value)));
+  ExpectQuery(root, ".x"_ns, {rect});
+
+  classAttr->ClearAnimValue();
+  ExpectQuery(root, ".x"_ns, {});
+}
+
+static nsrefcnt RefCount(Element* aElement) {
+  aElement->AddRef();
+  return aElement->Release();
+}
+
+TEST(DOM_Base_QuerySelectorAllCache, MutationDropsResults)
+{
+  nsCOMPtr<Document> doc = SetUpDocument();
+  ASSERT_TRUE(doc);
+
+  RefPtr<Element> root = CreateDiv(doc);
+  RefPtr<Element> a = CreateDiv(doc, true);
+  RefPtr<Element> b = CreateDiv(doc);
+  IgnoredErrorResult rv;
+  root->AppendChild(*a, rv);
+  root->AppendChild(*b, rv);
+  ASSERT_FALSE(rv.Failed());
+
+  nsrefcnt uncached = RefCount(a);
+  ExpectQuery(root, ".x"_ns, {a});
+  EXPECT_EQ(RefCount(a), uncached + 1);
+
+  // A mutation elsewhere in the document releases the cached elements right
+  // away, rather than on the next query.
+  b->SetAttr(kNameSpaceID_None, nsGkAtoms::title, u"t"_ns, true);
+  EXPECT_EQ(RefCount(a), uncached);
+
+  ExpectQuery(root, ".x"_ns, {a});
+  EXPECT_EQ(RefCount(a), uncached + 1);
+  root->RemoveChild(*b, rv);
+  ASSERT_FALSE(rv.Failed());
+  EXPECT_EQ(RefCount(a), uncached);
+}
@@ -0,0 +1,76 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/* vim: set ts=8 sts=2 et sw=2 tw=80: */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "gtest/gtest.h"
+
+#include "nsString.h"
+#include "nsTextFragment.h"
+
+struct TextFragmentReplaceCase {
+  uint32_t offset;
+  uint32_t count;
+  const char16_t* replacement;
+  const char16_t* expected;
+};
+
+// "abcdef" with a non-Latin1 character so that the fragment stays 2-byte.
+static const char16_t kInitialText[] = u"ab\u0100def";
+
+static const TextFragmentReplaceCase kReplaceCases[] = {
+    // Insert in the middle.
+    {1, 0, u"XY", u"aXYb\u0100def"},
+    // Delete in the middle.
+    {1, 3, u"", u"aef"},
+    // Replace in the middle with a shorter, equal and longer string.
+    {2, 2, u"Z", u"abZef"},
+    {2, 2, u"ZW", u"abZWef"},
+    {2, 2, u"ZWVU", u"abZWVUef"},
+    // Edits at both ends.
+    {0, 1, u"__", u"__b\u0100def"},
+    {6, 0, u"!", u"ab\u0100def!"},
+};
+
+static void CheckReplace(const TextFragmentReplaceCase& aCase,
+                         bool aShareBuffer) {
+  nsTextFragment frag;
+  ASSERT_TRUE(frag.SetTo(kInitialText, 6, false, true));
+  ASSERT_TRUE(frag.Is2b());
+
+  // Hand the buffer out, like reading .data from script does, so that the
+  // fragment's buffer becomes shared.
+  nsString shared;
+  if (aShareBuffer) {
+    frag.AppendTo(shared);
+  }
+
+  nsDependentString replacement(aCase.replacement);
+  ASSERT_TRUE(frag.Replace(aCase.offset, aCase.count, replacement.get(),
+                           replacement.Length(), false));
+
+  nsAutoString result;
+  frag.AppendTo(result);
+  EXPECT_TRUE(result.Equals(aCase.expected));
+  EXPECT_EQ(frag.GetLength(), result.Length());
+
+  if (aShareBuffer) {
+    // The other owner of the old buffer must not see the edit.
+    EXPECT_TRUE(shared.Equals(kInitialText));
+  }
+}
+
+TEST(DOM_Base_TextFragment, ReplaceInPlace)
+{
+  for (const auto& replaceCase : kReplaceCases) {
+    CheckReplace(replaceCase, false);
+  }
+}
+
+TEST(DOM_Base_TextFragment, ReplaceSharedBuffer)
+{
+  for (const auto& replaceCase : kReplaceCases) {
+    CheckReplace(replaceCase, true);
+  }
+}
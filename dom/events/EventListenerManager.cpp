@@ -102,6 +102,7 @@ uint32_t EventListenerManager::sMainThreadCreatedCount = 0;
 
 EventListenerManagerBase::EventListenerManagerBase()
     : mNoListenerForEvent(eVoidEvent),
+      mPreviousNoListenerForEvent(eVoidEvent),
       mMayHavePaintEventListener(false),
       mMayHaveMutationListeners(false),
       mMayHaveCapturingListeners(false),
@@ -117,7 +118,9 @@ EventListenerManagerBase::EventListenerManagerBase()
       mIsMainThreadELM(NS_IsMainThread()),
       mHasNonPrivilegedClickListeners(false),
       mUnknownNonPrivilegedClickListeners(false) {
-  static_assert(sizeof(EventListenerManagerBase) == sizeof(uint32_t),
+  // On 64-bit this still fits in the padding before
+  // EventListenerManager::mRefCnt.
+  static_assert(sizeof(EventListenerManagerBase) <= sizeof(uint64_t),
                 "Keep the size of EventListenerManagerBase size compact!");
 }
 
@@ -241,8 +244,7 @@ void EventListenerManager::AddEventListenerInternal(
     }
   }
 
-  mNoListenerForEvent = eVoidEvent;
-  mNoListenerForEventAtom = nullptr;
+  ClearNoListenerForEvent();
 
   listener =
       aAllEvents ? mListeners.InsertElementAt(0) : mListeners.AppendElement();
@@ -776,8 +778,7 @@ void EventListenerManager::DisableDevice(EventMessage aEventMessage) {
 void EventListenerManager::NotifyEventListenerRemoved(nsAtom* aUserType) {
   // If the following code is changed, other callsites of EventListenerRemoved
   // and NotifyAboutMainThreadListenerChange should be changed too.
-  mNoListenerForEvent = eVoidEvent;
-  mNoListenerForEventAtom = nullptr;
+  ClearNoListenerForEvent();
   if (mTarget) {
     mTarget->EventListenerRemoved(aUserType);
   }
@@ -1575,8 +1576,7 @@ void EventListenerManager::HandleEventInternal(nsPresContext* aPresContext,
   }
 
   if (mIsMainThreadELM && !hasListener) {
-    mNoListenerForEvent = aEvent->mMessage;
-    mNoListenerForEventAtom = aEvent->mSpecifiedEventType;
+    SetNoListenerForEvent(aEvent->mMessage, aEvent->mSpecifiedEventType);
   }
 
   if (aEvent->DefaultPrevented()) {
@@ -1858,8 +1858,7 @@ nsresult EventListenerManager::SetListenerEnabled(
   if (aEnabled) {
     // We may have enabled some listener, clear the cache for which events
     // we don't have listeners.
-    mNoListenerForEvent = eVoidEvent;
-    mNoListenerForEventAtom = nullptr;
+    ClearNoListenerForEvent();
   }
   return NS_OK;
 }
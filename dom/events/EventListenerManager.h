@@ -146,6 +146,10 @@ class EventListenerManagerBase {
   EventListenerManagerBase();
 
   EventMessage mNoListenerForEvent;
+  // The event message mNoListenerForEvent had before it was last replaced,
+  // if that was an identified one. Events are often dispatched in pairs, e.g.
+  // pointermove and mousemove, which would otherwise keep evicting each other.
+  EventMessage mPreviousNoListenerForEvent;
   uint16_t mMayHavePaintEventListener : 1;
   uint16_t mMayHaveMutationListeners : 1;
   uint16_t mMayHaveCapturingListeners : 1;
@@ -392,6 +396,9 @@ class EventListenerManager final : public EventListenerManagerBase {
          mNoListenerForEventAtom == aEvent->mSpecifiedEventType)) {
       return;
     }
+    if (mPreviousNoListenerForEvent == aEvent->mMessage) {
+      return;
+    }
     HandleEventInternal(aPresContext, aEvent, aDOMEvent, aCurrentTarget,
                         aEventStatus, aItemInShadowTree);
   }
@@ -690,6 +697,24 @@ class EventListenerManager final : public EventListenerManagerBase {
 
   void MaybeMarkPassive(EventMessage aMessage, EventListenerFlags& aFlags);
 
+  void ClearNoListenerForEvent() {
+    mNoListenerForEvent = eVoidEvent;
+    mPreviousNoListenerForEvent = eVoidEvent;
+    mNoListenerForEventAtom = nullptr;
+  }
+
+  void SetNoListenerForEvent(EventMessage aMessage, nsAtom* aTypeAtom) {
+    if (mNoListenerForEvent != aMessage &&
+        mNoListenerForEvent != eUnidentifiedEvent) {
+      mPreviousNoListenerForEvent = mNoListenerForEvent;
+    }
+    if (mPreviousNoListenerForEvent == aMessage) {
+      mPreviousNoListenerForEvent = eVoidEvent;
+    }
+    mNoListenerForEvent = aMessage;
+    mNoListenerForEventAtom = aTypeAtom;
+  }
+
   nsAutoTObserverArray<Listener, 2> mListeners;
   dom::EventTarget* MOZ_NON_OWNING_REF mTarget;
   RefPtr<nsAtom> mNoListenerForEventAtom;
@@ -16,6 +16,12 @@
 #include "mozilla/dom/UnionTypes.h"
 #include "private/pprio.h"
 
+#include <limits>
+
+#ifdef XP_UNIX
+#  include <unistd.h>
+#endif
+
 namespace mozilla {
 
 LazyLogModule gOPFSLog("OPFS");
@@ -54,6 +60,100 @@ static nsresult TruncFile(PRFileDesc* aFD, int64_t aEOF) {
   return NS_OK;
 }
 
+/**
+ * Positional read/write of at most PR_INT32_MAX bytes. Where the platform has
+ * pread/pwrite this is a single syscall that leaves the file offset alone,
+ * which matters for workloads (e.g. SQLite) that issue many small random
+ * accesses; elsewhere it falls back to a seek followed by PR_Read/PR_Write.
+ * Returns -1 on failure, including for offsets that don't fit in off_t, which
+ * is only 32 bits wide on some 32-bit platforms.
+ */
+static int32_t ReadChunkAt(PRFileDesc* aFD, uint8_t* aData, int32_t aLength,
+                           uint64_t aOffset) {
+#if defined(XP_UNIX)
+  if (aOffset > static_cast<uint64_t>(std::numeric_limits<off_t>::max())) {
+    return -1;
+  }
+  ssize_t cnt;
+  do {
+    cnt = pread(PR_FileDesc2NativeHandle(aFD), aData, aLength,
+                static_cast<off_t>(aOffset));
+  } while (cnt == -1 && errno == EINTR);
+  return static_cast<int32_t>(cnt);
+#else
+  if (aOffset > static_cast<uint64_t>(INT64_MAX) ||
+      PR_Seek64(aFD, (PROffset64)aOffset, PR_SEEK_SET) != (int64_t)aOffset) {
+    return -1;
+  }
+  return PR_Read(aFD, aData, aLength);
+#endif
+}
+
+static int32_t WriteChunkAt(PRFileDesc* aFD, const uint8_t* aData,
+                            int32_t aLength, uint64_t aOffset) {
+#if defined(XP_UNIX)
+  if (aOffset > static_cast<uint64_t>(std::numeric_limits<off_t>::max())) {
+    return -1;
+  }
+  ssize_t cnt;
+  do {
+    cnt = pwrite(PR_FileDesc2NativeHandle(aFD), aData, aLength,
+                 static_cast<off_t>(aOffset));
+  } while (cnt == -1 && errno == EINTR);
+  return static_cast<int32_t>(cnt);
+#else
+  if (aOffset > static_cast<uint64_t>(INT64_MAX) ||
+      PR_Seek64(aFD, (PROffset64)aOffset, PR_SEEK_SET) != (int64_t)aOffset) {
+    return -1;
+  }
+  return PR_Write(aFD, aData, aLength);
+#endif
+}
+
+namespace mozilla::dom::fs {
+
+uint64_t ReadAt(PRFileDesc* aFD, uint8_t* aData, size_t aLength,
+                uint64_t aOffset, int32_t aMaxChunk) {
+  MOZ_ASSERT(aMaxChunk > 0);
+
+  // Unfortunately, ReadChunkAt() is limited to int32
+  uint64_t result = 0;
+  while (aLength > 0) {
+    int32_t iterLen = (aLength > size_t(aMaxChunk)) ? aMaxChunk : aLength;
+    int32_t temp = ReadChunkAt(aFD, aData, iterLen, aOffset);
+    if (temp == -1 || temp == 0 /* EOF*/) {
+      break;
+    }
+    result += temp;
+    aData += temp;
+    aOffset += temp;
+    aLength -= temp;
+  }
+  return result;
+}
+
+uint64_t WriteAt(PRFileDesc* aFD, const uint8_t* aData, size_t aLength,
+                 uint64_t aOffset, int32_t aMaxChunk) {
+  MOZ_ASSERT(aMaxChunk > 0);
+
+  // Unfortunately, WriteChunkAt() is limited to int32
+  uint64_t result = 0;
+  while (aLength > 0) {
+    int32_t iterLen = (aLength > size_t(aMaxChunk)) ? aMaxChunk : aLength;
+    int32_t temp = WriteChunkAt(aFD, aData, iterLen, aOffset);
+    if (temp == -1) {
+      break;
+    }
+    result += temp;
+    aData += temp;
+    aOffset += temp;
+    aLength -= temp;
+  }
+  return result;
+}
+
+}  // namespace mozilla::dom::fs
+
 namespace mozilla::dom {
 
 FileSystemSyncAccessHandle::FileSystemSyncAccessHandle(
@@ -133,22 +233,10 @@ uint64_t FileSystemSyncAccessHandle::Read(
 
   // read directly from filehandle, blocking
 
-  // Handle seek before read ('at')
   uint64_t at = 0;  // Spec says default for at is 0 (2.6)
   if (aOptions.mAt.WasPassed()) {
     at = aOptions.mAt.Value();
   }
-  LOG(("%p: Seeking to %" PRIu64, fileDesc, at));
-  int64_t where = PR_Seek64(fileDesc, (PROffset64)at, PR_SEEK_SET);
-  if (where == -1) {
-    LOG(("Read at %" PRIu64 " failed to seek (errno %d)", at, errno));
-    return 0;
-  }
-  if (where != (int64_t)at) {
-    LOG(("Read at %" PRIu64 " failed to seek (%" PRId64 " instead)", at,
-         where));
-    return 0;
-  }
 
   uint8_t* data;
   size_t length;
@@ -169,19 +257,9 @@ uint64_t FileSystemSyncAccessHandle::Read(
   }
   // for read starting past the end of the file, return 0, which should happen
   // automatically
-  LOG(("%p: Reading %zu bytes", fileDesc, length));
-  // Unfortunately, PR_Read() is limited to int32
-  uint64_t result = 0;
-  while (length > 0) {
-    PRInt32 iter_len = (length > PR_INT32_MAX) ? PR_INT32_MAX : length;
-    PRInt32 temp = PR_Read(fileDesc, data, iter_len);
-    if (temp == -1 || temp == 0 /* EOF*/) {
-      return result;  // per spec, 2.6.1 #11
-    }
-    result += temp;
-    length -= temp;
-  }
-  return result;
+  LOG(("%p: Reading %zu bytes at %" PRIu64, fileDesc, length, at));
+  // Per spec, 2.6.1 #11, a failed read returns what was read so far.
+  return fs::ReadAt(fileDesc, data, length, at);
 }
 
 uint64_t FileSystemSyncAccessHandle::Write(
@@ -196,22 +274,10 @@ uint64_t FileSystemSyncAccessHandle::Write(
 
   // Write directly from filehandle, blocking
 
-  // Handle seek before write ('at')
   uint64_t at = 0;  // Spec says default for at is 0 (2.6)
   if (aOptions.mAt.WasPassed()) {
     at = aOptions.mAt.Value();
   }
-  LOG(("%p: Seeking to %" PRIu64, fileDesc, at));
-  int64_t where = PR_Seek64(fileDesc, (PROffset64)at, PR_SEEK_SET);
-  if (where == -1) {
-    LOG(("Write at %" PRIu64 " failed to seek (errno %d)", at, errno));
-    return 0;
-  }
-  if (where != (int64_t)at) {
-    LOG(("Write at %" PRIu64 " failed to seek (%" PRId64 " instead)", at,
-         where));
-    return 0;
-  }
 
   // if we seek past the end of the file and write, it implicitly extends it
   // with 0's
@@ -231,19 +297,9 @@ uint64_t FileSystemSyncAccessHandle::Write(
     LOG(("Impossible write source"));
     return 0;
   }
-  LOG(("%p: Writing %zu bytes", fileDesc, length));
-  // Unfortunately, PR_Write() is limited to int32
-  uint64_t result = 0;
-  while (length > 0) {
-    PRInt32 iter_len = (length > PR_INT32_MAX) ? PR_INT32_MAX : length;
-    PRInt32 temp = PR_Write(fileDesc, data, iter_len);
-    if (temp == -1) {
-      return result;  // per spec, 2.6.2 #13
-    }
-    result += temp;
-    length -= temp;
-  }
-  return result;
+  LOG(("%p: Writing %zu bytes at %" PRIu64, fileDesc, length, at));
+  // Per spec, 2.6.2 #13, a failed write returns what was written so far.
+  return fs::WriteAt(fileDesc, data, length, at);
 }
 
 already_AddRefed<Promise> FileSystemSyncAccessHandle::Truncate(
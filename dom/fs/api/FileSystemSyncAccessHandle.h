@@ -12,8 +12,10 @@
 #include "nsCOMPtr.h"
 #include "nsISupports.h"
 #include "nsWrapperCache.h"
+#include "prtypes.h"
 
 class nsIGlobalObject;
+struct PRFileDesc;
 
 namespace mozilla {
 extern LazyLogModule gOPFSLog;
@@ -34,6 +36,17 @@ class Promise;
 
 namespace fs {
 class FileSystemRequestHandler;
+
+// Reads up to aLength bytes at aOffset, in chunks of at most aMaxChunk bytes,
+// stopping at the end of the file or on the first error. Returns the number of
+// bytes read.
+uint64_t ReadAt(PRFileDesc* aFD, uint8_t* aData, size_t aLength,
+                uint64_t aOffset, int32_t aMaxChunk = PR_INT32_MAX);
+
+// Writes aLength bytes at aOffset, in chunks of at most aMaxChunk bytes,
+// stopping on the first error. Returns the number of bytes written.
+uint64_t WriteAt(PRFileDesc* aFD, const uint8_t* aData, size_t aLength,
+                 uint64_t aOffset, int32_t aMaxChunk = PR_INT32_MAX);
 }  // namespace fs
 
 class FileSystemSyncAccessHandle final : public nsISupports,
@@ -0,0 +1,88 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/* vim: set ts=8 sts=2 et sw=2 tw=80: */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "FileSystemSyncAccessHandle.h"
+#include "gtest/gtest.h"
+#include "nsAppDirectoryServiceDefs.h"
+#include "nsDirectoryServiceUtils.h"
+#include "nsIFile.h"
+#include "nsTArray.h"
+#include "prio.h"
+
+namespace mozilla::dom::fs::test {
+
+class TestFileSystemSyncAccessHandleIO : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    ASSERT_TRUE(NS_SUCCEEDED(
+        NS_GetSpecialDirectory(NS_OS_TEMP_DIR, getter_AddRefs(mFile))));
+    ASSERT_TRUE(NS_SUCCEEDED(mFile->Append(u"sync-access-handle-io"_ns)));
+    ASSERT_TRUE(NS_SUCCEEDED(
+        mFile->CreateUnique(nsIFile::NORMAL_FILE_TYPE, 0600)));
+    ASSERT_TRUE(NS_SUCCEEDED(mFile->OpenNSPRFileDesc(
+        PR_RDWR | PR_CREATE_FILE | PR_TRUNCATE, 0600, &mFD)));
+  }
+
+  void TearDown() override {
+    if (mFD) {
+      PR_Close(mFD);
+    }
+    if (mFile) {
+      mFile->Remove(false);
+    }
+  }
+
+  nsCOMPtr<nsIFile> mFile;
+  PRFileDesc* mFD = nullptr;
+};
+
+// The chunk size is PR_INT32_MAX in practice. Use small ones, so that the
+// loop goes around several times without needing gigabytes of data, and
+// check that every chunk lands at the right offset in the file and buffer.
+TEST_F(TestFileSystemSyncAccessHandleIO, ChunkedReadWriteAtOffset) {
+  const uint64_t kAt = 13;
+  nsTArray<uint8_t> data;
+  for (uint32_t i = 0; i < 100; ++i) {
+    data.AppendElement(uint8_t(i + 1));
+  }
+
+  for (int32_t chunk : {1, 7, 16, 100, PR_INT32_MAX}) {
+    SCOPED_TRACE(testing::Message() << "chunk = " << chunk);
+    ASSERT_EQ(WriteAt(mFD, data.Elements(), data.Length(), kAt, chunk),
+              data.Length());
+
+    nsTArray<uint8_t> read;
+    read.SetLength(data.Length());
+    ASSERT_EQ(ReadAt(mFD, read.Elements(), read.Length(), kAt, chunk),
+              read.Length());
+    EXPECT_EQ(read, data);
+
+    // Writing past the end extended the file with zeroes.
+    nsTArray<uint8_t> head;
+    head.SetLength(kAt);
+    ASSERT_EQ(ReadAt(mFD, head.Elements(), head.Length(), 0, chunk), kAt);
+    for (uint8_t byte : head) {
+      EXPECT_EQ(byte, 0);
+    }
+
+    // A read across the end of the file stops there, even mid-chunk.
+    nsTArray<uint8_t> tail;
+    tail.SetLength(50);
+    ASSERT_EQ(ReadAt(mFD, tail.Elements(), tail.Length(), kAt + 80, chunk),
+              20u);
+    for (uint32_t i = 0; i < 20; ++i) {
+      EXPECT_EQ(tail[i], data[80 + i]);
+    }
+  }
+}
+
+TEST_F(TestFileSystemSyncAccessHandleIO, OffsetOutOfRange) {
+  uint8_t byte = 42;
+  EXPECT_EQ(WriteAt(mFD, &byte, 1, UINT64_MAX), 0u);
+  EXPECT_EQ(ReadAt(mFD, &byte, 1, UINT64_MAX), 0u);
+}
+
+}  // namespace mozilla::dom::fs::test
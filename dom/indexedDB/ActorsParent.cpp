@@ -389,6 +389,11 @@ constexpr auto kIdbDeletionMarkerFilePrefix = u"idb-deleting-"_ns;
 
 const uint32_t kDeleteTimeoutMs = 1000;
 
+// The number of bytes a cursor aims to preload per response. Cursors over
+// large records preload fewer extra records so that a single response does not
+// carry much more data than the child is likely to consume.
+const size_t kCursorPreloadTargetBytes = 1024 * 1024;  // 1MB
+
 #ifdef DEBUG
 
 const int32_t kDEBUGThreadPriority = nsISupportsPriority::PRIORITY_NORMAL;
@@ -4333,7 +4338,14 @@ class CursorBase : public PBackgroundIDBCursorParent {
 
   const Direction mDirection;
 
-  const int32_t mMaxExtraCount;
+  // The upper bound for mMaxExtraCount, as configured by the
+  // dom.indexedDB.maxPreloadExtraRecords pref.
+  const int32_t mMaxExtraCountLimit;
+
+  // The number of extra records to preload with the next response. This is
+  // only touched on the connection thread and adapted to the observed record
+  // size and to how the child consumes the preloaded records.
+  int32_t mMaxExtraCount;
 
   const bool mIsSameProcessActor;
 
@@ -4348,6 +4360,15 @@ class CursorBase : public PBackgroundIDBCursorParent {
              Direction aDirection,
              ConstructFromTransactionBase aConstructionTag);
 
+  // Grows mMaxExtraCount if the child consumed the previously preloaded
+  // records one by one, and shrinks it if the child skipped over them.
+  void AdaptMaxExtraCountToConsumption(bool aConsumedSequentially);
+
+  // Limits mMaxExtraCount so that the next response stays around
+  // kCursorPreloadTargetBytes, given the size of the records just populated.
+  void AdaptMaxExtraCountToResponseSize(uint32_t aResponseCount,
+                                        size_t aResponseSize);
+
  protected:
   // Reference counted.
   ~CursorBase() override { MOZ_ASSERT(!mObjectStoreMetadata); }
@@ -11725,7 +11746,8 @@ CursorBase::CursorBase(SafeRefPtr<TransactionBase> aTransaction,
       mObjectStoreMetadata(WrapNotNull(std::move(aObjectStoreMetadata))),
       mObjectStoreId((*mObjectStoreMetadata)->mCommonMetadata.id()),
       mDirection(aDirection),
-      mMaxExtraCount(IndexedDatabaseManager::MaxPreloadExtraRecords()),
+      mMaxExtraCountLimit(IndexedDatabaseManager::MaxPreloadExtraRecords()),
+      mMaxExtraCount(mMaxExtraCountLimit),
       mIsSameProcessActor(!BackgroundParent::IsOtherProcessActor(
           mTransaction->GetBackgroundParent())) {
   AssertIsOnBackgroundThread();
@@ -11736,6 +11758,34 @@ CursorBase::CursorBase(SafeRefPtr<TransactionBase> aTransaction,
       "Lots of code here assumes only four types of cursors!");
 }
 
+void CursorBase::AdaptMaxExtraCountToConsumption(
+    const bool aConsumedSequentially) {
+  MOZ_ASSERT(!IsOnBackgroundThread());
+
+  mMaxExtraCount = aConsumedSequentially
+                       ? std::min(std::max(mMaxExtraCount * 2, 1),
+                                  mMaxExtraCountLimit)
+                       : mMaxExtraCount / 2;
+}
+
+void CursorBase::AdaptMaxExtraCountToResponseSize(const uint32_t aResponseCount,
+                                                  const size_t aResponseSize) {
+  MOZ_ASSERT(!IsOnBackgroundThread());
+  MOZ_ASSERT(aResponseCount);
+
+  const size_t averageResponseSize =
+      std::max<size_t>(aResponseSize / aResponseCount, 1);
+
+  // Always allow at least one extra record, so that the count can grow again
+  // once the records get smaller.
+  const size_t maxExtraCountForSize =
+      std::max<size_t>(kCursorPreloadTargetBytes / averageResponseSize, 1);
+
+  if (maxExtraCountForSize < size_t(mMaxExtraCount)) {
+    mMaxExtraCount = int32_t(maxExtraCountForSize);
+  }
+}
+
 template <IDBCursorType CursorType>
 bool Cursor<CursorType>::VerifyRequestParams(
     const CursorRequestParams& aParams,
@@ -19464,17 +19514,24 @@ nsresult ObjectStoreAddOrPutRequestOp::DoDatabaseWork(
       QM_TRY(MOZ_TO_RESULT(stmt->BindInt64ByName(kStmtParamNameData, data)));
     } else {
       AutoTArray<char, 4096> flatCloneData;  // 4096 from JSStructuredCloneData
-      QM_TRY(OkIf(flatCloneData.SetLength(cloneDataSize, fallible)),
-             Err(NS_ERROR_OUT_OF_MEMORY));
+      const char* uncompressed;
 
       {
+        // Most records fit in the first segment of the clone buffer and can
+        // be compressed from there without flattening them first.
         auto iter = cloneData.Start();
-        MOZ_ALWAYS_TRUE(
-            cloneData.ReadBytes(iter, flatCloneData.Elements(), cloneDataSize));
+        if (iter.RemainingInSegment() >= cloneDataSize) {
+          uncompressed = iter.Data();
+        } else {
+          QM_TRY(OkIf(flatCloneData.SetLength(cloneDataSize, fallible)),
+                 Err(NS_ERROR_OUT_OF_MEMORY));
+          MOZ_ALWAYS_TRUE(cloneData.ReadBytes(iter, flatCloneData.Elements(),
+                                              cloneDataSize));
+          uncompressed = flatCloneData.Elements();
+        }
       }
 
       // Compress the bytes before adding into the database.
-      const char* const uncompressed = flatCloneData.Elements();
       const size_t uncompressedLength = cloneDataSize;
 
       size_t compressedLength = snappy::MaxCompressedLength(uncompressedLength);
@@ -20565,8 +20622,9 @@ void CursorOpBaseHelperBase<CursorType>::PopulateExtraResponses(
     Key* const aOptPreviousSortKey) {
   mOp.AssertIsOnConnectionThread();
 
+  auto accumulatedResponseSize = aInitialResponseSize;
+
   const auto extraCount = [&]() -> uint32_t {
-    auto accumulatedResponseSize = aInitialResponseSize;
     uint32_t extraCount = 0;
 
     do {
@@ -20602,8 +20660,8 @@ void CursorOpBaseHelperBase<CursorType>::PopulateExtraResponses(
           });
 
       // Check accumulated size of individual responses and maybe break early.
-      accumulatedResponseSize += responseSize;
-      if (accumulatedResponseSize > IPC::Channel::kMaximumMessageSize / 2) {
+      if (accumulatedResponseSize + responseSize >
+          IPC::Channel::kMaximumMessageSize / 2) {
         IDB_LOG_MARK_PARENT_TRANSACTION_REQUEST(
             "PRELOAD: %s: Dropping entries because maximum message size is "
             "exceeded: %" PRIu32 "/%zu bytes",
@@ -20611,10 +20669,11 @@ void CursorOpBaseHelperBase<CursorType>::PopulateExtraResponses(
             IDB_LOG_ID_STRING(mOp.mBackgroundChildLoggingId),
             mOp.mTransactionLoggingSerialNumber, mOp.mLoggingSerialNumber,
             PromiseFlatCString(aOperation).get(), extraCount,
-            accumulatedResponseSize);
+            accumulatedResponseSize + responseSize);
 
         break;
       }
+      accumulatedResponseSize += responseSize;
 
       // TODO: Do not count entries skipped for unique cursors.
       ++extraCount;
@@ -20629,6 +20688,9 @@ void CursorOpBaseHelperBase<CursorType>::PopulateExtraResponses(
       IDB_LOG_ID_STRING(mOp.mBackgroundChildLoggingId),
       mOp.mTransactionLoggingSerialNumber, mOp.mLoggingSerialNumber,
       PromiseFlatCString(aOperation).get(), extraCount, aMaxExtraCount);
+
+  GetCursor().AdaptMaxExtraCountToResponseSize(1 + extraCount,
+                                               accumulatedResponseSize);
 }
 
 template <IDBCursorType CursorType>
@@ -21200,6 +21262,15 @@ nsresult Cursor<CursorType>::ContinueOp::DoDatabaseWork(
   // preload only for an assumed basic operation. Other operations would require
   // more work on the client side for invalidation, and may not make any sense
   // at all.
+  //
+  // The child only sends a request once it has no preloaded records left. A
+  // basic operation means it went through them one by one, so preloading more
+  // will save round trips. Advancing by more than one record means it skipped
+  // over some of them, so preloading fewer wastes less work.
+  if (!hasContinueKey) {
+    mCursor->AdaptMaxExtraCountToConsumption(advanceCount == 1);
+  }
+
   const uint32_t maxExtraCount = hasContinueKey ? 0 : mCursor->mMaxExtraCount;
 
   QM_TRY_INSPECT(const auto& stmt,
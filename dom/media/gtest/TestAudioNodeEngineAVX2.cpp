@@ -0,0 +1,112 @@
+/* -*- Mode: C++; tab-width: 2; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "AlignedTArray.h"
+#include "AudioNodeEngineAVX2.h"
+#include "AudioNodeEngineSSE2.h"
+#include "gtest/gtest.h"
+#include "mozilla/Casting.h"
+#include "mozilla/SSE.h"
+
+using namespace mozilla;
+
+// The AVX2 kernels must give exactly the same results as the SSE2 and scalar
+// versions, since which one runs depends on the CPU.
+
+static void FillWithNoise(float* aBuffer, uint32_t aLength, uint32_t aSeed) {
+  uint32_t state = aSeed;
+  for (uint32_t i = 0; i < aLength; ++i) {
+    state = state * 1664525 + 1013904223;
+    aBuffer[i] = static_cast<float>(static_cast<int32_t>(state)) / 1073741824.f;
+  }
+}
+
+static void ExpectSameSamples(const float* aExpected, const float* aActual,
+                              uint32_t aLength, const char* aWhat) {
+  for (uint32_t i = 0; i < aLength; ++i) {
+    // Compare the bits, so that the sign of zero counts too.
+    ASSERT_EQ(BitwiseCast<uint32_t>(aExpected[i]),
+              BitwiseCast<uint32_t>(aActual[i]))
+        << aWhat << " differs at " << i << ": " << aExpected[i] << " vs "
+        << aActual[i];
+  }
+}
+
+// Callers only guarantee 16-byte alignment, so also run the kernels on
+// buffers which aren't 32-byte aligned.
+static const uint32_t kOffsets[] = {0, 4};
+static const uint32_t kSizes[] = {16, WEBAUDIO_BLOCK_SIZE, 2048};
+
+TEST(AudioNodeEngineAVX2, AudioBufferAddWithScale)
+{
+  if (!supports_avx2()) {
+    return;
+  }
+
+  for (uint32_t offset : kOffsets) {
+    for (uint32_t size : kSizes) {
+      AlignedTArray<float> input, scalar, sse, avx2;
+      input.SetLength(size + offset);
+      scalar.SetLength(size + offset);
+      sse.SetLength(size + offset);
+      avx2.SetLength(size + offset);
+      FillWithNoise(input.Elements(), size + offset, 1);
+      FillWithNoise(scalar.Elements(), size + offset, 2);
+      FillWithNoise(sse.Elements(), size + offset, 2);
+      FillWithNoise(avx2.Elements(), size + offset, 2);
+
+      const float scale = 0.7071f;
+      const float* in = input.Elements() + offset;
+      for (uint32_t i = 0; i < size; ++i) {
+        scalar[offset + i] += scale * in[i];
+      }
+      AudioBufferAddWithScale_SSE(in, scale, sse.Elements() + offset, size);
+      AudioBufferAddWithScale_AVX2(in, scale, avx2.Elements() + offset, size);
+
+      ExpectSameSamples(scalar.Elements() + offset, sse.Elements() + offset,
+                        size, "SSE2");
+      ExpectSameSamples(scalar.Elements() + offset, avx2.Elements() + offset,
+                        size, "AVX2");
+    }
+  }
+}
+
+TEST(AudioNodeEngineAVX2, BufferComplexMultiply)
+{
+  if (!supports_avx2()) {
+    return;
+  }
+
+  for (uint32_t offset : kOffsets) {
+    for (uint32_t size : kSizes) {
+      // |size| complex numbers, stored as interleaved real and imaginary
+      // parts.
+      const uint32_t length = size * 2 + offset;
+      AlignedTArray<float> input, scale, scalar, sse, avx2;
+      input.SetLength(length);
+      scale.SetLength(length);
+      scalar.SetLength(length);
+      sse.SetLength(length);
+      avx2.SetLength(length);
+      FillWithNoise(input.Elements(), length, 3);
+      FillWithNoise(scale.Elements(), length, 4);
+
+      const float* in = input.Elements() + offset;
+      const float* sc = scale.Elements() + offset;
+      float* out = scalar.Elements() + offset;
+      for (uint32_t i = 0; i < size * 2; i += 2) {
+        float real = in[i] * sc[i] - in[i + 1] * sc[i + 1];
+        float imag = in[i] * sc[i + 1] + in[i + 1] * sc[i];
+        out[i] = real;
+        out[i + 1] = imag;
+      }
+      BufferComplexMultiply_SSE(in, sc, sse.Elements() + offset, size);
+      BufferComplexMultiply_AVX2(in, sc, avx2.Elements() + offset, size);
+
+      ExpectSameSamples(out, sse.Elements() + offset, size * 2, "SSE2");
+      ExpectSameSamples(out, avx2.Elements() + offset, size * 2, "AVX2");
+    }
+  }
+}
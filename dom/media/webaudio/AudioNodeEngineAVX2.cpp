@@ -0,0 +1,68 @@
+/* -*- mode: c++; tab-width: 2; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/* this source code form is subject to the terms of the mozilla public
+ * license, v. 2.0. if a copy of the mpl was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "AudioNodeEngineAVX2.h"
+#include "AlignmentUtils.h"
+#include <immintrin.h>
+
+// These kernels use unaligned loads and stores, since callers only guarantee
+// 16-byte alignment, and they don't use FMA so that their results match the
+// SSE2 and scalar versions exactly.
+
+namespace mozilla {
+void AudioBufferAddWithScale_AVX2(const float* aInput, float aScale,
+                                  float* aOutput, uint32_t aSize) {
+  __m256 vin0, vin1, vscaled0, vscaled1, vout0, vout1;
+
+  ASSERT_MULTIPLE16(aSize);
+
+  __m256 vgain = _mm256_set1_ps(aScale);
+
+  for (unsigned i = 0; i < aSize; i += 16) {
+    vin0 = _mm256_loadu_ps(&aInput[i]);
+    vin1 = _mm256_loadu_ps(&aInput[i + 8]);
+
+    vscaled0 = _mm256_mul_ps(vin0, vgain);
+    vscaled1 = _mm256_mul_ps(vin1, vgain);
+
+    vin0 = _mm256_loadu_ps(&aOutput[i]);
+    vin1 = _mm256_loadu_ps(&aOutput[i + 8]);
+
+    vout0 = _mm256_add_ps(vin0, vscaled0);
+    vout1 = _mm256_add_ps(vin1, vscaled1);
+
+    _mm256_storeu_ps(&aOutput[i], vout0);
+    _mm256_storeu_ps(&aOutput[i + 8], vout1);
+  }
+}
+
+void BufferComplexMultiply_AVX2(const float* aInput, const float* aScale,
+                                float* aOutput, uint32_t aSize) {
+  __m256 in0, in1, scale0, scale1, real0, real1, imag0, imag1;
+
+  ASSERT_MULTIPLE16(aSize);
+
+  // Each vector holds four interleaved (real, imaginary) pairs. For
+  // a = (ar, ai) and b = (br, bi), we compute (ar * br, ai * br) and
+  // (ai * bi, ar * bi), and addsub gives
+  // (ar * br - ai * bi, ai * br + ar * bi).
+  for (unsigned i = 0; i < aSize * 2; i += 16) {
+    in0 = _mm256_loadu_ps(&aInput[i]);
+    in1 = _mm256_loadu_ps(&aInput[i + 8]);
+    scale0 = _mm256_loadu_ps(&aScale[i]);
+    scale1 = _mm256_loadu_ps(&aScale[i + 8]);
+
+    real0 = _mm256_mul_ps(in0, _mm256_moveldup_ps(scale0));
+    real1 = _mm256_mul_ps(in1, _mm256_moveldup_ps(scale1));
+    imag0 = _mm256_mul_ps(_mm256_permute_ps(in0, _MM_SHUFFLE(2, 3, 0, 1)),
+                          _mm256_movehdup_ps(scale0));
+    imag1 = _mm256_mul_ps(_mm256_permute_ps(in1, _MM_SHUFFLE(2, 3, 0, 1)),
+                          _mm256_movehdup_ps(scale1));
+
+    _mm256_storeu_ps(&aOutput[i], _mm256_addsub_ps(real0, imag0));
+    _mm256_storeu_ps(&aOutput[i + 8], _mm256_addsub_ps(real1, imag1));
+  }
+}
+}  // namespace mozilla
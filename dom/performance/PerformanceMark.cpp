@@ -20,7 +20,11 @@ PerformanceMark::PerformanceMark(nsISupports* aParent, const nsAString& aName,
     : PerformanceEntry(aParent, aName, u"mark"_ns),
       mStartTime(aStartTime),
       mDetail(aDetail) {
-  mozilla::HoldJSObjects(this);
+  // Most marks have no detail. Only register with the JS holder table when
+  // there is something to trace, so that hot mark() calls stay cheap.
+  if (mDetail.isGCThing()) {
+    mozilla::HoldJSObjects(this);
+  }
 }
 
 already_AddRefed<PerformanceMark> PerformanceMark::Constructor(
@@ -19,7 +19,11 @@ PerformanceMeasure::PerformanceMeasure(nsISupports* aParent,
       mStartTime(aStartTime),
       mDuration(aEndTime - aStartTime),
       mDetail(aDetail) {
-  mozilla::HoldJSObjects(this);
+  // Only register with the JS holder table if there is a detail to trace, see
+  // PerformanceMark.
+  if (mDetail.isGCThing()) {
+    mozilla::HoldJSObjects(this);
+  }
 }
 
 PerformanceMeasure::~PerformanceMeasure() { mozilla::DropJSObjects(this); }
@@ -225,6 +225,11 @@ nsresult SVGElement::CopyInnerTo(mozilla::dom::Element* aDest) {
 // SVGElement methods
 
 void SVGElement::DidAnimateClass() {
+  // Class selectors match the animated value, so this counts as a mutation
+  // for cached querySelectorAll results.
+  nsMutationGuard::DidMutate();
+  OwnerDoc()->DropQuerySelectorAllResults();
+
   // For Servo, snapshot the element before we change it.
   PresShell* presShell = OwnerDoc()->GetPresShell();
   if (presShell) {
@@ -352,6 +352,7 @@ void LoadJSGCMemoryOptions(const char* aPrefName, void* /* aClosure */) {
       PREF("gc_large_heap_size_min_mb", JSGC_LARGE_HEAP_SIZE_MIN),
       PREF("gc_balanced_heap_limits", JSGC_BALANCED_HEAP_LIMITS_ENABLED),
       PREF("gc_heap_growth_factor", JSGC_HEAP_GROWTH_FACTOR),
+      PREF("gc_target_overhead_percent", JSGC_TARGET_GC_OVERHEAD_PERCENT),
       PREF("gc_allocation_threshold_mb", JSGC_ALLOCATION_THRESHOLD),
       PREF("gc_malloc_threshold_base_mb", JSGC_MALLOC_THRESHOLD_BASE),
       PREF("gc_small_heap_incremental_limit",
@@ -432,6 +433,7 @@ void LoadJSGCMemoryOptions(const char* aPrefName, void* /* aClosure */) {
       case JSGC_MIN_EMPTY_CHUNK_COUNT:
       case JSGC_MAX_EMPTY_CHUNK_COUNT:
       case JSGC_HEAP_GROWTH_FACTOR:
+      case JSGC_TARGET_GC_OVERHEAD_PERCENT:
         UpdateCommonJSGCMemoryOption(rts, pref->fullName, pref->key);
         break;
       default:
@@ -2113,6 +2113,36 @@ XMLHttpRequestMainThread::OnStartRequest(nsIRequest* request) {
     NS_ENSURE_SUCCESS(rv, rv);
   }
 
+  // If we decode text eagerly, preallocate the response text from the
+  // Content-Length so that large responses are not reallocated and copied for
+  // every chunk in AppendToResponseText.
+  if (mDecoder &&
+      !(mRequestMethod.EqualsLiteral("HEAD") ||
+        mRequestMethod.EqualsLiteral("CONNECT")) &&
+      (mResponseType == XMLHttpRequestResponseType::Text ||
+       mResponseType == XMLHttpRequestResponseType::Json ||
+       (mResponseType == XMLHttpRequestResponseType::_empty &&
+        !mResponseXML))) {
+    int64_t contentLength;
+    if (NS_SUCCEEDED(channel->GetContentLength(&contentLength)) &&
+        contentLength > 0 &&
+        contentLength < XML_HTTP_REQUEST_MAX_CONTENT_LENGTH_PREALLOCATE /
+                            int32_t(sizeof(char16_t))) {
+      CheckedInt<size_t> capacity =
+          mDecoder->MaxUTF16BufferLength(static_cast<size_t>(contentLength));
+
+      XMLHttpRequestStringWriterHelper helper(mResponseText);
+      const uint32_t len = helper.Length();
+      capacity += len;
+      if (capacity.isValid() && capacity.value() <= UINT32_MAX) {
+        auto handleOrErr = helper.BulkWrite(capacity.value());
+        if (handleOrErr.isOk()) {
+          handleOrErr.unwrap().Finish(len, false);
+        }
+      }
+    }
+  }
+
   // Download phase beginning; start the progress event timer if necessary.
   if (NS_SUCCEEDED(rv) && HasListenersFor(nsGkAtoms::onprogress)) {
     StartProgressEventTimer();
@@ -51,7 +51,7 @@ ProcessingInstruction::ProcessingInstruction(
   MOZ_ASSERT(mNodeInfo->NodeType() == nsINode::PROCESSING_INSTRUCTION_NODE,
              "Bad NodeType in aNodeInfo");
 
-  SetTextInternal(0, mText.GetLength(), aData.BeginReading(), aData.Length(),
+  SetTextInternal(0, mText.GetLength(), aData,
                   false);  // Don't notify (bug 420429).
 }
 
@@ -11,6 +11,7 @@
 #include "aom/aomdx.h"
 
 #include "DAV1DDecoder.h"
+#include "DecodePool.h"
 #include "gfxPlatform.h"
 #include "mozilla/gfx/Types.h"
 #include "YCbCrUtils.h"
@@ -18,6 +19,7 @@
 
 #include "SurfacePipeFactory.h"
 
+#include "mozilla/PodOperations.h"
 #include "mozilla/Telemetry.h"
 #include "mozilla/TelemetryComms.h"
 
@@ -59,6 +61,29 @@ static const LABELS_AVIF_YUV_COLOR_SPACE gColorSpaceLabel[] = {
     LABELS_AVIF_YUV_COLOR_SPACE::BT601, LABELS_AVIF_YUV_COLOR_SPACE::BT709,
     LABELS_AVIF_YUV_COLOR_SPACE::BT2020, LABELS_AVIF_YUV_COLOR_SPACE::identity};
 
+// Number of threads the AV1 decoder may use to decode the tiles of a single
+// image in parallel. This mirrors the video decoders' heuristic: small images
+// don't have enough tiles to benefit, and several decode pool threads can be
+// decoding AVIF images at once, so we scale with the width and cap at the
+// number of cores rather than letting each decoder spawn one thread per core.
+static uint32_t AV1DecoderThreadCount(const MaybeIntSize& aSize) {
+  if (int32_t count = StaticPrefs::image_avif_decoder_thread_count();
+      count > 0) {
+    return uint32_t(count);
+  }
+  uint32_t threads = 1;
+  if (aSize.isSome()) {
+    if (aSize->width >= 2048) {
+      threads = 8;
+    } else if (aSize->width >= 1024) {
+      threads = 4;
+    } else if (aSize->width >= 512) {
+      threads = 2;
+    }
+  }
+  return std::min(threads, DecodePool::NumberOfCores());
+}
+
 static MaybeIntSize GetImageSize(const Mp4parseAvifImage& image) {
   // Note this does not take cropping via CleanAperture (clap) into account
   const struct Mp4parseImageSpatialExtents* ispe = image.spatial_extents;
@@ -521,9 +546,10 @@ class Dav1dDecoder final : AVIFDecoderInterface {
   }
 
   static DecodeResult Create(UniquePtr<AVIFParser>&& aParser,
-                             UniquePtr<AVIFDecoderInterface>& aDecoder) {
+                             UniquePtr<AVIFDecoderInterface>& aDecoder,
+                             uint32_t aThreadCount) {
     UniquePtr<Dav1dDecoder> d(new Dav1dDecoder(std::move(aParser)));
-    Dav1dResult r = d->Init();
+    Dav1dResult r = d->Init(aThreadCount);
     if (r == 0) {
       MOZ_ASSERT(d->mContext);
       aDecoder.reset(d.release());
@@ -586,14 +612,14 @@ class Dav1dDecoder final : AVIFDecoderInterface {
     MOZ_LOG(sAVIFLog, LogLevel::Verbose, ("Create Dav1dDecoder=%p", this));
   }
 
-  Dav1dResult Init() {
+  Dav1dResult Init(uint32_t aThreadCount) {
     MOZ_ASSERT(!mContext);
 
     Dav1dSettings settings;
     dav1d_default_settings(&settings);
     settings.all_layers = 0;
     settings.max_frame_delay = 1;
-    // TODO: tune settings a la DAV1DDecoder for AV1 (Bug 1681816)
+    settings.n_threads = static_cast<int>(aThreadCount);
 
     return dav1d_open(&mContext, &settings);
   }
@@ -680,9 +706,10 @@ class AOMDecoder final : AVIFDecoderInterface {
   }
 
   static DecodeResult Create(UniquePtr<AVIFParser>&& aParser,
-                             UniquePtr<AVIFDecoderInterface>& aDecoder) {
+                             UniquePtr<AVIFDecoderInterface>& aDecoder,
+                             uint32_t aThreadCount) {
     UniquePtr<AOMDecoder> d(new AOMDecoder(std::move(aParser)));
-    aom_codec_err_t e = d->Init();
+    aom_codec_err_t e = d->Init(aThreadCount);
     if (e == AOM_CODEC_OK) {
       MOZ_ASSERT(d->mContext);
       aDecoder.reset(d.release());
@@ -761,13 +788,18 @@ class AOMDecoder final : AVIFDecoderInterface {
     MOZ_LOG(sAVIFLog, LogLevel::Verbose, ("Create AOMDecoder=%p", this));
   }
 
-  aom_codec_err_t Init() {
+  aom_codec_err_t Init(uint32_t aThreadCount) {
     MOZ_ASSERT(mContext.isNothing());
 
     aom_codec_iface_t* iface = aom_codec_av1_dx();
+    aom_codec_dec_cfg_t config;
+    PodZero(&config);
+    config.threads = aThreadCount;
+    config.allow_lowbitdepth = true;
+
     mContext.emplace();
-    aom_codec_err_t r = aom_codec_dec_init(
-        mContext.ptr(), iface, /* cfg = */ nullptr, /* flags = */ 0);
+    aom_codec_err_t r = aom_codec_dec_init(mContext.ptr(), iface, &config,
+                                           /* flags = */ 0);
 
     MOZ_LOG(sAVIFLog, r == AOM_CODEC_OK ? LogLevel::Verbose : LogLevel::Error,
             ("[this=%p] aom_codec_dec_init -> %d, name = %s", this, r,
@@ -1350,9 +1382,11 @@ nsAVIFDecoder::DecodeResult nsAVIFDecoder::Decode(
   }
 
   UniquePtr<AVIFDecoderInterface> decoder;
-  DecodeResult r = StaticPrefs::image_avif_use_dav1d()
-                       ? Dav1dDecoder::Create(std::move(parser), decoder)
-                       : AOMDecoder::Create(std::move(parser), decoder);
+  uint32_t threadCount = AV1DecoderThreadCount(parsedImageSize);
+  DecodeResult r =
+      StaticPrefs::image_avif_use_dav1d()
+          ? Dav1dDecoder::Create(std::move(parser), decoder, threadCount)
+          : AOMDecoder::Create(std::move(parser), decoder, threadCount);
 
   MOZ_LOG(sAVIFLog, LogLevel::Debug,
           ("[this=%p] Create %sDecoder %ssuccessfully", this,
@@ -24,6 +24,7 @@
 #include "gfxPlatform.h"
 #include "mozilla/EndianUtils.h"
 #include "mozilla/gfx/Types.h"
+#include "mozilla/StaticPrefs_image.h"
 #include "mozilla/Telemetry.h"
 
 extern "C" {
@@ -350,6 +351,22 @@ LexerTransition<nsJPEGDecoder::State> nsJPEGDecoder::ReadJPEGData(
       mInfo.buffered_image =
           mDecodeStyle == PROGRESSIVE && jpeg_has_multiple_scans(&mInfo);
 
+      // If we're downscaling by at least a factor of two, let libjpeg do the
+      // power-of-two part in the IDCT, which is much cheaper than decoding at
+      // full size. The downscaling filter then handles the remainder.
+      if (OutputSize() != Size() &&
+          StaticPrefs::image_jpeg_dct_scaling_enabled()) {
+        UnorientedIntSize target = GetOrientation().ToUnoriented(OutputSize());
+        unsigned int denom = 8;
+        while (denom > 1 &&
+               (mInfo.image_width / denom < uint32_t(target.width) ||
+                mInfo.image_height / denom < uint32_t(target.height))) {
+          denom /= 2;
+        }
+        mInfo.scale_num = 1;
+        mInfo.scale_denom = denom;
+      }
+
       /* Used to set up image size so arrays can be allocated */
       jpeg_calc_output_dimensions(&mInfo);
 
@@ -360,8 +377,11 @@ LexerTransition<nsJPEGDecoder::State> nsJPEGDecoder::ReadJPEGData(
       qcms_transform* pipeTransform =
           mInfo.out_color_space != JCS_GRAYSCALE ? mTransform : nullptr;
 
+      OrientedIntSize inputSize = GetOrientation().ToOriented(
+          UnorientedIntSize(mInfo.output_width, mInfo.output_height));
+
       Maybe<SurfacePipe> pipe = SurfacePipeFactory::CreateReorientSurfacePipe(
-          this, Size(), OutputSize(), SurfaceFormat::OS_RGBX, pipeTransform,
+          this, inputSize, OutputSize(), SurfaceFormat::OS_RGBX, pipeTransform,
           GetOrientation());
       if (!pipe) {
         mState = JPEG_ERROR;
@@ -661,8 +681,17 @@ WriteState nsJPEGDecoder::OutputScanlines() {
 
   Maybe<SurfaceInvalidRect> invalidRect = mPipe.TakeInvalidRect();
   if (invalidRect) {
-    PostInvalidation(invalidRect->mInputSpaceRect,
-                     Some(invalidRect->mOutputSpaceRect));
+    OrientedIntRect inputRect = invalidRect->mInputSpaceRect;
+    if (mInfo.scale_denom > 1) {
+      // The pipe's input space is the IDCT-scaled image; map the rect back to
+      // the image's full size.
+      int32_t scale = int32_t(mInfo.scale_denom);
+      inputRect = OrientedIntRect(inputRect.x * scale, inputRect.y * scale,
+                                  inputRect.width * scale,
+                                  inputRect.height * scale)
+                      .Intersect(OrientedIntRect(OrientedIntPoint(), Size()));
+    }
+    PostInvalidation(inputRect, Some(invalidRect->mOutputSpaceRect));
   }
 
   return result;
@@ -14,6 +14,7 @@
 #include "ImageOps.h"
 #include "imgIContainer.h"
 #include "ImageFactory.h"
+#include "mozilla/Preferences.h"
 #include "mozilla/ScopeExit.h"
 #include "mozilla/gfx/2D.h"
 #include "nsComponentManagerUtils.h"
@@ -305,6 +306,52 @@ static void CheckDownscaleDuringDecode(const ImageTestCase& aTestCase) {
       });
 }
 
+static void CheckJPGDCTScaledDecode(const IntSize& aOutputSize,
+                                    uint8_t aFuzz) {
+  // downscaled.jpg is 100x100, in four horizontal bands of 25 rows each:
+  // green, red, green, red. The decoder lets libjpeg scale it by 1/2, 1/4 or
+  // 1/8 in the IDCT when that keeps it at least as large as the output size,
+  // so 50x50 and 25x25 come straight out of libjpeg, and 12x12 is scaled to
+  // 13x13 by libjpeg and then by the downscaling filter.
+  ImageTestCase testCase("downscaled.jpg", "image/jpeg", IntSize(100, 100),
+                         aOutputSize);
+
+  WithSingleChunkDecode(
+      testCase, Some(aOutputSize), /* aUseDecodePool */ false,
+      [&](image::Decoder* aDecoder) {
+        RefPtr<SourceSurface> surface = CheckDecoderState(testCase, aDecoder);
+        ASSERT_TRUE(surface != nullptr);
+
+        // Skip the row on each side of a band boundary, which JPEG blocks
+        // and the downscaler both blur.
+        const int32_t height = aOutputSize.height;
+        for (int32_t band = 0; band < 4; ++band) {
+          int32_t first = (band * height + 3) / 4 + 1;
+          int32_t last = ((band + 1) * height) / 4 - 2;
+          if (band == 0) {
+            first = 0;
+          }
+          if (band == 3) {
+            last = height - 1;
+          }
+          if (last < first) {
+            continue;
+          }
+          BGRAColor color = band % 2 ? testCase.ChooseColor(BGRAColor::Red())
+                                     : testCase.ChooseColor(BGRAColor::Green());
+          EXPECT_TRUE(RowsAreSolidColor(surface, first, last - first + 1,
+                                        color, aFuzz))
+              << "band " << band << ", rows " << first << " to " << last;
+        }
+      });
+}
+
+static void CheckJPGDCTScaledDecodes() {
+  CheckJPGDCTScaledDecode(IntSize(50, 50), /* aFuzz */ 27);
+  CheckJPGDCTScaledDecode(IntSize(25, 25), /* aFuzz */ 27);
+  CheckJPGDCTScaledDecode(IntSize(12, 12), /* aFuzz */ 47);
+}
+
 static void CheckAnimationDecoderResults(const ImageTestCase& aTestCase,
                                          AnimationSurfaceProvider* aProvider,
                                          image::Decoder* aDecoder) {
@@ -684,6 +731,19 @@ IMAGE_GTEST_DECODER_BASE_F(WebP)
 IMAGE_GTEST_DECODER_BASE_F(JXL)
 #endif
 
+TEST_F(ImageDecoders, JPGDCTScaledDownscaleDuringDecode) {
+  CheckJPGDCTScaledDecodes();
+}
+
+TEST_F(ImageDecoders, JPGDownscaleDuringDecodeWithoutDCTScaling) {
+  const char* kPref = "image.jpeg.dct_scaling.enabled";
+  bool enabled = Preferences::GetBool(kPref);
+  Preferences::SetBool(kPref, false);
+  auto restore =
+      MakeScopeExit([&] { Preferences::SetBool(kPref, enabled); });
+  CheckJPGDCTScaledDecodes();
+}
+
 TEST_F(ImageDecoders, ICOWithANDMaskDownscaleDuringDecode) {
   CheckDownscaleDuringDecode(DownscaledTransparentICOWithANDMaskTestCase());
 }
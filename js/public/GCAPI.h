@@ -470,6 +470,28 @@ typedef enum JSGCParamKey {
    * incremental limit.
    */
   JSGC_URGENT_THRESHOLD_MB = 48,
+
+  /**
+   * Whether the tables swept at the end of a minor GC may be swept on helper
+   * threads, one zone per task.
+   *
+   * Default: ParallelMinorGCSweepingEnabled
+   */
+  JSGC_PARALLEL_MINOR_GC_SWEEPING_ENABLED = 49,
+
+  /**
+   * Target percentage of time to spend in major GC when balanced heap limits
+   * are enabled, or zero to use JSGC_HEAP_GROWTH_FACTOR as it is.
+   *
+   * When this is set, the heap growth factor used by the balanced heap limit
+   * calculation is adjusted after every major GC to bring the measured GC
+   * overhead towards the target. Lower values use less memory at the cost of
+   * collecting more often.
+   *
+   * Pref: javascript.options.mem.gc_target_overhead_percent
+   * Default: TargetGCOverheadPercent
+   */
+  JSGC_TARGET_GC_OVERHEAD_PERCENT = 50,
 } JSGCParamKey;
 
 /*
@@ -561,6 +583,18 @@ struct JSExternalStringCallbacks {
    */
   virtual size_t sizeOfBuffer(const char16_t* chars,
                               mozilla::MallocSizeOf mallocSizeOf) const = 0;
+
+  /**
+   * Optional. Embedders whose buffers are immutable, thread-safe and reference
+   * counted can let same-process structured clones share them with other
+   * threads instead of copying the characters. Return true if a new reference
+   * to the buffer holding |chars| was taken; it is dropped by a later call to
+   * finalize. Callbacks which support this must outlive every runtime in the
+   * process, and may be called off the main thread.
+   */
+  virtual bool addSharedReference(const char16_t* chars) const {
+    return false;
+  }
 };
 
 namespace JS {
@@ -894,6 +928,69 @@ typedef void (*GCSliceCallback)(JSContext* cx, GCProgress progress,
 extern JS_PUBLIC_API GCSliceCallback
 SetGCSliceCallback(JSContext* cx, GCSliceCallback callback);
 
+/**
+ * A compact summary of a single major GC slice, suitable for aggregation by
+ * telemetry. Unlike the JSON returned by GCDescription, these are collected
+ * for every slice whether or not anything is listening.
+ */
+struct GCSliceRecord {
+  mozilla::TimeStamp start;
+  mozilla::TimeStamp end;
+
+  uint64_t majorGCNumber = 0;
+  uint64_t sliceNumber = 0;
+  GCReason reason = GCReason::NO_REASON;
+
+  // Whether this was the last slice of its major GC.
+  bool isLastSlice = false;
+
+  // Whether the incremental GC was reset during this slice.
+  bool wasReset = false;
+
+  uint32_t collectedZoneCount = 0;
+  uint32_t zoneCount = 0;
+
+  // Main thread time spent in the mark, sweep and compact phases.
+  mozilla::TimeDuration markTime;
+  mozilla::TimeDuration sweepTime;
+  mozilla::TimeDuration compactTime;
+
+  // The size of the GC heap at the start and the end of the slice. Bytes
+  // allocated between slices can be derived from consecutive records.
+  size_t heapBytesBefore = 0;
+  size_t heapBytesAfter = 0;
+
+  // The fraction of live nursery bytes which were promoted by the most recent
+  // minor GC.
+  double nurseryPromotionRate = 0.0;
+
+  // Time spent in parallel GC tasks as a fraction of the time available to the
+  // GC's helper threads during the slice.
+  double helperThreadUtilization = 0.0;
+};
+
+/**
+ * Called with the slice records collected since the last call, oldest first.
+ * This happens whenever the runtime's buffer of records fills up and when
+ * FlushGCSliceRecords is called. The callback must not GC.
+ */
+using GCSliceRecordCallback = void (*)(JSContext* cx,
+                                       const GCSliceRecord* records,
+                                       size_t length, void* data);
+
+/**
+ * Set the callback which receives GC slice records. The runtime keeps a fixed
+ * number of the most recent records, and older records are overwritten while
+ * no callback is set.
+ */
+extern JS_PUBLIC_API void SetGCSliceRecordCallback(
+    JSContext* cx, GCSliceRecordCallback callback, void* data);
+
+/**
+ * Pass any pending GC slice records to the slice record callback.
+ */
+extern JS_PUBLIC_API void FlushGCSliceRecords(JSContext* cx);
+
 /**
  * Describes the progress of an observed nursery collection.
  */
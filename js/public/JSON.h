@@ -23,6 +23,11 @@ using JSONWriteCallback = bool (*)(const char16_t* buf, uint32_t len,
  * Performs the JSON.stringify operation, as specified by ECMAScript, except
  * writing stringified data by repeated calls of |callback|, with each such
  * call passed |data| as argument.
+ *
+ * Large results are passed to |callback| in chunks while stringification is in
+ * progress, so the complete result is never held in memory at once. If
+ * stringification fails, part of the result may already have been passed to
+ * |callback|.
  */
 extern JS_PUBLIC_API bool JS_Stringify(JSContext* cx,
                                        JS::MutableHandle<JS::Value> value,
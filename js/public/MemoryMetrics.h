@@ -457,11 +457,12 @@ struct NotableScriptSourceInfo : public ScriptSourceInfo {
 };
 
 struct HelperThreadStats {
-#define FOR_EACH_SIZE(MACRO)           \
-  MACRO(_, MallocHeap, stateData)      \
-  MACRO(_, MallocHeap, parseTask)      \
-  MACRO(_, MallocHeap, ionCompileTask) \
-  MACRO(_, MallocHeap, wasmCompile)    \
+#define FOR_EACH_SIZE(MACRO)                \
+  MACRO(_, MallocHeap, stateData)           \
+  MACRO(_, MallocHeap, parseTask)           \
+  MACRO(_, MallocHeap, ionCompileTask)      \
+  MACRO(_, MallocHeap, baselineCompileTask) \
+  MACRO(_, MallocHeap, wasmCompile)         \
   MACRO(_, MallocHeap, contexts)
 
   HelperThreadStats() = default;
@@ -483,6 +484,9 @@ struct GlobalStats {
 
   HelperThreadStats helperThread;
 
+  // The process-wide cache of regexp bytecode shared between runtimes.
+  size_t regExpCodeCache = 0;
+
   mozilla::MallocSizeOf mallocSizeOf_;
 };
 
@@ -406,6 +406,8 @@ enum OwnTransferablePolicy {
   NoTransferables
 };
 
+struct JSExternalStringCallbacks;
+
 namespace js {
 class SharedArrayRawBuffer;
 
@@ -426,6 +428,32 @@ class SharedArrayRawBufferRefs {
   js::Vector<js::SharedArrayRawBuffer*, 0, js::SystemAllocPolicy> refs_;
 };
 
+// References to the characters of external strings which are shared with the
+// reader of a same-process clone, see JSExternalStringCallbacks.
+class SharedExternalStringRefs {
+ public:
+  SharedExternalStringRefs() = default;
+  SharedExternalStringRefs(SharedExternalStringRefs&& other) = default;
+  SharedExternalStringRefs& operator=(SharedExternalStringRefs&& other);
+  ~SharedExternalStringRefs();
+
+  // Take ownership of a reference which has already been added.
+  [[nodiscard]] bool adopt(JSContext* cx,
+                           const JSExternalStringCallbacks* callbacks,
+                           const char16_t* chars);
+  // Take a new reference to each of |that|'s strings.
+  [[nodiscard]] bool acquireAll(const SharedExternalStringRefs& that);
+  void takeOwnership(SharedExternalStringRefs&&);
+  void releaseAll();
+
+ private:
+  struct Ref {
+    const JSExternalStringCallbacks* callbacks;
+    const char16_t* chars;
+  };
+  js::Vector<Ref, 0, js::SystemAllocPolicy> refs_;
+};
+
 template <typename T, typename AllocPolicy>
 struct BufferIterator;
 }  // namespace js
@@ -455,6 +483,7 @@ class MOZ_NON_MEMMOVABLE JS_PUBLIC_API JSStructuredCloneData {
   OwnTransferablePolicy ownTransferables_ =
       OwnTransferablePolicy::NoTransferables;
   js::SharedArrayRawBufferRefs refsHeld_;
+  js::SharedExternalStringRefs stringRefsHeld_;
 
   friend struct JSStructuredCloneWriter;
   friend class JS_PUBLIC_API JSAutoStructuredCloneBuffer;
@@ -590,12 +619,9 @@ class MOZ_NON_MEMMOVABLE JS_PUBLIC_API JSStructuredCloneData {
     return true;
   }
 
-  // Append the entire contents of other's bufList_ to our own.
-  [[nodiscard]] bool Append(const JSStructuredCloneData& other) {
-    MOZ_ASSERT(scope() == other.scope());
-    return other.ForEachDataChunk(
-        [&](const char* data, size_t size) { return AppendBytes(data, size); });
-  }
+  // Append the entire contents of other's bufList_ to our own, and take a
+  // reference to the external strings it shares.
+  [[nodiscard]] bool Append(const JSStructuredCloneData& other);
 
   size_t SizeOfExcludingThis(mozilla::MallocSizeOf mallocSizeOf) {
     return bufList_.SizeOfExcludingThis(mallocSizeOf);
@@ -68,6 +68,7 @@ enum ThreadType {
   THREAD_TYPE_WORKER,                // 11
   THREAD_TYPE_DELAZIFY,              // 12
   THREAD_TYPE_DELAZIFY_FREE,         // 13
+  THREAD_TYPE_BASELINE,              // 14
   THREAD_TYPE_MAX                    // Used to check shell function arguments
 };
 
@@ -511,12 +511,13 @@ namespace js {
 // js::FutexWaiter are stack-allocated and linked onto a list across a
 // call to FutexThread::wait().
 //
-// The 'waiters' field of the SharedArrayRawBuffer points to the highest
-// priority waiter in the list, and lower priority nodes are linked through
-// the 'lower_pri' field.  The 'back' field goes the other direction.
-// The list is circular, so the 'lower_pri' field of the lowest priority
-// node points to the first node in the list.  The list has no dedicated
-// header node.
+// The SharedArrayRawBuffer keeps one list per bucket of byte offsets, and
+// waiters(offset) points to the highest priority waiter in the list for that
+// offset's bucket.  Lower priority nodes are linked through the 'lower_pri'
+// field.  The 'back' field goes the other direction.  Each list is circular,
+// so the 'lower_pri' field of the lowest priority node points to the first
+// node in the list.  The lists have no dedicated header node.  Waiters on
+// other offsets that hash to the same bucket are skipped by notify.
 
 class FutexWaiter {
  public:
@@ -577,27 +578,32 @@ static FutexThread::WaitResult AtomicsWait(
     return FutexThread::WaitResult::NotEqual;
   }
 
+  if (!sarb->ensureWaiters()) {
+    ReportOutOfMemory(cx);
+    return FutexThread::WaitResult::Error;
+  }
+
   // Steps 14, 18-22.
   FutexWaiter w(byteOffset, cx);
-  if (FutexWaiter* waiters = sarb->waiters()) {
+  if (FutexWaiter* waiters = sarb->waiters(byteOffset)) {
     w.lower_pri = waiters;
     w.back = waiters->back;
     waiters->back->lower_pri = &w;
     waiters->back = &w;
   } else {
     w.lower_pri = w.back = &w;
-    sarb->setWaiters(&w);
+    sarb->setWaiters(byteOffset, &w);
   }
 
   FutexThread::WaitResult retval = cx->fx.wait(cx, lock.unique(), timeout);
 
   if (w.lower_pri == &w) {
-    sarb->setWaiters(nullptr);
+    sarb->setWaiters(byteOffset, nullptr);
   } else {
     w.lower_pri->back = w.back;
     w.back->lower_pri = w.lower_pri;
-    if (sarb->waiters() == &w) {
-      sarb->setWaiters(w.lower_pri);
+    if (sarb->waiters(byteOffset) == &w) {
+      sarb->setWaiters(byteOffset, w.lower_pri);
     }
   }
 
@@ -741,7 +747,7 @@ int64_t js::atomics_notify_impl(SharedArrayRawBuffer* sarb, size_t byteOffset,
   int64_t woken = 0;
 
   // Steps 10, 13-14.
-  FutexWaiter* waiters = sarb->waiters();
+  FutexWaiter* waiters = sarb->waiters(byteOffset);
   if (waiters && count) {
     FutexWaiter* iter = waiters;
     do {
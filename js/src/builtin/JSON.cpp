@@ -212,16 +212,38 @@ class StringifyContext {
  public:
   StringifyContext(JSContext* cx, StringBuffer& sb, const StringBuffer& gap,
                    HandleObject replacer, const RootedIdVector& propertyList,
-                   bool maybeSafely)
+                   bool maybeSafely, JSONWriteCallback flushCallback,
+                   void* flushData)
       : sb(sb),
         gap(gap),
         replacer(cx, replacer),
         stack(cx, ObjectVector(cx)),
         propertyList(propertyList),
         depth(0),
-        maybeSafely(maybeSafely) {
+        maybeSafely(maybeSafely),
+        flushCallback(flushCallback),
+        flushData(flushData) {
     MOZ_ASSERT_IF(maybeSafely, !replacer);
     MOZ_ASSERT_IF(maybeSafely, gap.empty());
+    MOZ_ASSERT_IF(flushCallback, !sb.isUnderlyingBufferLatin1());
+  }
+
+  // Number of chars above which the buffer is passed to flushCallback.
+  static constexpr size_t FlushThreshold = 64 * 1024;
+
+  // Pass the buffered output to flushCallback, if there is one and enough
+  // output has been buffered. This must only be called after a complete
+  // member of an object or array has been written, as the buffer must not be
+  // empty at the end if anything has been flushed.
+  bool maybeFlush() {
+    if (!flushCallback || sb.length() < FlushThreshold) {
+      return true;
+    }
+    if (!flushCallback(sb.rawTwoByteBegin(), sb.length(), flushData)) {
+      return false;
+    }
+    sb.clear();
+    return true;
   }
 
   StringBuffer& sb;
@@ -231,6 +253,8 @@ class StringifyContext {
   const RootedIdVector& propertyList;
   uint32_t depth;
   bool maybeSafely;
+  JSONWriteCallback flushCallback;
+  void* flushData;
 };
 
 } /* anonymous namespace */
@@ -549,6 +573,10 @@ static bool JO(JSContext* cx, HandleObject obj, StringifyContext* scx) {
         !Str(cx, outputValue, scx)) {
       return false;
     }
+
+    if (!scx->maybeFlush()) {
+      return false;
+    }
   }
 
   if (wroteMember && !WriteIndent(scx, scx->depth - 1)) {
@@ -682,6 +710,10 @@ static bool JA(JSContext* cx, HandleObject obj, StringifyContext* scx) {
         }
       }
 
+      if (!scx->maybeFlush()) {
+        return false;
+      }
+
       /* Steps 3, 4, 10b(i). */
       if (i < length - 1) {
         if (!scx->sb.append(',')) {
@@ -795,7 +827,8 @@ static bool Str(JSContext* cx, const Value& v, StringifyContext* scx) {
 /* ES6 24.3.2. */
 bool js::Stringify(JSContext* cx, MutableHandleValue vp, JSObject* replacer_,
                    const Value& space_, StringBuffer& sb,
-                   StringifyBehavior stringifyBehavior) {
+                   StringifyBehavior stringifyBehavior,
+                   JSONWriteCallback flushCallback, void* flushData) {
   RootedObject replacer(cx, replacer_);
   RootedValue space(cx, space_);
 
@@ -959,7 +992,8 @@ bool js::Stringify(JSContext* cx, MutableHandleValue vp, JSObject* replacer_,
 
   /* Step 12. */
   StringifyContext scx(cx, sb, gap, replacer, propertyList,
-                       stringifyBehavior == StringifyBehavior::RestrictedSafe);
+                       stringifyBehavior == StringifyBehavior::RestrictedSafe,
+                       flushCallback, flushData);
   if (!PreprocessValue(cx, wrapper, HandleId(emptyId), vp, &scx)) {
     return false;
   }
@@ -11,6 +11,7 @@
 
 #include "NamespaceImports.h"
 
+#include "js/JSON.h"  // JSONWriteCallback
 #include "js/RootingAPI.h"
 
 namespace js {
@@ -25,10 +26,19 @@ enum class StringifyBehavior { Normal, RestrictedSafe };
  * If maybeSafely is true, Stringify will attempt to assert the API requirements
  * of JS::ToJSONMaybeSafely as it traverses the graph, and will not try to
  * invoke .toJSON on things as it goes.
+ *
+ * If flushCallback is non-null, |sb| must hold two-byte chars, and its contents
+ * are passed to flushCallback and then cleared whenever it grows beyond a
+ * fixed size, so that the stringified result never needs to be held in memory
+ * as a whole. The caller is responsible for passing whatever remains in |sb|
+ * once Stringify returns. Flushing only happens in the middle of an object or
+ * array, so |sb| is non-empty on success if anything was flushed.
  */
 extern bool Stringify(JSContext* cx, js::MutableHandleValue vp,
                       JSObject* replacer, const Value& space, StringBuffer& sb,
-                      StringifyBehavior stringifyBehavior);
+                      StringifyBehavior stringifyBehavior,
+                      JSONWriteCallback flushCallback = nullptr,
+                      void* flushData = nullptr);
 
 template <typename CharT>
 extern bool ParseJSONWithReviver(JSContext* cx,
@@ -1442,7 +1442,6 @@ static bool PromiseReactionJob(JSContext* cx, unsigned argc, Value* vp);
   cx->check(handlerArg);
   reaction->setTargetStateAndHandlerArg(targetState, handlerArg);
 
-  RootedValue reactionVal(cx, ObjectValue(*reaction));
   RootedValue handler(cx, reaction->handler());
 
   // NewPromiseReactionJob
@@ -1486,27 +1485,26 @@ static bool PromiseReactionJob(JSContext* cx, unsigned argc, Value* vp);
     //           objects.
     RootedObject handlerObj(cx, &handler.toObject());
     ar2.emplace(cx, handlerObj);
+  }
 
-    // We need to wrap the reaction to store it on the job function.
-    if (!cx->compartment()->wrap(cx, &reactionVal)) {
-      return false;
-    }
+  // The internal job queue ignores everything but the job, and can run
+  // reaction records directly. Skip allocating the job function when the job
+  // doesn't have to switch realms.
+  if (cx->realm() == reaction->realm() && cx->internalJobQueue.ref() &&
+      cx->jobQueue == cx->internalJobQueue.ref().get()) {
+    RootedObject job(cx, reaction);
+    return cx->jobQueue->enqueuePromiseJob(cx, nullptr, job, nullptr, nullptr);
   }
 
   // NewPromiseReactionJob
   // Step 1. Let job be a new Job Abstract Closure with no parameters that
   //         captures reaction and argument and performs the following steps
   //         when called:
-  Handle<PropertyName*> funName = cx->names().empty;
-  RootedFunction job(
-      cx, NewNativeFunction(cx, PromiseReactionJob, 0, funName,
-                            gc::AllocKind::FUNCTION_EXTENDED, GenericObject));
+  RootedFunction job(cx, NewPromiseReactionJobFunction(cx, reaction));
   if (!job) {
     return false;
   }
 
-  job->setExtendedSlot(ReactionJobSlot_ReactionRecord, reactionVal);
-
   // When using JS::AddPromiseReactions{,IgnoringUnHandledRejection}, no actual
   // promise is created, so we might not have one here.
   // Additionally, we might have an object here that isn't an instance of
@@ -2142,6 +2140,36 @@ static bool PromiseReactionJob(JSContext* cx, unsigned argc, Value* vp) {
 
   RootedObject reactionObj(
       cx, &job->getExtendedSlot(ReactionJobSlot_ReactionRecord).toObject());
+  return RunPromiseReactionJob(cx, reactionObj);
+}
+
+JSFunction* js::NewPromiseReactionJobFunction(JSContext* cx,
+                                              HandleObject reaction) {
+  // We need to wrap the reaction to store it on the job function, if the job
+  // is created in the handler's compartment.
+  RootedValue reactionVal(cx, ObjectValue(*reaction));
+  if (!cx->compartment()->wrap(cx, &reactionVal)) {
+    return nullptr;
+  }
+
+  Handle<PropertyName*> funName = cx->names().empty;
+  JSFunction* job =
+      NewNativeFunction(cx, PromiseReactionJob, 0, funName,
+                        gc::AllocKind::FUNCTION_EXTENDED, GenericObject);
+  if (!job) {
+    return nullptr;
+  }
+
+  job->setExtendedSlot(ReactionJobSlot_ReactionRecord, reactionVal);
+  return job;
+}
+
+bool js::IsPromiseReactionRecord(JSObject* obj) {
+  return obj->is<PromiseReactionRecord>();
+}
+
+bool js::RunPromiseReactionJob(JSContext* cx, HandleObject reactionObjArg) {
+  RootedObject reactionObj(cx, reactionObjArg);
 
   // To ensure that the embedding ends up with the right entry global, we're
   // guaranteeing that the reaction job function gets created in the same
@@ -262,6 +262,21 @@ bool IsPromiseWithDefaultResolvingFunction(PromiseObject* promise);
 void SetAlreadyResolvedPromiseWithDefaultResolvingFunction(
     PromiseObject* promise);
 
+// When the internal job queue is used, same-realm promise reaction jobs are
+// enqueued as the reaction record itself instead of a job function.
+// InternalJobQueue::runJobs uses these to recognize and run them.
+bool IsPromiseReactionRecord(JSObject* obj);
+[[nodiscard]] bool RunPromiseReactionJob(JSContext* cx,
+                                         JS::Handle<JSObject*> reactionObj);
+
+// Create the job function running the given reaction record, in the current
+// compartment. This is what gets enqueued when the internal job queue is not
+// used or the job has to switch realms. Queued reaction records are also
+// turned into job functions before being handed out, so that the records
+// themselves are never exposed to script.
+JSFunction* NewPromiseReactionJobFunction(JSContext* cx,
+                                          JS::Handle<JSObject*> reaction);
+
 }  // namespace js
 
 #endif  // builtin_Promise_h
@@ -2357,6 +2357,46 @@ static bool str_lastIndexOf(JSContext* cx, unsigned argc, Value* vp) {
   return true;
 }
 
+/*
+ * Return a linear string holding the characters [*start, *start + length) of
+ * |str|, adjusting *start to be relative to it. For ropes this descends into
+ * the child which contains the whole range, so checking a prefix or suffix of
+ * a long string built by concatenation doesn't flatten it. Falls back to
+ * flattening when the range straddles two children, or when the rope is too
+ * deep: repeatedly appending to a string and checking its prefix would
+ * otherwise walk the whole left spine every time, and flattening reuses the
+ * extensible buffer of the left child.
+ */
+static JSLinearString* LinearStringForRange(JSContext* cx, JSString* str,
+                                            uint32_t* start, uint32_t length) {
+  MOZ_ASSERT(*start + length <= str->length());
+
+  static constexpr size_t MaxDepth = 8;
+
+  uint32_t offset = *start;
+  JSString* child = str;
+  size_t depth = 0;
+  while (child->isRope()) {
+    if (depth++ == MaxDepth) {
+      return str->ensureLinear(cx);
+    }
+
+    JSString* left = child->asRope().leftChild();
+    uint32_t leftLen = left->length();
+    if (offset + length <= leftLen) {
+      child = left;
+    } else if (offset >= leftLen) {
+      child = child->asRope().rightChild();
+      offset -= leftLen;
+    } else {
+      return str->ensureLinear(cx);
+    }
+  }
+
+  *start = offset;
+  return &child->asLinear();
+}
+
 // ES2018 draft rev de77aaeffce115deaf948ed30c7dbe4c60983c0c
 // 21.1.3.20 String.prototype.startsWith ( searchString [ , position ] )
 bool js::str_startsWith(JSContext* cx, unsigned argc, Value* vp) {
@@ -2412,7 +2452,7 @@ bool js::str_startsWith(JSContext* cx, unsigned argc, Value* vp) {
   }
 
   // Steps 11-12.
-  JSLinearString* text = str->ensureLinear(cx);
+  JSLinearString* text = LinearStringForRange(cx, str, &start, searchLen);
   if (!text) {
     return false;
   }
@@ -2428,17 +2468,19 @@ bool js::StringStartsWith(JSContext* cx, HandleString string,
     return true;
   }
 
-  JSLinearString* str = string->ensureLinear(cx);
-  if (!str) {
+  JSLinearString* searchStr = searchString->ensureLinear(cx);
+  if (!searchStr) {
     return false;
   }
 
-  JSLinearString* searchStr = searchString->ensureLinear(cx);
-  if (!searchStr) {
+  uint32_t start = 0;
+  JSLinearString* str =
+      LinearStringForRange(cx, string, &start, searchStr->length());
+  if (!str) {
     return false;
   }
 
-  *result = HasSubstringAt(str, searchStr, 0);
+  *result = HasSubstringAt(str, searchStr, start);
   return true;
 }
 
@@ -2499,7 +2541,7 @@ bool js::str_endsWith(JSContext* cx, unsigned argc, Value* vp) {
   uint32_t start = end - searchLen;
 
   // Steps 12-13.
-  JSLinearString* text = str->ensureLinear(cx);
+  JSLinearString* text = LinearStringForRange(cx, str, &start, searchLen);
   if (!text) {
     return false;
   }
@@ -2515,17 +2557,17 @@ bool js::StringEndsWith(JSContext* cx, HandleString string,
     return true;
   }
 
-  JSLinearString* str = string->ensureLinear(cx);
-  if (!str) {
-    return false;
-  }
-
   JSLinearString* searchStr = searchString->ensureLinear(cx);
   if (!searchStr) {
     return false;
   }
 
-  uint32_t start = str->length() - searchStr->length();
+  uint32_t start = string->length() - searchStr->length();
+  JSLinearString* str =
+      LinearStringForRange(cx, string, &start, searchStr->length());
+  if (!str) {
+    return false;
+  }
 
   *result = HasSubstringAt(str, searchStr, start);
   return true;
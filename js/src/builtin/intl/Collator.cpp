@@ -12,6 +12,9 @@
 #include "mozilla/intl/Collator.h"
 #include "mozilla/intl/Locale.h"
 #include "mozilla/Span.h"
+#include "mozilla/TextUtils.h"
+
+#include <algorithm>
 
 #include "builtin/Array.h"
 #include "builtin/intl/CommonFunctions.h"
@@ -206,12 +209,37 @@ bool js::intl_availableCollations(JSContext* cx, unsigned argc, Value* vp) {
   return true;
 }
 
+using AsciiComparison = CollatorObject::AsciiComparison;
+
+/**
+ * Returns true if the collation of |tag| orders ASCII characters like the CLDR
+ * root collation. The listed languages don't tailor ASCII characters and don't
+ * reorder scripts.
+ */
+static bool HasRootAsciiOrder(const mozilla::intl::Locale& tag) {
+  const auto& language = tag.Language();
+  if (!language.EqualTo("de") && !language.EqualTo("en") &&
+      !language.EqualTo("es") && !language.EqualTo("fr") &&
+      !language.EqualTo("it") && !language.EqualTo("nl") &&
+      !language.EqualTo("pt")) {
+    return false;
+  }
+
+  // Variants, extensions and private use subtags may select a different
+  // collation.
+  return (tag.Script().Missing() || tag.Script().EqualTo("Latn")) &&
+         tag.Variants().empty() && tag.Extensions().empty() &&
+         tag.PrivateUse().isNothing();
+}
+
 /**
  * Returns a new mozilla::intl::Collator with the locale and collation options
- * of the given Collator.
+ * of the given Collator. |*asciiComparison| is set to how the collator orders
+ * ASCII strings.
  */
 static mozilla::intl::Collator* NewIntlCollator(
-    JSContext* cx, Handle<CollatorObject*> collator) {
+    JSContext* cx, Handle<CollatorObject*> collator,
+    AsciiComparison* asciiComparison) {
   RootedValue value(cx);
 
   RootedObject internals(cx, intl::GetInternalsObject(cx, collator));
@@ -260,6 +288,8 @@ static mozilla::intl::Collator* NewIntlCollator(
     }
   }
 
+  bool hasRootAsciiOrder = usage == Usage::Sort && HasRootAsciiOrder(tag);
+
   JS::RootedVector<intl::UnicodeExtensionKeyword> keywords(cx);
 
   // ICU expects collation as Unicode locale extensions on locale.
@@ -297,6 +327,7 @@ static mozilla::intl::Collator* NewIntlCollator(
       if (!keywords.emplaceBack("co", collation)) {
         return nullptr;
       }
+      hasRootAsciiOrder = false;
     }
   }
 
@@ -371,6 +402,19 @@ static mozilla::intl::Collator* NewIntlCollator(
     }
   }
 
+  // The default case order of the supported locales sorts lower case first.
+  *asciiComparison = AsciiComparison::Unsupported;
+  if (hasRootAsciiOrder && !options.ignorePunctuation && !options.numeric) {
+    if (options.sensitivity == Collator::Sensitivity::Base ||
+        options.sensitivity == Collator::Sensitivity::Accent) {
+      *asciiComparison = AsciiComparison::Primary;
+    } else if (options.caseFirst == Collator::CaseFirst::Upper) {
+      *asciiComparison = AsciiComparison::UpperFirst;
+    } else {
+      *asciiComparison = AsciiComparison::LowerFirst;
+    }
+  }
+
   auto collResult = Collator::TryCreate(locale.get());
   if (collResult.isErr()) {
     ReportInternalError(cx, collResult.unwrapErr());
@@ -395,11 +439,13 @@ static mozilla::intl::Collator* GetOrCreateCollator(
     return coll;
   }
 
-  coll = NewIntlCollator(cx, collator);
+  AsciiComparison asciiComparison;
+  coll = NewIntlCollator(cx, collator, &asciiComparison);
   if (!coll) {
     return nullptr;
   }
   collator->setCollator(coll);
+  collator->setAsciiComparison(asciiComparison);
 
   intl::AddICUCellMemory(collator, CollatorObject::EstimatedMemoryUse);
   return coll;
@@ -433,6 +479,137 @@ static bool intl_CompareStrings(JSContext* cx, mozilla::intl::Collator* coll,
   return true;
 }
 
+namespace {
+
+/**
+ * The primary weights of the ASCII characters in the CLDR root collation. Upper
+ * and lower case letters share the same primary weight. The control characters
+ * other than whitespace are completely ignorable and have the weight zero, so
+ * that strings containing them are left to ICU.
+ */
+class AsciiPrimaryWeights {
+  uint8_t weights_[128] = {};
+
+ public:
+  constexpr AsciiPrimaryWeights() {
+    constexpr char order[] =
+        "\t\n\v\f\r _-,;:!?.'\"()[]{}@*/\\&#%`^+<=>|~$"
+        "0123456789abcdefghijklmnopqrstuvwxyz";
+
+    uint8_t weight = 1;
+    for (char ch : order) {
+      if (ch == '\0') {
+        break;
+      }
+      weights_[size_t(ch)] = weight++;
+    }
+    for (char ch = 'A'; ch <= 'Z'; ch++) {
+      weights_[size_t(ch)] = weights_[size_t(ch - 'A' + 'a')];
+    }
+  }
+
+  template <typename CharT>
+  bool hasWeights(mozilla::Span<const CharT> chars) const {
+    for (CharT ch : chars) {
+      if (ch >= 128 || weights_[ch] == 0) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  template <typename CharT>
+  uint8_t operator[](CharT ch) const {
+    MOZ_ASSERT(ch < 128);
+    return weights_[ch];
+  }
+};
+
+}  // namespace
+
+static constexpr AsciiPrimaryWeights AsciiWeights;
+
+template <typename CharT1, typename CharT2>
+static bool CompareAsciiChars(AsciiComparison comparison,
+                              mozilla::Span<const CharT1> chars1,
+                              mozilla::Span<const CharT2> chars2,
+                              int32_t* result) {
+  if (!AsciiWeights.hasWeights(chars1) || !AsciiWeights.hasWeights(chars2)) {
+    return false;
+  }
+
+  // All characters have a single primary weight and the same secondary weight,
+  // so the first difference in the primary weights decides, followed by the
+  // length and then by the first case difference.
+  int32_t caseResult = 0;
+  size_t length = std::min(chars1.size(), chars2.size());
+  for (size_t i = 0; i < length; i++) {
+    char16_t ch1 = chars1[i];
+    char16_t ch2 = chars2[i];
+    if (ch1 == ch2) {
+      continue;
+    }
+
+    uint8_t weight1 = AsciiWeights[ch1];
+    uint8_t weight2 = AsciiWeights[ch2];
+    if (weight1 != weight2) {
+      *result = weight1 < weight2 ? -1 : 1;
+      return true;
+    }
+
+    // The same letter in a different case.
+    if (caseResult == 0) {
+      caseResult = mozilla::IsAsciiLowercaseAlpha(ch1) ? -1 : 1;
+    }
+  }
+
+  if (chars1.size() != chars2.size()) {
+    *result = chars1.size() < chars2.size() ? -1 : 1;
+    return true;
+  }
+
+  switch (comparison) {
+    case AsciiComparison::Primary:
+      *result = 0;
+      return true;
+    case AsciiComparison::LowerFirst:
+      *result = caseResult;
+      return true;
+    case AsciiComparison::UpperFirst:
+      *result = -caseResult;
+      return true;
+    case AsciiComparison::Unsupported:
+      break;
+  }
+  MOZ_CRASH("unexpected ASCII comparison");
+}
+
+/**
+ * Compare two strings without calling into ICU. Returns false if either string
+ * contains characters other than printable ASCII and whitespace.
+ */
+static bool CompareAsciiStrings(AsciiComparison comparison,
+                                JSLinearString* str1, JSLinearString* str2,
+                                int32_t* result) {
+  JS::AutoCheckCannotGC nogc;
+  if (str1->hasLatin1Chars()) {
+    auto chars1 = mozilla::Span(str1->latin1Chars(nogc), str1->length());
+    if (str2->hasLatin1Chars()) {
+      auto chars2 = mozilla::Span(str2->latin1Chars(nogc), str2->length());
+      return CompareAsciiChars(comparison, chars1, chars2, result);
+    }
+    auto chars2 = mozilla::Span(str2->twoByteChars(nogc), str2->length());
+    return CompareAsciiChars(comparison, chars1, chars2, result);
+  }
+  auto chars1 = mozilla::Span(str1->twoByteChars(nogc), str1->length());
+  if (str2->hasLatin1Chars()) {
+    auto chars2 = mozilla::Span(str2->latin1Chars(nogc), str2->length());
+    return CompareAsciiChars(comparison, chars1, chars2, result);
+  }
+  auto chars2 = mozilla::Span(str2->twoByteChars(nogc), str2->length());
+  return CompareAsciiChars(comparison, chars1, chars2, result);
+}
+
 bool js::intl_CompareStrings(JSContext* cx, unsigned argc, Value* vp) {
   CallArgs args = CallArgsFromVp(argc, vp);
   MOZ_ASSERT(args.length() == 3);
@@ -448,9 +625,32 @@ bool js::intl_CompareStrings(JSContext* cx, unsigned argc, Value* vp) {
     return false;
   }
 
-  // Use the UCollator to actually compare the strings.
   RootedString str1(cx, args[1].toString());
   RootedString str2(cx, args[2].toString());
+
+  AsciiComparison asciiComparison = collator->getAsciiComparison();
+  if (asciiComparison != AsciiComparison::Unsupported && str1 != str2) {
+    if (!str1->ensureLinear(cx) || !str2->ensureLinear(cx)) {
+      return false;
+    }
+
+    int32_t result;
+    if (CompareAsciiStrings(asciiComparison, &str1->asLinear(),
+                            &str2->asLinear(), &result)) {
+#ifdef DEBUG
+      RootedValue icuResult(cx);
+      if (!intl_CompareStrings(cx, coll, str1, str2, &icuResult)) {
+        return false;
+      }
+      MOZ_ASSERT(result == icuResult.toInt32());
+#endif
+
+      args.rval().setInt32(result);
+      return true;
+    }
+  }
+
+  // Use the UCollator to actually compare the strings.
   return intl_CompareStrings(cx, coll, str1, str2, args.rval());
 }
 
@@ -28,7 +28,8 @@ class CollatorObject : public NativeObject {
 
   static constexpr uint32_t INTERNALS_SLOT = 0;
   static constexpr uint32_t INTL_COLLATOR_SLOT = 1;
-  static constexpr uint32_t SLOT_COUNT = 2;
+  static constexpr uint32_t ASCII_COMPARISON_SLOT = 2;
+  static constexpr uint32_t SLOT_COUNT = 3;
 
   static_assert(INTERNALS_SLOT == INTL_INTERNALS_OBJECT_SLOT,
                 "INTERNALS_SLOT must match self-hosting define for internals "
@@ -49,6 +50,35 @@ class CollatorObject : public NativeObject {
     setFixedSlot(INTL_COLLATOR_SLOT, PrivateValue(collator));
   }
 
+  // How strings which only contain printable ASCII characters can be compared
+  // without calling into ICU. Only valid after the collator was created.
+  enum class AsciiComparison : int32_t {
+    // The locale or the options change the order of ASCII characters.
+    Unsupported,
+
+    // Only compare the primary weights, i.e. ignore case differences.
+    Primary,
+
+    // Compare the primary weights, then lower case before upper case.
+    LowerFirst,
+
+    // Compare the primary weights, then upper case before lower case.
+    UpperFirst,
+  };
+
+  AsciiComparison getAsciiComparison() const {
+    const auto& slot = getFixedSlot(ASCII_COMPARISON_SLOT);
+    if (slot.isUndefined()) {
+      return AsciiComparison::Unsupported;
+    }
+    return static_cast<AsciiComparison>(slot.toInt32());
+  }
+
+  void setAsciiComparison(AsciiComparison comparison) {
+    setFixedSlot(ASCII_COMPARISON_SLOT,
+                 Int32Value(static_cast<int32_t>(comparison)));
+  }
+
  private:
   static const JSClassOps classOps_;
   static const ClassSpec classSpec_;
@@ -6,7 +6,8 @@
 
 #include "frontend/ParserAtom.h"
 
-#include "mozilla/TextUtils.h"  // mozilla::IsAscii
+#include "mozilla/CheckedInt.h"  // mozilla::CheckedUint32
+#include "mozilla/TextUtils.h"   // mozilla::IsAscii
 
 #include <memory>  // std::uninitialized_fill_n
 
@@ -14,6 +15,7 @@
 
 #include "frontend/BytecodeCompiler.h"  // IsIdentifier
 #include "frontend/CompilationStencil.h"
+#include "gc/Zone.h"  // JS::Zone::atomCache
 #include "util/StringBuffer.h"  // StringBuffer
 #include "util/Text.h"          // AsciiDigitToNumber
 #include "util/Unicode.h"
@@ -1148,11 +1150,45 @@ bool ParserAtomsTable::appendTo(StringBuffer& buffer,
   return buffer.append(content, 3);
 }
 
+// Every atom instantiated below is added to the zone's atom cache. When
+// instantiating a large stencil, e.g. the result of an off-thread parse of a
+// big script or module, reserve space for them up front so that the cache is
+// not rehashed repeatedly as it grows. This is only an optimization, so
+// failure is ignored.
+static void ReserveZoneAtomCache(JSContext* cx, const ParserAtomSpan& entries,
+                                 CompilationAtomCache& atomCache) {
+  static constexpr size_t MinAtomsToReserve = 256;
+  if (entries.size() < MinAtomsToReserve) {
+    return;
+  }
+
+  size_t count = 0;
+  for (size_t i = 0; i < entries.size(); i++) {
+    const auto& entry = entries[i];
+    if (entry && entry->isUsedByStencil() && entry->isInstantiatedAsJSAtom() &&
+        !atomCache.hasAtomAt(ParserAtomIndex(i))) {
+      count++;
+    }
+  }
+  if (count < MinAtomsToReserve) {
+    return;
+  }
+
+  AtomSet& zoneCache = cx->zone()->atomCache();
+  mozilla::CheckedUint32 capacity(zoneCache.count());
+  capacity += count;
+  if (capacity.isValid()) {
+    (void)zoneCache.reserve(capacity.value());
+  }
+}
+
 bool InstantiateMarkedAtoms(JSContext* cx, ErrorContext* ec,
                             const ParserAtomSpan& entries,
                             CompilationAtomCache& atomCache) {
   MOZ_ASSERT(cx->zone());
 
+  ReserveZoneAtomCache(cx, entries, atomCache);
+
   for (size_t i = 0; i < entries.size(); i++) {
     const auto& entry = entries[i];
     if (!entry) {
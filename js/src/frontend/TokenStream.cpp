@@ -14,6 +14,7 @@
 #include "mozilla/Maybe.h"
 #include "mozilla/MemoryChecking.h"
 #include "mozilla/ScopeExit.h"
+#include "mozilla/SIMD.h"
 #include "mozilla/Span.h"
 #include "mozilla/TemplateLib.h"
 #include "mozilla/TextUtils.h"
@@ -2204,6 +2205,12 @@ bool TokenStreamSpecific<Unit, AnyCharsAccess>::putIdentInCharBuffer(
   return true;
 }
 
+template <typename Unit>
+static MOZ_ALWAYS_INLINE bool IsAsciiIdentifierPart(Unit unit) {
+  auto value = CodeUnitValue(unit);
+  return value < 128 && unicode::IsIdentifierPartASCII(char(value));
+}
+
 template <typename Unit, class AnyCharsAccess>
 [[nodiscard]] bool TokenStreamSpecific<Unit, AnyCharsAccess>::identifierName(
     TokenStart start, const Unit* identStart, IdentifierEscapes escaping,
@@ -2217,6 +2224,17 @@ template <typename Unit, class AnyCharsAccess>
   // code points in the loop below.
   int32_t unit;
   while (true) {
+    // Consume runs of ASCII IdentifierPart code units directly, rather than
+    // peeking and consuming each of them.
+    const Unit* run = this->sourceUnits.addressOfNextCodeUnit();
+    const Unit* runEnd = run;
+    const Unit* limit = this->sourceUnits.limit();
+    while (runEnd < limit && IsAsciiIdentifierPart(*runEnd)) {
+      runEnd++;
+    }
+    this->sourceUnits.skipCodeUnits(
+        AssertedCast<uint32_t>(PointerRangeSize(run, runEnd)));
+
     unit = peekCodeUnit();
     if (unit == EOF) {
       break;
@@ -2376,9 +2394,39 @@ static const uint8_t firstCharKinds[] = {
 static_assert(LastCharKind < (1 << (sizeof(firstCharKinds[0]) * 8)),
               "Elements of firstCharKinds[] are too small");
 
+static const char16_t* FindNonPrintableAsciiOr(const char16_t* cur,
+                                               const char16_t* limit, char c1,
+                                               char c2, char c3) {
+  const char16_t* result = mozilla::SIMD::memchr3OrOutside16(
+      cur, c1, c2, c3, 0x20, 0x7F, PointerRangeSize(cur, limit));
+  return result ? result : limit;
+}
+
+static const Utf8Unit* FindNonPrintableAsciiOr(const Utf8Unit* cur,
+                                               const Utf8Unit* limit, char c1,
+                                               char c2, char c3) {
+  const char* result = mozilla::SIMD::memchr3OrOutside8(
+      reinterpret_cast<const char*>(cur), c1, c2, c3, 0x20, 0x7F,
+      PointerRangeSize(cur, limit));
+  return result ? reinterpret_cast<const Utf8Unit*>(result) : limit;
+}
+
+template <typename Unit>
+void SourceUnits<Unit>::consumePrintableAsciiExcept(char c1, char c2,
+                                                    char c3) {
+  MOZ_ASSERT(!isPoisoned(), "shouldn't use poisoned SourceUnits");
+  ptr = FindNonPrintableAsciiOr(ptr, limit_, c1, c2, c3);
+}
+
 template <>
 void SourceUnits<char16_t>::consumeRestOfSingleLineComment() {
   while (MOZ_LIKELY(!atEnd())) {
+    // Skip runs of printable ASCII, which contain no LineTerminators.
+    consumePrintableAsciiExcept('\n', '\n', '\n');
+    if (atEnd()) {
+      return;
+    }
+
     char16_t unit = peekCodeUnit();
     if (IsLineTerminator(unit)) {
       return;
@@ -2391,6 +2439,11 @@ void SourceUnits<char16_t>::consumeRestOfSingleLineComment() {
 template <>
 void SourceUnits<Utf8Unit>::consumeRestOfSingleLineComment() {
   while (MOZ_LIKELY(!atEnd())) {
+    consumePrintableAsciiExcept('\n', '\n', '\n');
+    if (atEnd()) {
+      return;
+    }
+
     const Utf8Unit unit = peekCodeUnit();
     if (IsSingleUnitLineTerminator(unit)) {
       return;
@@ -3257,6 +3310,10 @@ template <typename Unit, class AnyCharsAccess>
           unsigned linenoBefore = anyChars.lineno;
 
           do {
+            // Skip runs of printable ASCII that can't end the comment or
+            // start a directive.
+            this->sourceUnits.consumePrintableAsciiExcept('*', '@', '#');
+
             int32_t unit = getCodeUnit();
             if (unit == EOF) {
               error(JSMSG_UNTERMINATED_COMMENT);
@@ -3343,6 +3400,23 @@ template <typename Unit, class AnyCharsAccess>
   } while (true);
 }
 
+// Append the printable ASCII code units in [cur, end) to |charBuffer|.
+template <typename Unit>
+[[nodiscard]] static bool AppendPrintableAsciiToCharBuffer(
+    CharBuffer& charBuffer, const Unit* cur, const Unit* end) {
+  size_t length = PointerRangeSize(cur, end);
+  if (!charBuffer.growByUninitialized(length)) {
+    return false;
+  }
+
+  char16_t* dest = charBuffer.end() - length;
+  for (; cur < end; cur++) {
+    MOZ_ASSERT(CodeUnitValue(*cur) >= 0x20 && CodeUnitValue(*cur) < 0x7F);
+    *dest++ = char16_t(CodeUnitValue(*cur));
+  }
+  return true;
+}
+
 template <typename Unit, class AnyCharsAccess>
 bool TokenStreamSpecific<Unit, AnyCharsAccess>::getStringOrTemplateToken(
     char untilChar, Modifier modifier, TokenKind* out) {
@@ -3375,11 +3449,50 @@ bool TokenStreamSpecific<Unit, AnyCharsAccess>::getStringOrTemplateToken(
     return;
   };
 
+  // Printable ASCII other than the closing delimiter, '\\' and (in templates)
+  // '$' stands for itself.  Literals consisting only of such code units are
+  // very common, and their atom can be created directly from sourceUnits.
+  char specialUnit = parsingTemplate ? '$' : untilChar;
+  const Unit* run = this->sourceUnits.addressOfNextCodeUnit();
+  this->sourceUnits.consumePrintableAsciiExcept(untilChar, '\\', specialUnit);
+  const Unit* runEnd = this->sourceUnits.addressOfNextCodeUnit();
+  if (matchCodeUnit(untilChar)) {
+    TaggedParserAtomIndex atom = atomizeSourceChars(Span(run, runEnd));
+    if (!atom) {
+      return false;
+    }
+
+    noteBadToken.release();
+
+    TokenKind kind =
+        !parsingTemplate ? TokenKind::String : TokenKind::NoSubsTemplate;
+    newAtomToken(kind, atom, start, modifier, out);
+    return true;
+  }
+
+  if (!AppendPrintableAsciiToCharBuffer(this->charBuffer, run, runEnd)) {
+    return false;
+  }
+
   // We need to detect any of these chars:  " or ', \n (or its
   // equivalents), \\, EOF.  Because we detect EOL sequences here and
   // put them back immediately, we can use getCodeUnit().
   int32_t unit;
-  while ((unit = getCodeUnit()) != untilChar) {
+  while (true) {
+    // Copy runs of printable ASCII which stand for themselves in bulk.
+    run = this->sourceUnits.addressOfNextCodeUnit();
+    this->sourceUnits.consumePrintableAsciiExcept(untilChar, '\\',
+                                                  specialUnit);
+    runEnd = this->sourceUnits.addressOfNextCodeUnit();
+    if (!AppendPrintableAsciiToCharBuffer(this->charBuffer, run, runEnd)) {
+      return false;
+    }
+
+    unit = getCodeUnit();
+    if (unit == untilChar) {
+      break;
+    }
+
     if (unit == EOF) {
       ReportPrematureEndOfLiteral(JSMSG_EOF_BEFORE_END_OF_LITERAL);
       return false;
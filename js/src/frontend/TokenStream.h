@@ -1447,6 +1447,16 @@ class SourceUnits {
    */
   void consumeRestOfSingleLineComment();
 
+  /**
+   * Consume code units up to (but not including) the first one that is |c1|,
+   * |c2| or |c3|, or that isn't printable ASCII, or up to the end of the
+   * source text.
+   *
+   * Printable ASCII contains no LineTerminators and no encoding errors, so
+   * such runs can be consumed without updating line-status or validating.
+   */
+  void consumePrintableAsciiExcept(char c1, char c2, char c3);
+
   /**
    * The maximum radius of code around the location of an error that should
    * be included in a syntax error message -- this many code units to either
@@ -539,6 +539,19 @@ TenuredCell* ArenaLists::refillFreeListAndAllocate(
     return freeLists().setArenaAndAllocate(arena, thingKind);
   }
 
+  // Use an arena allocated by a previous refill if there is one. These have
+  // already been accounted for in the heap size.
+  if (Arena* spare = spareArenas.ref()[thingKind]) {
+    MOZ_ASSERT(spare->isEmpty());
+    spareArenas.ref()[thingKind] = spare->next;
+
+    ArenaList& al = arenaList(thingKind);
+    MOZ_ASSERT(al.isCursorAtEnd());
+    al.insertBeforeCursor(spare);
+
+    return freeLists().setArenaAndAllocate(spare, thingKind);
+  }
+
   // Parallel threads have their own ArenaLists, but chunks are shared;
   // if we haven't already, take the GC lock now to avoid racing.
   if (maybeLock.isNothing()) {
@@ -562,9 +575,40 @@ TenuredCell* ArenaLists::refillFreeListAndAllocate(
   MOZ_ASSERT(al.isCursorAtEnd());
   al.insertBeforeCursor(arena);
 
+  // If this kind keeps needing new arenas, allocate a few more while we hold
+  // the lock so that the next refills can be satisfied without it.
+  newArenaCounts.ref()[thingKind]++;
+  if (checkThresholds == ShouldCheckThresholds::CheckThresholds &&
+      newArenaCounts.ref()[thingKind] >= SpareArenaAllocThreshold) {
+    allocateSpareArenas(thingKind, maybeLock.ref());
+  }
+
   return freeLists().setArenaAndAllocate(arena, thingKind);
 }
 
+void ArenaLists::allocateSpareArenas(AllocKind thingKind,
+                                     AutoLockGCBgAlloc& lock) {
+  MOZ_ASSERT(!spareArenas.ref()[thingKind]);
+
+  JSRuntime* rt = runtimeFromAnyThread();
+  for (size_t i = 0; i < SpareArenaCount; i++) {
+    TenuredChunk* chunk = rt->gc.pickChunk(lock);
+    if (!chunk) {
+      return;
+    }
+
+    Arena* arena =
+        rt->gc.allocateArena(chunk, zone_, thingKind,
+                             ShouldCheckThresholds::CheckThresholds, lock);
+    if (!arena) {
+      return;
+    }
+
+    arena->next = spareArenas.ref()[thingKind];
+    spareArenas.ref()[thingKind] = arena;
+  }
+}
+
 inline TenuredCell* FreeLists::setArenaAndAllocate(Arena* arena,
                                                    AllocKind kind) {
 #ifdef DEBUG
@@ -30,6 +30,8 @@ struct Statistics;
 namespace gc {
 
 class Arena;
+class AutoLockGC;
+class AutoLockGCBgAlloc;
 class BackgroundUnmarkTask;
 struct FinalizePhase;
 class FreeSpan;
@@ -292,6 +294,22 @@ class ArenaLists {
   // released at the end of sweeping every sweep group.
   ZoneOrGCTaskData<Arena*> savedEmptyArenas;
 
+  // Empty arenas allocated in advance for alloc kinds that are allocating
+  // heavily, linked through Arena::next. Refilling a free list from one of
+  // these doesn't need to take the GC lock. They are not in any arena list and
+  // are released at the start of every GC that collects this zone.
+  ZoneData<AllAllocKindArray<Arena*>> spareArenas;
+
+  // The number of arenas allocated from chunks for each kind since the spare
+  // arenas were last released.
+  ZoneData<AllAllocKindArray<uint32_t>> newArenaCounts;
+
+  // Once a kind has had this many arenas allocated for it since the spare
+  // arenas were last released, allocate SpareArenaCount extra arenas each time
+  // its free list needs a new arena.
+  static constexpr uint32_t SpareArenaAllocThreshold = 4;
+  static constexpr size_t SpareArenaCount = 3;
+
  public:
   explicit ArenaLists(JS::Zone* zone);
   ~ArenaLists();
@@ -343,6 +361,8 @@ class ArenaLists {
   void moveArenasToCollectingLists();
   void mergeArenasFromCollectingLists();
 
+  void releaseSpareArenas(const AutoLockGC& lock);
+
   void checkGCStateNotInUse();
   void checkSweepStateNotInUse();
   void checkNoArenasToUpdate();
@@ -373,6 +393,7 @@ class ArenaLists {
 
   TenuredCell* refillFreeListAndAllocate(AllocKind thingKind,
                                          ShouldCheckThresholds checkThresholds);
+  void allocateSpareArenas(AllocKind thingKind, AutoLockGCBgAlloc& lock);
 
   friend class BackgroundUnmarkTask;
   friend class GCRuntime;
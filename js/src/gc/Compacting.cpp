@@ -35,6 +35,8 @@ using namespace js;
 using namespace js::gc;
 
 using mozilla::Maybe;
+using mozilla::TimeDuration;
+using mozilla::TimeStamp;
 
 bool GCRuntime::canRelocateZone(Zone* zone) const {
   return !zone->isAtomsZone();
@@ -79,8 +81,15 @@ IncrementalProgress GCRuntime::compactPhase(JS::GCReason reason,
 
   ZoneList relocatedZones;
   Arena* relocatedArenas = nullptr;
+  size_t relocatedBytes = 0;
+  TimeStamp startTime = TimeStamp::Now();
   while (!zonesToMaybeCompact.ref().isEmpty()) {
     Zone* zone = zonesToMaybeCompact.ref().front();
+    if (shouldYieldBeforeCompactingZone(zone, sliceBudget,
+                                        !relocatedZones.isEmpty())) {
+      break;
+    }
+
     zonesToMaybeCompact.ref().removeFront();
 
     MOZ_ASSERT(nursery().isEmpty());
@@ -89,6 +98,7 @@ IncrementalProgress GCRuntime::compactPhase(JS::GCReason reason,
     if (relocateArenas(zone, reason, relocatedArenas, sliceBudget)) {
       updateZonePointersToRelocatedCells(zone);
       relocatedZones.append(zone);
+      relocatedBytes += zone->gcHeapSize.bytes();
       zonesCompacted++;
     } else {
       zone->changeGCState(Zone::Compact, Zone::Finished);
@@ -102,6 +112,11 @@ IncrementalProgress GCRuntime::compactPhase(JS::GCReason reason,
   if (!relocatedZones.isEmpty()) {
     updateRuntimePointersToRelocatedCells(session);
 
+    double elapsedMS = (TimeStamp::Now() - startTime).ToMilliseconds();
+    if (elapsedMS > 0.0) {
+      compactingBytesPerMS = double(relocatedBytes) / elapsedMS;
+    }
+
     do {
       Zone* zone = relocatedZones.front();
       relocatedZones.removeFront();
@@ -129,6 +144,26 @@ IncrementalProgress GCRuntime::compactPhase(JS::GCReason reason,
 
 void GCRuntime::endCompactPhase() { startedCompacting = false; }
 
+bool GCRuntime::shouldYieldBeforeCompactingZone(Zone* zone,
+                                                const SliceBudget& sliceBudget,
+                                                bool compactedAnyZone) const {
+  // Compacting a zone can't be split across slices: once its arenas have been
+  // relocated, every pointer into the zone has to be updated before the
+  // mutator runs again. Estimate how long the next zone will take from the
+  // rate we achieved previously and leave it for the next slice if we expect
+  // to overrun the deadline. We always compact at least one zone per slice so
+  // that we make progress.
+  if (!compactedAnyZone || !sliceBudget.isTimeBudget() ||
+      compactingBytesPerMS == 0.0) {
+    return false;
+  }
+
+  double estimatedMS = double(zone->gcHeapSize.bytes()) / compactingBytesPerMS;
+  TimeStamp estimatedEnd =
+      TimeStamp::Now() + TimeDuration::FromMilliseconds(estimatedMS);
+  return estimatedEnd > sliceBudget.deadline();
+}
+
 static bool ShouldRelocateAllArenas(JS::GCReason reason) {
   return reason == JS::GCReason::DEBUG_GC;
 }
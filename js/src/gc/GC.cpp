@@ -419,6 +419,7 @@ GCRuntime::GCRuntime(JSRuntime* rt)
 #ifdef DEBUG
       hadShutdownGC(false),
 #endif
+      backgroundSweepThreadCount(1),
       requestSliceAfterBackgroundTask(false),
       lifoBlocksToFree((size_t)JSContext::TEMP_LIFO_ALLOC_PRIMARY_CHUNK_SIZE),
       lifoBlocksToFreeAfterMinorGC(
@@ -431,6 +432,7 @@ GCRuntime::GCRuntime(JSRuntime* rt)
       sweepMarkResult(IncrementalProgress::NotFinished),
       startedCompacting(false),
       zonesCompacted(0),
+      compactingBytesPerMS(0.0),
 #ifdef DEBUG
       relocatedArenasToRelease(nullptr),
 #endif
@@ -440,6 +442,8 @@ GCRuntime::GCRuntime(JSRuntime* rt)
       defaultTimeBudgetMS_(TuningDefaults::DefaultTimeBudgetMS),
       incrementalAllowed(true),
       compactingEnabled(TuningDefaults::CompactingEnabled),
+      parallelMinorGCSweepingEnabled(
+          TuningDefaults::ParallelMinorGCSweepingEnabled),
       rootsRemoved(false),
 #ifdef JS_GC_ZEAL
       zealModeBits(0),
@@ -1024,6 +1028,9 @@ bool GCRuntime::setParameter(JSGCParamKey key, uint32_t value,
     case JSGC_INCREMENTAL_WEAKMAP_ENABLED:
       marker.incrementalWeakMapMarkingEnabled = value != 0;
       break;
+    case JSGC_PARALLEL_MINOR_GC_SWEEPING_ENABLED:
+      parallelMinorGCSweepingEnabled = value != 0;
+      break;
     case JSGC_HELPER_THREAD_RATIO:
       if (rt->parentRuntime) {
         // Don't allow this to be set for worker runtimes.
@@ -1090,6 +1097,10 @@ void GCRuntime::resetParameter(JSGCParamKey key, AutoLockGC& lock) {
       marker.incrementalWeakMapMarkingEnabled =
           TuningDefaults::IncrementalWeakMapMarkingEnabled;
       break;
+    case JSGC_PARALLEL_MINOR_GC_SWEEPING_ENABLED:
+      parallelMinorGCSweepingEnabled =
+          TuningDefaults::ParallelMinorGCSweepingEnabled;
+      break;
     case JSGC_HELPER_THREAD_RATIO:
       if (rt->parentRuntime) {
         return;
@@ -1173,6 +1184,8 @@ uint32_t GCRuntime::getParameter(JSGCParamKey key, const AutoLockGC& lock) {
       return uint32_t(tunables.balancedHeapLimitsEnabled());
     case JSGC_HEAP_GROWTH_FACTOR:
       return uint32_t(tunables.heapGrowthFactor());
+    case JSGC_TARGET_GC_OVERHEAD_PERCENT:
+      return tunables.targetGCOverheadPercent();
     case JSGC_ALLOCATION_THRESHOLD:
       return tunables.gcZoneAllocThresholdBase() / 1024 / 1024;
     case JSGC_SMALL_HEAP_INCREMENTAL_LIMIT:
@@ -1187,6 +1200,8 @@ uint32_t GCRuntime::getParameter(JSGCParamKey key, const AutoLockGC& lock) {
       return compactingEnabled;
     case JSGC_INCREMENTAL_WEAKMAP_ENABLED:
       return marker.incrementalWeakMapMarkingEnabled;
+    case JSGC_PARALLEL_MINOR_GC_SWEEPING_ENABLED:
+      return parallelMinorGCSweepingEnabled;
     case JSGC_NURSERY_FREE_THRESHOLD_FOR_IDLE_COLLECTION:
       return tunables.nurseryFreeThresholdForIdleCollection();
     case JSGC_NURSERY_FREE_THRESHOLD_FOR_IDLE_COLLECTION_PERCENT:
@@ -2555,6 +2570,15 @@ void BackgroundUnmarkTask::run(AutoLockHelperThreadState& helperTheadLock) {
 void GCRuntime::endPreparePhase(JS::GCReason reason) {
   MOZ_ASSERT(unmarkTask.isIdle());
 
+  {
+    // Spare arenas are empty and not in any arena list, so release them now
+    // rather than letting them survive the collection.
+    AutoLockGC lock(this);
+    for (GCZonesIter zone(this); !zone.done(); zone.next()) {
+      zone->arenas.releaseSpareArenas(lock);
+    }
+  }
+
   for (GCZonesIter zone(this); !zone.done(); zone.next()) {
     /*
      * In an incremental GC, clear the area free lists to ensure that subsequent
@@ -2926,6 +2950,9 @@ void GCRuntime::updateSchedulingStateAfterCollection(TimeStamp currentTime) {
   TimeDuration totalGCTime = stats().totalGCTime();
   size_t totalInitialBytes = stats().initialCollectedBytes();
 
+  schedulingState.updateGCOverhead(totalGCTime, currentTime - lastGCEndTime_,
+                                   tunables);
+
   for (GCZonesIter zone(this); !zone.done(); zone.next()) {
     if (tunables.balancedHeapLimitsEnabled() && totalInitialBytes != 0) {
       zone->updateCollectionRate(totalGCTime, totalInitialBytes);
@@ -82,7 +82,10 @@ class TenuredChunk;
   _("helperThreadRatio", JSGC_HELPER_THREAD_RATIO, true)                   \
   _("maxHelperThreads", JSGC_MAX_HELPER_THREADS, true)                     \
   _("helperThreadCount", JSGC_HELPER_THREAD_COUNT, false)                  \
-  _("systemPageSizeKB", JSGC_SYSTEM_PAGE_SIZE_KB, false)
+  _("systemPageSizeKB", JSGC_SYSTEM_PAGE_SIZE_KB, false)                   \
+  _("parallelMinorGCSweepingEnabled",                                      \
+    JSGC_PARALLEL_MINOR_GC_SWEEPING_ENABLED, true)                         \
+  _("targetGCOverheadPercent", JSGC_TARGET_GC_OVERHEAD_PERCENT, true)
 
 // Get the key and writability give a GC parameter name.
 extern bool GetGCParameterInfo(const char* name, JSGCParamKey* keyOut,
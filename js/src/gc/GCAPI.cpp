@@ -411,6 +411,15 @@ JS_PUBLIC_API JS::GCSliceCallback JS::SetGCSliceCallback(
   return cx->runtime()->gc.setSliceCallback(callback);
 }
 
+JS_PUBLIC_API void JS::SetGCSliceRecordCallback(
+    JSContext* cx, GCSliceRecordCallback callback, void* data) {
+  cx->runtime()->gc.stats().setSliceRecordCallback(callback, data);
+}
+
+JS_PUBLIC_API void JS::FlushGCSliceRecords(JSContext* cx) {
+  cx->runtime()->gc.stats().flushSliceRecords();
+}
+
 JS_PUBLIC_API JS::DoCycleCollectionCallback JS::SetDoCycleCollectionCallback(
     JSContext* cx, JS::DoCycleCollectionCallback callback) {
   return cx->runtime()->gc.setDoCycleCollectionCallback(callback);
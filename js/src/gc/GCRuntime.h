@@ -47,6 +47,7 @@ class AutoCallGCCallbacks;
 class AutoGCSession;
 class AutoHeapSession;
 class AutoTraceSession;
+class BackgroundFinalizeTask;
 struct FinalizePhase;
 class MarkingValidator;
 struct MovingTracer;
@@ -465,6 +466,9 @@ class GCRuntime {
   bool hasForegroundWork() const;
 
   bool isCompactingGCEnabled() const;
+  bool isParallelMinorGCSweepingEnabled() const {
+    return parallelMinorGCSweepingEnabled;
+  }
 
   bool isShrinkingGC() const { return gcOptions() == JS::GCOptions::Shrink; }
 
@@ -845,7 +849,10 @@ class GCRuntime {
   void sweepFromBackgroundThread(AutoLockHelperThreadState& lock);
   void startBackgroundFree();
   void freeFromBackgroundThread(AutoLockHelperThreadState& lock);
-  void sweepBackgroundThings(ZoneList& zones);
+  void sweepBackgroundThings(ZoneList& zones, size_t threadCount);
+  void backgroundFinalizePhase(JS::GCContext* gcx, Zone* zone,
+                               const FinalizePhase& phase, size_t threadCount,
+                               Arena** empty);
   void backgroundFinalize(JS::GCContext* gcx, Zone* zone, AllocKind kind,
                           Arena** empty);
   void assertBackgroundSweepingFinished();
@@ -865,6 +872,9 @@ class GCRuntime {
                                    SliceBudget& sliceBudget,
                                    AutoGCSession& session);
   void endCompactPhase();
+  bool shouldYieldBeforeCompactingZone(Zone* zone,
+                                       const SliceBudget& sliceBudget,
+                                       bool compactedAnyZone) const;
   void sweepZoneAfterCompacting(MovingTracer* trc, Zone* zone);
   bool canRelocateZone(Zone* zone) const;
   [[nodiscard]] bool relocateArenas(Zone* zone, JS::GCReason reason,
@@ -1118,6 +1128,12 @@ class GCRuntime {
   /* Singly linked list of zones to be swept in the background. */
   HelperThreadLockData<ZoneList> backgroundSweepZones;
 
+  /*
+   * The number of threads, including the sweep task's own, that may finalize
+   * alloc kinds in parallel during background sweeping.
+   */
+  HelperThreadLockData<size_t> backgroundSweepThreadCount;
+
   /*
    * Whether to trigger a GC slice after a background task is complete, so that
    * the collector can continue or finsish collecting. This is only used for the
@@ -1168,6 +1184,11 @@ class GCRuntime {
   MainThreadData<bool> startedCompacting;
   MainThreadData<ZoneList> zonesToMaybeCompact;
   MainThreadData<size_t> zonesCompacted;
+
+  // The rate at which zones were compacted in the last slice that compacted
+  // any, in bytes of zone GC heap per millisecond. Used to avoid starting to
+  // compact a zone that is not expected to finish before the slice deadline.
+  MainThreadData<double> compactingBytesPerMS;
 #ifdef DEBUG
   GCLockData<Arena*> relocatedArenasToRelease;
 #endif
@@ -1198,6 +1219,13 @@ class GCRuntime {
    */
   MainThreadData<bool> compactingEnabled;
 
+  /*
+   * Whether zones can be swept on helper threads at the end of a minor GC.
+   *
+   * JSGC_PARALLEL_MINOR_GC_SWEEPING_ENABLED
+   */
+  MainThreadData<bool> parallelMinorGCSweepingEnabled;
+
   MainThreadData<bool> rootsRemoved;
 
   /*
@@ -1277,6 +1305,7 @@ class GCRuntime {
   js::Mutex lock MOZ_UNANNOTATED;
 
   friend class BackgroundSweepTask;
+  friend class BackgroundFinalizeTask;
   friend class BackgroundFreeTask;
 
   BackgroundAllocTask allocTask;
@@ -101,7 +101,8 @@ PhaseKindGraphRoots = [
                     addPhaseKind("MARK_RUNTIME_DATA", "Mark Runtime-wide Data", 52),
                     addPhaseKind("MARK_EMBEDDING", "Mark Embedding", 53),
                 ],
-            )
+            ),
+            addPhaseKind("JOIN_PARALLEL_TASKS", "Join Parallel Tasks", 67),
         ],
     ),
     addPhaseKind("WAIT_BACKGROUND_THREAD", "Wait Background Thread", 2),
@@ -118,7 +119,7 @@ PhaseKindGraphRoots = [
             addPhaseKind("PURGE", "Purge", 5),
             addPhaseKind("PURGE_PROP_MAP_TABLES", "Purge PropMapTables", 60),
             addPhaseKind("PURGE_SOURCE_URLS", "Purge Source URLs", 73),
-            addPhaseKind("JOIN_PARALLEL_TASKS", "Join Parallel Tasks", 67),
+            getPhaseKind("JOIN_PARALLEL_TASKS"),
         ],
     ),
     addPhaseKind(
@@ -230,6 +231,7 @@ PhaseKindGraphRoots = [
         45,
         [
             getPhaseKind("MARK_ROOTS"),
+            getPhaseKind("JOIN_PARALLEL_TASKS"),
         ],
     ),
     addPhaseKind(
@@ -238,6 +240,7 @@ PhaseKindGraphRoots = [
         46,
         [
             getPhaseKind("MARK_ROOTS"),
+            getPhaseKind("JOIN_PARALLEL_TASKS"),
         ],
     ),
     addPhaseKind(
@@ -20,6 +20,7 @@
 
 #include "gc/Heap-inl.h"
 
+#include "gc/GCInternals.h"
 #include "gc/GCLock.h"
 #include "gc/Memory.h"
 #include "jit/Assembler.h"
@@ -200,9 +201,13 @@ ArenaLists::ArenaLists(Zone* zone)
       incrementalSweptArenas(zone),
       gcCompactPropMapArenasToUpdate(zone, nullptr),
       gcNormalPropMapArenasToUpdate(zone, nullptr),
-      savedEmptyArenas(zone, nullptr) {
+      savedEmptyArenas(zone, nullptr),
+      spareArenas(zone),
+      newArenaCounts(zone) {
   for (auto i : AllAllocKinds()) {
     concurrentUse(i) = ConcurrentUse::None;
+    spareArenas.ref()[i] = nullptr;
+    newArenaCounts.ref()[i] = 0;
   }
 }
 
@@ -234,6 +239,18 @@ ArenaLists::~ArenaLists() {
   ReleaseArenaList(runtime(), incrementalSweptArenas.ref(), lock);
 
   ReleaseArenas(runtime(), savedEmptyArenas, lock);
+
+  releaseSpareArenas(lock);
+}
+
+void ArenaLists::releaseSpareArenas(const AutoLockGC& lock) {
+  AutoSetThreadIsFinalizing setThreadUse;
+
+  for (auto i : AllAllocKinds()) {
+    ReleaseArenas(runtime(), spareArenas.ref()[i], lock);
+    spareArenas.ref()[i] = nullptr;
+    newArenaCounts.ref()[i] = 0;
+  }
 }
 
 void ArenaLists::moveArenasToCollectingLists() {
@@ -22,6 +22,7 @@
 #include "gc/GCLock.h"
 #include "gc/GCProbes.h"
 #include "gc/Memory.h"
+#include "gc/ParallelWork.h"
 #include "gc/PublicIterators.h"
 #include "gc/Tenuring.h"
 #include "jit/JitFrames.h"
@@ -825,6 +826,11 @@ inline double js::Nursery::calcPromotionRate(bool* validForTenuring) const {
   return tenured / used;
 }
 
+double js::Nursery::lastPromotionRate() const {
+  bool validForTenuring;
+  return calcPromotionRate(&validForTenuring);
+}
+
 void js::Nursery::renderProfileJSON(JSONPrinter& json) const {
   if (!isEnabled()) {
     json.beginObject();
@@ -1122,6 +1128,7 @@ void js::Nursery::collect(JS::GCOptions options, JS::GCReason reason) {
     previousGC.reason = reason;
     previousGC.tenuredBytes = result.tenuredBytes;
     previousGC.tenuredCells = result.tenuredCells;
+    stats().addTenuredBytes(result.tenuredBytes);
     previousGC.nurseryUsedChunkCount = currentChunk_ + 1;
   }
 
@@ -1479,13 +1486,58 @@ void js::Nursery::sweep() {
   }
   cellsWithUid_.clear();
 
-  for (ZonesIter zone(runtime(), SkipAtoms); !zone.done(); zone.next()) {
-    zone->sweepAfterMinorGC(&trc);
-  }
+  sweepZones(&trc);
 
   sweepMapAndSetObjects();
+}
+
+static size_t SweepZoneAfterMinorGC(GCRuntime* gc, Zone* const& zone) {
+  AutoSetThreadIsSweeping threadIsSweeping(zone);
+  MinorSweepingTracer trc(gc->rt);
+  zone->sweepAfterMinorGC(&trc);
+  return 1;
+}
+
+void js::Nursery::sweepZones(MinorSweepingTracer* trc) {
+  // Each zone's tables only refer to cells in that zone or to forwarded
+  // nursery cells, whose forwarding pointers are not modified during sweeping,
+  // so zones can be swept independently. When there are several zones, sweep
+  // them on helper threads while the main thread sweeps the runtime caches.
+  if (!shouldSweepZonesInParallel()) {
+    for (ZonesIter zone(runtime(), SkipAtoms); !zone.done(); zone.next()) {
+      zone->sweepAfterMinorGC(trc);
+    }
+    runtime()->caches().sweepAfterMinorGC(trc);
+    return;
+  }
+
+  ZonesIter work(runtime(), SkipAtoms);
 
-  runtime()->caches().sweepAfterMinorGC(&trc);
+  AutoLockHelperThreadState lock;
+  AutoRunParallelWork sweepWork(gc, SweepZoneAfterMinorGC,
+                                gcstats::PhaseKind::NONE, GCUse::Sweeping,
+                                work, SliceBudget::unlimited(), lock);
+
+  AutoUnlockHelperThreadState unlock(lock);
+  runtime()->caches().sweepAfterMinorGC(trc);
+}
+
+bool js::Nursery::shouldSweepZonesInParallel() const {
+  if (!gc->isParallelMinorGCSweepingEnabled() ||
+      gc->parallelWorkerCount() == 0) {
+    return false;
+  }
+
+  // Starting helper tasks is not free, so only do this if there is more than
+  // one zone to sweep.
+  size_t zoneCount = 0;
+  for (ZonesIter zone(runtime(), SkipAtoms); !zone.done(); zone.next()) {
+    if (++zoneCount > 1) {
+      return true;
+    }
+  }
+
+  return false;
 }
 
 void js::Nursery::clear() {
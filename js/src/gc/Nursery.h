@@ -69,6 +69,7 @@ class AutoTraceSession;
 struct Cell;
 class GCSchedulingTunables;
 class MinorCollectionTracer;
+struct MinorSweepingTracer;
 class RelocationOverlay;
 class StringRelocationOverlay;
 enum class AllocKind : uint8_t;
@@ -290,6 +291,10 @@ class Nursery {
   size_t capacity() const { return capacity_; }
   size_t committed() const { return spaceToEnd(allocatedChunkCount()); }
 
+  // The fraction of used nursery space promoted by the most recent minor GC,
+  // or zero if there hasn't been one.
+  double lastPromotionRate() const;
+
   // Used and free space both include chunk headers for that part of the
   // nursery.
   //
@@ -657,6 +662,8 @@ class Nursery {
   // Updates pointers to nursery objects that have been tenured and discards
   // pointers to objects that have been freed.
   void sweep();
+  void sweepZones(gc::MinorSweepingTracer* trc);
+  bool shouldSweepZonesInParallel() const;
 
   // Reset the current chunk and position after a minor collection. Also poison
   // the nursery on debug & nightly builds.
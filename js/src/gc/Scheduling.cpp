@@ -62,6 +62,7 @@ GCSchedulingTunables::GCSchedulingTunables()
       lowFrequencyHeapGrowth_(TuningDefaults::LowFrequencyHeapGrowth),
       balancedHeapLimitsEnabled_(TuningDefaults::BalancedHeapLimitsEnabled),
       heapGrowthFactor_(TuningDefaults::HeapGrowthFactor),
+      targetGCOverheadPercent_(TuningDefaults::TargetGCOverheadPercent),
       nurseryFreeThresholdForIdleCollection_(
           TuningDefaults::NurseryFreeThresholdForIdleCollection),
       nurseryFreeThresholdForIdleCollectionFraction_(
@@ -158,6 +159,13 @@ bool GCSchedulingTunables::setParameter(JSGCParamKey key, uint32_t value) {
       setHeapGrowthFactor(double(value));
       break;
     }
+    case JSGC_TARGET_GC_OVERHEAD_PERCENT: {
+      if (value >= 100) {
+        return false;
+      }
+      targetGCOverheadPercent_ = value;
+      break;
+    }
     case JSGC_ALLOCATION_THRESHOLD: {
       size_t threshold;
       if (!megabytesToBytes(value, &threshold)) {
@@ -366,6 +374,9 @@ void GCSchedulingTunables::resetParameter(JSGCParamKey key) {
     case JSGC_HEAP_GROWTH_FACTOR:
       setHeapGrowthFactor(TuningDefaults::HeapGrowthFactor);
       break;
+    case JSGC_TARGET_GC_OVERHEAD_PERCENT:
+      targetGCOverheadPercent_ = TuningDefaults::TargetGCOverheadPercent;
+      break;
     case JSGC_ALLOCATION_THRESHOLD:
       gcZoneAllocThresholdBase_ = TuningDefaults::GCZoneAllocThresholdBase;
       break;
@@ -442,6 +453,61 @@ static double ExponentialMovingAverage(double prevAverage, double newData,
   return smoothingFactor * newData + (1.0 - smoothingFactor) * prevAverage;
 }
 
+// Parameters for adjusting the heap growth factor to a target GC overhead.
+
+// Smoothing for the GC overhead measurement, which varies a lot between GCs.
+static constexpr double GCOverheadSmoothingFactor = 0.3;
+
+// The most the heap growth factor may change by after one GC.
+static constexpr double MaxHeapGrowthFactorStep = 2.0;
+
+// Limits on how far the heap growth factor may be adjusted away from the value
+// of JSGC_HEAP_GROWTH_FACTOR.
+static constexpr double MinHeapGrowthFactorScale = 1.0 / 16.0;
+static constexpr double MaxHeapGrowthFactorScale = 16.0;
+
+double GCSchedulingState::heapGrowthFactor(
+    const GCSchedulingTunables& tunables) const {
+  if (tunables.targetGCOverheadPercent() == 0) {
+    return tunables.heapGrowthFactor();
+  }
+
+  return tunables.heapGrowthFactor() * heapGrowthFactorScale_;
+}
+
+void GCSchedulingState::updateGCOverhead(mozilla::TimeDuration gcTime,
+                                         mozilla::TimeDuration totalTime,
+                                         const GCSchedulingTunables& tunables) {
+  if (js::SupportDifferentialTesting() || totalTime.IsZero()) {
+    return;
+  }
+
+  double overhead = std::min(gcTime / totalTime, 1.0);
+  if (!smoothedGCOverhead_.ref()) {
+    smoothedGCOverhead_ = Some(overhead);
+  } else {
+    smoothedGCOverhead_ =
+        Some(ExponentialMovingAverage(smoothedGCOverhead_.ref().value(),
+                                      overhead, GCOverheadSmoothingFactor));
+  }
+
+  uint32_t targetPercent = tunables.targetGCOverheadPercent();
+  if (!tunables.balancedHeapLimitsEnabled() || targetPercent == 0) {
+    return;
+  }
+  double target = targetPercent / 100.0;
+
+  // With balanced heap limits the time spent collecting is roughly inversely
+  // proportional to the heap growth factor, so scale the factor by the ratio
+  // of the measured overhead to the target.
+  double step = smoothedGCOverhead_.ref().value() / target;
+  step = std::clamp(step, 1.0 / MaxHeapGrowthFactorStep,
+                    MaxHeapGrowthFactorStep);
+  heapGrowthFactorScale_ =
+      std::clamp(heapGrowthFactorScale_ * step, MinHeapGrowthFactorScale,
+                 MaxHeapGrowthFactorScale);
+}
+
 void js::ZoneAllocator::updateCollectionRate(
     mozilla::TimeDuration mainThreadGCTime, size_t initialBytesForAllZones) {
   MOZ_ASSERT(initialBytesForAllZones != 0);
@@ -648,14 +714,14 @@ static constexpr double DefaultCollectionRate = 200.0;
 
 double GCHeapThreshold::computeBalancedHeapLimit(
     size_t lastBytes, double allocationRate, double collectionRate,
-    const GCSchedulingTunables& tunables) {
+    const GCSchedulingTunables& tunables, const GCSchedulingState& state) {
   MOZ_ASSERT(tunables.balancedHeapLimitsEnabled());
 
   // Optimal heap limits as described in https://arxiv.org/abs/2204.10455
 
   double W = double(lastBytes) / BytesPerMB;  // Retained size / MB.
   double W0 = BalancedHeapBaseMB;
-  double d = tunables.heapGrowthFactor();  // Rearranged constant 'c'.
+  double d = state.heapGrowthFactor(tunables);  // Rearranged constant 'c'.
   double g = allocationRate;
   double s = collectionRate;
   double f = d * sqrt((W + W0) * (g / s));
@@ -677,7 +743,7 @@ void GCHeapThreshold::updateStartThreshold(
   } else {
     double threshold = computeBalancedHeapLimit(
         lastBytes, allocationRate.valueOr(DefaultAllocationRate),
-        collectionRate.valueOr(DefaultCollectionRate), tunables);
+        collectionRate.valueOr(DefaultCollectionRate), tunables, state);
 
     double triggerMax =
         double(tunables.gcMaxBytes()) / tunables.largeHeapIncrementalLimit();
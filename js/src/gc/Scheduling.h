@@ -389,6 +389,9 @@ static const double LowFrequencyHeapGrowth = 1.5;
 /* JSGC_HEAP_GROWTH_FACTOR */
 static const double HeapGrowthFactor = 50.0;
 
+/* JSGC_TARGET_GC_OVERHEAD_PERCENT */
+static const uint32_t TargetGCOverheadPercent = 0;
+
 /* JSGC_MIN_EMPTY_CHUNK_COUNT */
 static const uint32_t MinEmptyChunkCount = 1;
 
@@ -413,6 +416,9 @@ static const bool BalancedHeapLimitsEnabled = false;
 /* JSGC_INCREMENTAL_WEAKMAP_ENABLED */
 static const bool IncrementalWeakMapMarkingEnabled = true;
 
+/* JSGC_PARALLEL_MINOR_GC_SWEEPING_ENABLED */
+static const bool ParallelMinorGCSweepingEnabled = true;
+
 /* JSGC_NURSERY_FREE_THRESHOLD_FOR_IDLE_COLLECTION */
 static const uint32_t NurseryFreeThresholdForIdleCollection = ChunkSize / 4;
 
@@ -543,6 +549,14 @@ class GCSchedulingTunables {
    */
   MainThreadOrGCTaskData<double> heapGrowthFactor_;
 
+  /*
+   * JSGC_TARGET_GC_OVERHEAD_PERCENT
+   *
+   * The percentage of time we aim to spend in major GC, or zero if the heap
+   * growth factor is not adjusted.
+   */
+  MainThreadOrGCTaskData<uint32_t> targetGCOverheadPercent_;
+
   /*
    * JSGC_NURSERY_FREE_THRESHOLD_FOR_IDLE_COLLECTION
    * JSGC_NURSERY_FREE_THRESHOLD_FOR_IDLE_COLLECTION_FRACTION
@@ -642,6 +656,7 @@ class GCSchedulingTunables {
   double lowFrequencyHeapGrowth() const { return lowFrequencyHeapGrowth_; }
   bool balancedHeapLimitsEnabled() const { return balancedHeapLimitsEnabled_; }
   double heapGrowthFactor() const { return heapGrowthFactor_; }
+  uint32_t targetGCOverheadPercent() const { return targetGCOverheadPercent_; }
   uint32_t nurseryFreeThresholdForIdleCollection() const {
     return nurseryFreeThresholdForIdleCollection_;
   }
@@ -694,8 +709,22 @@ class GCSchedulingState {
    */
   mozilla::Atomic<bool, mozilla::ReleaseAcquire> inHighFrequencyGCMode_;
 
+  /*
+   * When a target GC overhead is set, the balanced heap limit growth factor is
+   * scaled by this after each major GC to bring the measured overhead towards
+   * the target.
+   */
+  MainThreadOrGCTaskData<double> heapGrowthFactorScale_;
+
+  /*
+   * Smoothed fraction of time spent in major GC between the end of one major
+   * GC and the end of the next.
+   */
+  MainThreadData<mozilla::Maybe<double>> smoothedGCOverhead_;
+
  public:
-  GCSchedulingState() : inHighFrequencyGCMode_(false) {}
+  GCSchedulingState()
+      : inHighFrequencyGCMode_(false), heapGrowthFactorScale_(1.0) {}
 
   bool inHighFrequencyGCMode() const { return inHighFrequencyGCMode_; }
 
@@ -703,6 +732,20 @@ class GCSchedulingState {
                                const mozilla::TimeStamp& currentTime,
                                const GCSchedulingTunables& tunables);
   void updateHighFrequencyModeForReason(JS::GCReason reason);
+
+  // The heap growth factor to use for balanced heap limits.
+  double heapGrowthFactor(const GCSchedulingTunables& tunables) const;
+
+  mozilla::Maybe<double> smoothedGCOverhead() const {
+    return smoothedGCOverhead_;
+  }
+
+  // Update the GC overhead estimate from a major GC that took |gcTime| out of
+  // |totalTime| since the end of the previous one, and adjust the heap growth
+  // factor if a target overhead is set.
+  void updateGCOverhead(mozilla::TimeDuration gcTime,
+                        mozilla::TimeDuration totalTime,
+                        const GCSchedulingTunables& tunables);
 };
 
 struct TriggerResult {
@@ -883,7 +926,8 @@ class GCHeapThreshold : public HeapThreshold {
   static double computeBalancedHeapLimit(size_t lastBytes,
                                          double allocationRate,
                                          double collectionRate,
-                                         const GCSchedulingTunables& tunables);
+                                         const GCSchedulingTunables& tunables,
+                                         const GCSchedulingState& state);
 };
 
 // A heap threshold that is calculated as a constant multiple of the retained
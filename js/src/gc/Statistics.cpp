@@ -18,6 +18,7 @@
 #include "gc/GC.h"
 #include "gc/GCInternals.h"
 #include "gc/Memory.h"
+#include "gc/Nursery.h"
 #include "util/GetPidProvider.h"
 #include "util/Text.h"
 #include "vm/JSONPrinter.h"
@@ -467,6 +468,7 @@ UniqueChars Statistics::formatDetailedDescription() const {
   Zones Collected: %d of %d (-%d)\n\
   Compartments Collected: %d of %d (-%d)\n\
   MinorGCs since last GC: %d\n\
+  Tenured by MinorGCs: %.3f MiB\n\
   Store Buffer Overflows: %d\n\
   MMU 20ms:%.1f%%; 50ms:%.1f%%\n\
   SCC Sweep Total (MaxPause): %.3fms (%.3fms)\n\
@@ -483,9 +485,9 @@ UniqueChars Statistics::formatDetailedDescription() const {
       zoneStats.collectedZoneCount, zoneStats.zoneCount,
       zoneStats.sweptZoneCount, zoneStats.collectedCompartmentCount,
       zoneStats.compartmentCount, zoneStats.sweptCompartmentCount,
-      getCount(COUNT_MINOR_GC), getCount(COUNT_STOREBUFFER_OVERFLOW),
-      mmu20 * 100., mmu50 * 100., t(sccTotal), t(sccLongest),
-      double(preTotalHeapBytes) / BYTES_PER_MB,
+      getCount(COUNT_MINOR_GC), double(getTenuredBytes()) / BYTES_PER_MB,
+      getCount(COUNT_STOREBUFFER_OVERFLOW), mmu20 * 100., mmu50 * 100.,
+      t(sccTotal), t(sccLongest), double(preTotalHeapBytes) / BYTES_PER_MB,
       getCount(COUNT_NEW_CHUNK) - getCount(COUNT_DESTROY_CHUNK),
       getCount(COUNT_NEW_CHUNK) + getCount(COUNT_DESTROY_CHUNK),
       double(ArenaSize * getCount(COUNT_ARENA_RELOCATED)) / BYTES_PER_MB);
@@ -678,6 +680,7 @@ void Statistics::formatJsonDescription(JSONPrinter& json) const {
   json.property("total_zones", zoneStats.zoneCount);
   json.property("total_compartments", zoneStats.compartmentCount);
   json.property("minor_gcs", getCount(COUNT_MINOR_GC));
+  json.property("minor_gc_tenured_bytes", getTenuredBytes());
   json.property("minor_gc_number", gc->minorGCCount());
   json.property("major_gc_number", gc->majorGCCount());
   uint32_t storebufferOverflows = getCount(COUNT_STOREBUFFER_OVERFLOW);
@@ -703,6 +706,14 @@ void Statistics::formatJsonDescription(JSONPrinter& json) const {
   json.property("allocated_bytes", preTotalHeapBytes);
   json.property("post_heap_size", postTotalHeapBytes);
 
+  if (Maybe<double> overhead = gc->schedulingState.smoothedGCOverhead()) {
+    json.property("gc_overhead_percent", int(*overhead * 100));
+  }
+  if (gc->tunables.balancedHeapLimitsEnabled()) {
+    json.property("heap_growth_factor",
+                  int(gc->schedulingState.heapGrowthFactor(gc->tunables)));
+  }
+
   uint32_t addedChunks = getCount(COUNT_NEW_CHUNK);
   if (addedChunks) {
     json.property("added_chunks", addedChunks);
@@ -763,6 +774,7 @@ Statistics::Statistics(GCRuntime* gc)
       nonincrementalReason_(GCAbortReason::None),
       creationTime_(TimeStamp::Now()),
       allocsSinceMinorGC({0, 0}),
+      tenuredBytesSinceLastGC(0),
       preTotalHeapBytes(0),
       postTotalHeapBytes(0),
       preCollectedHeapBytes(0),
@@ -772,6 +784,11 @@ Statistics::Statistics(GCRuntime* gc)
       maxPauseInInterval(0),
       sliceCallback(nullptr),
       nurseryCollectionCallback(nullptr),
+      sliceRecordHead_(0),
+      sliceRecordCount_(0),
+      sliceRecordCallback(nullptr),
+      sliceRecordCallbackData(nullptr),
+      sliceStartHeapBytes(0),
       aborted(false),
       enableProfiling_(false),
       sliceCount_(0) {
@@ -869,6 +886,31 @@ JS::GCNurseryCollectionCallback Statistics::setNurseryCollectionCallback(
   return oldCallback;
 }
 
+void Statistics::setSliceRecordCallback(JS::GCSliceRecordCallback callback,
+                                        void* data) {
+  sliceRecordCallback = callback;
+  sliceRecordCallbackData = data;
+}
+
+void Statistics::flushSliceRecords() {
+  if (!sliceRecordCallback || sliceRecordCount_ == 0) {
+    return;
+  }
+
+  // Make the records contiguous, oldest first.
+  if (sliceRecordHead_ != 0) {
+    MOZ_ASSERT(sliceRecordCount_ == MaxSliceRecords);
+    std::rotate(sliceRecords_.begin(), sliceRecords_.begin() + sliceRecordHead_,
+                sliceRecords_.end());
+  }
+
+  (*sliceRecordCallback)(context(), sliceRecords_.begin(), sliceRecordCount_,
+                         sliceRecordCallbackData);
+
+  sliceRecordHead_ = 0;
+  sliceRecordCount_ = 0;
+}
+
 TimeDuration Statistics::clearMaxGCPauseAccumulator() {
   TimeDuration prior = maxPauseInInterval;
   maxPauseInInterval = 0;
@@ -890,6 +932,14 @@ static TimeDuration SumPhase(PhaseKind phaseKind,
   return sum;
 }
 
+static TimeDuration SumAllPhaseKinds(const Statistics::PhaseKindTimes& times) {
+  TimeDuration sum;
+  for (PhaseKind kind : AllPhaseKinds()) {
+    sum += times[kind];
+  }
+  return sum;
+}
+
 static bool CheckSelfTime(Phase parent, Phase child,
                           const Statistics::PhaseTimes& times,
                           const Statistics::PhaseTimes& selfTimes,
@@ -1156,6 +1206,8 @@ void Statistics::beginSlice(const ZoneGCStats& zoneStats, JS::GCOptions options,
     return;
   }
 
+  sliceStartHeapBytes = gc->heapSize.bytes();
+
   runtime->metrics().GC_REASON_2(uint32_t(reason));
   runtime->metrics().GC_BUDGET_WAS_INCREASED(budgetWasIncreased);
 
@@ -1210,6 +1262,8 @@ void Statistics::endSlice() {
 
   // Slice callbacks should only fire for the outermost level.
   if (!aborted) {
+    recordSlice(slices_.back(), last);
+
     if (sliceCallback) {
       JSContext* cx = context();
       JS::GCDescription desc(!gc->fullGCRequested, last, gcOptions,
@@ -1226,6 +1280,7 @@ void Statistics::endSlice() {
     for (auto& count : counts) {
       count = 0;
     }
+    tenuredBytesSinceLastGC = 0;
 
     // Clear the timers at the end of a GC, preserving the data for
     // PhaseKind::MUTATOR.
@@ -1245,6 +1300,43 @@ void Statistics::endSlice() {
   aborted = false;
 }
 
+void Statistics::recordSlice(const SliceData& slice, bool last) {
+  size_t index = (sliceRecordHead_ + sliceRecordCount_) % MaxSliceRecords;
+  if (sliceRecordCount_ == MaxSliceRecords) {
+    // Overwrite the oldest record.
+    sliceRecordHead_ = (sliceRecordHead_ + 1) % MaxSliceRecords;
+  } else {
+    sliceRecordCount_++;
+  }
+
+  JS::GCSliceRecord& record = sliceRecords_[index];
+  record.start = slice.start;
+  record.end = slice.end;
+  record.majorGCNumber = gc->majorGCCount();
+  record.sliceNumber = gc->gcSliceCount();
+  record.reason = slice.reason;
+  record.isLastSlice = last;
+  record.wasReset = slice.wasReset();
+  record.collectedZoneCount = zoneStats.collectedZoneCount;
+  record.zoneCount = zoneStats.zoneCount;
+  record.markTime = SumPhase(PhaseKind::MARK, slice.phaseTimes);
+  record.sweepTime = SumPhase(PhaseKind::SWEEP, slice.phaseTimes);
+  record.compactTime = SumPhase(PhaseKind::COMPACT, slice.phaseTimes);
+  record.heapBytesBefore = sliceStartHeapBytes;
+  record.heapBytesAfter = gc->heapSize.bytes();
+  record.nurseryPromotionRate = gc->nursery().lastPromotionRate();
+
+  double helperTime = SumAllPhaseKinds(slice.totalParallelTimes).ToSeconds();
+  double availableTime =
+      slice.duration().ToSeconds() * double(gc->parallelWorkerCount());
+  record.helperThreadUtilization =
+      availableTime > 0.0 ? std::min(helperTime / availableTime, 1.0) : 0.0;
+
+  if (sliceRecordCallback && sliceRecordCount_ == MaxSliceRecords) {
+    flushSliceRecords();
+  }
+}
+
 void Statistics::sendSliceTelemetry(const SliceData& slice) {
   JSRuntime* runtime = gc->rt;
   TimeDuration sliceTime = slice.end - slice.start;
@@ -1574,14 +1666,6 @@ void Statistics::printProfileTimes(const ProfileDurations& times) {
   fprintf(file, "\n");
 }
 
-static TimeDuration SumAllPhaseKinds(const Statistics::PhaseKindTimes& times) {
-  TimeDuration sum;
-  for (PhaseKind kind : AllPhaseKinds()) {
-    sum += times[kind];
-  }
-  return sum;
-}
-
 void Statistics::printSliceProfile() {
   const SliceData& slice = slices_.back();
 
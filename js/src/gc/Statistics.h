@@ -215,6 +215,11 @@ struct Statistics {
 
   uint32_t getCount(Count s) const { return uint32_t(counts[s]); }
 
+  // Bytes promoted to the tenured heap by minor GCs since the last major GC
+  // ended.
+  void addTenuredBytes(size_t bytes) { tenuredBytesSinceLastGC += bytes; }
+  size_t getTenuredBytes() const { return tenuredBytesSinceLastGC; }
+
   void setStat(Stat s, uint32_t value) { stats[s] = value; }
 
   uint32_t getStat(Stat s) const { return stats[s]; }
@@ -253,6 +258,11 @@ struct Statistics {
   JS::GCNurseryCollectionCallback setNurseryCollectionCallback(
       JS::GCNurseryCollectionCallback callback);
 
+  void setSliceRecordCallback(JS::GCSliceRecordCallback callback, void* data);
+
+  // Pass the buffered slice records to the slice record callback, if any.
+  void flushSliceRecords();
+
   TimeDuration clearMaxGCPauseAccumulator();
   TimeDuration getMaxGCPauseSinceClear();
 
@@ -393,6 +403,9 @@ struct Statistics {
     uint32_t tenured;
   } allocsSinceMinorGC;
 
+  /* Bytes tenured by minor GCs for this GC. */
+  size_t tenuredBytesSinceLastGC;
+
   /* Total GC heap size before and after the GC ran. */
   size_t preTotalHeapBytes;
   size_t postTotalHeapBytes;
@@ -435,6 +448,21 @@ struct Statistics {
   JS::GCSliceCallback sliceCallback;
   JS::GCNurseryCollectionCallback nurseryCollectionCallback;
 
+  /*
+   * Ring buffer of summary records for the most recent slices. The oldest
+   * record is at sliceRecordHead_, which can only be non-zero once the buffer
+   * has filled up and started overwriting old records.
+   */
+  static const size_t MaxSliceRecords = 64;
+  mozilla::Array<JS::GCSliceRecord, MaxSliceRecords> sliceRecords_;
+  size_t sliceRecordHead_;
+  size_t sliceRecordCount_;
+  JS::GCSliceRecordCallback sliceRecordCallback;
+  void* sliceRecordCallbackData;
+
+  /* GC heap size at the start of the current slice. */
+  size_t sliceStartHeapBytes;
+
   /*
    * True if we saw an OOM while allocating slices or we saw an impossible
    * timestamp. The statistics for this GC will be invalid.
@@ -471,6 +499,7 @@ struct Statistics {
 
   void sendGCTelemetry();
   void sendSliceTelemetry(const SliceData& slice);
+  void recordSlice(const SliceData& slice, bool last);
 
   void recordPhaseBegin(Phase phase);
   void recordPhaseEnd(Phase phase);
@@ -84,6 +84,7 @@ StoreBuffer::StoreBuffer(JSRuntime* rt, const Nursery& nursery)
       bufBigIntCell(this, JS::GCReason::FULL_CELL_PTR_BIGINT_BUFFER),
       bufObjCell(this, JS::GCReason::FULL_CELL_PTR_OBJ_BUFFER),
       bufferSlot(this, JS::GCReason::FULL_SLOT_BUFFER),
+      bufferElementCards(this),
       bufferWholeCell(this),
       bufferGeneric(this),
       runtime_(rt),
@@ -104,8 +105,8 @@ void StoreBuffer::checkEmpty() const { MOZ_ASSERT(isEmpty()); }
 bool StoreBuffer::isEmpty() const {
   return bufferVal.isEmpty() && bufStrCell.isEmpty() &&
          bufBigIntCell.isEmpty() && bufObjCell.isEmpty() &&
-         bufferSlot.isEmpty() && bufferWholeCell.isEmpty() &&
-         bufferGeneric.isEmpty();
+         bufferSlot.isEmpty() && bufferElementCards.isEmpty() &&
+         bufferWholeCell.isEmpty() && bufferGeneric.isEmpty();
 }
 
 bool StoreBuffer::enable() {
@@ -148,6 +149,7 @@ void StoreBuffer::clear() {
   bufBigIntCell.clear();
   bufObjCell.clear();
   bufferSlot.clear();
+  bufferElementCards.clear();
   bufferWholeCell.clear();
   bufferGeneric.clear();
 }
@@ -166,12 +168,56 @@ void StoreBuffer::addSizeOfExcludingThis(mozilla::MallocSizeOf mallocSizeOf,
   sizes->storeBufferCells += bufStrCell.sizeOfExcludingThis(mallocSizeOf) +
                              bufBigIntCell.sizeOfExcludingThis(mallocSizeOf) +
                              bufObjCell.sizeOfExcludingThis(mallocSizeOf);
-  sizes->storeBufferSlots += bufferSlot.sizeOfExcludingThis(mallocSizeOf);
+  sizes->storeBufferSlots +=
+      bufferSlot.sizeOfExcludingThis(mallocSizeOf) +
+      bufferElementCards.sizeOfExcludingThis(mallocSizeOf);
   sizes->storeBufferWholeCells +=
       bufferWholeCell.sizeOfExcludingThis(mallocSizeOf);
   sizes->storeBufferGenerics += bufferGeneric.sizeOfExcludingThis(mallocSizeOf);
 }
 
+void StoreBuffer::ElementCardBuffer::clear() {
+  tables_.clear();
+  lastObject_ = nullptr;
+  lastTable_ = nullptr;
+  dirtyCardCount_ = 0;
+}
+
+StoreBuffer::ElementCardBuffer::CardTable*
+StoreBuffer::ElementCardBuffer::tableFor(NativeObject* obj) {
+  AutoEnterOOMUnsafeRegion oomUnsafe;
+  auto p = tables_.lookupForAdd(obj);
+  if (!p) {
+    auto table = MakeUnique<CardTable>();
+    if (!table || !tables_.add(p, obj, std::move(table))) {
+      oomUnsafe.crash("Failed to allocate for ElementCardBuffer::put.");
+    }
+  }
+
+  lastObject_ = obj;
+  lastTable_ = p->value().get();
+  return lastTable_;
+}
+
+void StoreBuffer::ElementCardBuffer::growTable(CardTable* table,
+                                               size_t length) {
+  MOZ_ASSERT(length > table->length());
+
+  AutoEnterOOMUnsafeRegion oomUnsafe;
+  if (!table->appendN(0, length - table->length())) {
+    oomUnsafe.crash("Failed to allocate for ElementCardBuffer::put.");
+  }
+}
+
+size_t StoreBuffer::ElementCardBuffer::sizeOfExcludingThis(
+    mozilla::MallocSizeOf mallocSizeOf) {
+  size_t size = tables_.shallowSizeOfExcludingThis(mallocSizeOf);
+  for (auto r = tables_.all(); !r.empty(); r.popFront()) {
+    size += r.front().value()->sizeOfIncludingThis(mallocSizeOf);
+  }
+  return size;
+}
+
 ArenaCellSet ArenaCellSet::Empty;
 
 ArenaCellSet::ArenaCellSet(Arena* arena, ArenaCellSet* next)
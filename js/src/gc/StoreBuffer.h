@@ -253,6 +253,92 @@ class StoreBuffer {
     GenericBuffer& operator=(const GenericBuffer& other) = delete;
   };
 
+  /*
+   * The remembered set for the elements of large objects. Rather than a
+   * SlotsEdge for every element written, each object gets a table with one
+   * byte per card of ElementsPerCard elements, and minor GC only traces the
+   * elements covered by dirty cards. The cost of a minor GC is then bounded by
+   * the size of the dirty region rather than by the number of writes.
+   *
+   * Cards are indexed by unshifted element index, as for SlotsEdge.
+   */
+  struct ElementCardBuffer {
+    static const size_t CardShift = 7;
+    static const size_t ElementsPerCard = size_t(1) << CardShift;
+
+    using CardTable = Vector<uint8_t, 0, SystemAllocPolicy>;
+    using CardTableMap =
+        HashMap<NativeObject*, UniquePtr<CardTable>,
+                PointerHasher<NativeObject*>, SystemAllocPolicy>;
+    CardTableMap tables_;
+
+    /*
+     * A one element cache in front of the map, as large objects tend to be
+     * written to repeatedly.
+     */
+    NativeObject* lastObject_;
+    CardTable* lastTable_;
+
+    /*
+     * The number of dirty cards in all tables. Tables are sized by the highest
+     * card written, which is proportional to the object's own elements, so
+     * only dirty cards count towards requesting a minor GC.
+     */
+    size_t dirtyCardCount_;
+
+    StoreBuffer* owner_;
+
+    /* Maximum number of dirty cards before we request a minor GC. */
+    const static size_t MaxDirtyCards = BufferOverflowThresholdBytes;
+
+    explicit ElementCardBuffer(StoreBuffer* owner)
+        : lastObject_(nullptr),
+          lastTable_(nullptr),
+          dirtyCardCount_(0),
+          owner_(owner) {}
+
+    void clear();
+
+    /* Dirty the cards covering |count| elements from |start|. */
+    void put(NativeObject* obj, uint32_t start, uint32_t count) {
+      MOZ_ASSERT(count > 0);
+      MOZ_ASSERT(start + count > start);
+
+      CardTable* table = obj == lastObject_ ? lastTable_ : tableFor(obj);
+
+      size_t first = start >> CardShift;
+      size_t last = (start + count - 1) >> CardShift;
+      if (last >= table->length()) {
+        growTable(table, last + 1);
+      }
+
+      for (size_t i = first; i <= last; i++) {
+        if (!(*table)[i]) {
+          (*table)[i] = 1;
+          dirtyCardCount_++;
+        }
+      }
+
+      if (MOZ_UNLIKELY(dirtyCardCount_ > MaxDirtyCards)) {
+        owner_->setAboutToOverflow(JS::GCReason::FULL_SLOT_BUFFER);
+      }
+    }
+
+    /* Trace the elements in all dirty cards. */
+    void trace(TenuringTracer& mover);
+
+    size_t sizeOfExcludingThis(mozilla::MallocSizeOf mallocSizeOf);
+
+    bool isEmpty() const { return tables_.empty(); }
+
+   private:
+    CardTable* tableFor(NativeObject* obj);
+    void growTable(CardTable* table, size_t length);
+
+    ElementCardBuffer(const ElementCardBuffer& other) = delete;
+    ElementCardBuffer& operator=(const ElementCardBuffer& other) = delete;
+  };
+
   template <typename Edge>
   struct PointerEdgeHasher {
     using Lookup = Edge;
@@ -432,6 +518,7 @@ class StoreBuffer {
   MonoTypeBuffer<BigIntPtrEdge> bufBigIntCell;
   MonoTypeBuffer<ObjectPtrEdge> bufObjCell;
   MonoTypeBuffer<SlotsEdge> bufferSlot;
+  ElementCardBuffer bufferElementCards;
   WholeCellBuffer bufferWholeCell;
   GenericBuffer bufferGeneric;
 
@@ -494,6 +581,19 @@ class StoreBuffer {
     }
   }
 
+  /*
+   * Insert a range of elements of a large object, using the card table rather
+   * than the slots buffer. |start| is an unshifted element index.
+   */
+  void putElementCards(NativeObject* obj, uint32_t start, uint32_t count) {
+    checkAccess();
+    if (!isEnabled()) {
+      return;
+    }
+    mozilla::ReentrancyGuard g(*this);
+    bufferElementCards.put(obj, start, count);
+  }
+
   inline void putWholeCell(Cell* cell);
 
   /* Insert an entry into the generic buffer. */
@@ -511,7 +611,10 @@ class StoreBuffer {
     bufBigIntCell.trace(mover);
     bufObjCell.trace(mover);
   }
-  void traceSlots(TenuringTracer& mover) { bufferSlot.trace(mover); }
+  void traceSlots(TenuringTracer& mover) {
+    bufferSlot.trace(mover);
+    bufferElementCards.trace(mover);
+  }
   void traceWholeCells(TenuringTracer& mover) { bufferWholeCell.trace(mover); }
   void traceGenericEntries(JSTracer* trc) { bufferGeneric.trace(trc); }
 
@@ -16,6 +16,7 @@
  * sweep phase. This is also implemented in this file.
  */
 
+#include "mozilla/Array.h"
 #include "mozilla/Maybe.h"
 #include "mozilla/ScopeExit.h"
 #include "mozilla/TimeStamp.h"
@@ -327,7 +328,126 @@ void ArenaLists::queueForegroundThingsForSweep() {
       collectingArenaList(AllocKind::NORMAL_PROP_MAP).head();
 }
 
-void GCRuntime::sweepBackgroundThings(ZoneList& zones) {
+// The alloc kinds of a background finalization phase that need finalizing in
+// a zone. Kinds are handed out one at a time to the threads sharing the work.
+class BackgroundFinalizeKinds {
+  mozilla::Array<AllocKind, size_t(AllocKind::LIMIT)> kinds;
+  size_t count = 0;
+  HelperThreadLockData<size_t> next;
+
+ public:
+  BackgroundFinalizeKinds(Zone* zone, const FinalizePhase& phase) : next(0) {
+    for (auto kind : phase.kinds) {
+      if (!zone->arenas.collectingArenaList(kind).isEmpty()) {
+        kinds[count++] = kind;
+      }
+    }
+  }
+
+  size_t length() const { return count; }
+
+  bool take(AllocKind* kindOut, const AutoLockHelperThreadState& lock) {
+    if (next.ref() == count) {
+      return false;
+    }
+
+    *kindOut = kinds[next.ref()++];
+    return true;
+  }
+};
+
+// Finalizes alloc kinds of a phase in parallel with the background sweep task.
+// Empty arenas are returned in per-kind lists so that no synchronization is
+// needed to collect them.
+class js::gc::BackgroundFinalizeTask : public GCParallelTask {
+  Zone* zone;
+  BackgroundFinalizeKinds& kinds;
+  AllAllocKindArray<Arena*>& emptyArenas;
+
+  BackgroundFinalizeTask(const BackgroundFinalizeTask&) = delete;
+
+ public:
+  BackgroundFinalizeTask(GCRuntime* gc, Zone* zone,
+                         BackgroundFinalizeKinds& kinds,
+                         AllAllocKindArray<Arena*>& emptyArenas)
+      : GCParallelTask(gc, gcstats::PhaseKind::SWEEP, GCUse::Finalizing),
+        zone(zone),
+        kinds(kinds),
+        emptyArenas(emptyArenas) {}
+
+  void run(AutoLockHelperThreadState& lock) override {
+    JS::GCContext* gcx = TlsGCContext.get();
+    AllocKind kind;
+    while (kinds.take(&kind, lock)) {
+      AutoUnlockHelperThreadState unlock(lock);
+      gc->backgroundFinalize(gcx, zone, kind, &emptyArenas[kind]);
+    }
+  }
+};
+
+static constexpr size_t MaxBackgroundFinalizeHelpers = MaxParallelWorkers - 1;
+
+void GCRuntime::backgroundFinalizePhase(JS::GCContext* gcx, Zone* zone,
+                                        const FinalizePhase& phase,
+                                        size_t threadCount, Arena** empty) {
+  BackgroundFinalizeKinds kinds(zone, phase);
+
+  // Each kind is finalized by a single thread, which collects its empty arenas
+  // into a separate list.
+  AllAllocKindArray<Arena*> emptyArenas;
+  for (auto kind : phase.kinds) {
+    emptyArenas[kind] = nullptr;
+  }
+
+  // This thread finalizes kinds alongside the helpers. Most kinds only have a
+  // few arenas to finalize, so start at most one helper for every two kinds.
+  size_t helperCount = std::min({threadCount - 1, kinds.length() / 2,
+                                 MaxBackgroundFinalizeHelpers});
+
+  mozilla::Maybe<BackgroundFinalizeTask> helpers[MaxBackgroundFinalizeHelpers];
+
+  AutoLockHelperThreadState lock;
+  for (size_t i = 0; i < helperCount; i++) {
+    helpers[i].emplace(this, zone, kinds, emptyArenas);
+    helpers[i]->startWithLockHeld(lock);
+  }
+
+  AllocKind kind;
+  while (kinds.take(&kind, lock)) {
+    AutoUnlockHelperThreadState unlock(lock);
+    backgroundFinalize(gcx, zone, kind, &emptyArenas[kind]);
+  }
+
+  // All the kinds have been taken. Helpers which have not started running yet
+  // have nothing left to do, so cancel them rather than waiting for a helper
+  // thread to become available.
+  for (size_t i = 0; i < helperCount; i++) {
+    BackgroundFinalizeTask& helper = *helpers[i];
+    if (helper.isDispatched(lock)) {
+      helper.cancelDispatchedTask(lock);
+    } else if (!helper.isIdle(lock)) {
+      helper.joinNonIdleTask(mozilla::Nothing(), lock);
+    }
+  }
+
+  for (auto kind : phase.kinds) {
+    Arena* arenas = emptyArenas[kind];
+    if (!arenas) {
+      continue;
+    }
+
+    Arena* last = arenas;
+    while (last->next) {
+      last = last->next;
+    }
+    last->next = *empty;
+    *empty = arenas;
+  }
+}
+
+void GCRuntime::sweepBackgroundThings(ZoneList& zones, size_t threadCount) {
+  MOZ_ASSERT(threadCount != 0);
+
   if (zones.isEmpty()) {
     return;
   }
@@ -346,8 +466,14 @@ void GCRuntime::sweepBackgroundThings(ZoneList& zones) {
     Arena* emptyArenas = zone->arenas.takeSweptEmptyArenas();
 
     // We must finalize thing kinds in the order specified by
-    // BackgroundFinalizePhases.
+    // BackgroundFinalizePhases. Kinds within a phase don't depend on each
+    // other and may be finalized in parallel.
     for (auto phase : BackgroundFinalizePhases) {
+      if (threadCount > 1) {
+        backgroundFinalizePhase(gcx, zone, phase, threadCount, &emptyArenas);
+        continue;
+      }
+
       for (auto kind : phase.kinds) {
         backgroundFinalize(gcx, zone, kind, &emptyArenas);
       }
@@ -403,6 +529,8 @@ void GCRuntime::queueZonesAndStartBackgroundSweep(ZoneList&& zones) {
     AutoLockHelperThreadState lock;
     MOZ_ASSERT(!requestSliceAfterBackgroundTask);
     backgroundSweepZones.ref().appendList(std::move(zones));
+    backgroundSweepThreadCount =
+        useBackgroundThreads ? parallelWorkerCount() : 1;
     if (useBackgroundThreads) {
       sweepTask.startOrRunIfIdle(lock);
     }
@@ -424,9 +552,10 @@ void GCRuntime::sweepFromBackgroundThread(AutoLockHelperThreadState& lock) {
   do {
     ZoneList zones;
     zones.appendList(std::move(backgroundSweepZones.ref()));
+    size_t threadCount = backgroundSweepThreadCount;
 
     AutoUnlockHelperThreadState unlock(lock);
-    sweepBackgroundThings(zones);
+    sweepBackgroundThings(zones, threadCount);
 
     // The main thread may call queueZonesAndStartBackgroundSweep() while this
     // is running so we must check there is no more work after releasing the
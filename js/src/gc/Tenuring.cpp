@@ -224,6 +224,35 @@ void js::gc::StoreBuffer::SlotsEdge::trace(TenuringTracer& mover) const {
   }
 }
 
+void js::gc::StoreBuffer::ElementCardBuffer::trace(TenuringTracer& mover) {
+  mozilla::ReentrancyGuard g(*owner_);
+  MOZ_ASSERT(owner_->isEnabled());
+
+  for (auto r = tables_.all(); !r.empty(); r.popFront()) {
+    NativeObject* obj = r.front().key();
+    const CardTable& table = *r.front().value();
+
+    // Trace each run of dirty cards as a single range of elements.
+    size_t i = 0;
+    while (i < table.length()) {
+      if (!table[i]) {
+        i++;
+        continue;
+      }
+
+      size_t end = i + 1;
+      while (end < table.length() && table[end]) {
+        end++;
+      }
+
+      SlotsEdge edge(obj, SlotsEdge::ElementKind, i << CardShift,
+                     (end - i) << CardShift);
+      edge.trace(mover);
+      i = end;
+    }
+  }
+}
+
 static inline void TraceWholeCell(TenuringTracer& mover, JSObject* object) {
   MOZ_ASSERT_IF(object->storeBuffer(),
                 !object->storeBuffer()->markingNondeduplicatable);
@@ -988,8 +1017,11 @@ size_t js::TenuringTracer::moveBigIntToTenured(JS::BigInt* dst, JS::BigInt* src,
 MinorSweepingTracer::MinorSweepingTracer(JSRuntime* rt)
     : GenericTracerImpl(rt, JS::TracerKind::MinorSweeping,
                         JS::WeakMapTraceAction::TraceKeysAndValues) {
-  MOZ_ASSERT(CurrentThreadCanAccessRuntime(runtime()));
-  MOZ_ASSERT(JS::RuntimeHeapIsMinorCollecting());
+  // Zones may be swept on GC helper threads, which have no JSContext, so
+  // check the heap state through the runtime rather than TlsContext.
+  MOZ_ASSERT(CurrentThreadCanAccessRuntime(runtime()) ||
+             CurrentThreadIsGCSweeping());
+  MOZ_ASSERT(runtime()->heapState() == JS::HeapState::MinorCollecting);
 }
 
 template <typename T>
@@ -796,6 +796,23 @@ void Zone::traceRootsInMajorGC(JSTracer* trc) {
   // calling this only during major (non-nursery) collections.
   traceScriptTableRoots(trc);
 
+  if (jitZone()) {
+    // Don't keep stub code for a zone whose realms have all died, such as the
+    // zone of a closed tab. It would keep the zone alive for several GCs.
+    bool hasLiveRealm = false;
+    for (RealmsInZoneIter realm(this); !realm.done(); realm.next()) {
+      if (realm->hasLiveGlobal()) {
+        hasLiveRealm = true;
+        break;
+      }
+    }
+    if (hasLiveRealm) {
+      jitZone()->traceRetainedStubCode(trc);
+    } else {
+      jitZone()->expireRetainedStubCode();
+    }
+  }
+
   if (FinalizationObservers* observers = finalizationObservers()) {
     observers->traceRoots(trc);
   }
@@ -0,0 +1,43 @@
+// |jit-test| --baseline-offthread-compile=on; --baseline-batch-size=4; --baseline-warmup-threshold=10; skip-if: !getJitCompilerOptions()["baseline.enable"]
+
+// Scripts queued for off-thread Baseline compilation in batches must run
+// correctly whether their batch is linked, cancelled by a GC, or left pending.
+
+function makeFunctions(n) {
+  var fs = [];
+  for (var i = 0; i < n; i++) {
+    fs.push(new Function("x", "return x + " + i + ";"));
+  }
+  return fs;
+}
+
+function run(fs, iterations) {
+  var sum = 0;
+  for (var j = 0; j < iterations; j++) {
+    for (var i = 0; i < fs.length; i++) {
+      sum += fs[i](j);
+    }
+  }
+  return sum;
+}
+
+function expected(n, iterations) {
+  return n * iterations * (iterations - 1) / 2 + iterations * n * (n - 1) / 2;
+}
+
+// Fill several batches, including a partial one.
+var fs = makeFunctions(10);
+assertEq(run(fs, 50), expected(10, 50));
+
+// A GC while a batch is pending discards the JitScripts it was compiled for.
+fs = makeFunctions(6);
+assertEq(run(fs, 12), expected(6, 12));
+gc();
+assertEq(run(fs, 50), expected(6, 50));
+
+// Shrinking GCs and relazification throw away the JitScripts too.
+fs = makeFunctions(6);
+assertEq(run(fs, 12), expected(6, 12));
+gc(this, "shrinking");
+relazifyFunctions();
+assertEq(run(fs, 50), expected(6, 50));
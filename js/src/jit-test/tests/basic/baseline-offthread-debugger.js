@@ -0,0 +1,43 @@
+// |jit-test| --baseline-offthread-compile=on; --baseline-batch-size=2; --baseline-warmup-threshold=10; skip-if: !getJitCompilerOptions()["baseline.enable"]
+
+// Attaching a debugger while a Baseline batch is compiling off-thread must not
+// link code compiled without debug instrumentation: breakpoints and onStep
+// set afterwards have to fire.
+
+var g = newGlobal({newCompartment: true});
+g.eval(`
+  function f(x) { return x + 1; }
+  function h(x) { return x * 2; }
+  function run(n) {
+    var sum = 0;
+    for (var i = 0; i < n; i++) {
+      sum += f(i) + h(i);
+    }
+    return sum;
+  }
+`);
+
+// Warm up enough to queue f and h, then attach before the batch can link.
+assertEq(g.run(15), 15 * 14 / 2 + 15 + 15 * 14);
+
+var dbg = new Debugger(g);
+var fw = dbg.makeGlobalObjectReference(g).getOwnPropertyDescriptor("f").value;
+var hits = 0;
+fw.script.setBreakpoint(fw.script.getPossibleBreakpointOffsets()[0], {
+  hit() { hits++; }
+});
+
+var steps = 0;
+dbg.onEnterFrame = frame => {
+  if (frame.callee === fw) {
+    frame.onStep = () => { steps++; };
+  }
+};
+
+assertEq(g.run(20), 20 * 19 / 2 + 20 + 20 * 19);
+assertEq(hits, 20);
+assertEq(steps > 0, true);
+
+// Detaching and recompiling still gives correct results.
+dbg.removeAllDebuggees();
+assertEq(g.run(50), 50 * 49 / 2 + 50 + 50 * 49);
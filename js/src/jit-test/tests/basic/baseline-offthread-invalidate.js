@@ -0,0 +1,31 @@
+// |jit-test| --baseline-offthread-compile=on; --baseline-batch-size=3; --baseline-warmup-threshold=10; skip-if: !getJitCompilerOptions()["baseline.enable"]
+
+// Baseline code compiled off-thread must not be linked to a script whose
+// JitScript was discarded and recreated after the compile started: the code
+// would use the old ICScript's stubs and fallback counters.
+
+function makeFunction(i) {
+  return new Function("o", "return o.x + o.y + " + i + ";");
+}
+
+for (var round = 0; round < 20; round++) {
+  var fs = [makeFunction(0), makeFunction(1), makeFunction(2)];
+  var sum = 0;
+  for (var j = 0; j < 12; j++) {
+    for (var f of fs) {
+      sum += f({x: j, y: 1});
+    }
+  }
+
+  // Drop the JitScripts while the batch may still be pending, then run again
+  // so new ones are created and warmed up with different shapes.
+  gc(this, "shrinking");
+  relazifyFunctions();
+
+  for (var j = 0; j < 30; j++) {
+    for (var i = 0; i < fs.length; i++) {
+      assertEq(fs[i]({y: 1, z: 0, x: j}), j + 1 + i);
+      assertEq(fs[i]({x: "a", y: "b"}), "ab" + i);
+    }
+  }
+}
@@ -0,0 +1,79 @@
+// startsWith and endsWith look at rope children without flattening shallow
+// ropes, and flatten deep ones or when the compared range straddles two
+// children. All of them must give the same answers as on flat strings.
+
+// Checks are done on a fresh rope each time, as a check which straddles two
+// children flattens the rope.
+function check(make, flat) {
+  assertEq(make(flat).length, flat.length);
+  var searches = [];
+  for (var len of [0, 1, 2, 3, 5]) {
+    for (var i = 0; i + len <= flat.length; i++) {
+      searches.push([flat.substring(i, i + len), i]);
+    }
+  }
+  searches.push(["x", 0], ["zz", 3], [flat + "a", 0]);
+
+  for (var [search, pos] of searches) {
+    assertEq(make(flat).startsWith(search, pos), flat.startsWith(search, pos));
+    assertEq(make(flat).endsWith(search, pos + search.length),
+             flat.endsWith(search, pos + search.length));
+    assertEq(make(flat).startsWith(search), flat.startsWith(search));
+    assertEq(make(flat).endsWith(search), flat.endsWith(search));
+  }
+}
+
+// Balanced, left-leaning and right-leaning ropes, so the compared ranges fall
+// within children at every level and straddle boundaries between them.
+function balanced(s) {
+  if (s.length <= 2) {
+    return s;
+  }
+  var mid = s.length >> 1;
+  return newRope(balanced(s.substring(0, mid)), balanced(s.substring(mid)));
+}
+function leftLeaning(s) {
+  var rope = s.substring(0, 1);
+  for (var i = 1; i < s.length; i++) {
+    rope = newRope(rope, s.substring(i, i + 1));
+  }
+  return rope;
+}
+function rightLeaning(s) {
+  var rope = s.substring(s.length - 1);
+  for (var i = s.length - 2; i >= 0; i--) {
+    rope = newRope(s.substring(i, i + 1), rope);
+  }
+  return rope;
+}
+
+var flat = "abcdefghijklmnopqrstuvwxyz0123456789";
+for (var make of [balanced, leftLeaning, rightLeaning]) {
+  check(make, flat);
+  check(make, "ሴ" + flat + "噸");
+}
+
+// A shallow rope isn't flattened when the range is within one child.
+var shallow = newRope("abcdefghijklmnopqrstuvwxyz", "0123456789");
+assertEq(shallow.startsWith("abc"), true);
+assertEq(shallow.endsWith("789"), true);
+assertEq(isRope(shallow), true);
+
+// It is when the range straddles the two children.
+assertEq(shallow.startsWith("yz01", 24), true);
+assertEq(isRope(shallow), false);
+
+// Deep ropes are flattened rather than walked all the way down.
+var deep = leftLeaning(flat);
+assertEq(deep.startsWith("a"), true);
+assertEq(isRope(deep), false);
+
+// Appending and checking the prefix in a loop stays linear: the deep left
+// spine gets flattened once instead of being walked on every check.
+var s = "prefix:";
+for (var i = 0; i < 100000; i++) {
+  s += "chunk" + (i % 10);
+  assertEq(s.startsWith("prefix:chunk0"), true);
+  assertEq(s.endsWith("chunk" + (i % 10)), true);
+}
+assertEq(s.length, "prefix:".length + 100000 * "chunk0".length);
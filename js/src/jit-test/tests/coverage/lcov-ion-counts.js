@@ -0,0 +1,65 @@
+// |jit-test| --code-coverage; --ion-eager; --ion-offthread-compile=off; skip-if: !isLcovEnabled() || !getJitCompilerOptions()["ion.enable"]
+
+// Line, function and branch hit counts collected while Ion code runs must
+// match the ones collected by the interpreters alone, including for the
+// blocks Baseline resumes in after a bailout.
+//
+// Loops are kept out of the measured code: an OSR entry counts its loop head
+// once more.
+
+var source = `
+function f(x, bail) {
+  var r = 0;
+  if (x & 1) {
+    r += 1;
+  } else {
+    r -= 1;
+  }
+  seen.push(inIon());
+  if (bail) {
+    bailout();
+    r += 10;
+  }
+  switch (x % 3) {
+    case 0:
+      r *= 2;
+      break;
+    case 1:
+      r *= 3;
+      break;
+    default:
+      r = -r;
+  }
+  return x > 20 ? r : -r;
+}
+var seen = [];
+var inputs = Array.from({length: 40}, (_, i) => i);
+var results = inputs.map(x => f(x, x == 25 || x == 33));
+`;
+
+function runWithCoverage() {
+  var g = newGlobal();
+  g.evaluate(source, {fileName: "lcov-ion-counts-source.js"});
+  return {
+    lcov: getLcovInfo(g),
+    results: g.results.join(),
+    ranInIon: g.seen.includes(true),
+  };
+}
+
+function hitCounts(lcov) {
+  return lcov.split("\n")
+             .filter(line => /^(FNDA|DA|BRDA):/.test(line))
+             .join("\n");
+}
+
+var withIon = runWithCoverage();
+assertEq(withIon.ranInIon, true);
+
+setJitCompilerOption("ion.enable", 0);
+setJitCompilerOption("baseline.enable", 0);
+var interpreted = runWithCoverage();
+assertEq(interpreted.ranInIon, false);
+
+assertEq(withIon.results, interpreted.results);
+assertEq(hitCounts(withIon.lcov), hitCounts(interpreted.lcov));
@@ -0,0 +1,55 @@
+// Minor GCs sweep per-zone tables on helper threads when there are several
+// zones. Exercise that path, including nursery eviction from a major GC.
+
+gcparam("parallelMinorGCSweepingEnabled", 1);
+assertEq(gcparam("parallelMinorGCSweepingEnabled"), 1);
+
+var globals = [];
+for (var i = 0; i < 4; i++) {
+  var g = newGlobal({newCompartment: true});
+  g.evaluate(`
+    var map = new WeakMap();
+    var keys = [];
+    function churn(n) {
+      for (var j = 0; j < n; j++) {
+        var key = {j};
+        map.set(key, {value: "v" + j});
+        if (j % 4 === 0) {
+          keys.push(key);
+        }
+      }
+    }
+  `);
+  globals.push(g);
+}
+
+// Cross-zone string wrappers end up in the per-zone wrapper maps.
+function crossZoneStrings(g, n) {
+  for (var j = 0; j < n; j++) {
+    g.keys.push("str" + j + "x".repeat(j % 8));
+  }
+}
+
+for (var round = 0; round < 10; round++) {
+  for (var g of globals) {
+    g.churn(200);
+    crossZoneStrings(g, 20);
+  }
+  minorgc();
+  if (round % 3 === 0) {
+    gc();
+  }
+}
+
+for (var g of globals) {
+  assertEq(g.evaluate("keys.every(k => typeof k === 'string' || map.has(k))"),
+           true);
+}
+
+// The serial path still works with the parameter turned off.
+gcparam("parallelMinorGCSweepingEnabled", 0);
+for (var g of globals) {
+  g.churn(100);
+}
+minorgc();
+gc();
@@ -0,0 +1,60 @@
+// |jit-test| --ion-eager; --ion-offthread-compile=off; skip-if: typeof Intl === "undefined"
+
+// The inlined Date.prototype.getFullYear, getMonth and getDate must return
+// the same local date as the interpreter, including around daylight saving
+// time transitions and for invalid dates.
+
+setTimeZone("America/Los_Angeles");
+
+function components(d) {
+  return d.getFullYear() + "-" + d.getMonth() + "-" + d.getDate();
+}
+
+function run() {
+  var hour = 60 * 60 * 1000;
+  var times = [];
+
+  // Both DST transitions of 2021 (2021-03-14 10:00 UTC and 2021-11-07
+  // 09:00 UTC), in half-hour steps, and the UTC midnights around them, where
+  // the local date differs from the UTC date.
+  for (var start of [Date.UTC(2021, 2, 14, 10), Date.UTC(2021, 10, 7, 9)]) {
+    for (var t = start - 12 * hour; t <= start + 12 * hour; t += hour / 2) {
+      times.push(t);
+    }
+  }
+
+  // The end of a leap year and the start of the next one.
+  for (var t = Date.UTC(2024, 11, 31, 0); t <= Date.UTC(2025, 0, 1, 12);
+       t += hour) {
+    times.push(t);
+  }
+
+  var out = [];
+  for (var i = 0; i < times.length; i++) {
+    out.push(components(new Date(times[i])));
+
+    // Invalid dates are mixed in once the getters have been compiled.
+    if (i % 7 == 0) {
+      out.push(components(new Date(NaN)));
+    }
+  }
+
+  // A date which is invalidated after its local time was cached.
+  var d = new Date(Date.UTC(2021, 2, 14, 10));
+  out.push(components(d));
+  d.setTime(NaN);
+  out.push(components(d));
+
+  return out.join();
+}
+
+var withJit = run();
+assertEq(withJit.includes("NaN-NaN-NaN"), true);
+
+setJitCompilerOption("ion.enable", 0);
+setJitCompilerOption("baseline.enable", 0);
+var interpreted = run();
+
+assertEq(withJit, interpreted);
+
+setTimeZone(undefined);
@@ -0,0 +1,69 @@
+// |jit-test| --ion-eager; --ion-offthread-compile=off; skip-if: !getJitCompilerOptions()["ion.enable"]
+
+// Lambdas which are only guarded and read for their environment after
+// inlining aren't allocated. The results must match the interpreter's, also
+// when the lambda escapes after its guards or is recovered on bailout.
+
+function apply(fn, x) {
+  return fn(x);
+}
+
+function applyAndKeep(fn, x, keep) {
+  var r = fn(x);
+  if (keep) {
+    kept.push(fn);
+  }
+  return r;
+}
+
+function applyAndBail(fn, x, bail) {
+  var r = fn(x);
+  if (bail) {
+    bailout();
+    r += fn(x);
+  }
+  return r;
+}
+
+var kept = [];
+
+function run() {
+  var out = [];
+  kept = [];
+
+  // Environment reads, with a captured binding per iteration and one shared
+  // binding which is changed by another closure.
+  var shared = 0;
+  var bump = () => shared++;
+  for (let i = 0; i < 100; i++) {
+    out.push(apply(x => x + i * 2 + shared, i));
+    bump();
+  }
+
+  // The lambda escapes after its guards on some iterations. The escaped
+  // lambdas must see the environment they were created with.
+  for (let i = 0; i < 100; i++) {
+    out.push(applyAndKeep(x => x * i, 3, i % 10 == 0));
+  }
+  out.push(kept.length);
+  out.push(kept.map(f => f(2)).join());
+  out.push(kept.every(f => typeof f === "function" && f.length === 1));
+
+  // Bailing out after the lambda has been replaced recovers it with the same
+  // environment.
+  for (let i = 0; i < 100; i++) {
+    var captured = i;
+    out.push(applyAndBail(x => x + captured, 1, i == 50 || i == 90));
+    captured = -1;
+  }
+
+  return out.join();
+}
+
+var withIon = run();
+
+setJitCompilerOption("ion.enable", 0);
+setJitCompilerOption("baseline.enable", 0);
+var interpreted = run();
+
+assertEq(withIon, interpreted);
@@ -0,0 +1,154 @@
+// |jit-test| --ion-eager; --ion-offthread-compile=off
+
+// Map.prototype.set and Set.prototype.add calls are inlined when the callee
+// is the native and |this| is a Map or Set. The inlined calls must behave
+// like the natives.
+
+function mapSet(m, k, v) {
+  return m.set(k, v);
+}
+function setAdd(s, k) {
+  return s.add(k);
+}
+
+// The result is the receiver.
+function testReturnsReceiver() {
+  var m = new Map();
+  var s = new Set();
+  for (var i = 0; i < 100; i++) {
+    assertEq(mapSet(m, i, i * 2), m);
+    assertEq(setAdd(s, i), s);
+  }
+  assertEq(m.size, 100);
+  assertEq(s.size, 100);
+  assertEq(m.get(99), 198);
+  assertEq(s.has(99), true);
+}
+testReturnsReceiver();
+
+// -0 keys are stored as +0.
+function testNegativeZero() {
+  for (var i = 0; i < 100; i++) {
+    var m = new Map();
+    var s = new Set();
+    mapSet(m, -0, i);
+    setAdd(s, -0);
+    assertEq(m.size, 1);
+    assertEq(s.size, 1);
+    assertEq(Object.is([...m.keys()][0], 0), true);
+    assertEq(Object.is([...s][0], 0), true);
+    assertEq(m.get(0), i);
+    assertEq(s.has(0), true);
+
+    mapSet(m, 0, i + 1);
+    setAdd(s, 0);
+    assertEq(m.size, 1);
+    assertEq(s.size, 1);
+    assertEq(m.get(-0), i + 1);
+  }
+}
+testNegativeZero();
+
+// All NaNs are the same key.
+function testNaN() {
+  var otherNaN = new Float64Array(new Uint32Array([1, 0x7ff80000]).buffer)[0];
+  for (var i = 0; i < 100; i++) {
+    var m = new Map();
+    var s = new Set();
+    mapSet(m, NaN, 1);
+    mapSet(m, 0 / 0, 2);
+    mapSet(m, otherNaN, i);
+    setAdd(s, NaN);
+    setAdd(s, 0 / 0);
+    setAdd(s, otherNaN);
+    assertEq(m.size, 1);
+    assertEq(s.size, 1);
+    assertEq(m.get(NaN), i);
+    assertEq(s.has(NaN), true);
+  }
+}
+testNaN();
+
+// Subclass instances have the Map and Set classes, and use the inherited
+// natives unless they're overridden.
+class MyMap extends Map {}
+class MySet extends Set {}
+class CountingMap extends Map {
+  constructor() {
+    super();
+    this.count = 0;
+  }
+  set(k, v) {
+    this.count++;
+    return super.set(k, v);
+  }
+}
+function testSubclass() {
+  var m = new MyMap();
+  var s = new MySet();
+  var c = new CountingMap();
+  for (var i = 0; i < 100; i++) {
+    assertEq(mapSet(m, i, i), m);
+    assertEq(setAdd(s, i), s);
+    assertEq(mapSet(c, i, i), c);
+  }
+  assertEq(m.size, 100);
+  assertEq(s.size, 100);
+  assertEq(c.size, 100);
+  assertEq(c.count, 100);
+}
+testSubclass();
+
+// Replacing the natives fails the callee guard and bails out of the inlined
+// code, and the replacements are called.
+function testModifiedPrototype() {
+  var m = new Map();
+  var s = new Set();
+  for (var i = 0; i < 100; i++) {
+    mapSet(m, i, i);
+    setAdd(s, i);
+  }
+
+  var origSet = Map.prototype.set;
+  var origAdd = Set.prototype.add;
+  var calls = 0;
+  Map.prototype.set = function(k, v) {
+    calls++;
+    return origSet.call(this, k, v + 1);
+  };
+  Set.prototype.add = function(k) {
+    calls++;
+    return origAdd.call(this, k + 1000);
+  };
+  try {
+    for (var i = 0; i < 100; i++) {
+      assertEq(mapSet(m, i, i), m);
+      assertEq(setAdd(s, i), s);
+    }
+  } finally {
+    Map.prototype.set = origSet;
+    Set.prototype.add = origAdd;
+  }
+
+  assertEq(calls, 200);
+  assertEq(m.size, 100);
+  assertEq(m.get(50), 51);
+  assertEq(s.size, 200);
+  assertEq(s.has(1050), true);
+}
+testModifiedPrototype();
+
+// Non-Map and non-Set receivers still throw.
+function testWrongReceiver() {
+  for (var i = 0; i < 100; i++) {
+    var o = i < 90 ? new Map() : {set: Map.prototype.set};
+    var ex = null;
+    try {
+      mapSet(o, i, i);
+    } catch (e) {
+      ex = e;
+    }
+    assertEq(ex instanceof TypeError, i >= 90);
+  }
+}
+testWrongReceiver();
@@ -0,0 +1,107 @@
+// |jit-test| --ion-regalloc=simple; --ion-eager; --ion-offthread-compile=off
+
+// Exercise the simple register allocator on small functions covering values
+// live across blocks, calls, doubles, GC things at safepoints and bailouts.
+
+function mixed(a, b, o) {
+  var d = a * 0.5;
+  var s = "";
+  for (var i = 0; i < b; i++) {
+    if (i & 1) {
+      d += o.x;
+      s += i;
+    } else {
+      d -= Math.sqrt(i);
+      o = {x: o.x + 1};
+    }
+  }
+  return [d, s, o.x];
+}
+
+function reference(a, b, o) {
+  var d = a * 0.5;
+  var s = "";
+  var x = o.x;
+  for (var i = 0; i < b; i++) {
+    if (i & 1) {
+      d += x;
+      s += i;
+    } else {
+      d -= Math.sqrt(i);
+      x += 1;
+    }
+  }
+  return [d, s, x];
+}
+
+for (var n = 0; n < 200; n++) {
+  var got = mixed(n, n % 17, {x: n});
+  var expected = reference(n, n % 17, {x: n});
+  assertEq(got[0], expected[0]);
+  assertEq(got[1], expected[1]);
+  assertEq(got[2], expected[2]);
+}
+
+// Values held in registers and stack slots must survive a bailout.
+function withBailout(a, b, c) {
+  var x = a + b;
+  var y = a * c + 0.25;
+  var z = {a, b, c};
+  if (a === 150) {
+    bailout();
+  }
+  return x + y + z.a + z.b + z.c;
+}
+
+for (var n = 0; n < 200; n++) {
+  assertEq(withBailout(n, n + 1, n + 2),
+           (2 * n + 1) + (n * (n + 2) + 0.25) + (3 * n + 3));
+}
+
+// And exceptions thrown from a callee.
+function thrower(i) {
+  if (i % 50 === 49) {
+    throw i;
+  }
+  return i;
+}
+
+function catcher(n) {
+  var sum = 0.5;
+  var caught = 0;
+  for (var i = 0; i < n; i++) {
+    try {
+      sum += thrower(i);
+    } catch (e) {
+      caught += e;
+    }
+  }
+  return sum + caught * 2;
+}
+
+for (var n = 0; n < 20; n++) {
+  assertEq(catcher(200), 0.5 + (199 * 200) / 2 + (49 + 99 + 149 + 199));
+}
+
+// GC things kept alive across calls which trigger minor GCs.
+function allocating(n) {
+  var objs = [];
+  var last = {v: -1};
+  for (var i = 0; i < n; i++) {
+    var o = {v: i, prev: last};
+    if (i % 100 === 0) {
+      minorgc();
+    }
+    objs.push(o);
+    last = o;
+  }
+  var sum = 0;
+  for (var o = last; o.prev; o = o.prev) {
+    sum += o.v;
+  }
+  return sum + objs.length;
+}
+
+for (var n = 0; n < 5; n++) {
+  assertEq(allocating(1000), (999 * 1000) / 2 + 1000);
+}
@@ -0,0 +1,69 @@
+// |jit-test| --ion-simple-regalloc-threshold=2000; --ion-warmup-threshold=50; --ion-offthread-compile=off
+
+// Functions above the threshold fall back to the simple register allocator,
+// smaller ones keep using the backtracking allocator. Both must compute the
+// same results as the interpreter.
+
+function makeBody(numStatements) {
+  var lines = [
+    "var a = x | 0, b = y, c = 0.5, o = {v: 1};",
+    "if (inIon() === true) { ranInIon = true; }",
+  ];
+  for (var i = 0; i < numStatements; i++) {
+    switch (i % 5) {
+      case 0:
+        lines.push(`a = (a + ${i}) | 0;`);
+        break;
+      case 1:
+        lines.push(`b = b * 1.0001 + ${i % 7};`);
+        break;
+      case 2:
+        lines.push(`if (a & ${1 << (i % 8)}) { c += b; } else { c -= a; }`);
+        break;
+      case 3:
+        lines.push(`o = {v: o.v + (a & 3)};`);
+        break;
+      case 4:
+        lines.push(`c = Math.max(c, f(a, ${i}));`);
+        break;
+    }
+  }
+  lines.push("return [a, b, c, o.v];");
+  return lines.join("\n");
+}
+
+function f(a, i) {
+  return (a ^ i) & 0xff;
+}
+
+var ranInIon = false;
+
+function check(numStatements) {
+  var body = makeBody(numStatements);
+  var NumInputs = 20;
+
+  // Called fewer times than the Ion warm-up threshold, so these results come
+  // from the interpreter and Baseline.
+  var reference = new Function("x", "y", "f", body);
+  var expected = [];
+  for (var i = 0; i < NumInputs; i++) {
+    expected.push(reference(i, i * 0.5, f));
+  }
+
+  ranInIon = false;
+  var compiled = new Function("x", "y", "f", body);
+  for (var i = 0; i < 200; i++) {
+    var got = compiled(i % NumInputs, (i % NumInputs) * 0.5, f);
+    var want = expected[i % NumInputs];
+    assertEq(got.length, want.length);
+    for (var j = 0; j < got.length; j++) {
+      assertEq(got[j], want[j]);
+    }
+  }
+  assertEq(ranInIon, true);
+}
+
+// Small enough for the backtracking allocator.
+check(20);
+// Large enough for the simple allocator.
+check(1000);
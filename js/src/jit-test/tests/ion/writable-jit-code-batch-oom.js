@@ -0,0 +1,36 @@
+// |jit-test| --ion-eager; --ion-offthread-compile=off; skip-if: !('oomTest' in this)
+
+// Patching JIT code in a batch (profiler toggling and Ion invalidation) must
+// leave all code executable and runnable when recording a range fails with OOM.
+
+function f(x) {
+  return x + 1;
+}
+function g(x) {
+  return f(x) * 2;
+}
+
+function run() {
+  var sum = 0;
+  for (var i = 0; i < 50; i++) {
+    sum += g(i);
+  }
+  assertEq(sum, 2550);
+}
+
+run();
+
+oomTest(() => {
+  enableGeckoProfiling();
+  run();
+  disableGeckoProfiling();
+  run();
+});
+
+oomTest(() => {
+  run();
+  invalidate();
+  run();
+});
+
+run();
@@ -0,0 +1,46 @@
+load(libdir + "asserts.js");
+
+// Argument validation.
+assertErrorMessage(() => bench(), Error,
+                   "bench's first argument should be a function.");
+assertErrorMessage(() => bench({}), Error,
+                   "bench's first argument should be a function.");
+assertErrorMessage(() => bench(() => {}, 0), Error,
+                   "bench needs at least one run.");
+assertErrorMessage(() => bench(() => {}, -1), Error,
+                   "bench needs at least one run.");
+assertErrorMessage(() => bench(() => {}, 1, -1), Error,
+                   "bench's warm-up count can't be negative.");
+
+// Warm-up calls and measured runs are all made.
+var calls = 0;
+var result = bench(() => { calls++; }, 4, 2);
+assertEq(calls, 6);
+
+// Zero warm-ups is allowed, and undefined picks the defaults.
+calls = 0;
+bench(() => { calls++; }, 1, 0);
+assertEq(calls, 1);
+calls = 0;
+bench(() => { calls++; }, undefined, undefined);
+assertEq(calls, 13);
+
+// Exceptions from the function propagate.
+assertThrowsValue(() => bench(() => { throw 42; }), 42);
+
+// The result object.
+assertEq(JSON.stringify(Object.keys(result)),
+         '["runs","mean","stddev","ci95","min","max"]');
+assertEq(result.runs, 4);
+for (var key of ["mean", "stddev", "ci95", "min", "max"]) {
+  assertEq(typeof result[key], "number");
+  assertEq(result[key] >= 0, true);
+}
+assertEq(result.min <= result.max, true);
+
+// With a single run there's no spread.
+var single = bench(() => {}, 1, 0);
+assertEq(single.runs, 1);
+assertEq(single.stddev, 0);
+assertEq(single.ci95, 0);
+assertEq(single.min, single.max);
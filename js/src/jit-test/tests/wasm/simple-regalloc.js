@@ -0,0 +1,76 @@
+// |jit-test| --ion-regalloc=simple; --wasm-compiler=optimizing; skip-if: !wasmIsSupported() || !wasmCompileMode().includes("ion")
+
+// Wasm Ion shares the register allocation path with JS Ion. Check a function
+// with loops, calls, float and int64 values that live across blocks, and a
+// large generated function.
+
+var ins = new WebAssembly.Instance(new WebAssembly.Module(wasmTextToBinary(`
+  (module
+    (func $callee (param i32 f64) (result f64)
+      (f64.add (f64.convert_i32_s (local.get 0)) (local.get 1)))
+
+    (func (export "loop") (param $n i32) (result f64)
+      (local $i i32) (local $d f64) (local $l i64)
+      (local.set $d (f64.const 0.5))
+      (block $done
+        (loop $top
+          (br_if $done (i32.ge_s (local.get $i) (local.get $n)))
+          (local.set $l (i64.add (local.get $l) (i64.extend_i32_s (local.get $i))))
+          (if (i32.and (local.get $i) (i32.const 1))
+            (then (local.set $d (call $callee (local.get $i) (local.get $d))))
+            (else (local.set $d (f64.sub (local.get $d) (f64.const 0.25)))))
+          (local.set $i (i32.add (local.get $i) (i32.const 1)))
+          (br $top)))
+      (f64.add (local.get $d) (f64.convert_i64_s (local.get $l))))
+  )`)));
+
+function reference(n) {
+  var d = 0.5;
+  var l = 0;
+  for (var i = 0; i < n; i++) {
+    l += i;
+    if (i & 1) {
+      d = i + d;
+    } else {
+      d -= 0.25;
+    }
+  }
+  return d + l;
+}
+
+for (var n of [0, 1, 2, 10, 1000]) {
+  assertEq(ins.exports.loop(n), reference(n));
+}
+
+// A large straight-line function with many values live at once.
+var NumLocals = 200;
+var body = [];
+for (var i = 0; i < NumLocals; i++) {
+  body.push(`(local.set ${i + 1} (i32.add (local.get 0) (i32.const ${i * 3})))`);
+}
+var sum = "(local.get 1)";
+for (var i = 1; i < NumLocals; i++) {
+  sum = `(i32.add ${sum} (i32.mul (local.get ${i + 1}) (i32.const ${i % 5})))`;
+}
+var bigIns = new WebAssembly.Instance(new WebAssembly.Module(wasmTextToBinary(`
+  (module
+    (func (export "big") (param i32) (result i32)
+      (local ${"i32 ".repeat(NumLocals)})
+      ${body.join("\n")}
+      ${sum}))`)));
+
+function bigReference(x) {
+  var locals = [];
+  for (var i = 0; i < NumLocals; i++) {
+    locals.push((x + i * 3) | 0);
+  }
+  var s = locals[0];
+  for (var i = 1; i < NumLocals; i++) {
+    s = (s + Math.imul(locals[i], i % 5)) | 0;
+  }
+  return s;
+}
+
+for (var x of [0, 1, -7, 123456, 0x7fffffff]) {
+  assertEq(bigIns.exports.big(x), bigReference(x));
+}
@@ -123,6 +123,7 @@ namespace jit {
   _(js::jit::NumberBigIntCompare<ComparisonKind::GreaterThanOrEqual>) \
   _(js::jit::BigIntNumberCompare<ComparisonKind::GreaterThanOrEqual>) \
   _(js::jit::CreateMatchResultFallbackFunc)                           \
+  _(js::jit::DateFillLocalTimeSlots)                                  \
   _(js::jit::EqualStringsHelperPure)                                  \
   _(js::jit::FinishBailoutToBaseline)                                 \
   _(js::jit::FrameIsDebuggeeCheck)                                    \
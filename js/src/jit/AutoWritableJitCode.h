@@ -23,16 +23,62 @@
 
 namespace js::jit {
 
+// Batches the protection changes of the AutoWritableJitCode(Fallible)
+// instances created while it's alive. Code is made writable the first time it
+// is written to, and all of it is made executable again when the batch is
+// destroyed. Ranges which touch are merged, so neighbouring code in the same
+// pool is reprotected with a single system call.
+//
+// Code written to during the batch must not run until the batch has been
+// destroyed. Nested batches are allowed, the outermost one does all the work.
+class MOZ_RAII AutoWritableJitCodeBatch {
+  struct Range {
+    uintptr_t start;
+    uintptr_t end;
+  };
+
+  JSRuntime* rt_;
+  Vector<Range, 8, SystemAllocPolicy> ranges_;
+  bool outermost_ = false;
+
+ public:
+  explicit AutoWritableJitCodeBatch(JSRuntime* rt) : rt_(rt) {
+    if (!rt_->autoWritableJitCodeBatch()) {
+      rt_->setAutoWritableJitCodeBatch(this);
+      outermost_ = true;
+    }
+  }
+  ~AutoWritableJitCodeBatch();
+
+  // Whether [addr, addr + size) has already been made writable during this
+  // batch.
+  bool contains(void* addr, size_t size) const;
+
+  // Record that [addr, addr + size) has been made writable. Returns false on
+  // OOM, in which case the caller must make the code executable again itself
+  // and then call restoreWritable.
+  [[nodiscard]] bool add(void* addr, size_t size);
+
+  // Called after [addr, addr + size) has been made executable outside of the
+  // batch. Makes the pages it shares with ranges already recorded writable
+  // again, as code on them may still be written to before the batch ends.
+  void restoreWritable(void* addr, size_t size);
+};
+
 // This class ensures JIT code is executable on its destruction. Creators
 // must call makeWritable(), and not attempt to write to the buffer if it fails.
 //
 // AutoWritableJitCodeFallible may only fail to make code writable; it cannot
 // fail to make JIT code executable (because the creating code has no chance to
 // recover from a failed destructor).
+//
+// If an AutoWritableJitCodeBatch is active, making the code executable again
+// is left to the batch.
 class MOZ_RAII AutoWritableJitCodeFallible {
   JSRuntime* rt_;
   void* addr_;
   size_t size_;
+  bool batched_ = false;
 
  public:
   AutoWritableJitCodeFallible(JSRuntime* rt, void* addr, size_t size)
@@ -48,10 +94,24 @@ class MOZ_RAII AutoWritableJitCodeFallible {
                                     code->bufferSize()) {}
 
   [[nodiscard]] bool makeWritable() {
-    return ExecutableAllocator::makeWritable(addr_, size_);
+    AutoWritableJitCodeBatch* batch = rt_->autoWritableJitCodeBatch();
+    if (batch && batch->contains(addr_, size_)) {
+      batched_ = true;
+      return true;
+    }
+    if (!ExecutableAllocator::makeWritable(addr_, size_)) {
+      return false;
+    }
+    batched_ = batch && batch->add(addr_, size_);
+    return true;
   }
 
   ~AutoWritableJitCodeFallible() {
+    if (batched_) {
+      rt_->toggleAutoWritableJitCodeActive(false);
+      return;
+    }
+
     mozilla::TimeStamp startTime = mozilla::TimeStamp::Now();
     auto timer = mozilla::MakeScopeExit([&] {
       if (Realm* realm = rt_->mainContextFromOwnThread()->realm()) {
@@ -62,6 +122,9 @@ class MOZ_RAII AutoWritableJitCodeFallible {
     if (!ExecutableAllocator::makeExecutableAndFlushICache(addr_, size_)) {
       MOZ_CRASH();
     }
+    if (AutoWritableJitCodeBatch* batch = rt_->autoWritableJitCodeBatch()) {
+      batch->restoreWritable(addr_, size_);
+    }
     rt_->toggleAutoWritableJitCodeActive(false);
   }
 };
@@ -2087,7 +2087,9 @@ ICAttachResult js::jit::AttachBaselineCacheIRStub(
   CacheIRStubInfo* stubInfo;
   CacheIRStubKey::Lookup lookup(kind, ICStubEngine::Baseline,
                                 writer.codeStart(), writer.codeLength());
-  JitCode* code = jitZone->getBaselineCacheIRStubCode(lookup, &stubInfo);
+  uint64_t majorGCNumber = cx->runtime()->gc.majorGCCount();
+  JitCode* code =
+      jitZone->getBaselineCacheIRStubCode(lookup, majorGCNumber, &stubInfo);
   if (!code) {
     // We have to generate stub code.
     TempAllocator temp(&cx->tempLifoAlloc());
@@ -2117,7 +2119,8 @@ ICAttachResult js::jit::AttachBaselineCacheIRStub(
     }
 
     CacheIRStubKey key(stubInfo);
-    if (!jitZone->putBaselineCacheIRStubCode(lookup, key, code)) {
+    if (!jitZone->putBaselineCacheIRStubCode(lookup, key, code,
+                                             majorGCNumber)) {
       return ICAttachResult::OOM;
     }
   }
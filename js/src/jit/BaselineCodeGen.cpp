@@ -74,10 +74,12 @@ BaselineCompilerHandler::BaselineCompilerHandler(JSContext* cx,
 #endif
       script_(script),
       pc_(script->code()),
+      globalLexicalEnvironment_(&cx->global()->lexicalEnvironment()),
+      globalThis_(globalLexicalEnvironment_->thisObject()),
       icEntryIndex_(0),
       compileDebugInstrumentation_(script->isDebuggee()),
-      ionCompileable_(IsIonEnabled(cx) && CanIonCompileScript(cx, script)) {
-}
+      ionCompileable_(IsIonEnabled(cx) && CanIonCompileScript(cx, script)),
+      compilingOffThread_(false) {}
 
 BaselineInterpreterHandler::BaselineInterpreterHandler(JSContext* cx,
                                                        MacroAssembler& masm)
@@ -151,7 +153,7 @@ bool BaselineCompilerHandler::recordCallRetAddr(JSContext* cx,
                 retAddrEntries_.back().returnOffset().offset() < retOffset);
 
   if (!retAddrEntries_.emplaceBack(pcOffset, kind, CodeOffset(retOffset))) {
-    ReportOutOfMemory(cx);
+    reportOutOfMemory(cx);
     return false;
   }
 
@@ -193,16 +195,12 @@ bool BaselineInterpreterHandler::addDebugInstrumentationOffset(
   return true;
 }
 
+static void CreateAllocSitesForICChain(JSScript* script, uint32_t entryIndex);
+
 MethodStatus BaselineCompiler::compile() {
   AutoCreatedBy acb(masm, "BaselineCompiler::compile");
 
   JSScript* script = handler.script();
-  JitSpew(JitSpew_BaselineScripts, "Baseline compiling script %s:%u:%u (%p)",
-          script->filename(), script->lineno(), script->column(), script);
-
-  JitSpew(JitSpew_Codegen, "# Emitting baseline code for script %s:%u:%u",
-          script->filename(), script->lineno(), script->column());
-
   AutoIncrementalTimer timer(cx->realm()->timers.baselineCompileTime);
 
   AutoKeepJitScripts keepJitScript(cx);
@@ -223,6 +221,38 @@ MethodStatus BaselineCompiler::compile() {
 
   MOZ_ASSERT(!script->hasBaselineScript());
 
+  MethodStatus status = emitCode();
+  if (status != Method_Compiled) {
+    return status;
+  }
+
+  AutoCreatedBy acb2(masm, "exception_tail");
+  Linker linker(masm);
+  if (masm.oom()) {
+    ReportOutOfMemory(cx);
+    return Method_Error;
+  }
+
+  JitCode* code = linker.newCode(cx, CodeKind::Baseline);
+  if (!code) {
+    return Method_Error;
+  }
+
+  if (!finishCompile(code)) {
+    return Method_Error;
+  }
+
+  return Method_Compiled;
+}
+
+MethodStatus BaselineCompiler::emitCode() {
+  JSScript* script = handler.script();
+  JitSpew(JitSpew_BaselineScripts, "Baseline compiling script %s:%u:%u (%p)",
+          script->filename(), script->lineno(), script->column(), script);
+
+  JitSpew(JitSpew_Codegen, "# Emitting baseline code for script %s:%u:%u",
+          script->filename(), script->lineno(), script->column());
+
   if (!emitPrologue()) {
     return Method_Error;
   }
@@ -240,16 +270,14 @@ MethodStatus BaselineCompiler::compile() {
     return Method_Error;
   }
 
-  AutoCreatedBy acb2(masm, "exception_tail");
-  Linker linker(masm);
-  if (masm.oom()) {
-    ReportOutOfMemory(cx);
-    return Method_Error;
-  }
+  return Method_Compiled;
+}
 
-  JitCode* code = linker.newCode(cx, CodeKind::Baseline);
-  if (!code) {
-    return Method_Error;
+bool BaselineCompiler::finishCompile(JitCode* code) {
+  JSScript* script = handler.script();
+
+  for (uint32_t entryIndex : handler.allocSiteICEntries()) {
+    CreateAllocSitesForICChain(script, entryIndex);
   }
 
   UniquePtr<BaselineScript> baselineScript(
@@ -261,7 +289,7 @@ MethodStatus BaselineCompiler::compile() {
           debugTrapEntries_.length(), script->resumeOffsets().size()),
       JS::DeletePolicy<BaselineScript>(cx->runtime()));
   if (!baselineScript) {
-    return Method_Error;
+    return false;
   }
 
   baselineScript->setMethod(code);
@@ -300,7 +328,7 @@ MethodStatus BaselineCompiler::compile() {
     // Generate profiling string.
     UniqueChars str = GeckoProfilerRuntime::allocProfileString(cx, script);
     if (!str) {
-      return Method_Error;
+      return false;
     }
 
     JitcodeGlobalEntry::BaselineEntry entry;
@@ -311,7 +339,7 @@ MethodStatus BaselineCompiler::compile() {
     if (!globalTable->addEntry(entry)) {
       entry.destroy();
       ReportOutOfMemory(cx);
-      return Method_Error;
+      return false;
     }
 
     // Mark the jitcode as having a bytecode map.
@@ -326,7 +354,7 @@ MethodStatus BaselineCompiler::compile() {
   vtune::MarkScript(code, script, "baseline");
 #endif
 
-  return Method_Compiled;
+  return true;
 }
 
 // On most platforms we use a dedicated bytecode PC register to avoid many
@@ -608,7 +636,15 @@ bool BaselineCompilerCodeGen::emitNextIC() {
   MOZ_ASSERT(BytecodeOpHasIC(JSOp(*handler.pc())));
 
   if (BytecodeOpCanHaveAllocSite(JSOp(*handler.pc()))) {
-    CreateAllocSitesForICChain(script, entryIndex);
+    // The IC chain is owned by the main thread, so off-thread compilations
+    // create the alloc sites when the code is linked.
+    if (handler.compilingOffThread()) {
+      if (!handler.allocSiteICEntries().append(entryIndex)) {
+        return false;
+      }
+    } else {
+      CreateAllocSitesForICChain(script, entryIndex);
+    }
   }
 
   // Load stub pointer into ICStubReg.
@@ -621,7 +657,7 @@ bool BaselineCompilerCodeGen::emitNextIC() {
 
   RetAddrEntry::Kind kind = RetAddrEntry::Kind::IC;
   if (!handler.retAddrEntries().emplaceBack(pcOffset, kind, returnOffset)) {
-    ReportOutOfMemory(cx);
+    handler.reportOutOfMemory(cx);
     return false;
   }
 
@@ -883,7 +919,7 @@ void BaselineInterpreterCodeGen::subtractScriptSlotsSize(Register reg,
 template <>
 void BaselineCompilerCodeGen::loadGlobalLexicalEnvironment(Register dest) {
   MOZ_ASSERT(!handler.script()->hasNonSyntacticScope());
-  masm.movePtr(ImmGCPtr(&cx->global()->lexicalEnvironment()), dest);
+  masm.movePtr(ImmGCPtr(handler.globalLexicalEnvironment()), dest);
 }
 
 template <>
@@ -898,7 +934,7 @@ void BaselineInterpreterCodeGen::loadGlobalLexicalEnvironment(Register dest) {
 template <>
 void BaselineCompilerCodeGen::pushGlobalLexicalEnvironmentValue(
     ValueOperand scratch) {
-  frame.push(ObjectValue(cx->global()->lexicalEnvironment()));
+  frame.push(ObjectValue(*handler.globalLexicalEnvironment()));
 }
 
 template <>
@@ -911,8 +947,7 @@ void BaselineInterpreterCodeGen::pushGlobalLexicalEnvironmentValue(
 
 template <>
 void BaselineCompilerCodeGen::loadGlobalThisValue(ValueOperand dest) {
-  JSObject* thisObj = cx->global()->lexicalEnvironment().thisObject();
-  masm.moveValue(ObjectValue(*thisObj), dest);
+  masm.moveValue(ObjectValue(*handler.globalThis()), dest);
 }
 
 template <>
@@ -1303,7 +1338,7 @@ bool BaselineCompilerCodeGen::emitWarmUpCounterIncrement() {
     uint32_t pcOffset = script->pcToOffset(pc);
     uint32_t nativeOffset = masm.currentOffset();
     if (!handler.osrEntries().emplaceBack(pcOffset, nativeOffset)) {
-      ReportOutOfMemory(cx);
+      handler.reportOutOfMemory(cx);
       return false;
     }
   }
@@ -2416,6 +2451,8 @@ bool BaselineInterpreterCodeGen::emit_Object() {
 
 template <>
 bool BaselineCompilerCodeGen::emit_CallSiteObj() {
+  MOZ_ASSERT(!handler.compilingOffThread());
+
   RootedScript script(cx, handler.script());
   JSObject* cso = ProcessCallSiteObjOperation(cx, script, handler.pc());
   if (!cso) {
@@ -3190,6 +3227,11 @@ bool BaselineCompilerCodeGen::tryOptimizeBindGlobalName() {
   JSScript* script = handler.script();
   MOZ_ASSERT(!script->hasNonSyntacticScope());
 
+  // Looking up the binding can't be done off-thread. Use the IC instead.
+  if (handler.compilingOffThread()) {
+    return false;
+  }
+
   Rooted<GlobalObject*> global(cx, &script->global());
   Rooted<PropertyName*> name(cx, script->getName(handler.pc()));
   if (JSObject* binding = MaybeOptimizeBindGlobalName(cx, global, name)) {
@@ -3684,6 +3726,8 @@ bool BaselineCodeGen<Handler>::emit_DelName() {
 
 template <>
 bool BaselineCompilerCodeGen::emit_GetImport() {
+  MOZ_ASSERT(!handler.compilingOffThread());
+
   JSScript* script = handler.script();
   ModuleEnvironmentObject* env = GetModuleEnvironmentForScript(script);
   MOZ_ASSERT(env);
@@ -6065,6 +6109,8 @@ bool BaselineCodeGen<Handler>::emit_InitHomeObject() {
 
 template <>
 bool BaselineCompilerCodeGen::emit_BuiltinObject() {
+  MOZ_ASSERT(!handler.compilingOffThread());
+
   // Built-in objects are constants for a given global.
   auto kind = BuiltinObjectKind(GET_UINT8(handler.pc()));
   JSObject* builtin = BuiltinObjectOperation(cx, kind);
@@ -6140,6 +6186,7 @@ template <>
 bool BaselineCompilerCodeGen::emit_ImportMeta() {
   // Note: this is like the interpreter implementation, but optimized a bit by
   // calling GetModuleObjectForScript at compile-time.
+  MOZ_ASSERT(!handler.compilingOffThread());
 
   Rooted<ModuleObject*> module(cx, GetModuleObjectForScript(handler.script()));
   MOZ_ASSERT(module);
@@ -6348,7 +6395,7 @@ MethodStatus BaselineCompiler::emitBody() {
       uint32_t pcOffset = script->pcToOffset(handler.pc());
       uint32_t nativeOffset = masm.currentOffset();
       if (!resumeOffsetEntries_.emplaceBack(pcOffset, nativeOffset)) {
-        ReportOutOfMemory(cx);
+        handler.reportOutOfMemory(cx);
         return Method_Error;
       }
     }
@@ -6358,7 +6405,7 @@ MethodStatus BaselineCompiler::emitBody() {
       return Method_Error;
     }
 
-    perfSpewer_.recordInstruction(masm, op);
+    perfSpewer_.recordInstruction(masm, script, handler.pc());
 
 #define EMIT_OP(OP, ...)                                       \
   case JSOp::OP: {                                             \
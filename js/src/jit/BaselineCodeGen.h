@@ -15,6 +15,8 @@
 
 namespace js {
 
+class GlobalLexicalEnvironmentObject;
+
 namespace jit {
 
 enum class ScriptGCThingType {
@@ -37,7 +39,7 @@ class BaselineCodeGen {
   Handler handler;
 
   JSContext* cx;
-  StackMacroAssembler masm;
+  typename Handler::MacroAssemblerT masm;
 
   typename Handler::FrameInfoT& frame;
 
@@ -284,6 +286,11 @@ class BaselineCompilerHandler {
   FixedList<Label> labels_;
   RetAddrEntryVector retAddrEntries_;
 
+  // Indexes of IC entries whose alloc sites still have to be created, for
+  // off-thread compilations. See emitNextIC.
+  using ICEntryIndexVector = Vector<uint32_t, 0, SystemAllocPolicy>;
+  ICEntryIndexVector allocSiteICEntries_;
+
   // Native code offsets for OSR at JSOp::LoopHead ops.
   using OSREntryVector =
       Vector<BaselineScript::OSREntry, 16, SystemAllocPolicy>;
@@ -292,14 +299,22 @@ class BaselineCompilerHandler {
   JSScript* script_;
   jsbytecode* pc_;
 
+  // The global lexical environment and its |this| object, captured at
+  // construction so code generation doesn't have to look at the context's
+  // realm, which may change under an off-thread compilation.
+  GlobalLexicalEnvironmentObject* globalLexicalEnvironment_;
+  JSObject* globalThis_;
+
   // Index of the current ICEntry in the script's JitScript.
   uint32_t icEntryIndex_;
 
   bool compileDebugInstrumentation_;
   bool ionCompileable_;
+  bool compilingOffThread_;
 
  public:
   using FrameInfoT = CompilerFrameInfo;
+  using MacroAssemblerT = BaselineMacroAssembler;
 
   BaselineCompilerHandler(JSContext* cx, MacroAssembler& masm,
                           TempAllocator& alloc, JSScript* script);
@@ -338,6 +353,25 @@ class BaselineCompilerHandler {
 
   bool maybeIonCompileable() const { return ionCompileable_; }
 
+  // Off-thread compilations must not report errors to the context or mutate
+  // VM state. Work which has to happen on the main thread is deferred until
+  // the code is linked.
+  void setCompilingOffThread() { compilingOffThread_ = true; }
+  bool compilingOffThread() const { return compilingOffThread_; }
+
+  GlobalLexicalEnvironmentObject* globalLexicalEnvironment() const {
+    return globalLexicalEnvironment_;
+  }
+  JSObject* globalThis() const { return globalThis_; }
+
+  ICEntryIndexVector& allocSiteICEntries() { return allocSiteICEntries_; }
+
+  void reportOutOfMemory(JSContext* cx) const {
+    if (!compilingOffThread_) {
+      ReportOutOfMemory(cx);
+    }
+  }
+
   uint32_t icEntryIndex() const { return icEntryIndex_; }
   void moveToNextICEntry() { icEntryIndex_++; }
 
@@ -381,6 +415,17 @@ class BaselineCompiler final : private BaselineCompilerCodeGen {
 
   MethodStatus compile();
 
+  // Off-thread compilations are split in two phases: emitCode() generates the
+  // code on a helper thread, then finishCompile() attaches the linked code to
+  // the script on the main thread.
+  MethodStatus emitCode();
+  [[nodiscard]] bool finishCompile(JitCode* code);
+
+  JSScript* script() const { return handler.script(); }
+  MacroAssembler& macroAssembler() { return masm; }
+
+  void setCompilingOffThread() { handler.setCompilingOffThread(); }
+
   bool compileDebugInstrumentation() const {
     return handler.compileDebugInstrumentation();
   }
@@ -426,6 +471,7 @@ class BaselineInterpreterHandler {
 
  public:
   using FrameInfoT = InterpreterFrameInfo;
+  using MacroAssemblerT = StackMacroAssembler;
 
   explicit BaselineInterpreterHandler(JSContext* cx, MacroAssembler& masm);
 
@@ -0,0 +1,377 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+ * vim: set ts=8 sts=2 et sw=2 tw=80:
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "jit/BaselineCompileTask.h"
+
+#include "gc/GC.h"
+#include "gc/Tracer.h"
+#include "jit/BaselineCodeGen.h"
+#include "jit/CompileWrappers.h"
+#include "jit/Ion.h"
+#include "jit/JitContext.h"
+#include "jit/JitOptions.h"
+#include "jit/JitRealm.h"
+#include "jit/JitRuntime.h"
+#include "jit/JitScript.h"
+#include "jit/Linker.h"
+#include "vm/BytecodeIterator.h"
+#include "vm/BytecodeLocation.h"
+#include "vm/HelperThreadState.h"
+#include "vm/JSContext.h"
+#include "vm/JSScript.h"
+#include "vm/Realm.h"
+
+#include "vm/BytecodeIterator-inl.h"
+#include "vm/BytecodeLocation-inl.h"
+#include "vm/JSScript-inl.h"
+#include "vm/Realm-inl.h"
+
+using namespace js;
+using namespace js::jit;
+
+BaselineCompileTask::BaselineCompileTask(JS::Realm* realm)
+    : realm_(realm),
+      lifoAlloc_(TempAllocator::PreferredLifoChunkSize),
+      alloc_(&lifoAlloc_),
+      cancelled_(false) {}
+
+BaselineCompileTask::~BaselineCompileTask() {
+  for (Entry& entry : entries_) {
+    // The script's JitScript may have been discarded and recreated since the
+    // script was queued.
+    JSScript* script = entry.script;
+    if (script->hasJitScript() &&
+        script->jitScript()->isBaselineCompilingOffThread()) {
+      script->jitScript()->clearIsBaselineCompilingOffThread();
+    }
+    js_delete(entry.compiler);
+  }
+}
+
+JSRuntime* BaselineCompileTask::runtimeFromAnyThread() const {
+  return realm_->runtimeFromAnyThread();
+}
+
+JS::Zone* BaselineCompileTask::zoneFromAnyThread() const {
+  return realm_->zoneFromAnyThread();
+}
+
+bool BaselineCompileTask::hasScript(JSScript* script) const {
+  for (const Entry& entry : entries_) {
+    if (entry.script == script) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool BaselineCompileTask::addScript(JSContext* cx, JSScript* script) {
+  MOZ_ASSERT(cx->realm() == realm_);
+  MOZ_ASSERT(script->jitScript()->isBaselineCompilingOffThread());
+
+  if (!entries_.reserve(entries_.length() + 1)) {
+    ReportOutOfMemory(cx);
+    return false;
+  }
+
+  BaselineCompiler* compiler = js_new<BaselineCompiler>(cx, alloc_, script);
+  if (!compiler) {
+    ReportOutOfMemory(cx);
+    return false;
+  }
+  entries_.infallibleAppend(
+      Entry{script, script->jitScript(), compiler, Method_Skipped});
+
+  compiler->setCompilingOffThread();
+  if (!compiler->init()) {
+    ReportOutOfMemory(cx);
+    return false;
+  }
+
+  return true;
+}
+
+size_t BaselineCompileTask::sizeOfExcludingThis(
+    mozilla::MallocSizeOf mallocSizeOf) {
+  size_t result = lifoAlloc_.sizeOfExcludingThis(mallocSizeOf) +
+                  entries_.sizeOfExcludingThis(mallocSizeOf);
+  for (const Entry& entry : entries_) {
+    result += mallocSizeOf(entry.compiler);
+  }
+  return result;
+}
+
+void BaselineCompileTask::trace(JSTracer* trc) {
+  if (!runtimeMatches(trc->runtime())) {
+    return;
+  }
+
+  for (Entry& entry : entries_) {
+    TraceManuallyBarrieredEdge(trc, &entry.script,
+                               "BaselineCompileTask::script");
+  }
+}
+
+void BaselineCompileTask::runHelperThreadTask(
+    AutoLockHelperThreadState& locked) {
+  {
+    AutoUnlockHelperThreadState unlock(locked);
+    runTask();
+  }
+
+  FinishOffThreadBaselineCompile(this, locked);
+
+  // Ping the main thread so that the compiled code can be linked at the next
+  // interrupt callback.
+  runtimeFromAnyThread()->mainContextFromAnyThread()->requestInterrupt(
+      InterruptReason::AttachBaselineCompilations);
+}
+
+void BaselineCompileTask::runTask() {
+  JitContext jctx(CompileRuntime::get(runtimeFromAnyThread()));
+
+  for (Entry& entry : entries_) {
+    if (cancelled_) {
+      break;
+    }
+    entry.status = entry.compiler->emitCode();
+  }
+}
+
+void BaselineCompileTask::link(JSContext* cx) {
+  MOZ_ASSERT(!empty());
+
+  AutoRealm ar(cx, entries_[0].script);
+  JitContext jctx(cx);
+  gc::AutoSuppressGC suppressGC(cx);
+
+  BatchLinker linker;
+  Vector<BaselineCompiler*, 8, SystemAllocPolicy> compilers;
+  for (Entry& entry : entries_) {
+    JSScript* script = entry.script;
+    if (entry.status == Method_CantCompile) {
+      script->disableBaselineCompile();
+      continue;
+    }
+
+    // Drop the code if the script was compiled on the main thread in the
+    // meantime, or if its state changed in a way the code doesn't account for:
+    //  - its JitScript and ICScript were discarded, e.g. by a GC, and the
+    //    script may have been queued again with new ones,
+    //  - it now needs debug instrumentation or code coverage counters.
+    if (entry.status != Method_Compiled || script->hasBaselineScript() ||
+        !script->canBaselineCompile()) {
+      continue;
+    }
+    if (!script->hasJitScript() || script->jitScript() != entry.jitScript ||
+        !entry.jitScript->isBaselineCompilingOffThread()) {
+      continue;
+    }
+    if (script->isDebuggee() || script->hasScriptCounts() ||
+        cx->realm()->collectCoverageForDebug()) {
+      continue;
+    }
+
+    if (!compilers.append(entry.compiler) ||
+        !linker.add(entry.compiler->macroAssembler())) {
+      return;
+    }
+  }
+
+  if (compilers.empty()) {
+    return;
+  }
+
+  // Errors are silently ignored: the scripts keep running in the interpreter
+  // and are queued again by their next warm-up check. It's not OK to throw a
+  // catchable exception from an interrupt.
+  BatchLinker::JitCodeVector codes;
+  if (!linker.newCode(cx, CodeKind::Baseline, &codes)) {
+    cx->clearPendingException();
+    return;
+  }
+
+  for (size_t i = 0; i < compilers.length(); i++) {
+    if (!compilers[i]->finishCompile(codes[i])) {
+      cx->clearPendingException();
+    }
+  }
+}
+
+bool jit::OffThreadBaselineCompilationAvailable(JSContext* cx) {
+  return JitOptions.baselineOffThreadCompile &&
+         OffThreadCompilationAvailable(cx);
+}
+
+static bool CanCompileOffThread(JSContext* cx, JSScript* script) {
+  // Debug instrumentation and code coverage depend on state which may change
+  // during an off-thread compilation.
+  if (script->isDebuggee() || script->hasScriptCounts() ||
+      cx->realm()->collectCoverageForDebug()) {
+    return false;
+  }
+
+  // The Baseline compiler looks up the VM state these ops refer to while
+  // generating code.
+  for (BytecodeLocation loc : AllBytecodesIterable(script)) {
+    switch (loc.getOp()) {
+      case JSOp::CallSiteObj:
+      case JSOp::BuiltinObject:
+      case JSOp::ImportMeta:
+      case JSOp::GetImport:
+        return false;
+      default:
+        break;
+    }
+  }
+
+  return true;
+}
+
+static void ClearBaselineBatch(JitRealm::BaselineBatch& batch,
+                               size_t start = 0) {
+  for (size_t i = start; i < batch.length(); i++) {
+    JSScript* script = batch[i];
+    if (script->hasJitScript() &&
+        script->jitScript()->isBaselineCompilingOffThread()) {
+      script->jitScript()->clearIsBaselineCompilingOffThread();
+    }
+  }
+  batch.clear();
+}
+
+static bool StartBaselineBatch(JSContext* cx) {
+  JitRealm::BaselineBatch& batch = cx->realm()->jitRealm()->baselineBatch();
+  MOZ_ASSERT(!batch.empty());
+
+  UniquePtr<BaselineCompileTask> task =
+      cx->make_unique<BaselineCompileTask>(cx->realm());
+  if (!task) {
+    ClearBaselineBatch(batch);
+    return false;
+  }
+
+  JitContext jctx(cx);
+
+  for (size_t i = 0; i < batch.length(); i++) {
+    JSScript* script = batch[i];
+
+    // Skip scripts which lost their JitScript since they were queued, or
+    // which were queued again after that.
+    if (!script->hasJitScript() ||
+        !script->jitScript()->isBaselineCompilingOffThread() ||
+        task->hasScript(script)) {
+      continue;
+    }
+
+    if (script->hasBaselineScript() || !script->canBaselineCompile() ||
+        !CanCompileOffThread(cx, script)) {
+      script->jitScript()->clearIsBaselineCompilingOffThread();
+      continue;
+    }
+
+    if (!task->addScript(cx, script)) {
+      ClearBaselineBatch(batch, i);
+      return false;
+    }
+  }
+
+  batch.clear();
+
+  if (task->empty()) {
+    return true;
+  }
+
+  AutoLockHelperThreadState lock;
+  if (!StartOffThreadBaselineCompile(task.get(), lock)) {
+    ReportOutOfMemory(cx);
+    return false;
+  }
+
+  (void)task.release();
+  return true;
+}
+
+bool jit::QueueOffThreadBaselineCompile(JSContext* cx, JSScript* script,
+                                        bool* queued) {
+  MOZ_ASSERT(OffThreadBaselineCompilationAvailable(cx));
+  MOZ_ASSERT(!script->hasBaselineScript());
+
+  *queued = false;
+
+  AutoKeepJitScripts keepJitScript(cx);
+  if (!script->ensureHasJitScript(cx, keepJitScript)) {
+    return false;
+  }
+
+  JitScript* jitScript = script->jitScript();
+  JitRealm::BaselineBatch& batch = cx->realm()->jitRealm()->baselineBatch();
+
+  if (jitScript->isBaselineCompilingOffThread()) {
+    *queued = true;
+
+    // Don't let a hot script wait too long for its batch to fill up.
+    if (script->getWarmUpCount() > 2 * JitOptions.baselineJitWarmUpThreshold) {
+      for (JSScript* queuedScript : batch) {
+        if (queuedScript == script) {
+          return StartBaselineBatch(cx);
+        }
+      }
+    }
+    return true;
+  }
+
+  if (!CanCompileOffThread(cx, script)) {
+    return true;
+  }
+
+  if (!batch.append(script)) {
+    ReportOutOfMemory(cx);
+    return false;
+  }
+  jitScript->setIsBaselineCompilingOffThread();
+  *queued = true;
+
+  if (batch.length() >= JitOptions.baselineBatchSize) {
+    return StartBaselineBatch(cx);
+  }
+  return true;
+}
+
+static BaselineCompileTask* TakeFinishedBaselineTask(
+    JSRuntime* rt, const AutoLockHelperThreadState& lock) {
+  GlobalHelperThreadState::BaselineCompileTaskVector& finished =
+      HelperThreadState().baselineFinishedList(lock);
+
+  for (size_t i = 0; i < finished.length(); i++) {
+    BaselineCompileTask* task = finished[i];
+    if (task->runtimeFromAnyThread() == rt) {
+      HelperThreadState().remove(finished, &i);
+      rt->jitRuntime()->numFinishedBaselineTasksRef(lock)--;
+      return task;
+    }
+  }
+
+  return nullptr;
+}
+
+void jit::AttachFinishedBaselineCompilations(JSContext* cx) {
+  JSRuntime* rt = cx->runtime();
+  MOZ_ASSERT(CurrentThreadCanAccessRuntime(rt));
+
+  if (!rt->jitRuntime() || !rt->jitRuntime()->numFinishedBaselineTasks()) {
+    return;
+  }
+
+  AutoLockHelperThreadState lock;
+  while (BaselineCompileTask* task = TakeFinishedBaselineTask(rt, lock)) {
+    AutoUnlockHelperThreadState unlock(lock);
+    if (!task->empty()) {
+      task->link(cx);
+    }
+    js_delete(task);
+  }
+}
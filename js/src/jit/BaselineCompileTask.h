@@ -0,0 +1,106 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+ * vim: set ts=8 sts=2 et sw=2 tw=80:
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef jit_BaselineCompileTask_h
+#define jit_BaselineCompileTask_h
+
+#include "mozilla/Atomics.h"
+#include "mozilla/MemoryReporting.h"
+
+#include "ds/LifoAlloc.h"
+#include "jit/JitAllocPolicy.h"
+#include "jit/JitContext.h"
+#include "js/Utility.h"
+#include "js/Vector.h"
+#include "vm/HelperThreadTask.h"
+
+struct JS_PUBLIC_API JSContext;
+
+namespace js {
+namespace jit {
+
+class BaselineCompiler;
+class JitScript;
+
+// BaselineCompileTask represents an off-thread Baseline compilation of a
+// batch of scripts from a single realm.
+//
+// The compilers are created on the main thread, where the bytecode analysis
+// runs and any state depending on the context is captured. The helper thread
+// only generates code. Once the whole batch has been compiled, the main thread
+// links all of it with a single BatchLinker, so the executable memory is made
+// writable and executable again only once for the batch.
+//
+// GCs which may collect or move the scripts cancel the task, see
+// CancelOffThreadIonCompile.
+class BaselineCompileTask final : public HelperThreadTask {
+  struct Entry {
+    JSScript* script;
+    // The JitScript, which holds the ICScript, the code was compiled for.
+    // Only used for comparison: it may have been discarded since.
+    JitScript* jitScript;
+    BaselineCompiler* compiler;
+    MethodStatus status;
+  };
+
+  JS::Realm* realm_;
+  LifoAlloc lifoAlloc_;
+  TempAllocator alloc_;
+  Vector<Entry, 0, SystemAllocPolicy> entries_;
+
+  // Set by the main thread to stop compiling the remaining scripts.
+  mozilla::Atomic<bool, mozilla::Relaxed> cancelled_;
+
+ public:
+  explicit BaselineCompileTask(JS::Realm* realm);
+  ~BaselineCompileTask();
+
+  JS::Realm* realm() const { return realm_; }
+  JSRuntime* runtimeFromAnyThread() const;
+  JS::Zone* zoneFromAnyThread() const;
+  bool runtimeMatches(JSRuntime* rt) const {
+    return runtimeFromAnyThread() == rt;
+  }
+
+  bool empty() const { return entries_.empty(); }
+  bool hasScript(JSScript* script) const;
+
+  // Create and initialize a compiler for |script|. Must be called on the main
+  // thread, in the realm of the task.
+  [[nodiscard]] bool addScript(JSContext* cx, JSScript* script);
+
+  void cancel() { cancelled_ = true; }
+
+  size_t sizeOfExcludingThis(mozilla::MallocSizeOf mallocSizeOf);
+  void trace(JSTracer* trc);
+
+  ThreadType threadType() override { return THREAD_TYPE_BASELINE; }
+  void runTask();
+  void runHelperThreadTask(AutoLockHelperThreadState& locked) override;
+
+  // Link the code of every successfully compiled script and attach it to the
+  // script. Errors are not reported, the scripts just keep running in the
+  // interpreter.
+  void link(JSContext* cx);
+};
+
+// Whether Baseline compilations may happen on helper threads.
+bool OffThreadBaselineCompilationAvailable(JSContext* cx);
+
+// Queue |script| for an off-thread Baseline compilation, and start compiling
+// the realm's batch if it is full. |*queued| is set to false if the script
+// can't be compiled off-thread, in which case the caller compiles it on the
+// main thread.
+[[nodiscard]] bool QueueOffThreadBaselineCompile(JSContext* cx,
+                                                 JSScript* script,
+                                                 bool* queued);
+
+void AttachFinishedBaselineCompilations(JSContext* cx);
+
+}  // namespace jit
+}  // namespace js
+
+#endif /* jit_BaselineCompileTask_h */
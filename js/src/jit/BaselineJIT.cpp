@@ -18,6 +18,7 @@
 #include "gc/PublicIterators.h"
 #include "jit/AutoWritableJitCode.h"
 #include "jit/BaselineCodeGen.h"
+#include "jit/BaselineCompileTask.h"
 #include "jit/BaselineIC.h"
 #include "jit/CalleeToken.h"
 #include "jit/JitCommon.h"
@@ -315,6 +316,20 @@ static MethodStatus CanEnterBaselineJIT(JSContext* cx, HandleScript script,
   // Debugger.Frame.prototype.eval.
   bool forceDebugInstrumentation =
       osrSourceFrame && osrSourceFrame.isDebuggee();
+
+  // Try to compile the script off-thread along with other warm scripts. It
+  // keeps running in the interpreter until the code has been linked.
+  if (!forceDebugInstrumentation &&
+      OffThreadBaselineCompilationAvailable(cx)) {
+    bool queued;
+    if (!QueueOffThreadBaselineCompile(cx, script, &queued)) {
+      return Method_Error;
+    }
+    if (queued) {
+      return Method_Skipped;
+    }
+  }
+
   return BaselineCompile(cx, script, forceDebugInstrumentation);
 }
 
@@ -890,6 +905,9 @@ void jit::ToggleBaselineProfiling(JSContext* cx, bool enable) {
     return;
   }
 
+  // Make each pool of Baseline code writable and executable again only once.
+  AutoWritableJitCodeBatch batch(cx->runtime());
+
   jrt->baselineInterpreter().toggleProfilerInstrumentation(enable);
 
   for (ZonesIter zone(cx->runtime(), SkipAtoms); !zone.done(); zone.next()) {
@@ -40,6 +40,7 @@
 #include "vm/ArrayBufferObject.h"
 #include "vm/BytecodeUtil.h"
 #include "vm/Compartment.h"
+#include "vm/DateObject.h"
 #include "vm/Iteration.h"
 #include "vm/PlainObject.h"  // js::PlainObject
 #include "vm/ProxyObject.h"
@@ -6016,6 +6017,50 @@ AttachDecision InlinableNativeIRGenerator::tryAttachDataViewSet(
   return AttachDecision::Attach;
 }
 
+AttachDecision InlinableNativeIRGenerator::tryAttachDateGetter(
+    InlinableNative native) {
+  // Ensure |this| is a DateObject.
+  if (!thisval_.isObject() || !thisval_.toObject().is<DateObject>()) {
+    return AttachDecision::NoAction;
+  }
+
+  // No arguments are used.
+
+  // Initialize the input operand.
+  initializeInputOperand();
+
+  // Guard callee is the Date getter native function.
+  emitNativeCalleeGuard();
+
+  // Guard |this| is a DateObject.
+  ValOperandId thisValId =
+      writer.loadArgumentFixedSlot(ArgumentKind::This, argc_);
+  ObjOperandId objId = writer.guardToObject(thisValId);
+  writer.guardClass(objId, GuardClassKind::Date);
+
+  uint32_t slot;
+  switch (native) {
+    case InlinableNative::DateGetDate:
+      slot = DateObject::LOCAL_DATE_SLOT;
+      break;
+    case InlinableNative::DateGetFullYear:
+      slot = DateObject::LOCAL_YEAR_SLOT;
+      break;
+    case InlinableNative::DateGetMonth:
+      slot = DateObject::LOCAL_MONTH_SLOT;
+      break;
+    default:
+      MOZ_CRASH("Unexpected native");
+  }
+  MOZ_ASSERT(slot < thisval_.toObject().as<DateObject>().numFixedSlots());
+
+  writer.loadDateLocalComponentResult(objId, slot);
+  writer.returnFromIC();
+
+  trackAttached("DateGetter");
+  return AttachDecision::Attach;
+}
+
 AttachDecision InlinableNativeIRGenerator::tryAttachUnsafeGetReservedSlot(
     InlinableNative native) {
   // Self-hosted code calls this with (object, int32) arguments.
@@ -8526,6 +8571,37 @@ AttachDecision InlinableNativeIRGenerator::tryAttachSetHas() {
   return AttachDecision::Attach;
 }
 
+AttachDecision InlinableNativeIRGenerator::tryAttachSetAdd() {
+  // Ensure |this| is a SetObject.
+  if (!thisval_.isObject() || !thisval_.toObject().is<SetObject>()) {
+    return AttachDecision::NoAction;
+  }
+
+  // Need a single argument.
+  if (argc_ != 1) {
+    return AttachDecision::NoAction;
+  }
+
+  // Initialize the input operand.
+  initializeInputOperand();
+
+  // Guard callee is the 'add' native function.
+  emitNativeCalleeGuard();
+
+  // Guard |this| is a SetObject.
+  ValOperandId thisValId =
+      writer.loadArgumentFixedSlot(ArgumentKind::This, argc_);
+  ObjOperandId objId = writer.guardToObject(thisValId);
+  writer.guardClass(objId, GuardClassKind::Set);
+
+  ValOperandId keyId = writer.loadArgumentFixedSlot(ArgumentKind::Arg0, argc_);
+  writer.setAddResult(objId, keyId);
+  writer.returnFromIC();
+
+  trackAttached("SetAdd");
+  return AttachDecision::Attach;
+}
+
 AttachDecision InlinableNativeIRGenerator::tryAttachMapHas() {
   // Ensure |this| is a MapObject.
   if (!thisval_.isObject() || !thisval_.toObject().is<MapObject>()) {
@@ -8700,6 +8776,38 @@ AttachDecision InlinableNativeIRGenerator::tryAttachMapGet() {
   return AttachDecision::Attach;
 }
 
+AttachDecision InlinableNativeIRGenerator::tryAttachMapSet() {
+  // Ensure |this| is a MapObject.
+  if (!thisval_.isObject() || !thisval_.toObject().is<MapObject>()) {
+    return AttachDecision::NoAction;
+  }
+
+  // Need two arguments.
+  if (argc_ != 2) {
+    return AttachDecision::NoAction;
+  }
+
+  // Initialize the input operand.
+  initializeInputOperand();
+
+  // Guard callee is the 'set' native function.
+  emitNativeCalleeGuard();
+
+  // Guard |this| is a MapObject.
+  ValOperandId thisValId =
+      writer.loadArgumentFixedSlot(ArgumentKind::This, argc_);
+  ObjOperandId objId = writer.guardToObject(thisValId);
+  writer.guardClass(objId, GuardClassKind::Map);
+
+  ValOperandId keyId = writer.loadArgumentFixedSlot(ArgumentKind::Arg0, argc_);
+  ValOperandId valId = writer.loadArgumentFixedSlot(ArgumentKind::Arg1, argc_);
+  writer.mapSetResult(objId, keyId, valId);
+  writer.returnFromIC();
+
+  trackAttached("MapSet");
+  return AttachDecision::Attach;
+}
+
 AttachDecision CallIRGenerator::tryAttachFunCall(HandleFunction callee) {
   MOZ_ASSERT(callee->isNativeWithoutJitEntry());
 
@@ -9724,6 +9832,12 @@ AttachDecision InlinableNativeIRGenerator::tryAttachStub() {
     case InlinableNative::DataViewSetBigUint64:
       return tryAttachDataViewSet(Scalar::BigUint64);
 
+    // Date natives.
+    case InlinableNative::DateGetDate:
+    case InlinableNative::DateGetFullYear:
+    case InlinableNative::DateGetMonth:
+      return tryAttachDateGetter(native);
+
     // Intl natives.
     case InlinableNative::IntlGuardToCollator:
     case InlinableNative::IntlGuardToDateTimeFormat:
@@ -10004,12 +10118,16 @@ AttachDecision InlinableNativeIRGenerator::tryAttachStub() {
     // Set natives.
     case InlinableNative::SetHas:
       return tryAttachSetHas();
+    case InlinableNative::SetAdd:
+      return tryAttachSetAdd();
 
     // Map natives.
     case InlinableNative::MapHas:
       return tryAttachMapHas();
     case InlinableNative::MapGet:
       return tryAttachMapGet();
+    case InlinableNative::MapSet:
+      return tryAttachMapSet();
 
     // Testing functions.
     case InlinableNative::TestBailout:
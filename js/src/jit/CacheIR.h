@@ -512,6 +512,7 @@ enum class GuardClassKind : uint8_t {
   JSFunction,
   Set,
   Map,
+  Date,
 };
 
 }  // namespace jit
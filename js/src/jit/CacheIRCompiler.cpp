@@ -39,6 +39,7 @@
 #include "vm/ArrayBufferObject.h"
 #include "vm/ArrayBufferViewObject.h"
 #include "vm/BigIntType.h"
+#include "vm/DateObject.h"
 #include "vm/FunctionFlags.h"  // js::FunctionFlags
 #include "vm/GeneratorObject.h"
 #include "vm/GetterSetter.h"
@@ -1985,6 +1986,9 @@ bool CacheIRCompiler::emitGuardClass(ObjOperandId objId, GuardClassKind kind) {
     case GuardClassKind::Map:
       clasp = &MapObject::class_;
       break;
+    case GuardClassKind::Date:
+      clasp = &DateObject::class_;
+      break;
     case GuardClassKind::JSFunction:
       MOZ_CRASH("JSFunction handled before switch");
   }
@@ -8546,6 +8550,48 @@ bool CacheIRCompiler::emitSetHasObjectResult(ObjOperandId setId,
   return true;
 }
 
+bool CacheIRCompiler::emitSetAddResult(ObjOperandId setId, ValOperandId keyId) {
+  JitSpew(JitSpew_Codegen, "%s", __FUNCTION__);
+
+  AutoCallVM callvm(masm, this, allocator);
+
+  Register set = allocator.useRegister(masm, setId);
+  ValueOperand key = allocator.useValueRegister(masm, keyId);
+
+  callvm.prepare();
+  masm.Push(key);
+  masm.Push(set);
+
+  using Fn = JSObject* (*)(JSContext*, HandleObject, HandleValue);
+  callvm.call<Fn, jit::SetObjectAdd>();
+  return true;
+}
+
+bool CacheIRCompiler::emitLoadDateLocalComponentResult(ObjOperandId dateId,
+                                                       uint32_t slot) {
+  JitSpew(JitSpew_Codegen, "%s", __FUNCTION__);
+
+  AutoOutputRegister output(*this);
+  Register date = allocator.useRegister(masm, dateId);
+  AutoScratchRegisterMaybeOutput scratch(allocator, masm, output);
+
+  LiveRegisterSet volatileRegs(GeneralRegisterSet::Volatile(),
+                               liveVolatileFloatRegs());
+  volatileRegs.takeUnchecked(scratch);
+  masm.PushRegsInMask(volatileRegs);
+
+  using Fn = void (*)(DateObject*);
+  masm.setupUnalignedABICall(scratch);
+  masm.passABIArg(date);
+  masm.callWithABI<Fn, jit::DateFillLocalTimeSlots>();
+
+  masm.PopRegsInMask(volatileRegs);
+
+  Address slotAddr(date, NativeObject::getFixedSlotOffset(slot));
+  masm.loadTypedOrValue(slotAddr, output);
+  return true;
+}
+
 bool CacheIRCompiler::emitMapHasResult(ObjOperandId mapId, ValOperandId valId) {
   JitSpew(JitSpew_Codegen, "%s", __FUNCTION__);
 
@@ -8685,6 +8731,27 @@ bool CacheIRCompiler::emitMapGetResult(ObjOperandId mapId, ValOperandId valId) {
   return true;
 }
 
+bool CacheIRCompiler::emitMapSetResult(ObjOperandId mapId, ValOperandId keyId,
+                                       ValOperandId valId) {
+  JitSpew(JitSpew_Codegen, "%s", __FUNCTION__);
+
+  AutoCallVM callvm(masm, this, allocator);
+
+  Register map = allocator.useRegister(masm, mapId);
+  ValueOperand key = allocator.useValueRegister(masm, keyId);
+  ValueOperand val = allocator.useValueRegister(masm, valId);
+
+  callvm.prepare();
+  masm.Push(val);
+  masm.Push(key);
+  masm.Push(map);
+
+  using Fn =
+      JSObject* (*)(JSContext*, HandleObject, HandleValue, HandleValue);
+  callvm.call<Fn, jit::MapObjectSet>();
+  return true;
+}
+
 bool CacheIRCompiler::emitMapGetNonGCThingResult(ObjOperandId mapId,
                                                  ValOperandId valId) {
   JitSpew(JitSpew_Codegen, "%s", __FUNCTION__);
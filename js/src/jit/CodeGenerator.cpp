@@ -6592,7 +6592,7 @@ bool CodeGenerator::generateBody() {
         return false;
       }
 
-      perfSpewer_.recordInstruction(masm, iter->op());
+      perfSpewer_.recordInstruction(masm, *iter);
 #ifdef JS_JITSPEW
       JitSpewStart(JitSpew_Codegen, "                                # LIR=%s",
                    iter->opName());
@@ -16063,6 +16063,11 @@ void CodeGenerator::visitIncrementWarmUpCounter(LIncrementWarmUpCounter* ins) {
   incrementWarmUpCounter(warmUpCount, ins->mir()->script(), tmp);
 }
 
+void CodeGenerator::visitIncrementCodeCoverageCounter(
+    LIncrementCodeCoverageCounter* ins) {
+  masm.inc64(AbsoluteAddress(ins->mir()->counter()));
+}
+
 void CodeGenerator::visitLexicalCheck(LLexicalCheck* ins) {
   ValueOperand inputValue = ToValue(ins, LLexicalCheck::InputIndex);
   Label bail;
@@ -17279,6 +17284,39 @@ void CodeGenerator::visitMapObjectGetValueVMCall(
   callVM<Fn, jit::MapObjectGet>(ins);
 }
 
+void CodeGenerator::visitMapObjectSet(LMapObjectSet* ins) {
+  pushArg(ToValue(ins, LMapObjectSet::ValueIndex));
+  pushArg(ToValue(ins, LMapObjectSet::KeyIndex));
+  pushArg(ToRegister(ins->mapObject()));
+
+  using Fn =
+      JSObject* (*)(JSContext*, HandleObject, HandleValue, HandleValue);
+  callVM<Fn, jit::MapObjectSet>(ins);
+}
+
+void CodeGenerator::visitSetObjectAdd(LSetObjectAdd* ins) {
+  pushArg(ToValue(ins, LSetObjectAdd::KeyIndex));
+  pushArg(ToRegister(ins->setObject()));
+
+  using Fn = JSObject* (*)(JSContext*, HandleObject, HandleValue);
+  callVM<Fn, jit::SetObjectAdd>(ins);
+}
+
+void CodeGenerator::visitDateLocalComponent(LDateLocalComponent* ins) {
+  Register date = ToRegister(ins->date());
+  ValueOperand output = ToOutValue(ins);
+
+  saveVolatile();
+  using Fn = void (*)(DateObject*);
+  masm.setupAlignedABICall();
+  masm.passABIArg(date);
+  masm.callWithABI<Fn, jit::DateFillLocalTimeSlots>();
+  restoreVolatile();
+
+  Address slotAddr(date, NativeObject::getFixedSlotOffset(ins->mir()->slot()));
+  masm.loadValue(slotAddr, output);
+}
+
 template <size_t NumDefs>
 void CodeGenerator::emitIonToWasmCallBase(LIonToWasmCallBase<NumDefs>* lir) {
   wasm::JitCallStackArgVector stackArgs;
@@ -27,6 +27,10 @@
 
 #include "jit/ExecutableAllocator.h"
 
+#include <algorithm>
+
+#include "gc/Memory.h"
+#include "jit/AutoWritableJitCode.h"
 #include "js/MemoryMetrics.h"
 #include "util/Poison.h"
 
@@ -327,3 +331,95 @@ void ExecutableAllocator::systemRelease(
     const ExecutablePool::Allocation& alloc) {
   DeallocateExecutableMemory(alloc.pages, alloc.size);
 }
+
+bool AutoWritableJitCodeBatch::contains(void* addr, size_t size) const {
+  // Only check the most recent ranges, which is where code written to in a
+  // loop is found. Missing an older range just costs an extra system call.
+  static constexpr size_t MaxRangesToCheck = 4;
+
+  uintptr_t start = uintptr_t(addr);
+  uintptr_t end = start + size;
+  size_t numChecked = std::min(ranges_.length(), MaxRangesToCheck);
+  for (size_t i = ranges_.length() - numChecked; i < ranges_.length(); i++) {
+    if (ranges_[i].start <= start && end <= ranges_[i].end) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool AutoWritableJitCodeBatch::add(void* addr, size_t size) {
+  MOZ_ASSERT(outermost_);
+
+  // ReprotectRegion works on whole pages, so widen the range.
+  uintptr_t pageMask = js::gc::SystemPageSize() - 1;
+  uintptr_t start = uintptr_t(addr) & ~pageMask;
+  uintptr_t end = (uintptr_t(addr) + size + pageMask) & ~pageMask;
+
+  if (!ranges_.empty()) {
+    Range& last = ranges_.back();
+    if (start <= last.end && last.start <= end) {
+      last.start = std::min(last.start, start);
+      last.end = std::max(last.end, end);
+      return true;
+    }
+  }
+
+  return ranges_.append(Range{start, end});
+}
+
+void AutoWritableJitCodeBatch::restoreWritable(void* addr, size_t size) {
+  uintptr_t pageMask = js::gc::SystemPageSize() - 1;
+  uintptr_t start = uintptr_t(addr) & ~pageMask;
+  uintptr_t end = (uintptr_t(addr) + size + pageMask) & ~pageMask;
+
+  for (const Range& range : ranges_) {
+    uintptr_t overlapStart = std::max(range.start, start);
+    uintptr_t overlapEnd = std::min(range.end, end);
+    if (overlapStart >= overlapEnd) {
+      continue;
+    }
+    // Like making code executable, this can't be allowed to fail: the code
+    // on these pages has been handed out as writable.
+    if (!ExecutableAllocator::makeWritable(
+            reinterpret_cast<void*>(overlapStart), overlapEnd - overlapStart)) {
+      MOZ_CRASH();
+    }
+  }
+}
+
+AutoWritableJitCodeBatch::~AutoWritableJitCodeBatch() {
+  if (!outermost_) {
+    MOZ_ASSERT(ranges_.empty());
+    return;
+  }
+
+  MOZ_ASSERT(rt_->autoWritableJitCodeBatch() == this);
+  rt_->setAutoWritableJitCodeBatch(nullptr);
+
+  if (ranges_.empty()) {
+    return;
+  }
+
+  mozilla::TimeStamp startTime = mozilla::TimeStamp::Now();
+
+  std::sort(ranges_.begin(), ranges_.end(),
+            [](const Range& a, const Range& b) { return a.start < b.start; });
+
+  size_t i = 0;
+  while (i < ranges_.length()) {
+    uintptr_t start = ranges_[i].start;
+    uintptr_t end = ranges_[i].end;
+    for (i++; i < ranges_.length() && ranges_[i].start <= end; i++) {
+      end = std::max(end, ranges_[i].end);
+    }
+    if (!ExecutableAllocator::makeExecutableAndFlushICache(
+            reinterpret_cast<void*>(start), end - start)) {
+      MOZ_CRASH();
+    }
+  }
+
+  if (Realm* realm = rt_->mainContextFromOwnThread()->realm()) {
+    realm->timers.protectTime += mozilla::TimeStamp::Now() - startTime;
+  }
+}
@@ -259,10 +259,15 @@ bool js::jit::CanInlineNativeCrossRealm(InlinableNative native) {
     case InlinableNative::DataViewSetFloat64:
     case InlinableNative::DataViewSetBigInt64:
     case InlinableNative::DataViewSetBigUint64:
+    case InlinableNative::DateGetDate:
+    case InlinableNative::DateGetFullYear:
+    case InlinableNative::DateGetMonth:
     case InlinableNative::MapGet:
     case InlinableNative::MapHas:
+    case InlinableNative::MapSet:
     case InlinableNative::NumberToString:
     case InlinableNative::ReflectGetPrototypeOf:
+    case InlinableNative::SetAdd:
     case InlinableNative::SetHas:
     case InlinableNative::String:
     case InlinableNative::StringToString:
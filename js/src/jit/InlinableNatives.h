@@ -55,6 +55,10 @@
   _(DataViewSetBigInt64)                           \
   _(DataViewSetBigUint64)                          \
                                                    \
+  _(DateGetDate)                                   \
+  _(DateGetFullYear)                               \
+  _(DateGetMonth)                                  \
+                                                   \
   _(IntlGuardToCollator)                           \
   _(IntlGuardToDateTimeFormat)                     \
   _(IntlGuardToDisplayNames)                       \
@@ -65,6 +69,7 @@
                                                    \
   _(MapGet)                                        \
   _(MapHas)                                        \
+  _(MapSet)                                        \
                                                    \
   _(MathAbs)                                       \
   _(MathFloor)                                     \
@@ -115,6 +120,7 @@
   _(RegExpInstanceOptimizable)                     \
   _(GetFirstDollarIndex)                           \
                                                    \
+  _(SetAdd)                                        \
   _(SetHas)                                        \
                                                    \
   _(String)                                        \
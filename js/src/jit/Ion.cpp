@@ -13,6 +13,7 @@
 #include "mozilla/ThreadLocal.h"
 
 #include "gc/GCContext.h"
+#include "gc/GCInternals.h"
 #include "gc/PublicIterators.h"
 #include "jit/AliasAnalysis.h"
 #include "jit/AlignmentMaskAnalysis.h"
@@ -48,6 +49,7 @@
 #include "jit/RangeAnalysis.h"
 #include "jit/ScalarReplacement.h"
 #include "jit/ScriptFromCalleeToken.h"
+#include "jit/SimpleAllocator.h"
 #include "jit/Sink.h"
 #include "jit/ValueNumbering.h"
 #include "jit/WarpBuilder.h"
@@ -404,6 +406,8 @@ void JitRealm::traceWeak(JSTracer* trc, JS::Realm* realm) {
   for (WeakHeapPtr<JitCode*>& stub : stubs_) {
     TraceWeakEdge(trc, &stub, "JitRealm::stubs_");
   }
+
+  baselineBatch_.traceWeak(trc);
 }
 
 bool JitZone::addInlinedCompilation(const RecompileInfo& info,
@@ -494,6 +498,43 @@ bool RecompileInfo::traceWeak(JSTracer* trc) {
   return maybeIonScriptToInvalidate() != nullptr;
 }
 
+void JitZone::traceRetainedStubCode(JSTracer* trc) {
+  // Baseline stub code is normally only kept alive by the IC stubs that use
+  // it. Stubs are thrown away whenever Baseline code is discarded and when
+  // the scripts using them die, e.g. when a page is reloaded, and then have to
+  // be compiled again as the code warms back up. Keep recently requested stub
+  // code alive for a few major GCs so it can be reused, except in shrinking
+  // GCs and under memory pressure, where we want to release as much memory as
+  // possible.
+  gc::GCRuntime& gc = trc->runtime()->gc;
+  if (gc.isShrinkingGC() || gc::IsOOMReason(gc.lastStartReason())) {
+    expireRetainedStubCode();
+    return;
+  }
+
+  uint64_t majorGCNumber = gc.majorGCCount();
+  for (auto r = baselineCacheIRStubCodes_.all(); !r.empty(); r.popFront()) {
+    BaselineCacheIRStubCodeEntry& entry = r.front().value();
+    if (entry.lastUsedMajorGC == BaselineCacheIRStubCodeEntry::NotRetained) {
+      continue;
+    }
+    MOZ_ASSERT(majorGCNumber >= entry.lastUsedMajorGC);
+    if (majorGCNumber - entry.lastUsedMajorGC <= StubCodeRetainMajorGCs) {
+      TraceManuallyBarrieredEdge(trc, entry.code.unbarrieredAddress(),
+                                 "JitZone::retainedStubCode");
+    }
+  }
+}
+
+void JitZone::expireRetainedStubCode() {
+  // Stub code still used by IC stubs stays alive through them. It's retained
+  // again when it is next requested.
+  for (auto r = baselineCacheIRStubCodes_.all(); !r.empty(); r.popFront()) {
+    r.front().value().lastUsedMajorGC =
+        BaselineCacheIRStubCodeEntry::NotRetained;
+  }
+}
+
 void JitZone::traceWeak(JSTracer* trc) {
   baselineCacheIRStubCodes_.traceWeak(trc);
   inlinedCompilations_.traceWeak(trc);
@@ -504,6 +545,7 @@ size_t JitRealm::sizeOfIncludingThis(mozilla::MallocSizeOf mallocSizeOf) const {
   if (stubCodes_) {
     n += stubCodes_->shallowSizeOfIncludingThis(mallocSizeOf);
   }
+  n += baselineBatch_.sizeOfExcludingThis(mallocSizeOf);
   return n;
 }
 
@@ -1444,6 +1486,16 @@ LIRGraph* GenerateLIR(MIRGenerator* mir) {
     IonRegisterAllocator allocator =
         mir->optimizationInfo().registerAllocator();
 
+    // Backtracking allocation of huge graphs can take longer than the rest of
+    // the compilation combined, so optionally fall back to the simple
+    // allocator unless a specific allocator was requested.
+    if (allocator == RegisterAllocator_Backtracking &&
+        JitOptions.forcedRegisterAllocator.isNothing() &&
+        JitOptions.simpleRegAllocThreshold &&
+        lir->numInstructions() > JitOptions.simpleRegAllocThreshold) {
+      allocator = RegisterAllocator_Simple;
+    }
+
     switch (allocator) {
       case RegisterAllocator_Backtracking:
       case RegisterAllocator_Testbed: {
@@ -1473,6 +1525,32 @@ LIRGraph* GenerateLIR(MIRGenerator* mir) {
         break;
       }
 
+      case RegisterAllocator_Simple: {
+#ifdef DEBUG
+        if (JitOptions.fullDebugChecks) {
+          if (!integrity.record()) {
+            return nullptr;
+          }
+        }
+#endif
+
+        SimpleAllocator regalloc(mir, &lirgen, *lir);
+        if (!regalloc.go()) {
+          return nullptr;
+        }
+
+#ifdef DEBUG
+        if (JitOptions.fullDebugChecks) {
+          if (!integrity.check()) {
+            return nullptr;
+          }
+        }
+#endif
+
+        gs.spewPass("Allocate Registers [Simple]");
+        break;
+      }
+
       default:
         MOZ_CRASH("Bad regalloc");
     }
@@ -1769,6 +1847,39 @@ bool CanIonInlineScript(JSScript* script) {
   return true;
 }
 
+// Decide whether to delay an off-thread compilation because too many are
+// already waiting for a helper thread. The helper threads always pick the
+// pending script with the highest warm-up count per bytecode, so a script that
+// has only just reached the Ion threshold would most likely wait behind all of
+// them, and creating its WarpSnapshot now would be wasted main thread time.
+//
+// Delaying resets the script's warm-up counter, so a script is only delayed a
+// few times before it is compiled regardless of the backlog.
+static constexpr uint32_t MaxIonCompileBacklogDelays = 4;
+
+static bool ShouldDelayIonCompileForBacklog(JSContext* cx, JSScript* script) {
+  if (!OffThreadCompilationAvailable(cx) ||
+      JitOptions.eagerIonCompilation()) {
+    return false;
+  }
+
+  if (script->getWarmUpResetCount() >= MaxIonCompileBacklogDelays) {
+    return false;
+  }
+
+  size_t pending = PendingOffThreadIonCompileCount(cx->runtime());
+  if (pending < JitOptions.ionCompileBacklogLimit) {
+    return false;
+  }
+
+  JitSpew(JitSpew_IonScheduling,
+          "Delaying compilation of %s:%u:%u (warm-up count %u, %u resets, "
+          "%zu pending compilations)",
+          script->filename(), script->lineno(), script->column(),
+          script->getWarmUpCount(), script->getWarmUpResetCount(), pending);
+  return true;
+}
+
 static MethodStatus Compile(JSContext* cx, HandleScript script,
                             BaselineFrame* osrFrame, jsbytecode* osrPc) {
   MOZ_ASSERT(jit::IsIonEnabled(cx));
@@ -1806,6 +1917,11 @@ static MethodStatus Compile(JSContext* cx, HandleScript script,
     return Method_Skipped;
   }
 
+  if (ShouldDelayIonCompileForBacklog(cx, script)) {
+    script->resetWarmUpCounterToDelayIonCompilation();
+    return Method_Skipped;
+  }
+
   MOZ_ASSERT(!script->hasIonScript());
 
   AbortReason reason = IonCompile(cx, script, osrPc);
@@ -2379,6 +2495,7 @@ void jit::InvalidateAll(JS::GCContext* gcx, Zone* zone) {
     return;
   }
   JSContext* cx = TlsContext.get();
+  AutoWritableJitCodeBatch batch(cx->runtime());
   for (JitActivationIterator iter(cx); !iter.done(); ++iter) {
     if (iter->compartment()->zone() == zone) {
       JitSpew(JitSpew_IonInvalidate, "Invalidating all frames for GC");
@@ -2438,8 +2555,11 @@ void jit::Invalidate(JSContext* cx, const RecompileInfoVector& invalid,
   }
 
   JS::GCContext* gcx = cx->gcContext();
-  for (JitActivationIterator iter(cx); !iter.done(); ++iter) {
-    InvalidateActivation(gcx, iter, false);
+  {
+    AutoWritableJitCodeBatch batch(cx->runtime());
+    for (JitActivationIterator iter(cx); !iter.done(); ++iter) {
+      InvalidateActivation(gcx, iter, false);
+    }
   }
 
   // Drop the references added above. If a script was never active, its
@@ -126,6 +126,9 @@ DefaultJitOptions::DefaultJitOptions() {
   // Whether the Baseline JIT is enabled.
   SET_DEFAULT(baselineJit, true);
 
+  // Whether Baseline JIT compilations may happen on helper threads.
+  SET_DEFAULT(baselineOffThreadCompile, false);
+
   // Whether the IonMonkey JIT is enabled.
   SET_DEFAULT(ion, true);
 
@@ -164,6 +167,10 @@ DefaultJitOptions::DefaultJitOptions() {
   // Duplicated in all.js - ensure both match.
   SET_DEFAULT(baselineJitWarmUpThreshold, 100);
 
+  // How many scripts are compiled and linked together when Baseline JIT
+  // compilations happen on helper threads.
+  SET_DEFAULT(baselineBatchSize, 8);
+
   // How many invocations or loop iterations are needed before functions
   // are considered for trial inlining.
   SET_DEFAULT(trialInliningWarmUpThreshold, 500);
@@ -197,6 +204,13 @@ DefaultJitOptions::DefaultJitOptions() {
   // Duplicated in all.js - ensure both match.
   SET_DEFAULT(frequentBailoutThreshold, 10);
 
+  // How many off-thread Ion compilations for a runtime may be waiting for a
+  // helper thread before we start delaying compilation of scripts that are
+  // only just warm enough. Creating the WarpSnapshot happens on the main
+  // thread, so this avoids spending main thread time on compilations that
+  // would wait behind hotter scripts anyway.
+  SET_DEFAULT(ionCompileBacklogLimit, 16);
+
   // Whether to run all debug checks in debug builds.
   // Disabling might make it more enjoyable to run JS in debug builds.
   SET_DEFAULT(fullDebugChecks, true);
@@ -247,6 +261,14 @@ DefaultJitOptions::DefaultJitOptions() {
     }
   }
 
+  // If non-zero, graphs with more LIR instructions than this are allocated
+  // with the simple allocator instead of the backtracking one, unless an
+  // allocator has been forced. Backtracking allocation time grows faster than
+  // linearly with the size of the graph, and dominates compilation time for
+  // huge functions. Disabled by default, as the simple allocator generates much
+  // slower code.
+  SET_DEFAULT(simpleRegAllocThreshold, 0);
+
 #if defined(JS_CODEGEN_MIPS32) || defined(JS_CODEGEN_MIPS64) || \
     defined(JS_CODEGEN_LOONG64)
   SET_DEFAULT(spectreIndexMasking, false);
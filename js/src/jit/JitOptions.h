@@ -19,6 +19,7 @@ namespace jit {
 enum IonRegisterAllocator {
   RegisterAllocator_Backtracking,
   RegisterAllocator_Testbed,
+  RegisterAllocator_Simple,
 };
 
 // Which register to use as base register to access stack slots: frame pointer,
@@ -34,6 +35,9 @@ static inline mozilla::Maybe<IonRegisterAllocator> LookupRegisterAllocator(
   if (!strcmp(name, "testbed")) {
     return mozilla::Some(RegisterAllocator_Testbed);
   }
+  if (!strcmp(name, "simple")) {
+    return mozilla::Some(RegisterAllocator_Simple);
+  }
   return mozilla::Nothing();
 }
 
@@ -62,6 +66,7 @@ struct DefaultJitOptions {
   bool disableBailoutLoopCheck;
   bool baselineInterpreter;
   bool baselineJit;
+  bool baselineOffThreadCompile;
   bool ion;
   bool jitForTrustedPrincipals;
   bool nativeRegExp;
@@ -87,12 +92,14 @@ struct DefaultJitOptions {
 #endif
   uint32_t baselineInterpreterWarmUpThreshold;
   uint32_t baselineJitWarmUpThreshold;
+  uint32_t baselineBatchSize;
   uint32_t trialInliningWarmUpThreshold;
   uint32_t trialInliningInitialWarmUpCount;
   uint32_t normalIonWarmUpThreshold;
   uint32_t regexpWarmUpThreshold;
   uint32_t exceptionBailoutThreshold;
   uint32_t frequentBailoutThreshold;
+  uint32_t ionCompileBacklogLimit;
   uint32_t maxStackArgs;
   uint32_t osrPcMismatchesBeforeRecompile;
   uint32_t smallFunctionMaxBytecodeLength;
@@ -109,6 +116,7 @@ struct DefaultJitOptions {
   uint32_t ionMaxLocalsAndArgsMainThread;
   uint32_t wasmBatchBaselineThreshold;
   uint32_t wasmBatchIonThreshold;
+  uint32_t simpleRegAllocThreshold;
   mozilla::Maybe<IonRegisterAllocator> forcedRegisterAllocator;
 
   // Spectre mitigation flags. Each mitigation has its own flag in order to
@@ -18,6 +18,7 @@
 #include "gc/Barrier.h"
 #include "gc/ZoneAllocator.h"
 #include "js/GCHashTable.h"
+#include "js/GCVector.h"
 #include "js/RootingAPI.h"
 #include "js/TracingAPI.h"
 #include "js/TypeDecls.h"
@@ -69,6 +70,12 @@ class JitRealm {
 
   gc::InitialHeap initialStringHeap;
 
+  // Scripts waiting to be sent to a helper thread for Baseline compilation as
+  // a single batch. See BaselineCompileTask.
+  using BaselineBatch =
+      GCVector<WeakHeapPtr<JSScript*>, 0, SystemAllocPolicy>;
+  BaselineBatch baselineBatch_;
+
   JitCode* generateStringConcatStub(JSContext* cx);
   JitCode* generateRegExpMatcherStub(JSContext* cx);
   JitCode* generateRegExpSearcherStub(JSContext* cx);
@@ -115,6 +122,8 @@ class JitRealm {
 
   void traceWeak(JSTracer* trc, JS::Realm* realm);
 
+  BaselineBatch& baselineBatch() { return baselineBatch_; }
+
   void discardStubs() {
     for (WeakHeapPtr<JitCode*>& stubRef : stubs_) {
       stubRef = nullptr;
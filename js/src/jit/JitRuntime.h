@@ -210,6 +210,9 @@ class JitRuntime {
       NumFinishedOffThreadTasksType;
   NumFinishedOffThreadTasksType numFinishedOffThreadTasks_{0};
 
+  // Number of off-thread Baseline compilations waiting to be linked.
+  NumFinishedOffThreadTasksType numFinishedBaselineTasks_{0};
+
   // List of Ion compilation waiting to get linked.
   using IonCompileTaskList = mozilla::LinkedList<js::jit::IonCompileTask>;
   MainThreadData<IonCompileTaskList> ionLazyLinkList_;
@@ -401,6 +404,12 @@ class JitRuntime {
     return numFinishedOffThreadTasks_;
   }
 
+  size_t numFinishedBaselineTasks() const { return numFinishedBaselineTasks_; }
+  NumFinishedOffThreadTasksType& numFinishedBaselineTasksRef(
+      const AutoLockHelperThreadState& locked) {
+    return numFinishedBaselineTasks_;
+  }
+
   IonCompileTaskList& ionLazyLinkList(JSRuntime* rt);
 
   size_t ionLazyLinkListSize() const { return ionLazyLinkListSize_; }
@@ -328,6 +328,10 @@ class alignas(uintptr_t) JitScript final : public TrailingArray {
 
     // True if this script entered Ion via OSR at a loop header.
     bool hadIonOSR : 1;
+
+    // True if this script is queued for, or undergoing, an off-thread
+    // Baseline compilation.
+    bool baselineCompilingOffThread : 1;
   };
   Flags flags_ = {};  // Zero-initialize flags.
 
@@ -374,6 +378,18 @@ class alignas(uintptr_t) JitScript final : public TrailingArray {
   void setHadIonOSR() { flags_.hadIonOSR = true; }
   bool hadIonOSR() const { return flags_.hadIonOSR; }
 
+  bool isBaselineCompilingOffThread() const {
+    return flags_.baselineCompilingOffThread;
+  }
+  void setIsBaselineCompilingOffThread() {
+    MOZ_ASSERT(!isBaselineCompilingOffThread());
+    flags_.baselineCompilingOffThread = true;
+  }
+  void clearIsBaselineCompilingOffThread() {
+    MOZ_ASSERT(isBaselineCompilingOffThread());
+    flags_.baselineCompilingOffThread = false;
+  }
+
   uint32_t numICEntries() const { return icScript_.numICEntries(); }
 
   bool active() const { return flags_.active; }
@@ -355,6 +355,7 @@ static void PrintHelpAndExit(int status = 0) {
       "  codegen       Native code generation\n"
       "  bailouts      Bailouts\n"
       "  caches        Inline caches\n"
+      "  scheduling    Ion compilation scheduling decisions\n"
       "  osi           Invalidation\n"
       "  safepoints    Safepoints\n"
       "  pools         Literal Pools (ARM only for now)\n"
@@ -453,6 +454,8 @@ void jit::CheckLogging() {
       EnableChannel(JitSpew_IonInvalidate);
     } else if (IsFlag(found, "caches")) {
       EnableChannel(JitSpew_IonIC);
+    } else if (IsFlag(found, "scheduling")) {
+      EnableChannel(JitSpew_IonScheduling);
     } else if (IsFlag(found, "safepoints")) {
       EnableChannel(JitSpew_Safepoints);
     } else if (IsFlag(found, "pools")) {
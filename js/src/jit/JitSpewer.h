@@ -105,6 +105,8 @@ namespace jit {
   _(IonSnapshots)                          \
   /* Generated inline cache stubs */       \
   _(IonIC)                                 \
+  /* Ion compilation scheduling */         \
+  _(IonScheduling)                         \
                                            \
   /* WARP SPEW */                          \
                                            \
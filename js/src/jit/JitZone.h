@@ -74,10 +74,23 @@ struct CacheIRStubKey : public DefaultHasher<CacheIRStubKey> {
   }
 };
 
+// Shared Baseline stub code, along with the major GC number at the time the
+// code was last requested, or NotRetained if it should no longer be kept alive
+// past its last use. See JitZone::traceRetainedStubCode.
+struct BaselineCacheIRStubCodeEntry {
+  static constexpr uint64_t NotRetained = UINT64_MAX;
+
+  WeakHeapPtr<JitCode*> code;
+  uint64_t lastUsedMajorGC;
+
+  BaselineCacheIRStubCodeEntry(JitCode* code, uint64_t majorGC)
+      : code(code), lastUsedMajorGC(majorGC) {}
+};
+
 struct BaselineCacheIRStubCodeMapGCPolicy {
   static bool traceWeak(JSTracer* trc, CacheIRStubKey*,
-                        WeakHeapPtr<JitCode*>* value) {
-    return TraceWeakEdge(trc, value, "traceWeak");
+                        BaselineCacheIRStubCodeEntry* value) {
+    return TraceWeakEdge(trc, &value->code, "traceWeak");
   }
 };
 
@@ -92,7 +105,7 @@ class JitZone {
 
   // Map CacheIRStubKey to shared JitCode objects.
   using BaselineCacheIRStubCodeMap =
-      GCHashMap<CacheIRStubKey, WeakHeapPtr<JitCode*>, CacheIRStubKey,
+      GCHashMap<CacheIRStubKey, BaselineCacheIRStubCodeEntry, CacheIRStubKey,
                 SystemAllocPolicy, BaselineCacheIRStubCodeMapGCPolicy>;
   BaselineCacheIRStubCodeMap baselineCacheIRStubCodes_;
 
@@ -111,6 +124,16 @@ class JitZone {
  public:
   ~JitZone() { MOZ_ASSERT(!keepJitScripts_); }
 
+  // Number of major GCs for which Baseline stub code is kept alive after it
+  // was last requested, even if no IC stub uses it any more.
+  static constexpr uint64_t StubCodeRetainMajorGCs = 3;
+
+  void traceRetainedStubCode(JSTracer* trc);
+  void expireRetainedStubCode();
+
+  size_t baselineCacheIRStubCodeCountForTesting() const {
+    return baselineCacheIRStubCodes_.count();
+  }
   void traceWeak(JSTracer* trc);
 
   void addSizeOfIncludingThis(mozilla::MallocSizeOf mallocSizeOf,
@@ -120,21 +143,25 @@ class JitZone {
   OptimizedICStubSpace* optimizedStubSpace() { return &optimizedStubSpace_; }
 
   JitCode* getBaselineCacheIRStubCode(const CacheIRStubKey::Lookup& key,
+                                      uint64_t majorGCNumber,
                                       CacheIRStubInfo** stubInfo) {
     auto p = baselineCacheIRStubCodes_.lookup(key);
     if (p) {
+      p->value().lastUsedMajorGC = majorGCNumber;
       *stubInfo = p->key().stubInfo.get();
-      return p->value();
+      return p->value().code;
     }
     *stubInfo = nullptr;
     return nullptr;
   }
   [[nodiscard]] bool putBaselineCacheIRStubCode(
       const CacheIRStubKey::Lookup& lookup, CacheIRStubKey& key,
-      JitCode* stubCode) {
+      JitCode* stubCode, uint64_t majorGCNumber) {
     auto p = baselineCacheIRStubCodes_.lookupForAdd(lookup);
     MOZ_ASSERT(!p);
-    return baselineCacheIRStubCodes_.add(p, std::move(key), stubCode);
+    return baselineCacheIRStubCodes_.add(
+        p, std::move(key),
+        BaselineCacheIRStubCodeEntry(stubCode, majorGCNumber));
   }
 
   CacheIRStubInfo* getIonCacheIRStubInfo(const CacheIRStubKey::Lookup& key) {
@@ -75,5 +75,97 @@ JitCode* Linker::newCode(JSContext* cx, CodeKind kind) {
   return code;
 }
 
+bool BatchLinker::newCode(JSContext* cx, CodeKind kind, JitCodeVector* codes) {
+  JS::AutoAssertNoGC nogc(cx);
+  MOZ_ASSERT(codes->empty());
+  MOZ_ASSERT(!masms_.empty());
+
+  static const size_t ExecutableAllocatorAlignment = sizeof(void*);
+
+  // Lay the pieces out back to back, each one sized as Linker::newCode would
+  // size it, so every JitCode owns a contiguous part of the allocation.
+  Vector<size_t, 8, SystemAllocPolicy> pieceBytes;
+  size_t totalBytes = 0;
+  for (MacroAssembler* masm : masms_) {
+    if (masm->oom()) {
+      return fail(cx);
+    }
+    size_t bytesNeeded = masm->bytesNeeded() + sizeof(JitCodeHeader) +
+                         (CodeAlignment - ExecutableAllocatorAlignment);
+    if (bytesNeeded >= MAX_BUFFER_SIZE) {
+      return fail(cx);
+    }
+    bytesNeeded = AlignBytes(bytesNeeded, ExecutableAllocatorAlignment);
+    if (!pieceBytes.append(bytesNeeded)) {
+      return fail(cx);
+    }
+    totalBytes += bytesNeeded;
+    if (totalBytes >= MAX_BUFFER_SIZE) {
+      return fail(cx);
+    }
+  }
+
+  if (!codes->reserve(masms_.length())) {
+    return fail(cx);
+  }
+
+  JitZone* jitZone = cx->zone()->getJitZone(cx);
+  if (!jitZone) {
+    // Note: don't call fail(cx) here, getJitZone reports OOM.
+    return false;
+  }
+
+  ExecutablePool* pool;
+  uint8_t* result =
+      (uint8_t*)jitZone->execAlloc().alloc(cx, totalBytes, &pool, kind);
+  if (!result) {
+    return fail(cx);
+  }
+
+  // The allocation holds a single reference to the pool, but each JitCode
+  // releases its own reference when it is finalized.
+  for (size_t i = 1; i < masms_.length(); i++) {
+    pool->addRef();
+  }
+
+  uint8_t* pieceStart = result;
+  for (size_t i = 0; i < masms_.length(); i++) {
+    uint8_t* codeStart = pieceStart + sizeof(JitCodeHeader);
+    codeStart = (uint8_t*)AlignBytes((uintptr_t)codeStart, CodeAlignment);
+    MOZ_ASSERT(codeStart + masms_[i]->bytesNeeded() <=
+               pieceStart + pieceBytes[i]);
+    uint32_t headerSize = codeStart - pieceStart;
+    JitCode* code = JitCode::New<NoGC>(cx, codeStart, pieceBytes[i],
+                                       headerSize, pool, kind);
+    if (!code) {
+      // JitCode::New released the failed piece. Release the ones after it;
+      // the code already created is collected by the next GC.
+      for (size_t j = i + 1; j < masms_.length(); j++) {
+        pool->release(pieceBytes[j], kind);
+      }
+      codes->clear();
+      return fail(cx);
+    }
+    codes->infallibleAppend(code);
+    pieceStart += pieceBytes[i];
+  }
+
+  awjcf.emplace(result, totalBytes);
+  if (!awjcf->makeWritable()) {
+    codes->clear();
+    return fail(cx);
+  }
+
+  for (size_t i = 0; i < masms_.length(); i++) {
+    JitCode* code = (*codes)[i];
+    code->copyFrom(*masms_[i]);
+    masms_[i]->link(code);
+    if (masms_[i]->embedsNurseryPointers()) {
+      cx->runtime()->gc.storeBuffer().putWholeCell(code);
+    }
+  }
+  return true;
+}
+
 }  // namespace jit
 }  // namespace js
@@ -15,6 +15,7 @@
 
 #include "jit/AutoWritableJitCode.h"
 #include "jit/MacroAssembler.h"
+#include "js/Vector.h"
 #include "vm/Runtime.h"
 
 struct JS_PUBLIC_API JSContext;
@@ -46,6 +47,39 @@ class Linker {
   JitCode* newCode(JSContext* cx, CodeKind kind);
 };
 
+// Like Linker, but links the contents of several macro assemblers into a
+// single executable memory allocation. The whole allocation is made writable
+// once, and made executable again once when the BatchLinker is destroyed,
+// instead of once per JitCode.
+class BatchLinker {
+  Vector<MacroAssembler*, 8, SystemAllocPolicy> masms_;
+  mozilla::Maybe<AutoWritableJitCodeFallible> awjcf;
+
+  bool fail(JSContext* cx) {
+    ReportOutOfMemory(cx);
+    return false;
+  }
+
+ public:
+  BatchLinker() = default;
+
+  [[nodiscard]] bool add(MacroAssembler& masm) {
+    masm.finish();
+    return masms_.append(&masm);
+  }
+
+  size_t length() const { return masms_.length(); }
+
+  // Create a new JitCode object for each macro assembler, in the order they
+  // were added, and populate it with the contents of that assembler's buffer.
+  // Either all of the code is created or none of it is.
+  //
+  // This method cannot GC. Errors are reported to the context.
+  using JitCodeVector = Vector<JitCode*, 8, SystemAllocPolicy>;
+  [[nodiscard]] bool newCode(JSContext* cx, CodeKind kind,
+                             JitCodeVector* codes);
+};
+
 }  // namespace jit
 }  // namespace js
 
@@ -5696,6 +5696,11 @@ void LIRGenerator::visitIncrementWarmUpCounter(MIncrementWarmUpCounter* ins) {
   add(lir, ins);
 }
 
+void LIRGenerator::visitIncrementCodeCoverageCounter(
+    MIncrementCodeCoverageCounter* ins) {
+  add(new (alloc()) LIncrementCodeCoverageCounter(), ins);
+}
+
 void LIRGenerator::visitLexicalCheck(MLexicalCheck* ins) {
   MDefinition* input = ins->input();
   MOZ_ASSERT(input->type() == MIRType::Value);
@@ -6318,6 +6323,28 @@ void LIRGenerator::visitMapObjectGetValueVMCall(MMapObjectGetValueVMCall* ins) {
   assignSafepoint(lir, ins);
 }
 
+void LIRGenerator::visitMapObjectSet(MMapObjectSet* ins) {
+  auto* lir = new (alloc())
+      LMapObjectSet(useRegisterAtStart(ins->map()), useBoxAtStart(ins->key()),
+                    useBoxAtStart(ins->value()));
+  defineReturn(lir, ins);
+  assignSafepoint(lir, ins);
+}
+
+void LIRGenerator::visitSetObjectAdd(MSetObjectAdd* ins) {
+  auto* lir = new (alloc())
+      LSetObjectAdd(useRegisterAtStart(ins->set()), useBoxAtStart(ins->key()));
+  defineReturn(lir, ins);
+  assignSafepoint(lir, ins);
+}
+
+void LIRGenerator::visitDateLocalComponent(MDateLocalComponent* ins) {
+  MOZ_ASSERT(ins->date()->type() == MIRType::Object);
+
+  auto* lir = new (alloc()) LDateLocalComponent(useRegister(ins->date()));
+  defineBox(lir, ins);
+}
+
 void LIRGenerator::visitConstant(MConstant* ins) {
   if (!IsFloatingPointType(ins->type()) && ins->canEmitAtUses()) {
     emitAtUses(ins);
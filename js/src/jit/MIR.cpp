@@ -5980,6 +5980,12 @@ AliasSet MThrowRuntimeLexicalError::getAliasSet() const {
   return AliasSet::Store(AliasSet::ExceptionState);
 }
 
+AliasSet MIncrementCodeCoverageCounter::getAliasSet() const {
+  // The counter isn't read by JIT code, but the increment must not be
+  // eliminated or moved across blocks.
+  return AliasSet::Store(AliasSet::ExceptionState);
+}
+
 AliasSet MSlots::getAliasSet() const {
   return AliasSet::Load(AliasSet::ObjectFields);
 }
@@ -6760,6 +6766,23 @@ AliasSet MMapObjectGetValueVMCall::getAliasSet() const {
   return AliasSet::Load(AliasSet::MapOrSetHashTable);
 }
 
+bool MDateLocalComponent::congruentTo(const MDefinition* ins) const {
+  if (!ins->isDateLocalComponent()) {
+    return false;
+  }
+  if (ins->toDateLocalComponent()->slot() != slot()) {
+    return false;
+  }
+  return congruentIfOperandsEqual(ins);
+}
+
+AliasSet MDateLocalComponent::getAliasSet() const {
+  // Filling the local time slots only caches values derived from the UTC time
+  // slot, and these slots aren't accessed by any other MIR instructions, so
+  // this can be treated as a plain load.
+  return AliasSet::Load(AliasSet::FixedSlot);
+}
+
 MIonToWasmCall* MIonToWasmCall::New(TempAllocator& alloc,
                                     WasmInstanceObject* instanceObj,
                                     const wasm::FuncExport& funcExport) {
@@ -2813,6 +2813,11 @@ IonHeapMacroAssembler::IonHeapMacroAssembler(TempAllocator& alloc,
   MOZ_ASSERT(CurrentThreadIsIonCompiling());
 }
 
+BaselineMacroAssembler::BaselineMacroAssembler(JSContext* cx,
+                                               TempAllocator& alloc)
+    : MacroAssembler(alloc, CompileRuntime::get(cx->runtime()),
+                     CompileRealm::get(cx->realm())) {}
+
 WasmMacroAssembler::WasmMacroAssembler(TempAllocator& alloc, bool limitedSize)
     : MacroAssembler(alloc) {
 #if defined(JS_CODEGEN_ARM64)
@@ -5330,6 +5330,14 @@ class IonHeapMacroAssembler : public MacroAssembler {
   IonHeapMacroAssembler(TempAllocator& alloc, CompileRealm* realm);
 };
 
+// MacroAssembler used by the Baseline compiler. Unlike StackMacroAssembler it
+// can outlive a GC-free region, because Baseline compilations may generate
+// code on a helper thread. GC cancels off-thread compilations.
+class BaselineMacroAssembler : public MacroAssembler {
+ public:
+  BaselineMacroAssembler(JSContext* cx, TempAllocator& alloc);
+};
+
 //{{{ check_macroassembler_style
 inline uint32_t MacroAssembler::framePushed() const { return framePushed_; }
 
@@ -26,6 +26,7 @@
 
 #include <atomic>
 
+#include "jit/InlineScriptTree.h"
 #include "jit/Jitdump.h"
 #include "jit/JitSpewer.h"
 #include "jit/LIR.h"
@@ -370,10 +371,40 @@ void InlineCachePerfSpewer::recordInstruction(MacroAssembler& masm,
   }
 }
 
-void IonPerfSpewer::recordInstruction(MacroAssembler& masm, LNode::Opcode op) {
+void PerfSpewer::recordSourceLocation(MacroAssembler& masm, JSScript* script,
+                                      jsbytecode* pc) {
+  // Only add an entry when the location changes.
+  if (!sources_.empty() && sources_.back().script == script &&
+      sources_.back().pc == pc) {
+    return;
+  }
+
+  SourceEntry entry;
+  entry.script = script;
+  entry.pc = pc;
+  masm.bind(&entry.addr);
+
+  if (!sources_.append(entry)) {
+    AutoLockPerfSpewer lock;
+    sources_.clear();
+    DisablePerfSpewer(lock);
+  }
+}
+
+void IonPerfSpewer::recordInstruction(MacroAssembler& masm, LInstruction* ins) {
+  if (PerfSrcEnabled()) {
+    if (MDefinition* mir = ins->mirRaw()) {
+      const BytecodeSite* site = mir->trackedSite();
+      if (site->script()) {
+        recordSourceLocation(masm, site->script(), site->pc());
+      }
+    }
+  }
+
   if (!PerfIREnabled()) {
     return;
   }
+  LNode::Opcode op = ins->op();
   AutoLockPerfSpewer lock;
 
 #ifdef JS_ION_PERF
@@ -399,10 +430,16 @@ void IonPerfSpewer::recordInstruction(MacroAssembler& masm, LNode::Opcode op) {
   }
 }
 
-void BaselinePerfSpewer::recordInstruction(MacroAssembler& masm, JSOp op) {
+void BaselinePerfSpewer::recordInstruction(MacroAssembler& masm,
+                                           JSScript* script, jsbytecode* pc) {
+  if (PerfSrcEnabled()) {
+    recordSourceLocation(masm, script, pc);
+  }
+
   if (!PerfIREnabled()) {
     return;
   }
+  JSOp op = JSOp(*pc);
   AutoLockPerfSpewer lock;
 
 #ifdef JS_ION_PERF
@@ -445,10 +482,6 @@ void PerfSpewer::CollectJitCodeInfo(UniqueChars& function_name, JitCode* code,
 void PerfSpewer::CollectJitCodeInfo(const char* desc, JSScript* script,
                                     JitCode* code, JS::JitCodeRecord* record,
                                     AutoLockPerfSpewer& lock) {
-  if (PerfSrcEnabled()) {
-    SaveJitCodeSourceInfo(script, code, record, lock);
-  }
-
   UniqueChars function_name =
       JS_smprintf("%s %s:%u:%u", desc, script->filename(), script->lineno(),
                   script->column());
@@ -618,6 +651,88 @@ void PerfSpewer::SaveJitCodeSourceInfo(JSScript* script, JitCode* code,
   }
 }
 
+bool PerfSpewer::saveJitCodeNativeSourceInfo(JitCode* code,
+                                             JS::JitCodeRecord* profilerRecord,
+                                             AutoLockPerfSpewer& lock) {
+  if (sources_.empty()) {
+    return false;
+  }
+
+  struct Location {
+    uint64_t offset;
+    const char* filename;
+    uint32_t lineno;
+    uint32_t colno;
+  };
+  Vector<Location, 0, SystemAllocPolicy> locations;
+
+#ifdef JS_ION_PERF
+  uint64_t debugRecordSize = sizeof(JitDumpDebugRecord);
+#endif
+
+  for (SourceEntry& entry : sources_) {
+    const char* filename = entry.script->filename();
+    if (!filename) {
+      continue;
+    }
+    unsigned colno;
+    unsigned lineno = PCToLineNumber(entry.script, entry.pc, &colno);
+
+    // Merge entries with the same position, for example for the bytecode ops
+    // of a single expression.
+    if (!locations.empty() && locations.back().lineno == lineno &&
+        locations.back().colno == colno &&
+        strcmp(locations.back().filename, filename) == 0) {
+      continue;
+    }
+
+    if (!locations.append(
+            Location{entry.addr.offset(), filename, lineno, colno})) {
+      sources_.clear();
+      DisablePerfSpewer(lock);
+      return true;
+    }
+#ifdef JS_ION_PERF
+    debugRecordSize += sizeof(JitDumpDebugEntry) + strlen(filename) + 1;
+#endif
+  }
+  sources_.clear();
+
+#ifdef JS_ION_PERF
+  // perf can only show the source of files which exist on disk, but the
+  // entries are still useful to attribute samples to lines.
+  if (IsPerfProfiling() && !locations.empty()) {
+    JitDumpDebugRecord debug_record = {};
+    debug_record.header.id = JIT_CODE_DEBUG_INFO;
+    debug_record.header.total_size = debugRecordSize;
+    debug_record.header.timestamp = GetMonotonicTimestamp();
+    debug_record.code_addr = uint64_t(code->raw());
+    debug_record.nr_entry = locations.length();
+
+    WriteToJitDumpFile(&debug_record, sizeof(debug_record), lock);
+  }
+#endif
+
+  for (const Location& loc : locations) {
+    if (JS::JitCodeSourceInfo* srcInfo =
+            CreateProfilerSourceEntry(profilerRecord, lock)) {
+      srcInfo->offset = loc.offset;
+      srcInfo->lineno = loc.lineno;
+      srcInfo->colno = loc.colno;
+      srcInfo->filename = JS_smprintf("%s", loc.filename);
+    }
+
+#ifdef JS_ION_PERF
+    if (IsPerfProfiling()) {
+      WriteJitDumpDebugEntry(uint64_t(code->raw()) + loc.offset, loc.filename,
+                             loc.lineno, loc.colno, lock);
+    }
+#endif
+  }
+
+  return true;
+}
+
 void IonPerfSpewer::saveProfile(JSScript* script, JitCode* code) {
   if (!PerfEnabled()) {
     return;
@@ -630,6 +745,11 @@ void IonPerfSpewer::saveProfile(JSScript* script, JitCode* code) {
     saveJitCodeIRInfo(lirFilename.get(), code, profilerRecord, lock);
   }
 
+  if (PerfSrcEnabled() &&
+      !saveJitCodeNativeSourceInfo(code, profilerRecord, lock)) {
+    SaveJitCodeSourceInfo(script, code, profilerRecord, lock);
+  }
+
   CollectJitCodeInfo("Ion", script, code, profilerRecord, lock);
 }
 
@@ -645,6 +765,11 @@ void BaselinePerfSpewer::saveProfile(JSScript* script, JitCode* code) {
     saveJitCodeIRInfo(jsopFilename.get(), code, profilerRecord, lock);
   }
 
+  if (PerfSrcEnabled() &&
+      !saveJitCodeNativeSourceInfo(code, profilerRecord, lock)) {
+    SaveJitCodeSourceInfo(script, code, profilerRecord, lock);
+  }
+
   CollectJitCodeInfo("Baseline", script, code, profilerRecord, lock);
 }
 
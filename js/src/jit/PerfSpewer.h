@@ -47,6 +47,18 @@ class PerfSpewer {
   };
   Vector<OpcodeEntry, 0, SystemAllocPolicy> opcodes_;
 
+  // Bytecode location of the code starting at |addr|, used to map native code
+  // to source lines and columns.
+  struct SourceEntry {
+    Label addr;
+    JSScript* script = nullptr;
+    jsbytecode* pc = nullptr;
+  };
+  Vector<SourceEntry, 0, SystemAllocPolicy> sources_;
+
+  void recordSourceLocation(MacroAssembler& masm, JSScript* script,
+                            jsbytecode* pc);
+
   uint32_t lir_opcode_length = 0;
   uint32_t js_opcode_length = 0;
 
@@ -62,6 +74,14 @@ class PerfSpewer {
                                     JS::JitCodeRecord* record,
                                     AutoLockPerfSpewer& lock);
 
+  // Like SaveJitCodeSourceInfo, but uses the locations recorded with
+  // recordSourceLocation so source positions are attributed to native code
+  // offsets, including for inlined scripts. Returns false if no locations
+  // were recorded.
+  bool saveJitCodeNativeSourceInfo(JitCode* code,
+                                   JS::JitCodeRecord* profilerRecord,
+                                   AutoLockPerfSpewer& lock);
+
   static void CollectJitCodeInfo(const char* desc, JSScript* script,
                                  JitCode* code, JS::JitCodeRecord*,
                                  AutoLockPerfSpewer& lock);
@@ -87,7 +107,7 @@ class IonPerfSpewer : public PerfSpewer {
   JS::JitTier GetTier() override { return JS::JitTier::Ion; }
 
  public:
-  void recordInstruction(MacroAssembler& masm, LNode::Opcode op);
+  void recordInstruction(MacroAssembler& masm, LInstruction* ins);
   void saveProfile(JSScript* script, JitCode* code);
 };
 
@@ -97,7 +117,8 @@ class BaselinePerfSpewer : public PerfSpewer {
   JS::JitTier GetTier() override { return JS::JitTier::Baseline; }
 
  public:
-  void recordInstruction(MacroAssembler& masm, JSOp op);
+  void recordInstruction(MacroAssembler& masm, JSScript* script,
+                         jsbytecode* pc);
   void saveProfile(JSScript* script, JitCode* code);
 };
 
@@ -151,6 +151,51 @@ static bool PhiOperandsEqualTo(MPhi* phi, MInstruction* newObject) {
 static bool IsObjectEscaped(MDefinition* ins, MInstruction* newObject,
                             const Shape* shapeDefault = nullptr);
 
+static JSFunction* LambdaTemplateFunction(MInstruction* lambda) {
+  if (lambda->isLambda()) {
+    return lambda->toLambda()->templateFunction();
+  }
+  return lambda->toFunctionWithProto()->function();
+}
+
+// Returns true if |guard| is known to succeed for functions created by
+// |lambda|. Only flags which are copied from the template function and which
+// can't change afterwards are considered.
+static bool LambdaGuardSucceeds(MInstruction* lambda, MDefinition* guard) {
+  FunctionFlags flags = LambdaTemplateFunction(lambda)->flags();
+
+  switch (guard->op()) {
+    case MDefinition::Opcode::GuardFunctionFlags: {
+      constexpr uint16_t StableFlags =
+          FunctionFlags::STABLE_ACROSS_CLONES | FunctionFlags::BASESCRIPT |
+          FunctionFlags::SELFHOSTLAZY | FunctionFlags::WASM_JIT_ENTRY;
+
+      auto* flagsGuard = guard->toGuardFunctionFlags();
+      uint16_t expected = flagsGuard->expectedFlags();
+      uint16_t unexpected = flagsGuard->unexpectedFlags();
+      if ((expected | unexpected) & ~StableFlags) {
+        return false;
+      }
+      if (expected && !flags.hasFlags(expected)) {
+        return false;
+      }
+      return !flags.hasFlags(unexpected);
+    }
+
+    case MDefinition::Opcode::GuardFunctionKind: {
+      auto* kindGuard = guard->toGuardFunctionKind();
+      bool equal = flags.kind() == kindGuard->expected();
+      return equal != kindGuard->bailOnEquality();
+    }
+
+    case MDefinition::Opcode::GuardFunctionIsNonBuiltinCtor:
+      return flags.isNonBuiltinConstructor();
+
+    default:
+      MOZ_CRASH("Unexpected guard");
+  }
+}
+
 // Returns False if the lambda is not escaped and if it is optimizable by
 // ScalarReplacementOfObject.
 static bool IsLambdaEscaped(MInstruction* ins, MInstruction* lambda,
@@ -204,6 +249,21 @@ static bool IsLambdaEscaped(MInstruction* ins, MInstruction* lambda,
         break;
       }
 
+      case MDefinition::Opcode::GuardFunctionFlags:
+      case MDefinition::Opcode::GuardFunctionKind:
+      case MDefinition::Opcode::GuardFunctionIsNonBuiltinCtor: {
+        if (!LambdaGuardSucceeds(lambda, def)) {
+          JitSpewDef(JitSpew_Escape, "has a non-matching function guard\n",
+                     def);
+          return true;
+        }
+        if (IsLambdaEscaped(def->toInstruction(), lambda, newObject, shape)) {
+          JitSpewDef(JitSpew_Escape, "is indirectly escaped by\n", def);
+          return true;
+        }
+        break;
+      }
+
       case MDefinition::Opcode::FunctionEnvironment: {
         if (IsObjectEscaped(def->toFunctionEnvironment(), newObject, shape)) {
           JitSpewDef(JitSpew_Escape, "is indirectly escaped by\n", def);
@@ -449,6 +509,9 @@ class ObjectMemoryView : public MDefinitionVisitorDefaultNoop {
   void visitFunctionEnvironment(MFunctionEnvironment* ins);
   void visitGuardToFunction(MGuardToFunction* ins);
   void visitGuardFunctionScript(MGuardFunctionScript* ins);
+  void visitGuardFunctionFlags(MGuardFunctionFlags* ins);
+  void visitGuardFunctionKind(MGuardFunctionKind* ins);
+  void visitGuardFunctionIsNonBuiltinCtor(MGuardFunctionIsNonBuiltinCtor* ins);
   void visitLambda(MLambda* ins);
   void visitFunctionWithProto(MFunctionWithProto* ins);
   void visitPhi(MPhi* ins);
@@ -827,6 +890,15 @@ MDefinition* ObjectMemoryView::functionForCallObject(MDefinition* ins) {
       case MDefinition::Opcode::GuardFunctionScript:
         ins = ins->toGuardFunctionScript()->function();
         break;
+      case MDefinition::Opcode::GuardFunctionFlags:
+        ins = ins->toGuardFunctionFlags()->function();
+        break;
+      case MDefinition::Opcode::GuardFunctionKind:
+        ins = ins->toGuardFunctionKind()->function();
+        break;
+      case MDefinition::Opcode::GuardFunctionIsNonBuiltinCtor:
+        ins = ins->toGuardFunctionIsNonBuiltinCtor()->function();
+        break;
       default:
         return nullptr;
     }
@@ -874,6 +946,55 @@ void ObjectMemoryView::visitGuardFunctionScript(MGuardFunctionScript* ins) {
   ins->block()->discard(ins);
 }
 
+void ObjectMemoryView::visitGuardFunctionFlags(MGuardFunctionFlags* ins) {
+  // Skip guards on other objects.
+  auto* function = functionForCallObject(ins);
+  if (!function) {
+    return;
+  }
+
+  // IsLambdaEscaped checked that the guard can't fail. Replace the guard by
+  // its object.
+  MOZ_ASSERT(LambdaGuardSucceeds(function->toInstruction(), ins));
+  ins->replaceAllUsesWith(function);
+
+  // Remove original instruction.
+  ins->block()->discard(ins);
+}
+
+void ObjectMemoryView::visitGuardFunctionKind(MGuardFunctionKind* ins) {
+  // Skip guards on other objects.
+  auto* function = functionForCallObject(ins);
+  if (!function) {
+    return;
+  }
+
+  // IsLambdaEscaped checked that the guard can't fail. Replace the guard by
+  // its object.
+  MOZ_ASSERT(LambdaGuardSucceeds(function->toInstruction(), ins));
+  ins->replaceAllUsesWith(function);
+
+  // Remove original instruction.
+  ins->block()->discard(ins);
+}
+
+void ObjectMemoryView::visitGuardFunctionIsNonBuiltinCtor(
+    MGuardFunctionIsNonBuiltinCtor* ins) {
+  // Skip guards on other objects.
+  auto* function = functionForCallObject(ins);
+  if (!function) {
+    return;
+  }
+
+  // IsLambdaEscaped checked that the guard can't fail. Replace the guard by
+  // its object.
+  MOZ_ASSERT(LambdaGuardSucceeds(function->toInstruction(), ins));
+  ins->replaceAllUsesWith(function);
+
+  // Remove original instruction.
+  ins->block()->discard(ins);
+}
+
 void ObjectMemoryView::visitLambda(MLambda* ins) {
   if (ins->environmentChain() != obj_) {
     return;
@@ -2976,6 +3097,103 @@ void RestReplacer::visitConstructArray(MConstructArray* ins) {
   discardInstruction(ins, elements);
 }
 
+// Returns False if all uses of the lambda are either recoverable resume point
+// operands, guards which are known to succeed, or reads of its environment.
+// Such lambdas don't need to be allocated, because the environment is already
+// available as the lambda's operand and the lambda itself can be recovered on
+// bailout. This is common for closures passed to functions which have been
+// inlined, e.g. |arr.map(x => x + k)|.
+static bool IsLambdaAllocationEscaped(MInstruction* ins,
+                                      MInstruction* lambda) {
+  MOZ_ASSERT(lambda->isLambda() || lambda->isFunctionWithProto());
+  JitSpewDef(JitSpew_Escape, "Check lambda\n", ins);
+  JitSpewIndent spewIndent(JitSpew_Escape);
+
+  for (MUseIterator i(ins->usesBegin()); i != ins->usesEnd(); i++) {
+    MNode* consumer = (*i)->consumer();
+    if (!consumer->isDefinition()) {
+      // Cannot optimize if it is observable from fun.arguments or others.
+      if (!consumer->toResumePoint()->isRecoverableOperand(*i)) {
+        JitSpew(JitSpew_Escape, "Observable lambda cannot be recovered");
+        return true;
+      }
+      continue;
+    }
+
+    MDefinition* def = consumer->toDefinition();
+    switch (def->op()) {
+      case MDefinition::Opcode::GuardToFunction:
+        break;
+
+      case MDefinition::Opcode::GuardFunctionScript: {
+        auto* guard = def->toGuardFunctionScript();
+        if (LambdaTemplateFunction(lambda)->baseScript() != guard->expected()) {
+          JitSpewDef(JitSpew_Escape, "has a non-matching script guard\n",
+                     guard);
+          return true;
+        }
+        break;
+      }
+
+      case MDefinition::Opcode::GuardFunctionFlags:
+      case MDefinition::Opcode::GuardFunctionKind:
+      case MDefinition::Opcode::GuardFunctionIsNonBuiltinCtor:
+        if (!LambdaGuardSucceeds(lambda, def)) {
+          JitSpewDef(JitSpew_Escape, "has a non-matching function guard\n",
+                     def);
+          return true;
+        }
+        break;
+
+      case MDefinition::Opcode::FunctionEnvironment:
+        continue;
+
+      default:
+        JitSpewDef(JitSpew_Escape, "is escaped by\n", def);
+        return true;
+    }
+
+    // The guard is known to succeed. Check the uses of the guarded lambda.
+    if (IsLambdaAllocationEscaped(def->toInstruction(), lambda)) {
+      JitSpewDef(JitSpew_Escape, "is indirectly escaped by\n", def);
+      return true;
+    }
+  }
+
+  JitSpew(JitSpew_Escape, "Lambda is not escaped");
+  return false;
+}
+
+// Replace all guards on |ins| by the lambda and all environment reads by the
+// lambda's environment chain. This leaves the lambda without any uses other
+// than resume points, so that the Sink pass recovers it on bailout instead of
+// allocating it.
+static void ReplaceLambdaUses(MInstruction* ins, MInstruction* lambda) {
+  MDefinition* env = lambda->isLambda()
+                         ? lambda->toLambda()->environmentChain()
+                         : lambda->toFunctionWithProto()->environmentChain();
+
+  for (MUseIterator i(ins->usesBegin()); i != ins->usesEnd();) {
+    MNode* consumer = (*i++)->consumer();
+    if (!consumer->isDefinition()) {
+      continue;
+    }
+
+    MInstruction* def = consumer->toDefinition()->toInstruction();
+    if (def->isFunctionEnvironment()) {
+      def->replaceAllUsesWith(env);
+    } else {
+      ReplaceLambdaUses(def, lambda);
+      def->replaceAllUsesWith(lambda);
+    }
+
+    // |i| may point to a use of |def| when |def| uses |ins| multiple times, so
+    // restart the iteration after discarding it.
+    def->block()->discard(def);
+    i = ins->usesBegin();
+  }
+}
+
 bool ScalarReplacement(MIRGenerator* mir, MIRGraph& graph) {
   JitSpew(JitSpew_Escape, "Begin (ScalarReplacement)");
 
@@ -3033,6 +3251,12 @@ bool ScalarReplacement(MIRGenerator* mir, MIRGraph& graph) {
         }
         continue;
       }
+
+      if ((ins->isLambda() || ins->isFunctionWithProto()) &&
+          ins->hasDefUses() && !IsLambdaAllocationEscaped(*ins, *ins)) {
+        ReplaceLambdaUses(*ins, *ins);
+        continue;
+      }
     }
   }
 
@@ -0,0 +1,1076 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+ * vim: set ts=8 sts=2 et sw=2 tw=80:
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "jit/SimpleAllocator.h"
+
+#include <algorithm>
+
+#include "jit/JitSpewer.h"
+
+using namespace js;
+using namespace js::jit;
+
+static inline bool IsFloatType(LDefinition::Type type) {
+  return type == LDefinition::FLOAT32 || type == LDefinition::DOUBLE ||
+         type == LDefinition::SIMD128;
+}
+
+// Whether safepoints need to know where values of this type are.
+static inline bool IsSafepointType(LDefinition::Type type) {
+  switch (type) {
+    case LDefinition::OBJECT:
+    case LDefinition::SLOTS:
+    case LDefinition::STACKRESULTS:
+#ifdef JS_NUNBOX32
+    case LDefinition::TYPE:
+    case LDefinition::PAYLOAD:
+#else
+    case LDefinition::BOX:
+#endif
+      return true;
+    default:
+      return false;
+  }
+}
+
+static inline size_t SlotWidthIndex(LDefinition::Type type) {
+  switch (StackSlotAllocator::width(type)) {
+    case 4:
+      return 0;
+    case 8:
+      return 1;
+    case 16:
+      return 2;
+  }
+  MOZ_CRASH("Unknown slot width");
+}
+
+bool SimpleAllocator::init() {
+  if (!RegisterAllocator::init()) {
+    return false;
+  }
+
+  liveIn = mir->allocate<BitSet>(graph.numBlockIds());
+  if (!liveIn) {
+    return false;
+  }
+
+  size_t numVregs = graph.numVirtualRegisters();
+  if (!vregs.init(mir->alloc(), numVregs)) {
+    return false;
+  }
+  for (uint32_t i = 0; i < numVregs; i++) {
+    new (&vregs[i]) VirtualRegister();
+  }
+
+  if (!releaseLists.init(mir->alloc(), graph.numInstructions())) {
+    return false;
+  }
+  for (uint32_t i = 0; i < graph.numInstructions(); i++) {
+    releaseLists[i] = 0;
+  }
+
+  for (size_t i = 0; i < graph.numBlocks(); i++) {
+    if (mir->shouldCancel("Simple Create data structures (main loop)")) {
+      return false;
+    }
+
+    LBlock* block = graph.getBlock(i);
+    for (LInstructionIterator ins = block->begin(); ins != block->end();
+         ins++) {
+      for (size_t j = 0; j < ins->numDefs(); j++) {
+        LDefinition* def = ins->getDef(j);
+        if (def->isBogusTemp()) {
+          continue;
+        }
+        VirtualRegister& reg = vreg(def);
+        reg.ins = *ins;
+        reg.def = def;
+      }
+
+      for (size_t j = 0; j < ins->numTemps(); j++) {
+        LDefinition* def = ins->getTemp(j);
+        if (def->isBogusTemp()) {
+          continue;
+        }
+        VirtualRegister& reg = vreg(def);
+        reg.ins = *ins;
+        reg.def = def;
+        reg.isTemp = true;
+      }
+    }
+    for (size_t j = 0; j < block->numPhis(); j++) {
+      LPhi* phi = block->getPhi(j);
+      VirtualRegister& reg = vreg(phi->getDef(0));
+      reg.ins = phi;
+      reg.def = phi->getDef(0);
+    }
+  }
+
+  LiveRegisterSet remainingRegisters(allRegisters_.asLiveSet());
+  while (!remainingRegisters.emptyGeneral()) {
+    AnyRegister reg = AnyRegister(remainingRegisters.takeAnyGeneral());
+    registers[reg.code()].allocatable = true;
+    if (!generalRegisters.append(reg)) {
+      return false;
+    }
+  }
+  while (!remainingRegisters.emptyFloat()) {
+    AnyRegister reg =
+        AnyRegister(remainingRegisters.takeAnyFloat<RegTypeName::Any>());
+    registers[reg.code()].allocatable = true;
+    if (!floatRegisters.append(reg)) {
+      return false;
+    }
+  }
+
+  return safepointEntries.appendN(SafepointEntries(), graph.numSafepoints());
+}
+
+/*
+ * This function computes the liveIn set of every block, in the same way as
+ * BacktrackingAllocator::buildLivenessInfo, and from it a conservative end
+ * position for every virtual register: no position after |end| has the
+ * register live, and every block where it is live lies between its definition
+ * and |end|. Registers live at a loop header stay live until the end of the
+ * last block in the loop.
+ */
+bool SimpleAllocator::buildLivenessInfo() {
+  JitSpew(JitSpew_RegAlloc, "Beginning liveness analysis");
+
+  Vector<MBasicBlock*, 1, SystemAllocPolicy> loopWorkList;
+  BitSet loopDone(graph.numBlockIds());
+  if (!loopDone.init(alloc())) {
+    return false;
+  }
+
+  for (size_t i = graph.numBlocks(); i > 0; i--) {
+    if (mir->shouldCancel("Simple Build Liveness Info (main loop)")) {
+      return false;
+    }
+
+    LBlock* block = graph.getBlock(i - 1);
+    MBasicBlock* mblock = block->mir();
+
+    BitSet& live = liveIn[mblock->id()];
+    new (&live) BitSet(graph.numVirtualRegisters());
+    if (!live.init(alloc())) {
+      return false;
+    }
+
+    // Propagate liveIn from our successors to us, skipping backedges which
+    // are fixed up at the loop header.
+    for (size_t i = 0; i < mblock->lastIns()->numSuccessors(); i++) {
+      MBasicBlock* successor = mblock->lastIns()->getSuccessor(i);
+      if (mblock->id() < successor->id()) {
+        live.insertAll(liveIn[successor->id()]);
+      }
+    }
+
+    // Phi inputs are read, and phi outputs written, at the end of the
+    // predecessor.
+    if (mblock->successorWithPhis()) {
+      LBlock* phiSuccessor = mblock->successorWithPhis()->lir();
+      for (unsigned int j = 0; j < phiSuccessor->numPhis(); j++) {
+        LPhi* phi = phiSuccessor->getPhi(j);
+        LAllocation* use = phi->getOperand(mblock->positionInPhiSuccessor());
+        live.insert(use->toUse()->virtualRegister());
+        extend(phi->getDef(0)->virtualRegister(), exitOf(block));
+      }
+    }
+
+    for (BitSet::Iterator liveRegId(live); liveRegId; ++liveRegId) {
+      extend(*liveRegId, exitOf(block));
+    }
+
+    for (LInstructionReverseIterator ins = block->rbegin();
+         ins != block->rend(); ins++) {
+      for (size_t j = 0; j < ins->numDefs(); j++) {
+        LDefinition* def = ins->getDef(j);
+        if (def->isBogusTemp()) {
+          continue;
+        }
+        live.remove(def->virtualRegister());
+        extend(def->virtualRegister(), outputOf(*ins));
+      }
+
+      for (size_t j = 0; j < ins->numTemps(); j++) {
+        LDefinition* temp = ins->getTemp(j);
+        if (temp->isBogusTemp()) {
+          continue;
+        }
+        extend(temp->virtualRegister(), outputOf(*ins));
+      }
+
+      for (LInstruction::InputIterator inputAlloc(**ins); inputAlloc.more();
+           inputAlloc.next()) {
+        if (!inputAlloc->isUse()) {
+          continue;
+        }
+        LUse* use = inputAlloc->toUse();
+
+        // RECOVERED_INPUT entries are rewritten to the instruction's output.
+        if (use->policy() == LUse::RECOVERED_INPUT) {
+          continue;
+        }
+
+        // Snapshot entries must survive the instruction, so they can be read
+        // when bailing out of it.
+        CodePosition pos = use->usedAtStart() && !inputAlloc.isSnapshotInput()
+                               ? inputOf(*ins)
+                               : outputOf(*ins);
+        extend(use->virtualRegister(), pos);
+        live.insert(use->virtualRegister());
+      }
+    }
+
+    for (size_t j = 0; j < block->numPhis(); j++) {
+      LDefinition* def = block->getPhi(j)->getDef(0);
+      live.remove(def->virtualRegister());
+      extend(def->virtualRegister(), outputOf(block->getPhi(j)));
+    }
+
+    if (mblock->isLoopHeader()) {
+      // Registers live at the start of a loop are live in all its blocks.
+      // As in the backtracking allocator, the blocks of a loop need not be
+      // contiguous, so walk them from the backedge.
+      CodePosition loopEnd = exitOf(block);
+      MBasicBlock* loopBlock = mblock->backedge();
+      while (true) {
+        // Blocks must already have been visited to have a liveIn set.
+        MOZ_ASSERT(loopBlock->id() >= mblock->id());
+
+        if (loopEnd < exitOf(loopBlock->lir())) {
+          loopEnd = exitOf(loopBlock->lir());
+        }
+
+        liveIn[loopBlock->id()].insertAll(live);
+        loopDone.insert(loopBlock->id());
+
+        if (loopBlock != mblock) {
+          for (size_t i = 0; i < loopBlock->numPredecessors(); i++) {
+            MBasicBlock* pred = loopBlock->getPredecessor(i);
+            if (loopDone.contains(pred->id())) {
+              continue;
+            }
+            if (!loopWorkList.append(pred)) {
+              return false;
+            }
+          }
+        }
+
+        if (loopWorkList.empty()) {
+          break;
+        }
+
+        // Grab the next block off the work list, skipping any OSR block.
+        MBasicBlock* osrBlock = graph.mir().osrBlock();
+        while (!loopWorkList.empty()) {
+          loopBlock = loopWorkList.popCopy();
+          if (loopBlock != osrBlock) {
+            break;
+          }
+        }
+
+        if (loopBlock == osrBlock) {
+          MOZ_ASSERT(loopWorkList.empty());
+          break;
+        }
+      }
+
+      loopDone.clear();
+
+      for (BitSet::Iterator liveRegId(live); liveRegId; ++liveRegId) {
+        extend(*liveRegId, loopEnd);
+      }
+    }
+
+    MOZ_ASSERT_IF(!mblock->numPredecessors(), live.empty());
+  }
+
+  JitSpew(JitSpew_RegAlloc, "Completed liveness analysis");
+  return true;
+}
+
+// Record, for every safepoint, the GC-relevant virtual registers live at the
+// start of its instruction other than the instruction's own temps. These all
+// have valid homes when the instruction executes.
+bool SimpleAllocator::buildSafepointInfo() {
+  if (!graph.numSafepoints()) {
+    return true;
+  }
+
+  BitSet live(graph.numVirtualRegisters());
+  if (!live.init(alloc())) {
+    return false;
+  }
+
+  size_t index = graph.numSafepoints();
+  for (size_t i = graph.numBlocks(); i > 0; i--) {
+    if (mir->shouldCancel("Simple Build Safepoint Info (main loop)")) {
+      return false;
+    }
+
+    LBlock* block = graph.getBlock(i - 1);
+    MBasicBlock* mblock = block->mir();
+
+    live.clear();
+    for (size_t i = 0; i < mblock->lastIns()->numSuccessors(); i++) {
+      MBasicBlock* successor = mblock->lastIns()->getSuccessor(i);
+      live.insertAll(liveIn[successor->id()]);
+    }
+    if (mblock->successorWithPhis()) {
+      LBlock* phiSuccessor = mblock->successorWithPhis()->lir();
+      for (unsigned int j = 0; j < phiSuccessor->numPhis(); j++) {
+        LPhi* phi = phiSuccessor->getPhi(j);
+        LAllocation* use = phi->getOperand(mblock->positionInPhiSuccessor());
+        live.insert(use->toUse()->virtualRegister());
+      }
+    }
+
+    for (LInstructionReverseIterator ins = block->rbegin();
+         ins != block->rend(); ins++) {
+      for (size_t j = 0; j < ins->numDefs(); j++) {
+        LDefinition* def = ins->getDef(j);
+        if (!def->isBogusTemp()) {
+          live.remove(def->virtualRegister());
+        }
+      }
+
+      for (LInstruction::InputIterator inputAlloc(**ins); inputAlloc.more();
+           inputAlloc.next()) {
+        if (inputAlloc->isUse() &&
+            inputAlloc->toUse()->policy() != LUse::RECOVERED_INPUT) {
+          live.insert(inputAlloc->toUse()->virtualRegister());
+        }
+      }
+
+      if (!ins->safepoint()) {
+        continue;
+      }
+
+      MOZ_ASSERT(index > 0);
+      index--;
+      MOZ_ASSERT(graph.getSafepoint(index) == *ins);
+
+      SafepointEntries& entries = safepointEntries[index];
+      entries.start = safepointVregs.length();
+      for (BitSet::Iterator liveRegId(live); liveRegId; ++liveRegId) {
+        if (IsSafepointType(vregs[*liveRegId].type()) &&
+            !safepointVregs.append(*liveRegId)) {
+          return false;
+        }
+      }
+      entries.count = safepointVregs.length() - entries.start;
+    }
+  }
+
+  MOZ_ASSERT(index == 0);
+  return true;
+}
+
+void SimpleAllocator::ensureHome(uint32_t vreg) {
+  VirtualRegister& reg = vregs[vreg];
+  if (!reg.home.isBogus()) {
+    return;
+  }
+  MOZ_ASSERT(!reg.isStack());
+
+  Vector<uint32_t, 0, SystemAllocPolicy>& slots =
+      freeSlots[SlotWidthIndex(reg.type())];
+  uint32_t slot = slots.empty() ? stackSlotAllocator.allocateSlot(reg.type())
+                                : slots.popCopy();
+  reg.home = LStackSlot(slot);
+  reg.ownsHome = true;
+
+  uint32_t releaseAt = reg.end.ins();
+  MOZ_ASSERT(releaseAt >= releasedUpTo);
+  reg.nextRelease = releaseLists[releaseAt];
+  releaseLists[releaseAt] = vreg;
+}
+
+bool SimpleAllocator::releaseHomes(uint32_t upTo) {
+  for (; releasedUpTo < upTo; releasedUpTo++) {
+    uint32_t vreg = releaseLists[releasedUpTo];
+    while (vreg) {
+      VirtualRegister& reg = vregs[vreg];
+      MOZ_ASSERT(reg.ownsHome);
+      uint32_t slot = reg.home.toStackSlot()->slot();
+      if (!freeSlots[SlotWidthIndex(reg.type())].append(slot)) {
+        return false;
+      }
+      reg.home = LAllocation();
+      vreg = reg.nextRelease;
+    }
+  }
+  return true;
+}
+
+LAllocation SimpleAllocator::preLocation(uint32_t vreg) {
+  VirtualRegister& reg = vregs[vreg];
+  if (reg.preIns == currentId && reg.preReg != NoRegister) {
+    return LAllocation(AnyRegister::FromCode(reg.preReg));
+  }
+  MOZ_ASSERT(!reg.dirty);
+  MOZ_ASSERT(!reg.home.isBogus());
+  return reg.home;
+}
+
+bool SimpleAllocator::addMove(LAllocation from, LAllocation to,
+                              LDefinition::Type type) {
+  if (from == to) {
+    return true;
+  }
+
+  // Stack destinations are only written once per instruction, but a value
+  // may be copied to the same fixed register by several uses.
+  if (to.isRegister()) {
+    for (const PendingMove& move : moves) {
+      if (move.to == to) {
+        MOZ_ASSERT(move.from == from);
+        return true;
+      }
+    }
+  }
+
+  return moves.emplaceBack(from, to, type);
+}
+
+bool SimpleAllocator::syncRegister(uint32_t vreg) {
+  VirtualRegister& reg = vregs[vreg];
+  MOZ_ASSERT(reg.dirty);
+  MOZ_ASSERT(reg.preIns == currentId && reg.preReg != NoRegister);
+
+  ensureHome(vreg);
+  reg.dirty = false;
+  return addMove(LAllocation(AnyRegister::FromCode(reg.preReg)), reg.home,
+                 reg.type());
+}
+
+bool SimpleAllocator::evictRegister(AnyRegister reg) {
+  for (size_t i = 0; i < reg.numAliased(); i++) {
+    uint32_t vreg = registers[reg.aliased(i).code()].vreg;
+    if (vreg && vregs[vreg].dirty && !syncRegister(vreg)) {
+      return false;
+    }
+  }
+  dropRegister(reg);
+  return true;
+}
+
+void SimpleAllocator::dropRegister(AnyRegister reg) {
+  for (size_t i = 0; i < reg.numAliased(); i++) {
+    PhysicalRegister& physical = registers[reg.aliased(i).code()];
+    if (physical.vreg) {
+      vregs[physical.vreg].reg = NoRegister;
+      physical.vreg = 0;
+    }
+  }
+}
+
+void SimpleAllocator::cacheRegister(AnyRegister reg, uint32_t vreg,
+                                    bool dirty) {
+#ifdef DEBUG
+  for (size_t i = 0; i < reg.numAliased(); i++) {
+    MOZ_ASSERT(!registers[reg.aliased(i).code()].vreg);
+  }
+#endif
+  MOZ_ASSERT(vregs[vreg].reg == NoRegister);
+
+  registers[reg.code()].vreg = vreg;
+  registers[reg.code()].lastUse = currentId;
+  vregs[vreg].reg = reg.code();
+  vregs[vreg].dirty = dirty;
+}
+
+void SimpleAllocator::markRegister(AnyRegister reg, uint8_t flags) {
+  for (size_t i = 0; i < reg.numAliased(); i++) {
+    registers[reg.aliased(i).code()].flags |= flags;
+  }
+  registers[reg.code()].lastUse = currentId;
+}
+
+// Pick a register for a value of the given type which has none of the |avoid|
+// flags, preferring registers whose contents can be discarded, then clean
+// ones, then the least recently used. Values whose registers end before
+// |deadBefore| are considered discardable.
+bool SimpleAllocator::pickRegister(LDefinition::Type type, uint8_t avoid,
+                                   CodePosition deadBefore,
+                                   AnyRegister* result) {
+  bool isFloat = IsFloatType(type);
+  const auto& candidates = isFloat ? floatRegisters : generalRegisters;
+
+  uint32_t bestCost = UINT32_MAX;
+  uint32_t bestLastUse = UINT32_MAX;
+  for (AnyRegister reg : candidates) {
+    if (isFloat && !LDefinition::isFloatRegCompatible(type, reg.fpu())) {
+      continue;
+    }
+    if (registers[reg.code()].flags & avoid) {
+      continue;
+    }
+
+    uint32_t cost = 0;
+    uint32_t lastUse = 0;
+    for (size_t i = 0; i < reg.numAliased(); i++) {
+      const PhysicalRegister& physical = registers[reg.aliased(i).code()];
+      lastUse = std::max(lastUse, physical.lastUse);
+      if (!physical.vreg || vregs[physical.vreg].end < deadBefore) {
+        continue;
+      }
+      cost = std::max(cost, vregs[physical.vreg].dirty ? 2u : 1u);
+    }
+
+    if (cost < bestCost || (cost == bestCost && lastUse < bestLastUse)) {
+      *result = reg;
+      bestCost = cost;
+      bestLastUse = lastUse;
+    }
+  }
+
+  return bestCost != UINT32_MAX;
+}
+
+void SimpleAllocator::allocateStackDefinition(LInstruction* ins,
+                                              LDefinition* def) {
+  if (def->type() == LDefinition::STACKRESULTS) {
+    LStackArea alloc(ins);
+    stackSlotAllocator.allocateStackArea(&alloc);
+    def->setOutput(alloc);
+  } else {
+    // Because the definitions are visited in order, the area has been
+    // allocated before we reach this result, so we know the operand is an
+    // LStackArea.
+    const LUse* use = ins->getOperand(0)->toUse();
+    VirtualRegister& area = vregs[use->virtualRegister()];
+    const LStackArea* areaAlloc = area.def->output()->toStackArea();
+    def->setOutput(areaAlloc->resultAlloc(ins, def));
+  }
+}
+
+bool SimpleAllocator::allocateReusedDefinition(LInstruction* ins,
+                                               LDefinition* def,
+                                               uint8_t flag) {
+  size_t index = def->getReusedInput();
+  LAllocation* input = ins->getOperand(index);
+
+  AnyRegister reg;
+  if (input->isRegister()) {
+    // The input has a fixed register.
+    reg = input->toRegister();
+  } else {
+    uint32_t vreg = input->toUse()->virtualRegister();
+    VirtualRegister& inputReg = vregs[vreg];
+    if (inputReg.reg != NoRegister && !registers[inputReg.reg].flags) {
+      reg = AnyRegister::FromCode(inputReg.reg);
+    } else {
+      if (!pickRegister(def->type(), UseInput | UseThrough | UseTemp | UseDef,
+                        inputOf(ins), &reg)) {
+        return false;
+      }
+      if (!evictRegister(reg) ||
+          !addMove(preLocation(vreg), LAllocation(reg), inputReg.type())) {
+        return false;
+      }
+    }
+    ins->setOperand(index, LAllocation(reg));
+  }
+
+  // The instruction overwrites the input, so it can't stay cached here. Any
+  // other uses of the input by this instruction read its old location.
+  if (uint32_t vreg = registers[reg.code()].vreg) {
+    if (vregs[vreg].dirty && vregs[vreg].end >= outputOf(ins) &&
+        !syncRegister(vreg)) {
+      return false;
+    }
+    dropRegister(reg);
+  }
+
+  markRegister(reg, UseInput | UseThrough | flag);
+  def->setOutput(LAllocation(reg));
+  return true;
+}
+
+bool SimpleAllocator::addSafepointAllocation(LSafepoint* safepoint,
+                                             uint32_t vreg, LAllocation alloc) {
+  switch (vregs[vreg].type()) {
+    case LDefinition::OBJECT:
+      return safepoint->addGcPointer(alloc);
+    case LDefinition::SLOTS:
+      return safepoint->addSlotsOrElementsPointer(alloc);
+    case LDefinition::STACKRESULTS: {
+      MOZ_ASSERT(alloc.isStackArea());
+      for (auto iter = alloc.toStackArea()->results(); iter; iter.next()) {
+        if (iter.isGcPointer()) {
+          if (!safepoint->addGcPointer(iter.alloc())) {
+            return false;
+          }
+        }
+      }
+      return true;
+    }
+#ifdef JS_NUNBOX32
+    case LDefinition::TYPE:
+      return safepoint->addNunboxType(vreg, alloc);
+    case LDefinition::PAYLOAD:
+      return safepoint->addNunboxPayload(vreg, alloc);
+#else
+    case LDefinition::BOX:
+      return safepoint->addBoxedValue(alloc);
+#endif
+    default:
+      return true;
+  }
+}
+
+bool SimpleAllocator::populateSafepoint(LInstruction* ins) {
+  LSafepoint* safepoint = ins->safepoint();
+  MOZ_ASSERT(graph.getSafepoint(nextSafepoint) == ins);
+  const SafepointEntries& entries = safepointEntries[nextSafepoint++];
+
+  // Nothing is kept in a register across a safepoint, so the only live
+  // registers are those used by the instruction itself. Calls clobber all of
+  // them.
+  if (!ins->isCall()) {
+    size_t index = 0;
+    for (LInstruction::InputIterator alloc(*ins); alloc.more();
+         alloc.next(), index++) {
+      if (!alloc->isRegister()) {
+        continue;
+      }
+      safepoint->addLiveRegister(alloc->toRegister());
+      if (uint32_t vreg = inputVregs[index]) {
+        if (!addSafepointAllocation(safepoint, vreg, **alloc)) {
+          return false;
+        }
+      }
+    }
+
+    for (size_t i = 0; i < ins->numTemps(); i++) {
+      LDefinition* temp = ins->getTemp(i);
+      if (temp->isBogusTemp()) {
+        continue;
+      }
+      safepoint->addLiveRegister(temp->output()->toRegister());
+#ifdef CHECK_OSIPOINT_REGISTERS
+      safepoint->addClobberedRegister(temp->output()->toRegister());
+#endif
+      if (!addSafepointAllocation(safepoint, temp->virtualRegister(),
+                                  *temp->output())) {
+        return false;
+      }
+    }
+
+#ifdef CHECK_OSIPOINT_REGISTERS
+    for (size_t i = 0; i < ins->numDefs(); i++) {
+      LDefinition* def = ins->getDef(i);
+      if (!def->isBogusTemp() && def->output()->isRegister()) {
+        safepoint->addClobberedRegister(def->output()->toRegister());
+      }
+    }
+#endif
+  }
+
+  for (size_t i = 0; i < entries.count; i++) {
+    uint32_t vreg = safepointVregs[entries.start + i];
+    VirtualRegister& reg = vregs[vreg];
+    MOZ_ASSERT(!reg.dirty);
+    MOZ_ASSERT(!reg.home.isBogus());
+    if (!addSafepointAllocation(safepoint, vreg, reg.home)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+void SimpleAllocator::allocateOsiPoint(LInstruction* ins) {
+  // No moves may be placed between an instruction and its OSI point, so the
+  // snapshot describes wherever the values are after the instruction.
+  for (LInstruction::InputIterator alloc(*ins); alloc.more(); alloc.next()) {
+    if (!alloc->isUse()) {
+      continue;
+    }
+    VirtualRegister& reg = vreg(alloc->toUse());
+    if (reg.reg != NoRegister) {
+      alloc.replace(LAllocation(AnyRegister::FromCode(reg.reg)));
+    } else {
+      MOZ_ASSERT(!reg.dirty);
+      alloc.replace(reg.home);
+    }
+  }
+}
+
+bool SimpleAllocator::allocatePhiMoves(LBlock* block) {
+  MBasicBlock* mblock = block->mir();
+  CodePosition exit = exitOf(block);
+
+  // Write back everything which is still needed after this block.
+  for (size_t i = 0; i < AnyRegister::Total; i++) {
+    uint32_t vreg = registers[i].vreg;
+    if (vreg && vregs[vreg].dirty && vregs[vreg].end > exit &&
+        !syncRegister(vreg)) {
+      return false;
+    }
+  }
+
+  if (!mblock->successorWithPhis()) {
+    return true;
+  }
+
+  LBlock* successor = mblock->successorWithPhis()->lir();
+  uint32_t position = mblock->positionInPhiSuccessor();
+  for (size_t i = 0; i < successor->numPhis(); i++) {
+    LPhi* phi = successor->getPhi(i);
+    uint32_t vreg = phi->getDef(0)->virtualRegister();
+    uint32_t input = phi->getOperand(position)->toUse()->virtualRegister();
+
+    ensureHome(vreg);
+    if (!addMove(preLocation(input), vregs[vreg].home, vregs[vreg].type())) {
+      return false;
+    }
+    phi->setOperand(position, vregs[vreg].home);
+  }
+
+  return true;
+}
+
+bool SimpleAllocator::allocateInstruction(LInstruction* ins,
+                                          bool lastInBlock) {
+  currentId = ins->id();
+  CodePosition inputPos = inputOf(ins);
+  CodePosition outputPos = outputOf(ins);
+
+  // Calls clobber the registers and safepoints don't describe cached values,
+  // so nothing stays in a register across either.
+  bool flush = ins->isCall() || ins->safepoint();
+
+  if (!releaseHomes(currentId)) {
+    return false;
+  }
+
+  for (size_t i = 0; i < AnyRegister::Total; i++) {
+    PhysicalRegister& physical = registers[i];
+    physical.flags = 0;
+    if (!physical.vreg) {
+      continue;
+    }
+    VirtualRegister& reg = vregs[physical.vreg];
+    if (reg.end < inputPos) {
+      reg.reg = NoRegister;
+      physical.vreg = 0;
+      continue;
+    }
+    reg.preReg = i;
+    reg.preIns = currentId;
+  }
+
+  if (flush) {
+    for (size_t i = 0; i < AnyRegister::Total; i++) {
+      uint32_t vreg = registers[i].vreg;
+      if (vreg && vregs[vreg].dirty && !syncRegister(vreg)) {
+        return false;
+      }
+    }
+  }
+
+  inputVregs.clear();
+  for (LInstruction::InputIterator alloc(*ins); alloc.more(); alloc.next()) {
+    uint32_t vreg = alloc->isUse() ? alloc->toUse()->virtualRegister() : 0;
+    if (!inputVregs.append(vreg)) {
+      return false;
+    }
+  }
+
+  // Stack results are found through the stack area operand, so allocate them
+  // before the operand is rewritten.
+  for (size_t i = 0; i < ins->numDefs(); i++) {
+    LDefinition* def = ins->getDef(i);
+    if (!def->isBogusTemp() && def->policy() == LDefinition::STACK) {
+      allocateStackDefinition(ins, def);
+    }
+  }
+
+  // Fixed uses first, so that nothing else takes their registers.
+  for (size_t i = 0; i < ins->numOperands(); i++) {
+    LAllocation* alloc = ins->getOperand(i);
+    if (!alloc->isUse() || alloc->toUse()->policy() != LUse::FIXED) {
+      continue;
+    }
+    LUse* use = alloc->toUse();
+    uint32_t vreg = use->virtualRegister();
+    VirtualRegister& reg = vregs[vreg];
+
+    AnyRegister fixed = GetFixedRegister(reg.def, use);
+    if (reg.reg != fixed.code()) {
+      if (!evictRegister(fixed) ||
+          !addMove(preLocation(vreg), LAllocation(fixed), reg.type())) {
+        return false;
+      }
+      if (reg.reg == NoRegister && registers[fixed.code()].allocatable) {
+        cacheRegister(fixed, vreg, reg.dirty);
+      }
+    }
+    markRegister(fixed, UseInput | (use->usedAtStart() ? 0 : UseThrough));
+    ins->setOperand(i, LAllocation(fixed));
+  }
+
+  for (size_t i = 0; i < ins->numTemps(); i++) {
+    LDefinition* temp = ins->getTemp(i);
+    if (!temp->isBogusTemp() && temp->policy() == LDefinition::FIXED) {
+      markRegister(temp->output()->toRegister(), UseTemp);
+    }
+  }
+  for (size_t i = 0; i < ins->numDefs(); i++) {
+    LDefinition* def = ins->getDef(i);
+    if (!def->isBogusTemp() && def->policy() == LDefinition::FIXED &&
+        def->output()->isRegister()) {
+      markRegister(def->output()->toRegister(), UseDef);
+    }
+  }
+
+  for (size_t i = 0; i < ins->numDefs(); i++) {
+    LDefinition* def = ins->getDef(i);
+    if (!def->isBogusTemp() &&
+        def->policy() == LDefinition::MUST_REUSE_INPUT &&
+        !allocateReusedDefinition(ins, def, UseDef)) {
+      return false;
+    }
+  }
+  for (size_t i = 0; i < ins->numTemps(); i++) {
+    LDefinition* temp = ins->getTemp(i);
+    if (!temp->isBogusTemp() &&
+        temp->policy() == LDefinition::MUST_REUSE_INPUT &&
+        !allocateReusedDefinition(ins, temp, UseTemp)) {
+      return false;
+    }
+  }
+
+  for (size_t i = 0; i < ins->numOperands(); i++) {
+    LAllocation* alloc = ins->getOperand(i);
+    if (!alloc->isUse() || alloc->toUse()->policy() != LUse::REGISTER) {
+      continue;
+    }
+    LUse* use = alloc->toUse();
+    uint32_t vreg = use->virtualRegister();
+    VirtualRegister& reg = vregs[vreg];
+
+    AnyRegister chosen;
+    if (reg.reg != NoRegister &&
+        !(registers[reg.reg].flags & (UseTemp | UseDef))) {
+      chosen = AnyRegister::FromCode(reg.reg);
+    } else {
+      if (!pickRegister(reg.type(), UseInput | UseThrough | UseTemp | UseDef,
+                        inputPos, &chosen)) {
+        return false;
+      }
+      if (!evictRegister(chosen) ||
+          !addMove(preLocation(vreg), LAllocation(chosen), reg.type())) {
+        return false;
+      }
+      bool dirty = reg.dirty;
+      if (reg.reg != NoRegister) {
+        dropRegister(AnyRegister::FromCode(reg.reg));
+      }
+      cacheRegister(chosen, vreg, dirty);
+    }
+    markRegister(chosen, UseInput | (use->usedAtStart() ? 0 : UseThrough));
+    ins->setOperand(i, LAllocation(chosen));
+  }
+
+  for (size_t i = 0; i < ins->numTemps(); i++) {
+    LDefinition* temp = ins->getTemp(i);
+    if (temp->isBogusTemp() || temp->policy() != LDefinition::REGISTER) {
+      continue;
+    }
+    AnyRegister chosen;
+    if (!pickRegister(temp->type(), UseInput | UseThrough | UseTemp | UseDef,
+                      outputPos, &chosen)) {
+      return false;
+    }
+    markRegister(chosen, UseTemp);
+    temp->setOutput(LAllocation(chosen));
+  }
+
+  for (size_t i = 0; i < ins->numDefs(); i++) {
+    LDefinition* def = ins->getDef(i);
+    if (def->isBogusTemp() || def->policy() != LDefinition::REGISTER) {
+      continue;
+    }
+    AnyRegister chosen;
+    if (!pickRegister(def->type(), UseThrough | UseTemp | UseDef, outputPos,
+                      &chosen)) {
+      return false;
+    }
+    markRegister(chosen, UseDef);
+    def->setOutput(LAllocation(chosen));
+  }
+
+  // Remaining operands and snapshot entries can read a register which the
+  // instruction does not clobber before they are read, or their home.
+  for (LInstruction::InputIterator alloc(*ins); alloc.more(); alloc.next()) {
+    if (!alloc->isUse()) {
+      continue;
+    }
+    LUse* use = alloc->toUse();
+    if (use->policy() == LUse::RECOVERED_INPUT) {
+      continue;
+    }
+    MOZ_ASSERT(use->policy() == LUse::ANY ||
+               use->policy() == LUse::KEEPALIVE ||
+               use->policy() == LUse::STACK);
+    uint32_t vreg = use->virtualRegister();
+    VirtualRegister& reg = vregs[vreg];
+
+    bool atStart = use->usedAtStart() && !alloc.isSnapshotInput();
+    if (use->policy() != LUse::STACK && reg.reg != NoRegister &&
+        (atStart || !ins->isCall())) {
+      uint8_t clobbers = UseTemp | (atStart ? 0 : UseDef);
+      if (!(registers[reg.reg].flags & clobbers)) {
+        AnyRegister cached = AnyRegister::FromCode(reg.reg);
+        markRegister(cached, UseInput | (atStart ? 0 : UseThrough));
+        alloc.replace(LAllocation(cached));
+        continue;
+      }
+    }
+
+    if (reg.dirty && !syncRegister(vreg)) {
+      return false;
+    }
+    MOZ_ASSERT(!reg.home.isBogus());
+    alloc.replace(reg.home);
+  }
+
+  if (ins->recoversInput()) {
+    LSnapshot* snapshot = ins->snapshot();
+    for (size_t i = 0; i < snapshot->numEntries(); i++) {
+      LAllocation* entry = snapshot->getEntry(i);
+      if (entry->isUse() &&
+          entry->toUse()->policy() == LUse::RECOVERED_INPUT) {
+        *entry = *ins->getDef(0)->output();
+      }
+    }
+  }
+
+  if (ins->safepoint() && !populateSafepoint(ins)) {
+    return false;
+  }
+
+  // Evict values from the registers the instruction writes.
+  for (size_t i = 0; i < AnyRegister::Total; i++) {
+    PhysicalRegister& physical = registers[i];
+    if (!physical.vreg ||
+        (!flush && !(physical.flags & (UseTemp | UseDef)))) {
+      continue;
+    }
+    VirtualRegister& reg = vregs[physical.vreg];
+    if (reg.dirty && reg.end >= outputPos && !syncRegister(physical.vreg)) {
+      return false;
+    }
+    reg.reg = NoRegister;
+    physical.vreg = 0;
+  }
+
+  for (size_t i = 0; i < ins->numDefs(); i++) {
+    LDefinition* def = ins->getDef(i);
+    if (def->isBogusTemp()) {
+      continue;
+    }
+    uint32_t vreg = def->virtualRegister();
+    if (def->output()->isRegister()) {
+      cacheRegister(def->output()->toRegister(), vreg, /* dirty = */ true);
+    } else {
+      vregs[vreg].home = *def->output();
+    }
+  }
+
+  if (lastInBlock) {
+    MOZ_ASSERT(!ins->numDefs());
+    if (!allocatePhiMoves(ins->block())) {
+      return false;
+    }
+  }
+
+  if (!moves.empty()) {
+    LMoveGroup* group = getInputMoveGroup(ins);
+    for (const PendingMove& move : moves) {
+      if (!group->add(move.from, move.to, move.type)) {
+        return false;
+      }
+    }
+    moves.clear();
+  }
+
+  return true;
+}
+
+bool SimpleAllocator::allocateBlock(LBlock* block) {
+  // Phis are never cached; every predecessor writes the phi's home.
+  for (size_t i = 0; i < block->numPhis(); i++) {
+    LDefinition* def = block->getPhi(i)->getDef(0);
+    ensureHome(def->virtualRegister());
+    def->setOutput(vreg(def).home);
+  }
+
+  LInstruction* last = *block->rbegin();
+  for (LInstructionIterator iter = block->begin(); iter != block->end();
+       iter++) {
+    if (!alloc().ensureBallast()) {
+      return false;
+    }
+
+    if (iter->isOsiPoint()) {
+      allocateOsiPoint(*iter);
+      continue;
+    }
+    if (!allocateInstruction(*iter, *iter == last)) {
+      return false;
+    }
+  }
+
+  // Nothing is cached across block boundaries.
+  for (size_t i = 0; i < AnyRegister::Total; i++) {
+    PhysicalRegister& physical = registers[i];
+    if (physical.vreg) {
+      vregs[physical.vreg].reg = NoRegister;
+      physical.vreg = 0;
+    }
+  }
+
+  return true;
+}
+
+bool SimpleAllocator::go() {
+  JitSpewCont(JitSpew_RegAlloc, "\n");
+  JitSpew(JitSpew_RegAlloc, "Beginning simple register allocation");
+
+  if (!init()) {
+    return false;
+  }
+
+  if (!buildLivenessInfo()) {
+    return false;
+  }
+
+  if (!buildSafepointInfo()) {
+    return false;
+  }
+
+  for (size_t i = 0; i < graph.numBlocks(); i++) {
+    if (mir->shouldCancel("Simple Register Allocation (main loop)")) {
+      return false;
+    }
+    if (!allocateBlock(graph.getBlock(i))) {
+      return false;
+    }
+  }
+  MOZ_ASSERT(nextSafepoint == graph.numSafepoints());
+
+  graph.setLocalSlotsSize(stackSlotAllocator.stackHeight());
+
+  JitSpew(JitSpew_RegAlloc, "Simple register allocation complete");
+  return true;
+}
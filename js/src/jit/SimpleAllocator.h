@@ -0,0 +1,209 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+ * vim: set ts=8 sts=2 et sw=2 tw=80:
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef jit_SimpleAllocator_h
+#define jit_SimpleAllocator_h
+
+#include "mozilla/Array.h"
+
+#include "jit/BitSet.h"
+#include "jit/FixedList.h"
+#include "jit/RegisterAllocator.h"
+#include "jit/StackSlotAllocator.h"
+
+// Simple register allocator for very large graphs, where the time spent in
+// the backtracking allocator would dominate compilation.
+//
+// Every virtual register which outlives the block it is used in gets a stack
+// slot (its "home"). Stack slots are handed out by a linear scan over a
+// conservative live interval for each virtual register, so that slots are
+// reused once their owner is dead. Within a block, physical registers act as
+// a write-back cache in front of those homes: uses are loaded on demand,
+// definitions stay in registers until they are evicted, and everything is
+// written back at block boundaries, calls and safepoints. No value is kept in
+// a register across a safepoint, so safepoints only need to describe the
+// registers used by the instruction itself.
+//
+// The allocator runs in time linear in the size of the graph, plus the cost
+// of the liveness analysis used to size live intervals and describe
+// safepoints. The generated code is noticeably worse than the backtracking
+// allocator's.
+
+namespace js {
+namespace jit {
+
+class SimpleAllocator : protected RegisterAllocator {
+  static const uint8_t NoRegister = AnyRegister::Invalid;
+
+  struct VirtualRegister {
+    LNode* ins = nullptr;
+    LDefinition* def = nullptr;
+
+    // Conservative last position at which this register may be live. Along
+    // with the definition this covers every position where it is live.
+    CodePosition end;
+
+    // Stack location of the register, or bogus if none has been assigned.
+    LAllocation home;
+
+    // Physical register caching this register's value, if any.
+    uint8_t reg = NoRegister;
+
+    // Physical register holding this register at the start of the
+    // instruction |preIns|, used as the source of moves added before it.
+    uint8_t preReg = NoRegister;
+    uint32_t preIns = 0;
+
+    // Next register whose home is released at the same instruction.
+    uint32_t nextRelease = 0;
+
+    bool isTemp = false;
+
+    // Whether the value in |home| is out of date with respect to |reg|.
+    bool dirty = false;
+
+    // Whether |home| is one of our spill slots, rather than an argument slot
+    // or a part of a stack results area.
+    bool ownsHome = false;
+
+    LDefinition::Type type() const { return def->type(); }
+    bool isStack() const {
+      return def->policy() == LDefinition::STACK ||
+             (def->policy() == LDefinition::FIXED &&
+              !def->output()->isRegister());
+    }
+  };
+
+  struct PhysicalRegister {
+    // Virtual register cached in this register, or zero.
+    uint32_t vreg = 0;
+
+    // Id of the last instruction which accessed this register.
+    uint32_t lastUse = 0;
+
+    // How the current instruction uses this register, see the Use* flags.
+    uint8_t flags = 0;
+
+    bool allocatable = false;
+  };
+
+  // Flags describing how the instruction being allocated uses a register.
+  // UseInput: holds an input. UseThrough: holds an input which must survive
+  // until the output. UseTemp, UseDef: written by a temp or definition.
+  static const uint8_t UseInput = 1 << 0;
+  static const uint8_t UseThrough = 1 << 1;
+  static const uint8_t UseTemp = 1 << 2;
+  static const uint8_t UseDef = 1 << 3;
+
+  struct PendingMove {
+    LAllocation from;
+    LAllocation to;
+    LDefinition::Type type;
+
+    PendingMove(LAllocation from, LAllocation to, LDefinition::Type type)
+        : from(from), to(to), type(type) {}
+  };
+
+  // Range of |safepointVregs| describing a safepoint.
+  struct SafepointEntries {
+    uint32_t start = 0;
+    uint32_t count = 0;
+  };
+
+  FixedList<VirtualRegister> vregs;
+  mozilla::Array<PhysicalRegister, AnyRegister::Total> registers;
+
+  // Allocatable physical registers, in allocation order.
+  Vector<AnyRegister, 16, SystemAllocPolicy> generalRegisters;
+  Vector<AnyRegister, 32, SystemAllocPolicy> floatRegisters;
+
+  // Virtual registers live at the start of each block.
+  BitSet* liveIn;
+
+  // GC-relevant virtual registers live at each safepoint, in the order of
+  // graph.getSafepoint().
+  Vector<uint32_t, 0, SystemAllocPolicy> safepointVregs;
+  Vector<SafepointEntries, 0, SystemAllocPolicy> safepointEntries;
+  size_t nextSafepoint;
+
+  // Per instruction id, the head of the list of virtual registers whose home
+  // can be released once that instruction has executed.
+  FixedList<uint32_t> releaseLists;
+  uint32_t releasedUpTo;
+
+  // Free spill slots, indexed by log2 of their width in bytes minus two.
+  mozilla::Array<Vector<uint32_t, 0, SystemAllocPolicy>, 3> freeSlots;
+
+  // Moves to add before the instruction being allocated. These all happen in
+  // parallel, and read the locations values had before the instruction.
+  Vector<PendingMove, 16, SystemAllocPolicy> moves;
+
+  // Virtual register read by each input of the instruction being allocated,
+  // in InputIterator order, or zero for inputs which are not uses.
+  Vector<uint32_t, 16, SystemAllocPolicy> inputVregs;
+
+  StackSlotAllocator stackSlotAllocator;
+
+  // Id of the instruction being allocated.
+  uint32_t currentId;
+
+  VirtualRegister& vreg(const LDefinition* def) {
+    return vregs[def->virtualRegister()];
+  }
+  VirtualRegister& vreg(const LUse* use) {
+    return vregs[use->virtualRegister()];
+  }
+
+  void extend(uint32_t vreg, CodePosition pos) {
+    if (vregs[vreg].end < pos) {
+      vregs[vreg].end = pos;
+    }
+  }
+
+  [[nodiscard]] bool init();
+  [[nodiscard]] bool buildLivenessInfo();
+  [[nodiscard]] bool buildSafepointInfo();
+
+  [[nodiscard]] bool allocateBlock(LBlock* block);
+  [[nodiscard]] bool allocateInstruction(LInstruction* ins, bool lastInBlock);
+  [[nodiscard]] bool allocateReusedDefinition(LInstruction* ins,
+                                              LDefinition* def, uint8_t flag);
+  [[nodiscard]] bool allocatePhiMoves(LBlock* block);
+  void allocateOsiPoint(LInstruction* ins);
+  void allocateStackDefinition(LInstruction* ins, LDefinition* def);
+  [[nodiscard]] bool populateSafepoint(LInstruction* ins);
+  [[nodiscard]] bool addSafepointAllocation(LSafepoint* safepoint,
+                                            uint32_t vreg, LAllocation alloc);
+
+  void ensureHome(uint32_t vreg);
+  [[nodiscard]] bool releaseHomes(uint32_t upTo);
+  LAllocation preLocation(uint32_t vreg);
+  [[nodiscard]] bool addMove(LAllocation from, LAllocation to,
+                             LDefinition::Type type);
+  [[nodiscard]] bool syncRegister(uint32_t vreg);
+  [[nodiscard]] bool evictRegister(AnyRegister reg);
+  void dropRegister(AnyRegister reg);
+  void cacheRegister(AnyRegister reg, uint32_t vreg, bool dirty);
+  void markRegister(AnyRegister reg, uint8_t flags);
+  [[nodiscard]] bool pickRegister(LDefinition::Type type, uint8_t avoid,
+                                  CodePosition deadBefore,
+                                  AnyRegister* result);
+
+ public:
+  SimpleAllocator(MIRGenerator* mir, LIRGenerator* lir, LIRGraph& graph)
+      : RegisterAllocator(mir, lir, graph),
+        liveIn(nullptr),
+        nextSafepoint(0),
+        releasedUpTo(0),
+        currentId(0) {}
+
+  [[nodiscard]] bool go();
+};
+
+}  // namespace jit
+}  // namespace js
+
+#endif /* jit_SimpleAllocator_h */
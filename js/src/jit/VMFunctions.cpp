@@ -30,6 +30,7 @@
 #include "js/TraceKind.h"
 #include "vm/ArrayObject.h"
 #include "vm/Compartment.h"
+#include "vm/DateObject.h"
 #include "vm/Interpreter.h"
 #include "vm/JSAtom.h"
 #include "vm/PlainObject.h"  // js::PlainObject
@@ -883,15 +884,20 @@ void PostWriteElementBarrier(JSRuntime* rt, JSObject* obj, int32_t index) {
     return;
   }
 
-  if (nobj->getDenseInitializedLength() > MAX_WHOLE_CELL_BUFFER_SIZE
+  // Large objects are written to repeatedly, so remember their elements with
+  // the card table rather than a slots edge per write.
+  if (nobj->getDenseInitializedLength() > MAX_WHOLE_CELL_BUFFER_SIZE) {
+    rt->gc.storeBuffer().putElementCards(nobj, nobj->unshiftedIndex(index), 1);
+    return;
+  }
+
 #ifdef JS_GC_ZEAL
-      || rt->hasZealMode(gc::ZealMode::ElementsBarrier)
-#endif
-  ) {
+  if (rt->hasZealMode(gc::ZealMode::ElementsBarrier)) {
     rt->gc.storeBuffer().putSlot(nobj, HeapSlot::Element,
                                  nobj->unshiftedIndex(index), 1);
     return;
   }
+#endif
 
   rt->gc.storeBuffer().putWholeCell(obj);
 }
@@ -2785,6 +2791,27 @@ bool MapObjectGet(JSContext* cx, HandleObject obj, HandleValue key,
   return MapObject::get(cx, obj, key, rval);
 }
 
+JSObject* SetObjectAdd(JSContext* cx, HandleObject obj, HandleValue key) {
+  if (!SetObject::add(cx, obj, key)) {
+    return nullptr;
+  }
+  return obj;
+}
+
+JSObject* MapObjectSet(JSContext* cx, HandleObject obj, HandleValue key,
+                       HandleValue value) {
+  if (!MapObject::set(cx, obj, key, value)) {
+    return nullptr;
+  }
+  return obj;
+}
+
+void DateFillLocalTimeSlots(DateObject* dateObj) {
+  AutoUnsafeCallWithABI unsafe;
+
+  dateObj->fillLocalTimeSlots();
+}
+
 #ifdef DEBUG
 template <class OrderedHashTable>
 static mozilla::HashNumber HashValue(JSContext* cx, OrderedHashTable* hashTable,
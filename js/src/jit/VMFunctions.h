@@ -31,6 +31,7 @@ class GlobalObject;
 class InterpreterFrame;
 class LexicalScope;
 class ClassBodyScope;
+class DateObject;
 class MapObject;
 class NativeObject;
 class PlainObject;
@@ -673,9 +674,14 @@ JSAtom* AtomizeStringNoGC(JSContext* cx, JSString* str);
 
 bool SetObjectHas(JSContext* cx, HandleObject obj, HandleValue key, bool* rval);
 bool MapObjectHas(JSContext* cx, HandleObject obj, HandleValue key, bool* rval);
+JSObject* SetObjectAdd(JSContext* cx, HandleObject obj, HandleValue key);
+JSObject* MapObjectSet(JSContext* cx, HandleObject obj, HandleValue key,
+                       HandleValue value);
 bool MapObjectGet(JSContext* cx, HandleObject obj, HandleValue key,
                   MutableHandleValue rval);
 
+void DateFillLocalTimeSlots(DateObject* dateObj);
+
 void AssertSetObjectHash(JSContext* cx, SetObject* obj, const Value* value,
                          mozilla::HashNumber actualHash);
 void AssertMapObjectHash(JSContext* cx, MapObject* obj, const Value* value,
@@ -650,6 +650,23 @@ class MOZ_RAII WarpPoppedValueUseChecker {
 };
 #endif
 
+// Bump the LCov counter for |loc|, mirroring what Baseline does at the same
+// bytecode. Returns nullptr if coverage isn't being collected.
+MInstruction* WarpBuilder::addCodeCoverageCounter(BytecodeLocation loc) {
+  ScriptCounts* counts = scriptSnapshot()->coverageCounts();
+  if (!counts) {
+    return nullptr;
+  }
+  PCCounts* pcCounts =
+      counts->maybeGetPCCounts(script_->pcToOffset(loc.toRawBytecode()));
+  if (!pcCounts) {
+    return nullptr;
+  }
+  auto* ins = MIncrementCodeCoverageCounter::New(alloc(), &pcCounts->numExec());
+  current->add(ins);
+  return ins;
+}
+
 bool WarpBuilder::buildBody() {
   for (BytecodeLocation loc : AllBytecodesIterable(script_)) {
     if (mirGen().shouldCancel("WarpBuilder (opcode loop)")) {
@@ -693,6 +710,12 @@ bool WarpBuilder::buildBody() {
 
     JSOp op = loc.getOp();
 
+    // Like the Baseline prologue, count entry into the script if its main
+    // op isn't already counted as a jump target.
+    if (loc.toRawBytecode() == script_->main() && !loc.isJumpTarget()) {
+      addCodeCoverageCounter(loc);
+    }
+
 #define BUILD_OP(OP, ...)                       \
   case JSOp::OP:                                \
     if (MOZ_UNLIKELY(!this->build_##OP(loc))) { \
@@ -705,6 +728,17 @@ bool WarpBuilder::buildBody() {
 #ifdef DEBUG
     useChecker.checkAfterOp();
 #endif
+
+    // Count each reachable jump target, i.e. each basic block entry. Resume
+    // after the op so that a bailout later in the block doesn't make Baseline
+    // count it a second time.
+    if (loc.isJumpTarget() && !hasTerminatedBlock()) {
+      if (MInstruction* ins = addCodeCoverageCounter(loc)) {
+        if (!resumeAfter(ins, loc)) {
+          return false;
+        }
+      }
+    }
   }
 
   return true;
@@ -247,6 +247,7 @@ class MOZ_STACK_CLASS WarpBuilder : public WarpBuilderShared {
 
   [[nodiscard]] bool buildPrologue();
   [[nodiscard]] bool buildBody();
+  MInstruction* addCodeCoverageCounter(BytecodeLocation loc);
 
   [[nodiscard]] bool buildInlinePrologue();
 
@@ -28,6 +28,7 @@
 #include "js/ScalarType.h"  // js::Scalar::Type
 #include "vm/ArgumentsObject.h"
 #include "vm/BytecodeLocation.h"
+#include "vm/DateObject.h"
 #include "wasm/WasmCode.h"
 
 #include "gc/ObjectKind-inl.h"
@@ -391,6 +392,8 @@ const JSClass* WarpCacheIRTranspiler::classForGuardClassKind(
       return &SetObject::class_;
     case GuardClassKind::Map:
       return &MapObject::class_;
+    case GuardClassKind::Date:
+      return &DateObject::class_;
     case GuardClassKind::JSFunction:
       break;
   }
@@ -4397,6 +4400,43 @@ bool WarpCacheIRTranspiler::emitMapGetResult(ObjOperandId mapId,
   return true;
 }
 
+bool WarpCacheIRTranspiler::emitMapSetResult(ObjOperandId mapId,
+                                             ValOperandId keyId,
+                                             ValOperandId valId) {
+  MDefinition* map = getOperand(mapId);
+  MDefinition* key = getOperand(keyId);
+  MDefinition* val = getOperand(valId);
+
+  auto* ins = MMapObjectSet::New(alloc(), map, key, val);
+  addEffectful(ins);
+
+  pushResult(ins);
+  return resumeAfter(ins);
+}
+
+bool WarpCacheIRTranspiler::emitSetAddResult(ObjOperandId setId,
+                                             ValOperandId keyId) {
+  MDefinition* set = getOperand(setId);
+  MDefinition* key = getOperand(keyId);
+
+  auto* ins = MSetObjectAdd::New(alloc(), set, key);
+  addEffectful(ins);
+
+  pushResult(ins);
+  return resumeAfter(ins);
+}
+
+bool WarpCacheIRTranspiler::emitLoadDateLocalComponentResult(
+    ObjOperandId dateId, uint32_t slot) {
+  MDefinition* date = getOperand(dateId);
+
+  auto* ins = MDateLocalComponent::New(alloc(), date, slot);
+  add(ins);
+
+  pushResult(ins);
+  return true;
+}
+
 bool WarpCacheIRTranspiler::emitTruthyResult(OperandId inputId) {
   MDefinition* input = getOperand(inputId);
 
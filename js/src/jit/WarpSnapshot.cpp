@@ -12,6 +12,7 @@
 
 #include "jit/CacheIRCompiler.h"
 #include "jit/CacheIRSpewer.h"
+#include "vm/CodeCoverage.h"
 #include "vm/EnvironmentObject.h"
 #include "vm/GetterSetter.h"
 #include "vm/GlobalObject.h"
@@ -46,7 +47,12 @@ WarpScriptSnapshot::WarpScriptSnapshot(JSScript* script,
       environment_(env),
       opSnapshots_(std::move(opSnapshots)),
       moduleObject_(moduleObject),
-      isArrowFunction_(script->isFunction() && script->function()->isArrow()) {}
+      isArrowFunction_(script->isFunction() && script->function()->isArrow()),
+      // Only LCov counters are kept for the script's lifetime; counters owned
+      // by the Debugger can be cleared while Ion code is live.
+      coverageCounts_(coverage::IsLCovEnabled() && script->hasScriptCounts()
+                          ? &script->getScriptCounts()
+                          : nullptr) {}
 
 #ifdef JS_JITSPEW
 void WarpSnapshot::dump() const {
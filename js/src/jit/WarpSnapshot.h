@@ -26,6 +26,7 @@ class GlobalLexicalEnvironmentObject;
 class LexicalEnvironmentObject;
 class ModuleEnvironmentObject;
 class NamedLambdaObject;
+class ScriptCounts;
 
 namespace jit {
 
@@ -513,6 +514,11 @@ class WarpScriptSnapshot
   // Whether this script is for an arrow function.
   bool isArrowFunction_;
 
+  // If LCov code coverage is enabled, the script's counters. WarpBuilder
+  // bumps the same per-jump-target counters the Baseline JIT does, so that
+  // coverage stays accurate when the script runs in Ion.
+  ScriptCounts* coverageCounts_;
+
  public:
   WarpScriptSnapshot(JSScript* script, const WarpEnvironment& env,
                      WarpOpSnapshotList&& opSnapshots,
@@ -525,6 +531,8 @@ class WarpScriptSnapshot
 
   bool isArrowFunction() const { return isArrowFunction_; }
 
+  ScriptCounts* coverageCounts() const { return coverageCounts_; }
+
   void trace(JSTracer* trc);
 
 #ifdef JS_JITSPEW
@@ -766,3 +766,41 @@ inline bool RadixOutOfRange(uint8_t radix) {
   return true;
 }
 END_TEST(testBigIntToString_RadixOutOfRange)
+
+BEGIN_TEST(testBigIntMul_Karatsuba) {
+  JS::Rooted<JS::Value> v(cx);
+
+  // (2**n - 1)**2 == 2**(2n) - 2**(n+1) + 1, for operands around and well
+  // above the Karatsuba threshold.
+  EVAL(
+      "[2000, 2200, 5000, 12345].every(n => {\n"
+      "  let a = (1n << BigInt(n)) - 1n;\n"
+      "  return a * a === (1n << BigInt(2 * n)) - (1n << BigInt(n + 1)) + 1n;\n"
+      "})",
+      &v);
+  CHECK(v.isTrue());
+
+  // Check products of balanced and unbalanced pseudo-random operands against
+  // division, which doesn't use multiplication.
+  EVAL(
+      "function make(len, seed) {\n"
+      "  let s = '';\n"
+      "  for (let i = 0; i < len; i++) {\n"
+      "    seed = (seed * 1103515245 + 12345) % 2147483648;\n"
+      "    s += (seed % 16).toString(16);\n"
+      "  }\n"
+      "  return BigInt('0x1' + s);\n"
+      "}\n"
+      "[[600, 600], [1000, 700], [4000, 600], [3000, 2999]].every(([m, n]) => {\n"
+      "  let x = make(m, m);\n"
+      "  let y = make(n, n + 1);\n"
+      "  let p = x * y;\n"
+      "  return p / y === x && p % y === 0n && p / x === y &&\n"
+      "         (-x) * y === -p && y * x === p;\n"
+      "})",
+      &v);
+  CHECK(v.isTrue());
+
+  return true;
+}
+END_TEST(testBigIntMul_Karatsuba)
@@ -0,0 +1,41 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+ * vim: set ts=8 sts=2 et sw=2 tw=80:
+ */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "jsapi-tests/tests.h"
+
+// The local date components must match the UTC components of the time shifted
+// by the time zone offset, for times spread over the whole time value range
+// and looked up in an order which doesn't favor the time zone offset caches.
+BEGIN_TEST(testDateComponents) {
+  JS::RootedValue result(cx);
+  EVAL(
+      "(function() {\n"
+      "  const msPerDay = 24 * 60 * 60 * 1000;\n"
+      "  const times = [-8.64e15 + msPerDay, 8.64e15 - msPerDay, 0, -1,\n"
+      "                 msPerDay - 1, -msPerDay,\n"
+      "                 951782400000, 951868800000, -62198755200000];\n"
+      "  for (let i = 0; i < 2000; i++) {\n"
+      "    times.push(((i * 7919) % 2000 - 1000) * 3.3e11 + i);\n"
+      "  }\n"
+      "  for (const t of times) {\n"
+      "    const d = new Date(t);\n"
+      "    const shifted = new Date(t - d.getTimezoneOffset() * 60000);\n"
+      "    if (d.getFullYear() !== shifted.getUTCFullYear() ||\n"
+      "        d.getMonth() !== shifted.getUTCMonth() ||\n"
+      "        d.getDate() !== shifted.getUTCDate() ||\n"
+      "        d.getDay() !== shifted.getUTCDay() ||\n"
+      "        d.getHours() !== shifted.getUTCHours()) {\n"
+      "      return t;\n"
+      "    }\n"
+      "  }\n"
+      "  return true;\n"
+      "})()",
+      &result);
+  CHECK(result.isTrue());
+  return true;
+}
+END_TEST(testDateComponents)
@@ -0,0 +1,124 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+ * vim: set ts=8 sts=2 et sw=2 tw=80:
+ */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "gc/GCRuntime.h"
+#include "gc/StoreBuffer.h"
+#include "js/Array.h"               // JS::NewArrayObject
+#include "js/PropertyAndElement.h"  // JS_DefineElement
+#include "jsapi-tests/tests.h"
+#include "vm/NativeObject.h"
+#include "vm/PlainObject.h"
+#include "vm/Runtime.h"
+
+#include "vm/JSContext-inl.h"
+
+using namespace js;
+
+// Check that nursery pointers stored in the elements of a large tenured array
+// are updated by minor GC when they are only remembered by the card table.
+BEGIN_TEST(testGCElementCards) {
+  static const uint32_t Length = 16 * 1024;
+
+  JS::RootedObject array(cx, JS::NewArrayObject(cx, 0));
+  CHECK(array);
+  for (uint32_t i = 0; i < Length; i++) {
+    CHECK(JS_DefineElement(cx, array, i, i, JSPROP_ENUMERATE));
+  }
+
+  JS_GC(cx);
+  CHECK(!js::gc::IsInsideNursery(array));
+
+  NativeObject* nobj = &array->as<NativeObject>();
+  CHECK(nobj->getDenseInitializedLength() == Length);
+
+  // The first and last elements of a few cards, including two adjacent ones.
+  static const uint32_t Indexes[] = {0, 127, 128, 255, 1000, Length - 1};
+
+  {
+    JS::AutoSuppressGCAnalysis noAnalysis(cx);
+
+    gc::StoreBuffer& sb = cx->runtime()->gc.storeBuffer();
+    for (uint32_t index : Indexes) {
+      JSObject* obj = JS_NewPlainObject(cx);
+      CHECK(obj);
+      CHECK(js::gc::IsInsideNursery(obj));
+
+      // Skip the usual post barrier, which would add a slots edge.
+      nobj->getDenseElements().begin()[index].unbarrieredSet(
+          JS::ObjectValue(*obj));
+      sb.putElementCards(nobj, nobj->unshiftedIndex(index), 1);
+    }
+
+    cx->minorGC(JS::GCReason::API);
+  }
+
+  for (uint32_t index : Indexes) {
+    JS::Value v = nobj->getDenseElement(index);
+    CHECK(v.isObject());
+    CHECK(!js::gc::IsInsideNursery(&v.toObject()));
+    CHECK(v.toObject().is<PlainObject>());
+  }
+
+  // Elements in clean cards are left alone.
+  CHECK(nobj->getDenseElement(500).isInt32(500));
+
+  return true;
+}
+END_TEST(testGCElementCards)
+
+// Check that a single card far into the table does not make the store buffer
+// request a minor GC. Only dirty cards count towards the limit, not the size of
+// the table needed to reach them.
+//
+// Rather than allocating an array of more than 16M elements, this dirties a
+// card past the end of a smaller one: tracing clamps the range to the
+// initialized elements, as it does for elements removed after the write.
+BEGIN_TEST(testGCElementCardsLargeIndex) {
+  static const uint32_t Length = 16 * 1024;
+  static const uint32_t FarIndex = 32 * 1024 * 1024;
+
+  JS::RootedObject array(cx, JS::NewArrayObject(cx, 0));
+  CHECK(array);
+  for (uint32_t i = 0; i < Length; i++) {
+    CHECK(JS_DefineElement(cx, array, i, i, JSPROP_ENUMERATE));
+  }
+
+  JS_GC(cx);
+  CHECK(!js::gc::IsInsideNursery(array));
+
+  NativeObject* nobj = &array->as<NativeObject>();
+  static const uint32_t Index = Length - 1;
+
+  {
+    JS::AutoSuppressGCAnalysis noAnalysis(cx);
+
+    gc::StoreBuffer& sb = cx->runtime()->gc.storeBuffer();
+    CHECK(!sb.isAboutToOverflow());
+
+    sb.putElementCards(nobj, FarIndex, 1);
+    CHECK(!sb.isAboutToOverflow());
+
+    JSObject* obj = JS_NewPlainObject(cx);
+    CHECK(obj);
+    CHECK(js::gc::IsInsideNursery(obj));
+
+    nobj->getDenseElements().begin()[Index].unbarrieredSet(
+        JS::ObjectValue(*obj));
+    sb.putElementCards(nobj, nobj->unshiftedIndex(Index), 1);
+    CHECK(!sb.isAboutToOverflow());
+
+    cx->minorGC(JS::GCReason::API);
+  }
+
+  JS::Value v = nobj->getDenseElement(Index);
+  CHECK(v.isObject());
+  CHECK(!js::gc::IsInsideNursery(&v.toObject()));
+  CHECK(v.toObject().is<PlainObject>());
+
+  return true;
+}
+END_TEST(testGCElementCardsLargeIndex)
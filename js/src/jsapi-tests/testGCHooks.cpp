@@ -277,3 +277,60 @@ BEGIN_TEST(testGCTree) {
   return true;
 }
 END_TEST(testGCTree)
+
+static js::Vector<JS::GCSliceRecord, 0, js::SystemAllocPolicy> gSliceRecords;
+
+static void AppendSliceRecords(JSContext* cx, const JS::GCSliceRecord* records,
+                               size_t length, void* data) {
+  MOZ_RELEASE_ASSERT(data == &gSliceRecords);
+  MOZ_RELEASE_ASSERT(gSliceRecords.append(records, length));
+}
+
+BEGIN_TEST(testGCSliceRecords) {
+  AutoLeaveZeal nozeal(cx);
+
+  auto byebye = mozilla::MakeScopeExit([=] {
+    JS::SetGCSliceRecordCallback(cx, nullptr, nullptr);
+    gSliceRecords.clearAndFree();
+  });
+
+  // Discard any records from earlier GCs.
+  JS::SetGCSliceRecordCallback(cx, AppendSliceRecords, &gSliceRecords);
+  JS::FlushGCSliceRecords(cx);
+  gSliceRecords.clear();
+
+  JS_GC(cx);
+  JS_GC(cx);
+  CHECK(gSliceRecords.empty());
+
+  JS::FlushGCSliceRecords(cx);
+  CHECK(gSliceRecords.length() == 2);
+  for (const JS::GCSliceRecord& record : gSliceRecords) {
+    CHECK(record.reason == JS::GCReason::API);
+    CHECK(record.isLastSlice);
+    CHECK(record.end >= record.start);
+    CHECK(record.collectedZoneCount <= record.zoneCount);
+    CHECK(record.helperThreadUtilization >= 0.0);
+    CHECK(record.helperThreadUtilization <= 1.0);
+  }
+  CHECK(gSliceRecords[1].majorGCNumber == gSliceRecords[0].majorGCNumber + 1);
+
+  // Without a callback the oldest records are overwritten.
+  JS::SetGCSliceRecordCallback(cx, nullptr, nullptr);
+  gSliceRecords.clear();
+  static const size_t GCCount = 70;
+  for (size_t i = 0; i < GCCount; i++) {
+    JS_GC(cx);
+  }
+
+  JS::SetGCSliceRecordCallback(cx, AppendSliceRecords, &gSliceRecords);
+  JS::FlushGCSliceRecords(cx);
+  CHECK(!gSliceRecords.empty());
+  CHECK(gSliceRecords.length() < GCCount);
+  for (size_t i = 1; i < gSliceRecords.length(); i++) {
+    CHECK(gSliceRecords[i].sliceNumber > gSliceRecords[i - 1].sliceNumber);
+  }
+
+  return true;
+}
+END_TEST(testGCSliceRecords)
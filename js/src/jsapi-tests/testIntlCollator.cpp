@@ -0,0 +1,55 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+ * vim: set ts=8 sts=2 et sw=2 tw=80:
+ */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "jsapi-tests/tests.h"
+
+// Strings which only contain printable ASCII characters are compared without
+// ICU for some locales. Debug builds additionally check the results against
+// ICU.
+BEGIN_TEST(testIntlCollator_ascii) {
+  JS::RootedValue haveIntl(cx);
+  EVAL("typeof Intl !== 'undefined'", &haveIntl);
+  if (!haveIntl.toBoolean()) {
+    return true;
+  }
+
+  JS::RootedValue result(cx);
+  EVAL(
+      "var chars = [];\n"
+      "for (var i = 0x20; i < 0x7f; i++) chars.push(String.fromCharCode(i));\n"
+      "chars.sort(new Intl.Collator('en').compare).join('');",
+      &result);
+
+  bool match;
+  CHECK(JS_StringEqualsLiteral(
+      cx, result.toString(),
+      " _-,;:!?.'\"()[]{}@*/\\&#%`^+<=>|~$0123456789"
+      "aAbBcCdDeEfFgGhHiIjJkKlLmMnNoOpPqQrRsStTuUvVwWxXyYzZ",
+      &match));
+  CHECK(match);
+
+  EVAL(
+      "var tests = [\n"
+      "  ['en', {}, 'ab', 'Ab', -1],\n"
+      "  ['en', {}, 'aB', 'Ab', -1],\n"
+      "  ['en', {}, 'Ab', 'abc', -1],\n"
+      "  ['en', {caseFirst: 'upper'}, 'ab', 'Ab', 1],\n"
+      "  ['en', {sensitivity: 'base'}, 'ab', 'AB', 0],\n"
+      "  ['de', {sensitivity: 'case'}, 'a-b', 'A-b', -1],\n"
+      "  ['en', {numeric: true}, 'a10', 'a9', 1],\n"
+      "  ['en', {ignorePunctuation: true}, 'a-b', 'ab', 0],\n"
+      "  ['da', {}, 'aa', 'z', 1],\n"
+      "  ['en', {}, 'a\\u00e9', 'ae', 1],\n"
+      "];\n"
+      "tests.every(([locale, options, x, y, expected]) =>\n"
+      "  Math.sign(new Intl.Collator(locale, options).compare(x, y)) ===\n"
+      "    expected);",
+      &result);
+  CHECK(result.isTrue());
+  return true;
+}
+END_TEST(testIntlCollator_ascii)
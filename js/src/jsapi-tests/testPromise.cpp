@@ -7,6 +7,9 @@
 
 #include "jsapi.h"
 
+#include "jsfriendapi.h"
+#include "js/Array.h"               // JS::GetArrayLength
+#include "js/PropertyAndElement.h"  // JS_GetElement
 #include "jsapi-tests/tests.h"
 
 using namespace JS;
@@ -168,3 +171,71 @@ BEGIN_TEST(testPromise_PromiseCatch) {
   return true;
 }
 END_TEST(testPromise_PromiseCatch)
+
+BEGIN_TEST(testPromise_ReactionJobOrdering) {
+  // Reaction jobs, including the ones resuming async functions, must still run
+  // in FIFO order when they are enqueued without a job function.
+  EXEC(
+      "var log = [];\n"
+      "async function f() {\n"
+      "  log.push('f0');\n"
+      "  await null;\n"
+      "  log.push('f1');\n"
+      "  await null;\n"
+      "  log.push('f2');\n"
+      "}\n"
+      "f();\n"
+      "Promise.resolve().then(() => log.push('t0'))\n"
+      "                 .then(() => log.push('t1'));\n"
+      "Promise.reject(1).catch(() => log.push('c0'));\n");
+  js::RunJobs(cx);
+
+  RootedValue result(cx);
+  EVAL("log.join()", &result);
+  CHECK(result.isString());
+
+  bool match;
+  CHECK(JS_StringEqualsLiteral(cx, result.toString(), "f0,f1,t0,c0,f2,t1",
+                               &match));
+  CHECK(match);
+
+  return true;
+}
+END_TEST(testPromise_ReactionJobOrdering)
+
+#ifdef DEBUG
+BEGIN_TEST(testPromise_QueuedJobsAreFunctions) {
+  // Reaction jobs queued as their reaction record are handed out as job
+  // functions, so that the internal record is never exposed.
+  EXEC(
+      "var log = [];\n"
+      "Promise.resolve(1).then(v => log.push('then' + v));\n"
+      "(async function () { await null; log.push('await'); })();\n");
+
+  RootedObject jobs(cx, js::GetJobsInInternalJobQueue(cx));
+  CHECK(jobs);
+
+  uint32_t length;
+  CHECK(JS::GetArrayLength(cx, jobs, &length));
+  CHECK(length == 2);
+
+  for (uint32_t i = 0; i < length; i++) {
+    RootedValue job(cx);
+    CHECK(JS_GetElement(cx, jobs, i, &job));
+    CHECK(job.isObject());
+    CHECK(JS_ObjectIsFunction(&job.toObject()));
+  }
+
+  js::RunJobs(cx);
+
+  RootedValue result(cx);
+  EVAL("log.join()", &result);
+  CHECK(result.isString());
+  bool match;
+  CHECK(JS_StringEqualsLiteral(cx, result.toString(), "then1,await", &match));
+  CHECK(match);
+
+  return true;
+}
+END_TEST(testPromise_QueuedJobsAreFunctions)
+#endif  // DEBUG
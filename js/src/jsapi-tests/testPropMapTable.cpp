@@ -0,0 +1,45 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+ * vim: set ts=8 sts=2 et sw=2 tw=80:
+ */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "js/GCAPI.h"  // JS::NonIncrementalGC
+#include "jsapi-tests/tests.h"
+
+// Exercise the PropMapTable of a large dictionary object: growing, removing
+// entries, shrinking and tracing the table.
+BEGIN_TEST(testPropMapTable_LargeDictionary) {
+  EXEC(
+      "var obj = {};"
+      "for (var i = 0; i < 5000; i++) obj['p' + i] = i;"
+      "for (var i = 0; i < 5000; i += 2) delete obj['p' + i];");
+
+  JS::NonIncrementalGC(cx, JS::GCOptions::Shrink, JS::GCReason::API);
+
+  JS::RootedValue v(cx);
+  EVAL(
+      "var ok = true;"
+      "for (var i = 0; i < 5000; i++) {"
+      "  if (obj['p' + i] !== (i % 2 ? i : undefined)) ok = false;"
+      "}"
+      "ok",
+      &v);
+  CHECK(v.isTrue());
+
+  EXEC(
+      "for (var i = 0; i < 5000; i++) delete obj['p' + i];"
+      "for (var i = 0; i < 100; i++) obj['q' + i] = i;");
+
+  EVAL(
+      "var sum = 0;"
+      "for (var i = 0; i < 100; i++) sum += obj['q' + i];"
+      "sum + Object.keys(obj).length",
+      &v);
+  CHECK(v.isInt32());
+  CHECK_EQUAL(v.toInt32(), 4950 + 100);
+
+  return true;
+}
+END_TEST(testPropMapTable_LargeDictionary)
@@ -5,6 +5,9 @@
 #include "js/RegExp.h"
 #include "js/RegExpFlags.h"
 #include "jsapi-tests/tests.h"
+#include "vm/RegExpCodeCache.h"
+
+#include "vm/Realm-inl.h"
 
 BEGIN_TEST(testObjectIsRegExp) {
   JS::RootedValue val(cx);
@@ -63,3 +66,36 @@ BEGIN_TEST(testGetRegExpSource) {
   return true;
 }
 END_TEST(testGetRegExpSource)
+
+BEGIN_TEST(testRegExpCodeCache) {
+  js::PurgeRegExpCodeCache();
+  size_t hits = js::RegExpCodeCacheHitCount();
+
+  JS::RootedValue val(cx);
+  EVAL("/(a+)(b*)c/.exec('xaabbc')[2]", &val);
+  CHECK(val.isString());
+  CHECK(JS_LinearStringEqualsLiteral(
+      JS_ASSERT_STRING_IS_LINEAR(val.toString()), "bb"));
+  CHECK_EQUAL(js::RegExpCodeCacheHitCount(), hits);
+
+  // Another zone reuses the bytecode compiled above.
+  JS::RootedObject otherGlobal(cx, createGlobal(nullptr));
+  CHECK(otherGlobal);
+  CHECK(otherGlobal->zone() != global->zone());
+  {
+    js::AutoRealm realm(cx, otherGlobal);
+    EVAL("/(a+)(b*)c/.exec('xaac')[1]", &val);
+    CHECK(val.isString());
+    CHECK(JS_LinearStringEqualsLiteral(
+        JS_ASSERT_STRING_IS_LINEAR(val.toString()), "aa"));
+    CHECK_EQUAL(js::RegExpCodeCacheHitCount(), hits + 1);
+
+    // Different flags or input characters need different bytecode.
+    EVAL("/(a+)(b*)c/i.exec('xAac')[1]", &val);
+    EVAL("/(a+)(b*)c/.exec('\\u03c0aac')[1]", &val);
+    CHECK_EQUAL(js::RegExpCodeCacheHitCount(), hits + 1);
+  }
+
+  return true;
+}
+END_TEST(testRegExpCodeCache)
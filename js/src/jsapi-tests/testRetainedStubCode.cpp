@@ -0,0 +1,84 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+ * vim: set ts=8 sts=2 et sw=2 tw=80:
+ */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "jit/JitOptions.h"
+#include "jit/JitZone.h"
+#include "js/GlobalObject.h"  // JS_NewGlobalObject
+#include "jsapi-tests/tests.h"
+#include "vm/Realm.h"
+
+using namespace js;
+
+// Baseline stub code outlives the IC stubs using it for a few major GCs, so a
+// realm created in the same zone shortly after, e.g. on reload, can reuse it.
+BEGIN_TEST(testRetainedStubCode) {
+  if (!jit::IsBaselineInterpreterEnabled()) {
+    return true;
+  }
+
+  size_t count = runInNewRealm();
+  CHECK(count > 0);
+
+  // The realm which attached the stubs is dead, but the zone still has a live
+  // realm, so the code is kept.
+  JS_GC(cx);
+  CHECK_EQUAL(stubCodeCount(), count);
+
+  // Running the same code again reuses the retained stub code.
+  CHECK_EQUAL(runInNewRealm(), count);
+
+  // Stub code which isn't requested again expires.
+  for (uint64_t i = 0; i < jit::JitZone::StubCodeRetainMajorGCs + 2; i++) {
+    JS_GC(cx);
+  }
+  CHECK_EQUAL(stubCodeCount(), 0u);
+
+  // Memory pressure drops it straight away.
+  CHECK_EQUAL(runInNewRealm(), count);
+  JS::PrepareForFullGC(cx);
+  JS::NonIncrementalGC(cx, JS::GCOptions::Normal,
+                       JS::GCReason::MEM_PRESSURE);
+  CHECK_EQUAL(stubCodeCount(), 0u);
+
+  return true;
+}
+
+size_t stubCodeCount() {
+  jit::JitZone* jitZone = cx->zone()->jitZone();
+  return jitZone ? jitZone->baselineCacheIRStubCodeCountForTesting() : 0;
+}
+
+// Runs code which attaches Baseline IC stubs in a new realm in the test
+// global's zone, which is dead once this returns. Returns the number of stub
+// code entries in the zone afterwards.
+size_t runInNewRealm() {
+  JS::RealmOptions options;
+  options.creationOptions().setNewCompartmentInExistingZone(global);
+  JS::RootedObject newGlobal(
+      cx, JS_NewGlobalObject(cx, getGlobalClass(), nullptr,
+                             JS::FireOnNewGlobalHook, options));
+  if (!newGlobal) {
+    return 0;
+  }
+
+  {
+    JSAutoRealm ar(cx, newGlobal);
+    JS::RootedValue rval(cx);
+    if (!evaluate(
+            "function f(o) { return o.x + o.y; }\n"
+            "var s = 0;\n"
+            "for (var i = 0; i < 100; i++) { s += f({x: i, y: 1}); }\n"
+            "s;",
+            __FILE__, __LINE__, &rval) ||
+        !rval.isInt32() || rval.toInt32() != 5050) {
+      return 0;
+    }
+  }
+
+  return stubCodeCount();
+}
+END_TEST(testRetainedStubCode)
@@ -9,7 +9,9 @@
 
 #include "jsapi.h"
 
+#include "frontend/BytecodeCompilation.h"  // frontend::DelazifyCanonicalScriptedFunction
 #include "frontend/CompilationStencil.h"
+#include "frontend/ScopeBindingCache.h"  // frontend::StencilScopeBindingCache
 #include "js/CompilationAndEvaluation.h"
 #include "js/experimental/JSStencil.h"
 #include "js/Modules.h"
@@ -19,6 +21,8 @@
 #include "jsapi-tests/tests.h"
 #include "vm/HelperThreads.h"  // js::RunPendingSourceCompressions
 #include "vm/Monitor.h"        // js::Monitor, js::AutoLockMonitor
+#include "vm/Runtime.h"        // JSRuntime::caches
+#include "vm/StencilCache.h"   // js::StencilCache, js::StencilContext
 
 BEGIN_TEST(testStencil_Basic) {
   const char* chars =
@@ -868,3 +872,140 @@ static bool TestGetBuildId(JS::BuildIdCharVector* buildId) {
   return buildId->append(buildid, sizeof(buildid));
 }
 END_TEST(testStencil_OffThreadDecodePinned)
+
+BEGIN_TEST(testStencil_IncrementalEncodingCachedDelazifications) {
+  using namespace js::frontend;
+
+  JS::SetProcessBuildIdOp(TestGetBuildId);
+
+  const char* chars =
+      "function outer() {\n"
+      "  function inner() { return 42; }\n"
+      "  return inner;\n"
+      "}\n"
+      "outer()();\n";
+
+  JS::TranscodeBuffer buffer;
+
+  {
+    JS::SourceText<mozilla::Utf8Unit> srcBuf;
+    CHECK(srcBuf.init(cx, chars, strlen(chars), JS::SourceOwnership::Borrowed));
+
+    JS::CompileOptions options(cx);
+    RefPtr<JS::Stencil> stencil =
+        JS::CompileGlobalScriptToStencil(cx, options, srcBuf);
+    CHECK(stencil);
+
+    // The top-level script, then the lazy outer and inner functions.
+    CHECK(stencil->scriptData.size() == 3);
+    const ScriptIndex outerIndex(1);
+    const ScriptIndex innerIndex(2);
+    CHECK(!stencil->scriptData[outerIndex].hasSharedData());
+    CHECK(!stencil->scriptData[innerIndex].hasSharedData());
+    CHECK(stencil->scriptExtra[outerIndex].extent.sourceStart <
+          stencil->scriptExtra[innerIndex].extent.sourceStart);
+
+    // Delazify both functions the way the off-thread delazification task
+    // does, merging outer before parsing inner, which needs its enclosing
+    // scope.
+    js::AutoReportFrontendContext ec(cx);
+    JS::NativeStackLimit stackLimit = cx->stackLimitForCurrentPrincipal();
+
+    CompilationStencilMerger merger;
+    {
+      auto initial =
+          cx->make_unique<ExtensibleCompilationStencil>(cx, stencil->source);
+      CHECK(initial);
+      CHECK(initial->cloneFrom(&ec, *stencil));
+      CHECK(merger.setInitial(&ec, std::move(initial)));
+    }
+
+    RefPtr<CompilationStencil> outerStencil;
+    RefPtr<CompilationStencil> innerStencil;
+    {
+      StencilScopeBindingCache scopeCache(merger);
+      BorrowingCompilationStencil borrow(merger.getResult());
+      outerStencil = DelazifyCanonicalScriptedFunction(
+          cx, &ec, stackLimit, &scopeCache, borrow, outerIndex);
+      CHECK(outerStencil);
+    }
+    CHECK(merger.addDelazification(&ec, *outerStencil));
+    {
+      StencilScopeBindingCache scopeCache(merger);
+      BorrowingCompilationStencil borrow(merger.getResult());
+      innerStencil = DelazifyCanonicalScriptedFunction(
+          cx, &ec, stackLimit, &scopeCache, borrow, innerIndex);
+      CHECK(innerStencil);
+    }
+
+    JS::InstantiateOptions instantiateOptions(options);
+    JS::RootedScript script(
+        cx, JS::InstantiateGlobalStencil(cx, instantiateOptions, stencil));
+    CHECK(script);
+    CHECK(JS::StartIncrementalEncoding(cx, std::move(stencil)));
+
+    // Register the delazifications in the cache without running any of the
+    // functions, innermost first, as a helper thread finishing out of order
+    // would.
+    RefPtr<js::ScriptSource> source(script->scriptSource());
+    js::StencilCache& cache = cx->runtime()->caches().delazificationCache;
+    CHECK(cache.startCaching(RefPtr<js::ScriptSource>(source)));
+    {
+      auto guard = cache.isSourceCached(source);
+      CHECK(guard);
+      for (CompilationStencil* delazification :
+           {innerStencil.get(), outerStencil.get()}) {
+        js::StencilContext key(
+            source,
+            delazification->scriptExtra[CompilationStencil::TopLevelIndex]
+                .extent);
+        CHECK(cache.putNew(guard, key, delazification));
+      }
+
+      js::Vector<RefPtr<CompilationStencil>, 0, js::SystemAllocPolicy> all;
+      CHECK(cache.getAllForSource(guard, source, all));
+      CHECK(all.length() == 2);
+      CHECK(all[0] == outerStencil);
+      CHECK(all[1] == innerStencil);
+    }
+
+    CHECK(JS::FinishIncrementalEncoding(cx, script, buffer));
+    CHECK(!buffer.empty());
+    cache.clearAndDisable();
+  }
+
+  // Create a new global
+  CHECK(createGlobal());
+  JSAutoRealm ar(cx, global);
+
+  {
+    RefPtr<JS::Stencil> stencil;
+    {
+      JS::DecodeOptions decodeOptions;
+      JS::TranscodeRange range(buffer.begin(), buffer.length());
+      JS::TranscodeResult res =
+          JS::DecodeStencil(cx, decodeOptions, range, getter_AddRefs(stencil));
+      CHECK(res == JS::TranscodeResult::Ok);
+    }
+
+    // Both cached delazifications were merged into the encoded stencil.
+    CHECK(stencil->scriptData.size() == 3);
+    CHECK(stencil->scriptData[ScriptIndex(1)].hasSharedData());
+    CHECK(stencil->scriptData[ScriptIndex(2)].hasSharedData());
+
+    JS::InstantiateOptions instantiateOptions;
+    JS::RootedScript script(
+        cx, JS::InstantiateGlobalStencil(cx, instantiateOptions, stencil));
+    CHECK(script);
+    JS::RootedValue rval(cx);
+    CHECK(JS_ExecuteScript(cx, script, &rval));
+    CHECK(rval.isNumber() && rval.toNumber() == 42);
+  }
+
+  return true;
+}
+static bool TestGetBuildId(JS::BuildIdCharVector* buildId) {
+  const char buildid[] = "testXDR";
+  return buildId->append(buildid, sizeof(buildid));
+}
+END_TEST(testStencil_IncrementalEncodingCachedDelazifications)
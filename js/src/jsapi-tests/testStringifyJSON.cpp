@@ -0,0 +1,64 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+ * vim: set ts=8 sts=2 et sw=2 tw=80:
+ */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "js/JSON.h"
+#include "js/String.h"  // JS_CompareStrings, JS_NewUCStringCopyN
+#include "js/Vector.h"
+#include "jsapi-tests/tests.h"
+
+struct StringifyOutput {
+  js::Vector<char16_t, 0, js::SystemAllocPolicy> chars;
+  size_t calls = 0;
+};
+
+static bool AppendToOutput(const char16_t* buf, uint32_t len, void* data) {
+  auto* output = static_cast<StringifyOutput*>(data);
+  output->calls++;
+  return output->chars.append(buf, len);
+}
+
+BEGIN_TEST(testStringifyJSON_chunked) {
+  JS::RootedValue v(cx);
+  EVAL(
+      "var a = [];\n"
+      "for (var i = 0; i < 20000; i++) a.push({key: 'value' + i});\n"
+      "a",
+      &v);
+
+  // Large results are written in several chunks.
+  StringifyOutput output;
+  CHECK(JS_Stringify(cx, &v, nullptr, JS::NullHandleValue, AppendToOutput,
+                     &output));
+  CHECK(output.calls > 1);
+
+  JS::RootedValue expected(cx);
+  EVAL("JSON.stringify(a)", &expected);
+  JS::RootedString actual(
+      cx, JS_NewUCStringCopyN(cx, output.chars.begin(), output.chars.length()));
+  CHECK(actual);
+  int32_t result;
+  CHECK(JS_CompareStrings(cx, actual, expected.toString(), &result));
+  CHECK_EQUAL(result, 0);
+
+  // Small results are written at once.
+  EVAL("({key: [1, 2, 3]})", &v);
+  StringifyOutput small;
+  CHECK(JS_Stringify(cx, &v, nullptr, JS::NullHandleValue, AppendToOutput,
+                     &small));
+  CHECK_EQUAL(small.calls, 1u);
+
+  // An undefined result is written as "null".
+  v.setUndefined();
+  StringifyOutput undef;
+  CHECK(JS_Stringify(cx, &v, nullptr, JS::NullHandleValue, AppendToOutput,
+                     &undef));
+  CHECK_EQUAL(undef.calls, 1u);
+  CHECK_EQUAL(undef.chars.length(), 4u);
+
+  return true;
+}
+END_TEST(testStringifyJSON_chunked)
@@ -209,6 +209,81 @@ bool clone(JS::StructuredCloneScope scope, JS::HandleValue v1,
 }
 END_TEST(testStructuredClone_externalArrayBufferDifferentThreadOrProcess)
 
+BEGIN_TEST(testStructuredClone_sharedString) {
+  // Large enough to be shared, with two-byte chars.
+  static const size_t Length = 100 * 1024;
+  JS::UniqueTwoByteChars chars(js_pod_malloc<char16_t>(Length));
+  CHECK(chars);
+  for (size_t i = 0; i < Length; i++) {
+    chars[i] = char16_t(0x2600 + i % 64);
+  }
+
+  JS::RootedString str(cx, JS_NewUCStringCopyN(cx, chars.get(), Length));
+  CHECK(str);
+  JS::RootedValue v1(cx, JS::StringValue(str));
+
+  // Same-process clones share the characters, even when cloned again.
+  JS::RootedValue v2(cx);
+  CHECK(clone(JS::StructuredCloneScope::SameProcess, v1, &v2));
+  const JSExternalStringCallbacks* callbacks;
+  const char16_t* sharedChars;
+  CHECK(JS::IsExternalString(v2.toString(), &callbacks, &sharedChars));
+  CHECK(sharedChars != chars.get());
+
+  JS::RootedValue v3(cx);
+  CHECK(clone(JS::StructuredCloneScope::SameProcess, v2, &v3));
+  const char16_t* sharedChars2;
+  CHECK(JS::IsExternalString(v3.toString(), &callbacks, &sharedChars2));
+  CHECK(sharedChars2 == sharedChars);
+
+  int32_t result;
+  CHECK(JS_CompareStrings(cx, v3.toString(), str, &result));
+  CHECK_EQUAL(result, 0);
+
+  // Other clones copy them.
+  JS::RootedValue v4(cx);
+  CHECK(clone(JS::StructuredCloneScope::DifferentProcess, v1, &v4));
+  CHECK(!JS::IsExternalString(v4.toString(), &callbacks, &sharedChars));
+  CHECK(JS_CompareStrings(cx, v4.toString(), str, &result));
+  CHECK_EQUAL(result, 0);
+
+  // Appended clone data holds its own references, so it can still be read
+  // after the data it was copied from is cleared.
+  {
+    JSAutoStructuredCloneBuffer buf(JS::StructuredCloneScope::SameProcess,
+                                    nullptr, nullptr);
+    CHECK(buf.write(cx, v1));
+    JSStructuredCloneData appended(JS::StructuredCloneScope::SameProcess);
+    CHECK(appended.Append(buf.data()));
+    buf.clear();
+
+    JS::RootedValue v5(cx);
+    JS::CloneDataPolicy policy;
+    CHECK(JS_ReadStructuredClone(cx, appended, JS_STRUCTURED_CLONE_VERSION,
+                                 JS::StructuredCloneScope::SameProcess, &v5,
+                                 policy, nullptr, nullptr));
+    CHECK(JS::IsExternalString(v5.toString(), &callbacks, &sharedChars));
+    CHECK(JS_CompareStrings(cx, v5.toString(), str, &result));
+    CHECK_EQUAL(result, 0);
+  }
+
+  // Release the shared characters.
+  v2.setUndefined();
+  v3.setUndefined();
+  JS_GC(cx);
+
+  return true;
+}
+
+bool clone(JS::StructuredCloneScope scope, JS::HandleValue v1,
+           JS::MutableHandleValue v2) {
+  JSAutoStructuredCloneBuffer clonedBuffer(scope, nullptr, nullptr);
+  CHECK(clonedBuffer.write(cx, v1));
+  CHECK(clonedBuffer.read(cx, v2));
+  return true;
+}
+END_TEST(testStructuredClone_sharedString)
+
 struct StructuredCloneTestPrincipals final : public JSPrincipals {
   uint32_t rank;
 
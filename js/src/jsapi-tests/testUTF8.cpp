@@ -45,3 +45,53 @@ BEGIN_TEST(testUTF8_badSurrogate) {
   return true;
 }
 END_TEST(testUTF8_badSurrogate)
+
+BEGIN_TEST(testUTF8_inflateValid) {
+  // ASCII prefix, two-, three- and four-byte sequences.
+  static const char utf8[] = "abc\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80";
+  static const char16_t expected[] = {'a',    'b',    'c',   0x00E9,
+                                      0x20AC, 0xD83D, 0xDE00};
+
+  size_t len;
+  JS::UniqueTwoByteChars chars(
+      JS::UTF8CharsToNewTwoByteCharsZ(cx, JS::UTF8Chars(utf8, strlen(utf8)),
+                                      &len, js::MallocArena)
+          .get());
+  CHECK(chars);
+  CHECK_EQUAL(len, std::size(expected));
+  for (size_t i = 0; i < len; i++) {
+    CHECK(chars[i] == expected[i]);
+  }
+  CHECK(chars[len] == 0);
+
+  static const char latin1Utf8[] = "caf\xC3\xA9";
+  JS::UniqueLatin1Chars latin1(
+      JS::UTF8CharsToNewLatin1CharsZ(
+          cx, JS::UTF8Chars(latin1Utf8, strlen(latin1Utf8)), &len,
+          js::MallocArena)
+          .get());
+  CHECK(latin1);
+  CHECK_EQUAL(len, 4u);
+  CHECK(latin1[3] == 0xE9);
+  CHECK(latin1[len] == 0);
+  return true;
+}
+END_TEST(testUTF8_inflateValid)
+
+BEGIN_TEST(testUTF8_inflateLossy) {
+  // Invalid input still goes through the replacement character path.
+  static const char utf8[] = "abc\xC3\xA9\xFF" "d";
+
+  size_t len;
+  JS::UniqueTwoByteChars chars(
+      JS::LossyUTF8CharsToNewTwoByteCharsZ(
+          cx, JS::UTF8Chars(utf8, strlen(utf8)), &len, js::MallocArena)
+          .get());
+  CHECK(chars);
+  CHECK_EQUAL(len, 6u);
+  CHECK(chars[3] == 0x00E9);
+  CHECK(chars[4] == 0xFFFD);
+  CHECK(chars[5] == 'd');
+  return true;
+}
+END_TEST(testUTF8_inflateLossy)
@@ -3417,7 +3417,8 @@ JS_PUBLIC_API bool JS_Stringify(JSContext* cx, MutableHandleValue vp,
   if (!sb.ensureTwoByteChars()) {
     return false;
   }
-  if (!Stringify(cx, vp, replacer, space, sb, StringifyBehavior::Normal)) {
+  if (!Stringify(cx, vp, replacer, space, sb, StringifyBehavior::Normal,
+                 callback, data)) {
     return false;
   }
   if (sb.empty() && !sb.append(cx->names().null)) {
@@ -3440,7 +3441,7 @@ JS_PUBLIC_API bool JS::ToJSONMaybeSafely(JSContext* cx, JS::HandleObject input,
 
   RootedValue inputValue(cx, ObjectValue(*input));
   if (!Stringify(cx, &inputValue, nullptr, NullHandleValue, sb,
-                 StringifyBehavior::RestrictedSafe))
+                 StringifyBehavior::RestrictedSafe, callback, data))
     return false;
 
   if (sb.empty() && !sb.append(cx->names().null)) {
@@ -33,6 +33,7 @@
 #include "jsnum.h"
 #include "jstypes.h"
 
+#include "jit/InlinableNatives.h"
 #include "js/CallAndConstruct.h"  // JS::IsCallable
 #include "js/Conversions.h"
 #include "js/Date.h"
@@ -1602,101 +1603,72 @@ void DateObject::fillLocalTimeSlots() {
 
   setReservedSlot(LOCAL_TIME_SLOT, DoubleValue(localTime));
 
-  int year = (int)floor(localTime / (msPerDay * 365.2425)) + 1970;
-  double yearStartTime = TimeFromYear(year);
-
-  /* Adjust the year in case the approximation was wrong, as in YearFromTime. */
-  int yearDays;
-  if (yearStartTime > localTime) {
-    year--;
-    yearStartTime -= (msPerDay * DaysInYear(year));
-    yearDays = DaysInYear(year);
+  // The local time is integral and at most |msPerDay| outside the time value
+  // range, so the components can be computed with integer arithmetic. This
+  // uses the days-to-civil algorithm from
+  // <https://howardhinnant.github.io/date_algorithms.html#civil_from_days>,
+  // which counts years from March 1st, so that the leap day is the last day of
+  // the shifted year.
+  MOZ_ASSERT(localTime == trunc(localTime));
+  int64_t localMilliseconds = int64_t(localTime);
+  int64_t msPerDayInt = int64_t(msPerDay);
+
+  int64_t days = localMilliseconds / msPerDayInt;
+  int64_t msWithinDay = localMilliseconds % msPerDayInt;
+  if (msWithinDay < 0) {
+    days--;
+    msWithinDay += msPerDayInt;
+  }
+
+  constexpr int64_t DaysPerEra = 146097;
+  constexpr int64_t DaysFromEpochToMarch0000 = 719468;
+
+  int64_t shiftedDays = days + DaysFromEpochToMarch0000;
+  int64_t era =
+      (shiftedDays >= 0 ? shiftedDays : shiftedDays - (DaysPerEra - 1)) /
+      DaysPerEra;
+  int64_t dayOfEra = shiftedDays - era * DaysPerEra;  // [0, 146096]
+  int64_t yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 -
+                       dayOfEra / (DaysPerEra - 1)) /
+                      365;  // [0, 399]
+  int64_t shiftedDayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 -
+                                          yearOfEra / 100);  // [0, 365]
+  int64_t shiftedMonth = (5 * shiftedDayOfYear + 2) / 153;  // [0, 11]
+
+  int32_t date = int32_t(shiftedDayOfYear - (153 * shiftedMonth + 2) / 5 + 1);
+  int32_t month = int32_t(shiftedMonth < 10 ? shiftedMonth + 2
+                                            : shiftedMonth - 10);
+  int32_t year =
+      int32_t(yearOfEra + era * 400 + (shiftedMonth >= 10 ? 1 : 0));
+
+  int32_t dayWithinYear;
+  if (shiftedMonth < 10) {
+    // March 1st is the 59th or 60th day of the year.
+    dayWithinYear =
+        int32_t(shiftedDayOfYear) + 59 + (IsLeapYear(year) ? 1 : 0);
   } else {
-    yearDays = DaysInYear(year);
-    double nextStart = yearStartTime + (msPerDay * yearDays);
-    if (nextStart <= localTime) {
-      year++;
-      yearStartTime = nextStart;
-      yearDays = DaysInYear(year);
-    }
+    // January 1st is the 306th day starting from March 1st.
+    dayWithinYear = int32_t(shiftedDayOfYear) - 306;
   }
 
-  setReservedSlot(LOCAL_YEAR_SLOT, Int32Value(year));
-
-  uint64_t yearTime = uint64_t(localTime - yearStartTime);
-  int yearSeconds = uint32_t(yearTime / 1000);
+  // January 1st, 1970 was a Thursday.
+  int32_t weekday = int32_t((days + 4) % 7);
+  if (weekday < 0) {
+    weekday += 7;
+  }
 
-  int day = yearSeconds / int(SecondsPerDay);
+  int32_t yearSeconds = dayWithinYear * int32_t(SecondsPerDay) +
+                        int32_t(msWithinDay / int64_t(msPerSecond));
 
-  int step = -1, next = 30;
-  int month;
-
-  do {
-    if (day <= next) {
-      month = 0;
-      break;
-    }
-    step = next;
-    next += ((yearDays == 366) ? 29 : 28);
-    if (day <= next) {
-      month = 1;
-      break;
-    }
-    step = next;
-    if (day <= (next += 31)) {
-      month = 2;
-      break;
-    }
-    step = next;
-    if (day <= (next += 30)) {
-      month = 3;
-      break;
-    }
-    step = next;
-    if (day <= (next += 31)) {
-      month = 4;
-      break;
-    }
-    step = next;
-    if (day <= (next += 30)) {
-      month = 5;
-      break;
-    }
-    step = next;
-    if (day <= (next += 31)) {
-      month = 6;
-      break;
-    }
-    step = next;
-    if (day <= (next += 31)) {
-      month = 7;
-      break;
-    }
-    step = next;
-    if (day <= (next += 30)) {
-      month = 8;
-      break;
-    }
-    step = next;
-    if (day <= (next += 31)) {
-      month = 9;
-      break;
-    }
-    step = next;
-    if (day <= (next += 30)) {
-      month = 10;
-      break;
-    }
-    step = next;
-    month = 11;
-  } while (0);
+  MOZ_ASSERT(year == YearFromTime(localTime));
+  MOZ_ASSERT(month == MonthFromTime(localTime));
+  MOZ_ASSERT(date == DateFromTime(localTime));
+  MOZ_ASSERT(weekday == WeekDay(localTime));
 
+  setReservedSlot(LOCAL_YEAR_SLOT, Int32Value(year));
   setReservedSlot(LOCAL_MONTH_SLOT, Int32Value(month));
-  setReservedSlot(LOCAL_DATE_SLOT, Int32Value(day - step));
-
-  int weekday = WeekDay(localTime);
+  setReservedSlot(LOCAL_DATE_SLOT, Int32Value(date));
   setReservedSlot(LOCAL_DAY_SLOT, Int32Value(weekday));
-
   setReservedSlot(LOCAL_SECONDS_INTO_YEAR_SLOT, Int32Value(yearSeconds));
 }
 
@@ -3241,11 +3213,11 @@ static const JSFunctionSpec date_methods[] = {
     JS_FN("getTime", date_getTime, 0, 0),
     JS_FN("getTimezoneOffset", date_getTimezoneOffset, 0, 0),
     JS_FN("getYear", date_getYear, 0, 0),
-    JS_FN("getFullYear", date_getFullYear, 0, 0),
+    JS_INLINABLE_FN("getFullYear", date_getFullYear, 0, 0, DateGetFullYear),
     JS_FN("getUTCFullYear", date_getUTCFullYear, 0, 0),
-    JS_FN("getMonth", date_getMonth, 0, 0),
+    JS_INLINABLE_FN("getMonth", date_getMonth, 0, 0, DateGetMonth),
     JS_FN("getUTCMonth", date_getUTCMonth, 0, 0),
-    JS_FN("getDate", date_getDate, 0, 0),
+    JS_INLINABLE_FN("getDate", date_getDate, 0, 0, DateGetDate),
     JS_FN("getUTCDate", date_getUTCDate, 0, 0),
     JS_FN("getDay", date_getDay, 0, 0),
     JS_FN("getUTCDay", date_getUTCDay, 0, 0),
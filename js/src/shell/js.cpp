@@ -24,6 +24,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #ifdef XP_WIN
 #  include <direct.h>
 #  include <process.h>
@@ -2892,6 +2893,94 @@ static bool CpuNow(JSContext* cx, unsigned argc, Value* vp) {
   return true;
 }
 
+static bool Bench(JSContext* cx, unsigned argc, Value* vp) {
+  CallArgs args = CallArgsFromVp(argc, vp);
+
+  if (!args.get(0).isObject() || !IsCallable(args[0])) {
+    JS_ReportErrorASCII(cx, "bench's first argument should be a function.");
+    return false;
+  }
+
+  int32_t runs = 10;
+  if (args.hasDefined(1) && !ToInt32(cx, args[1], &runs)) {
+    return false;
+  }
+  int32_t warmups = 3;
+  if (args.hasDefined(2) && !ToInt32(cx, args[2], &warmups)) {
+    return false;
+  }
+  if (runs < 1) {
+    JS_ReportErrorASCII(cx, "bench needs at least one run.");
+    return false;
+  }
+  if (warmups < 0) {
+    JS_ReportErrorASCII(cx, "bench's warm-up count can't be negative.");
+    return false;
+  }
+
+  RootedValue fun(cx, args[0]);
+  RootedValue rval(cx);
+
+  // Warm-up calls let the JITs tier up before anything is measured.
+  for (int32_t i = 0; i < warmups; i++) {
+    if (!Call(cx, UndefinedHandleValue, fun, HandleValueArray::empty(),
+              &rval)) {
+      return false;
+    }
+  }
+
+  Vector<double, 0, SystemAllocPolicy> samples;
+  if (!samples.reserve(runs)) {
+    ReportOutOfMemory(cx);
+    return false;
+  }
+  for (int32_t i = 0; i < runs; i++) {
+    // Start every run from a collected heap so one run's garbage is not
+    // charged to the next.
+    JS_GC(cx);
+
+    TimeStamp start = TimeStamp::Now();
+    if (!Call(cx, UndefinedHandleValue, fun, HandleValueArray::empty(),
+              &rval)) {
+      return false;
+    }
+    samples.infallibleAppend((TimeStamp::Now() - start).ToMilliseconds());
+  }
+
+  double sum = 0;
+  double min = samples[0];
+  double max = samples[0];
+  for (double sample : samples) {
+    sum += sample;
+    min = std::min(min, sample);
+    max = std::max(max, sample);
+  }
+  double mean = sum / runs;
+  double variance = 0;
+  for (double sample : samples) {
+    variance += (sample - mean) * (sample - mean);
+  }
+  double stddev = runs > 1 ? std::sqrt(variance / (runs - 1)) : 0;
+  // Normal approximation of the 95% confidence interval for the mean.
+  double ci95 = 1.96 * stddev / std::sqrt(double(runs));
+
+  RootedObject result(cx, JS_NewPlainObject(cx));
+  if (!result) {
+    return false;
+  }
+  if (!JS_DefineProperty(cx, result, "runs", runs, JSPROP_ENUMERATE) ||
+      !JS_DefineProperty(cx, result, "mean", mean, JSPROP_ENUMERATE) ||
+      !JS_DefineProperty(cx, result, "stddev", stddev, JSPROP_ENUMERATE) ||
+      !JS_DefineProperty(cx, result, "ci95", ci95, JSPROP_ENUMERATE) ||
+      !JS_DefineProperty(cx, result, "min", min, JSPROP_ENUMERATE) ||
+      !JS_DefineProperty(cx, result, "max", max, JSPROP_ENUMERATE)) {
+    return false;
+  }
+
+  args.rval().setObject(*result);
+  return true;
+}
+
 static bool PrintInternal(JSContext* cx, const CallArgs& args, RCFile* file) {
   if (!file->isOpen()) {
     JS_ReportErrorASCII(cx, "output file is closed");
@@ -9321,6 +9410,13 @@ static const JSFunctionSpecWithHelp shell_functions[] = {
 " Returns the approximate processor time used by the process since an arbitrary epoch, in seconds.\n"
 " Only the difference between two calls to `cpuNow()` is meaningful."),
 
+    JS_FN_HELP("bench", Bench, /* nargs= */ 1, /* flags = */ 0,
+"bench(fun, [runs, [warmups]])",
+" Call |fun| |warmups| times (default 3) unmeasured, then |runs| times\n"
+" (default 10), each after a full GC. Returns {runs, mean, stddev, ci95, min,\n"
+" max} with times in milliseconds; ci95 is the half-width of the 95%\n"
+" confidence interval for the mean."),
+
 #ifdef FUZZING_JS_FUZZILLI
     JS_FN_HELP("fuzzilli", Fuzzilli, 0, 0,
 "fuzzilli(operation, arg)",
@@ -10835,6 +10931,21 @@ static bool SetContextOptions(JSContext* cx, const OptionParser& op) {
     jit::JitOptions.setEagerBaselineCompilation();
   }
 
+  if (const char* str = op.getStringOption("baseline-offthread-compile")) {
+    if (strcmp(str, "on") == 0) {
+      jit::JitOptions.baselineOffThreadCompile = true;
+    } else if (strcmp(str, "off") == 0) {
+      jit::JitOptions.baselineOffThreadCompile = false;
+    } else {
+      return OptionFailure("baseline-offthread-compile", str);
+    }
+  }
+
+  int32_t baselineBatchSize = op.getIntOption("baseline-batch-size");
+  if (baselineBatchSize > 0) {
+    jit::JitOptions.baselineBatchSize = baselineBatchSize;
+  }
+
   if (op.getBoolOption("blinterp")) {
     jit::JitOptions.baselineInterpreter = true;
   }
@@ -10898,6 +11009,12 @@ static bool SetContextOptions(JSContext* cx, const OptionParser& op) {
     }
   }
 
+  int32_t simpleRegAllocThreshold =
+      op.getIntOption("ion-simple-regalloc-threshold");
+  if (simpleRegAllocThreshold >= 0) {
+    jit::JitOptions.simpleRegAllocThreshold = simpleRegAllocThreshold;
+  }
+
   if (op.getBoolOption("ion-eager")) {
     jit::JitOptions.setEagerIonCompilation();
   }
@@ -11692,7 +11809,13 @@ int main(int argc, char** argv) {
           "  backtracking: Priority based backtracking register allocation "
           "(default)\n"
           "  testbed: Backtracking allocator with experimental features\n"
-          "  stupid: Simple block local register allocation") ||
+          "  simple: Block local register allocation with linear scan stack "
+          "slots") ||
+      !op.addIntOption('\0', "ion-simple-regalloc-threshold", "COUNT",
+                       "Use the simple register allocator for graphs with "
+                       "more than COUNT LIR instructions, unless --ion-regalloc "
+                       "is given (default: 0, disabled)",
+                       -1) ||
       !op.addBoolOption(
           '\0', "ion-eager",
           "Always ion-compile methods (implies --baseline-eager)") ||
@@ -11713,6 +11836,13 @@ int main(int argc, char** argv) {
           "Wait for COUNT calls or iterations before baseline-compiling "
           "(default: 10)",
           -1) ||
+      !op.addStringOption('\0', "baseline-offthread-compile", "on/off",
+                          "Compile baseline scripts off thread in batches "
+                          "(default: off)") ||
+      !op.addIntOption('\0', "baseline-batch-size", "COUNT",
+                       "Number of scripts compiled together when compiling "
+                       "baseline scripts off thread (default: 8)",
+                       -1) ||
       !op.addBoolOption('\0', "blinterp",
                         "Enable Baseline Interpreter (default)") ||
       !op.addBoolOption('\0', "no-blinterp", "Disable Baseline Interpreter") ||
@@ -79,6 +79,7 @@
 #include "vm/BigIntType.h"
 
 #include "mozilla/Casting.h"
+#include "mozilla/DebugOnly.h"
 #include "mozilla/FloatingPoint.h"
 #include "mozilla/HashFunctions.h"
 #include "mozilla/MathAlgorithms.h"
@@ -89,10 +90,12 @@
 #include "mozilla/Span.h"  // mozilla::Span
 #include "mozilla/WrappingOperations.h"
 
+#include <algorithm>
 #include <functional>
 #include <limits>
 #include <memory>
 #include <type_traits>  // std::is_same_v
+#include <utility>
 
 #include "jsnum.h"
 
@@ -490,6 +493,229 @@ void BigInt::multiplyAccumulate(BigInt* multiplicand, Digit multiplier,
   }
 }
 
+// Computes `x * y` into `result`, which must have exactly
+// `x.size() + y.size()` digits.
+void BigInt::multiplySchoolbook(Digits result, ConstDigits x, ConstDigits y) {
+  MOZ_ASSERT(result.size() == x.size() + y.size());
+  std::fill(result.begin(), result.end(), 0);
+
+  for (size_t i = 0; i < x.size(); i++) {
+    Digit multiplier = x[i];
+    if (!multiplier) {
+      continue;
+    }
+
+    Digit carry = 0;
+    Digit high = 0;
+    size_t k = i;
+    for (size_t j = 0; j < y.size(); j++, k++) {
+      Digit acc = result[k];
+      Digit newCarry = 0;
+
+      // Add last round's carryovers.
+      acc = digitAdd(acc, high, &newCarry);
+      acc = digitAdd(acc, carry, &newCarry);
+
+      // Compute this round's multiplication.
+      Digit low = digitMul(multiplier, y[j], &high);
+      acc = digitAdd(acc, low, &newCarry);
+
+      // Store result and prepare for next round.
+      result[k] = acc;
+      carry = newCarry;
+    }
+
+    // The partial product so far is less than `2**(DigitBits * k)`, so the
+    // remaining carryovers fit into the next, still unused digit.
+    MOZ_ASSERT(result[k] == 0);
+    result[k] = high + carry;
+  }
+}
+
+// Adds `summand` onto `x` and returns the carry (0 or 1) out of the most
+// significant digit of `x`.
+BigInt::Digit BigInt::digitsInplaceAdd(Digits x, ConstDigits summand) {
+  MOZ_ASSERT(x.size() >= summand.size());
+
+  Digit carry = 0;
+  size_t i = 0;
+  for (; i < summand.size(); i++) {
+    Digit newCarry = 0;
+    Digit sum = digitAdd(x[i], summand[i], &newCarry);
+    x[i] = digitAdd(sum, carry, &newCarry);
+    carry = newCarry;
+  }
+  for (; carry && i < x.size(); i++) {
+    Digit newCarry = 0;
+    x[i] = digitAdd(x[i], carry, &newCarry);
+    carry = newCarry;
+  }
+  return carry;
+}
+
+// Subtracts `subtrahend` from `x` and returns the borrow (0 or 1) out of the
+// most significant digit of `x`.
+BigInt::Digit BigInt::digitsInplaceSub(Digits x, ConstDigits subtrahend) {
+  MOZ_ASSERT(x.size() >= subtrahend.size());
+
+  Digit borrow = 0;
+  size_t i = 0;
+  for (; i < subtrahend.size(); i++) {
+    Digit newBorrow = 0;
+    Digit difference = digitSub(x[i], subtrahend[i], &newBorrow);
+    x[i] = digitSub(difference, borrow, &newBorrow);
+    borrow = newBorrow;
+  }
+  for (; borrow && i < x.size(); i++) {
+    Digit newBorrow = 0;
+    x[i] = digitSub(x[i], borrow, &newBorrow);
+    borrow = newBorrow;
+  }
+  return borrow;
+}
+
+// Computes `|x - y|` into `result`, treating missing high digits of either
+// operand as zero. Returns whether `x < y`.
+bool BigInt::digitsAbsoluteDifference(Digits result, ConstDigits x,
+                                      ConstDigits y) {
+  MOZ_ASSERT(result.size() >= x.size());
+  MOZ_ASSERT(result.size() >= y.size());
+
+  const auto digitAt = [](ConstDigits digits, size_t i) -> Digit {
+    return i < digits.size() ? digits[i] : 0;
+  };
+
+  size_t i = result.size();
+  while (i > 0 && digitAt(x, i - 1) == digitAt(y, i - 1)) {
+    i--;
+  }
+  bool xLessThanY = i > 0 && digitAt(x, i - 1) < digitAt(y, i - 1);
+
+  ConstDigits larger = xLessThanY ? y : x;
+  ConstDigits smaller = xLessThanY ? x : y;
+
+  Digit borrow = 0;
+  for (size_t j = 0; j < result.size(); j++) {
+    Digit newBorrow = 0;
+    Digit difference =
+        digitSub(digitAt(larger, j), digitAt(smaller, j), &newBorrow);
+    result[j] = digitSub(difference, borrow, &newBorrow);
+    borrow = newBorrow;
+  }
+  MOZ_ASSERT(!borrow);
+
+  return xLessThanY;
+}
+
+// Returns the number of scratch digits `multiplyKaratsuba` needs when the
+// longer operand has `length` digits.
+size_t BigInt::karatsubaScratchLength(size_t length) {
+  size_t scratch = 0;
+  while (length >= KaratsubaThreshold) {
+    size_t half = (length + 1) / 2;
+    scratch += 6 * half + 1;
+    length = half;
+  }
+  return scratch;
+}
+
+// Computes `x * y` into `result`, which must have exactly
+// `x.size() + y.size()` digits, using Karatsuba's algorithm. `scratch` must
+// have at least `karatsubaScratchLength(max(x.size(), y.size()))` digits.
+//
+// With `B = 2**(DigitBits * k)`, `x = x1 * B + x0` and `y = y1 * B + y0`:
+//
+//   x * y = z2 * B**2 + (z0 + z2 - (x0 - x1) * (y0 - y1)) * B + z0
+//
+// where `z0 = x0 * y0` and `z2 = x1 * y1`, so that only three half-length
+// multiplications are needed.
+void BigInt::multiplyKaratsuba(Digits result, ConstDigits x, ConstDigits y,
+                               Digits scratch) {
+  if (x.size() < y.size()) {
+    std::swap(x, y);
+  }
+  MOZ_ASSERT(result.size() == x.size() + y.size());
+
+  size_t n = x.size();
+  size_t m = y.size();
+  if (m < KaratsubaThreshold) {
+    multiplySchoolbook(result, x, y);
+    return;
+  }
+
+  // Multiply unbalanced operands by splitting `x` into chunks of `y`'s length.
+  if (n >= 2 * m) {
+    Digits product = scratch.To(2 * m);
+    Digits rest = scratch.From(2 * m);
+
+    std::fill(result.begin(), result.end(), 0);
+    for (size_t i = 0; i < n; i += m) {
+      ConstDigits chunk = x.Subspan(i, std::min(m, n - i));
+      Digits chunkProduct = product.To(chunk.size() + m);
+      multiplyKaratsuba(chunkProduct, chunk, y, rest);
+
+      mozilla::DebugOnly<Digit> carry =
+          digitsInplaceAdd(result.From(i), chunkProduct);
+      MOZ_ASSERT(!carry);
+    }
+    return;
+  }
+
+  // Split both operands at `k` digits. `m > n / 2` implies `m >= k`, so the
+  // low halves have exactly `k` digits and the high halves at most `k`.
+  size_t k = (n + 1) / 2;
+  MOZ_ASSERT(m >= k);
+
+  ConstDigits x0 = x.To(k);
+  ConstDigits x1 = x.From(k);
+  ConstDigits y0 = y.To(k);
+  ConstDigits y1 = y.From(k);
+
+  // Compute z0 and z2 directly into the low and high parts of the result.
+  Digits z0 = result.To(2 * k);
+  Digits z2 = result.From(2 * k);
+  multiplyKaratsuba(z0, x0, y0, scratch);
+  if (y1.empty()) {
+    std::fill(z2.begin(), z2.end(), 0);
+  } else {
+    multiplyKaratsuba(z2, x1, y1, scratch);
+  }
+
+  // Compute `|x0 - x1| * |y0 - y1|`.
+  Digits dx = scratch.To(k);
+  Digits dy = scratch.Subspan(k, k);
+  Digits product = scratch.Subspan(2 * k, 2 * k);
+  bool xNegative = digitsAbsoluteDifference(dx, x0, x1);
+  bool yNegative = digitsAbsoluteDifference(dy, y0, y1);
+  multiplyKaratsuba(product, dx, dy, scratch.From(4 * k));
+
+  // Compute the middle term `x0 * y1 + x1 * y0`, which fits into `2 * k + 1`
+  // digits. The nested multiplication above no longer needs its scratch
+  // space, so reuse it.
+  Digits middle = scratch.Subspan(4 * k, 2 * k + 1);
+  std::copy(z0.begin(), z0.end(), middle.begin());
+  middle[2 * k] = 0;
+
+  mozilla::DebugOnly<Digit> overflow = digitsInplaceAdd(middle, z2);
+  MOZ_ASSERT(!overflow);
+  if (xNegative == yNegative) {
+    overflow = digitsInplaceSub(middle, product);
+  } else {
+    overflow = digitsInplaceAdd(middle, product);
+  }
+  MOZ_ASSERT(!overflow);
+
+  // The final product fits into `result`, so any digits of the middle term
+  // above the result's length are zero.
+  Digits resultHigh = result.From(k);
+  size_t middleLength = std::min(middle.size(), resultHigh.size());
+  MOZ_ASSERT(std::all_of(middle.begin() + middleLength, middle.end(),
+                         [](Digit d) { return d == 0; }));
+
+  overflow = digitsInplaceAdd(resultHigh, middle.To(middleLength));
+  MOZ_ASSERT(!overflow);
+}
+
 inline int8_t BigInt::absoluteCompare(BigInt* x, BigInt* y) {
   MOZ_ASSERT(!HasLeadingZeroes(x));
   MOZ_ASSERT(!HasLeadingZeroes(y));
@@ -1895,6 +2121,26 @@ BigInt* BigInt::mul(JSContext* cx, HandleBigInt x, HandleBigInt y) {
   }
 
   unsigned resultLength = x->digitLength() + y->digitLength();
+
+  if (std::min(x->digitLength(), y->digitLength()) >= KaratsubaThreshold) {
+    size_t scratchLength = karatsubaScratchLength(
+        std::max(x->digitLength(), y->digitLength()));
+    auto scratch = cx->make_pod_array<Digit>(scratchLength);
+    if (!scratch) {
+      return nullptr;
+    }
+
+    BigInt* result = createUninitialized(cx, resultLength, resultNegative);
+    if (!result) {
+      return nullptr;
+    }
+
+    multiplyKaratsuba(result->digits(), x->digits(), y->digits(),
+                      Digits(scratch.get(), scratchLength));
+
+    return destructivelyTrimHighZeroDigits(cx, result);
+  }
+
   BigInt* result = createUninitialized(cx, resultLength, resultNegative);
   if (!result) {
     return nullptr;
@@ -287,6 +287,20 @@ class BigInt final : public js::gc::CellWithLengthAndFlags {
   static void multiplyAccumulate(BigInt* multiplicand, Digit multiplier,
                                  BigInt* accumulator,
                                  unsigned accumulatorIndex);
+
+  // Operands with at least this many digits are multiplied with Karatsuba's
+  // algorithm. For shorter operands the additional bookkeeping costs more
+  // than the saved digit multiplications.
+  static constexpr size_t KaratsubaThreshold = 34;
+
+  static void multiplySchoolbook(Digits result, ConstDigits x, ConstDigits y);
+  static void multiplyKaratsuba(Digits result, ConstDigits x, ConstDigits y,
+                                Digits scratch);
+  static size_t karatsubaScratchLength(size_t length);
+  static Digit digitsInplaceAdd(Digits x, ConstDigits summand);
+  static Digit digitsInplaceSub(Digits x, ConstDigits subtrahend);
+  static bool digitsAbsoluteDifference(Digits result, ConstDigits x,
+                                       ConstDigits y);
   static bool absoluteDivWithBigIntDivisor(
       JSContext* cx, Handle<BigInt*> dividend, Handle<BigInt*> divisor,
       const mozilla::Maybe<MutableHandle<BigInt*>>& quotient,
@@ -13,6 +13,7 @@
 #include "mozilla/TextUtils.h"
 #include "mozilla/Utf8.h"
 
+#include <algorithm>
 #include <limits>
 #include <type_traits>
 
@@ -25,15 +26,19 @@
 using mozilla::AsChars;
 using mozilla::AsciiValidUpTo;
 using mozilla::AsWritableChars;
+using mozilla::ConvertAsciitoUtf16;
 using mozilla::ConvertLatin1toUtf8Partial;
 using mozilla::ConvertUtf16toUtf8Partial;
 using mozilla::IsAscii;
 using mozilla::IsUtf8Latin1;
 using mozilla::LossyConvertUtf16toLatin1;
+using mozilla::LossyConvertUtf8toLatin1;
 using mozilla::Span;
 using mozilla::Tie;
 using mozilla::Tuple;
+using mozilla::UnsafeConvertValidUtf8toUtf16;
 using mozilla::Utf8Unit;
+using mozilla::Utf8ValidUpTo;
 
 using JS::Latin1CharsZ;
 using JS::TwoByteCharsZ;
@@ -56,10 +61,25 @@ Latin1CharsZ JS::LossyTwoByteCharsToNewLatin1CharsZ(
   return Latin1CharsZ(latin1, len);
 }
 
-template <typename CharT>
-static size_t GetDeflatedUTF8StringLength(const CharT* chars, size_t nchars) {
+static size_t GetDeflatedUTF8StringLength(const Latin1Char* chars,
+                                          size_t nchars) {
+  // Every non-ASCII Latin1 character takes two bytes.
+  size_t upTo = AsciiValidUpTo(AsChars(Span(chars, nchars)));
   size_t nbytes = nchars;
-  for (const CharT* end = chars + nchars; chars < end; chars++) {
+  for (size_t i = upTo; i < nchars; i++) {
+    nbytes += chars[i] >> 7;
+  }
+  return nbytes;
+}
+
+static size_t GetDeflatedUTF8StringLength(const char16_t* chars,
+                                          size_t nchars) {
+  if (IsAscii(Span(chars, nchars))) {
+    return nchars;
+  }
+
+  size_t nbytes = nchars;
+  for (const char16_t* end = chars + nchars; chars < end; chars++) {
     char16_t c = *chars;
     if (c < 0x80) {
       continue;
@@ -355,16 +375,27 @@ static bool InflateUTF8ToUTF16(JSContext* cx, const UTF8Chars src,
   return true;
 }
 
+static Span<const char> AsCharSpan(const UTF8Chars& chars) {
+  return Span(reinterpret_cast<const char*>(chars.begin().get()),
+              chars.length());
+}
+
+static void CopyASCII(Span<const char> src, Latin1Char* dst) {
+  std::copy_n(reinterpret_cast<const Latin1Char*>(src.Elements()),
+              src.Length(), dst);
+}
+
+static void CopyASCII(Span<const char> src, char16_t* dst) {
+  ConvertAsciitoUtf16(src, Span(dst, src.Length()));
+}
+
 template <OnUTF8Error ErrorAction, typename CharT>
 static void CopyAndInflateUTF8IntoBuffer(JSContext* cx, const UTF8Chars src,
                                          CharT* dst, size_t outlen,
                                          bool allASCII) {
   if (allASCII) {
-    size_t srclen = src.length();
-    MOZ_ASSERT(outlen == srclen);
-    for (uint32_t i = 0; i < srclen; i++) {
-      dst[i] = CharT(src[i]);
-    }
+    MOZ_ASSERT(outlen == src.length());
+    CopyASCII(AsCharSpan(src), dst);
   } else {
     size_t j = 0;
     auto push = [dst, &j](char16_t c) -> LoopDisposition {
@@ -376,6 +407,66 @@ static void CopyAndInflateUTF8IntoBuffer(JSContext* cx, const UTF8Chars src,
   }
 }
 
+static bool IsValidUTF8For(Span<const char> chars, Latin1Char*) {
+  return IsUtf8Latin1(chars);
+}
+
+static bool IsValidUTF8For(Span<const char> chars, char16_t*) {
+  return Utf8ValidUpTo(chars) == chars.Length();
+}
+
+static size_t ConvertValidUTF8(Span<const char> src, Span<Latin1Char> dst) {
+  return LossyConvertUtf8toLatin1(src, AsWritableChars(dst));
+}
+
+static size_t ConvertValidUTF8(Span<const char> src, Span<char16_t> dst) {
+  return UnsafeConvertValidUtf8toUtf16(src, dst);
+}
+
+// Most input is valid UTF-8, which can be checked and converted with the
+// vectorized routines from encoding_rs. Return false if the input needs to be
+// decoded one code point at a time instead, to handle errors or code points
+// which don't fit in CharT. Otherwise *result is set, or null on OOM.
+template <typename CharT>
+static bool TryInflateValidUTF8(JSContext* cx, const UTF8Chars src,
+                                CharT** result, size_t* outlen,
+                                arena_id_t destArenaId) {
+  Span<const char> chars = AsCharSpan(src);
+  size_t srclen = chars.Length();
+  size_t asciiLen = AsciiValidUpTo(chars);
+  if (asciiLen != srclen &&
+      !IsValidUTF8For(chars.From(asciiLen), static_cast<CharT*>(nullptr))) {
+    return false;
+  }
+
+  // Converting never produces more code units than it consumes. Allocate for
+  // the worst case and shrink the buffer afterwards.
+  *result = nullptr;
+  CharT* dst = cx->pod_arena_malloc<CharT>(destArenaId, srclen + 1);
+  if (!dst) {
+    ReportOutOfMemory(cx);
+    return true;
+  }
+
+  size_t len = srclen;
+  if (asciiLen == srclen) {
+    CopyASCII(chars, dst);
+  } else {
+    CopyASCII(chars.To(asciiLen), dst);
+    len = asciiLen + ConvertValidUTF8(chars.From(asciiLen),
+                                      Span(dst + asciiLen, srclen - asciiLen));
+    if (CharT* shrunk = cx->maybe_pod_arena_realloc<CharT>(
+            destArenaId, dst, srclen + 1, len + 1)) {
+      dst = shrunk;
+    }
+  }
+
+  dst[len] = CharT('\0');
+  *result = dst;
+  *outlen = len;
+  return true;
+}
+
 template <OnUTF8Error ErrorAction, typename CharsT>
 static CharsT InflateUTF8StringHelper(JSContext* cx, const UTF8Chars src,
                                       size_t* outlen, arena_id_t destArenaId) {
@@ -386,6 +477,11 @@ static CharsT InflateUTF8StringHelper(JSContext* cx, const UTF8Chars src,
 
   *outlen = 0;
 
+  CharT* result;
+  if (TryInflateValidUTF8(cx, src, &result, outlen, destArenaId)) {
+    return result ? CharsT(result, *outlen) : CharsT();
+  }
+
   size_t len = 0;
   bool allASCII = true;
   auto count = [&len, &allASCII](char16_t c) -> LoopDisposition {
@@ -582,13 +678,7 @@ void JS::ConstUTF8CharsZ::validate(size_t aLength) {
 #endif
 
 bool JS::StringIsASCII(const char* s) {
-  while (*s) {
-    if (*s & 0x80) {
-      return false;
-    }
-    s++;
-  }
-  return true;
+  return IsAscii(Span(s, strlen(s)));
 }
 
 bool JS::StringIsASCII(Span<const char> s) { return IsAscii(s); }
@@ -597,18 +687,14 @@ bool StringBuffer::append(const Utf8Unit* units, size_t len) {
   if (isLatin1()) {
     Latin1CharBuffer& latin1 = latin1Chars();
 
-    while (len > 0) {
-      if (!IsAscii(*units)) {
-        break;
-      }
-
-      if (!latin1.append(units->toUnsignedChar())) {
-        return false;
-      }
-
-      ++units;
-      --len;
+    size_t asciiLen =
+        AsciiValidUpTo(Span(reinterpret_cast<const char*>(units), len));
+    if (!latin1.append(reinterpret_cast<const Latin1Char*>(units), asciiLen)) {
+      return false;
     }
+
+    units += asciiLen;
+    len -= asciiLen;
     if (len == 0) {
       return true;
     }
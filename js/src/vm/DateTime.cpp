@@ -305,6 +305,13 @@ int32_t js::DateTimeInfo::getOrComputeValue(RangeCache& range, int64_t seconds,
     return range.oldOffsetMilliseconds;
   }
 
+  int32_t evictedOffsetMilliseconds;
+  if (range.lookupEvicted(seconds, &evictedOffsetMilliseconds)) {
+    return evictedOffsetMilliseconds;
+  }
+
+  range.evictOldRange();
+
   range.oldOffsetMilliseconds = range.offsetMilliseconds;
   range.oldStartSeconds = range.startSeconds;
   range.oldEndSeconds = range.endSeconds;
@@ -358,6 +365,28 @@ int32_t js::DateTimeInfo::getOrComputeValue(RangeCache& range, int64_t seconds,
   return range.offsetMilliseconds;
 }
 
+bool js::DateTimeInfo::RangeCache::lookupEvicted(
+    int64_t seconds, int32_t* offsetMilliseconds) const {
+  for (const Entry& entry : evicted) {
+    if (entry.startSeconds <= seconds && seconds <= entry.endSeconds) {
+      *offsetMilliseconds = entry.offsetMilliseconds;
+      return true;
+    }
+  }
+  return false;
+}
+
+void js::DateTimeInfo::RangeCache::evictOldRange() {
+  if (oldStartSeconds == INT64_MIN) {
+    return;
+  }
+
+  // Replace the entries in FIFO order.
+  evicted[nextEvicted] = {oldStartSeconds, oldEndSeconds,
+                          oldOffsetMilliseconds};
+  nextEvicted = (nextEvicted + 1) % EvictedEntries;
+}
+
 void js::DateTimeInfo::RangeCache::reset() {
   // The initial range values are carefully chosen to result in a cache miss
   // on first use given the range of possible values. Be careful to keep
@@ -367,6 +396,11 @@ void js::DateTimeInfo::RangeCache::reset() {
   oldOffsetMilliseconds = 0;
   oldStartSeconds = oldEndSeconds = INT64_MIN;
 
+  for (Entry& entry : evicted) {
+    entry = {INT64_MIN, INT64_MIN, 0};
+  }
+  nextEvicted = 0;
+
   sanityCheck();
 }
 
@@ -381,6 +415,10 @@ void js::DateTimeInfo::RangeCache::sanityCheck() {
 
   assertRange(startSeconds, endSeconds);
   assertRange(oldStartSeconds, oldEndSeconds);
+  for (const Entry& entry : evicted) {
+    assertRange(entry.startSeconds, entry.endSeconds);
+  }
+  MOZ_ASSERT(nextEvicted < EvictedEntries);
 }
 
 #if JS_HAS_INTL_API
@@ -222,6 +222,21 @@ class DateTimeInfo {
     int32_t offsetMilliseconds;
     int32_t oldOffsetMilliseconds;
 
+    // Ranges which were evicted from the last cached range. Code which works
+    // on times spread over many years (e.g. formatting a list of timestamps)
+    // otherwise keeps recomputing the offsets, because the current and the
+    // last cached range only cover at most two DST intervals.
+    struct Entry {
+      int64_t startSeconds, endSeconds;
+      int32_t offsetMilliseconds;
+    };
+    static constexpr size_t EvictedEntries = 8;
+    Entry evicted[EvictedEntries];
+    size_t nextEvicted;
+
+    bool lookupEvicted(int64_t seconds, int32_t* offsetMilliseconds) const;
+    void evictOldRange();
+
     void reset();
 
     void sanityCheck();
@@ -42,6 +42,7 @@ struct PromiseHelperTask;
 class PromiseObject;
 
 namespace jit {
+class BaselineCompileTask;
 class IonCompileTask;
 class IonFreeTask;
 }  // namespace jit
@@ -102,6 +103,8 @@ class GlobalHelperThreadState {
       IonCompileTaskVector;
   using IonFreeTaskVector =
       Vector<js::UniquePtr<jit::IonFreeTask>, 0, SystemAllocPolicy>;
+  using BaselineCompileTaskVector =
+      Vector<jit::BaselineCompileTask*, 0, SystemAllocPolicy>;
   typedef Vector<UniquePtr<ParseTask>, 0, SystemAllocPolicy> ParseTaskVector;
   using ParseTaskList = mozilla::LinkedList<ParseTask>;
   using DelazifyTaskList = mozilla::LinkedList<DelazifyTask>;
@@ -128,6 +131,9 @@ class GlobalHelperThreadState {
   IonCompileTaskVector ionWorklist_, ionFinishedList_;
   IonFreeTaskVector ionFreeList_;
 
+  // Baseline compilation worklist and finished jobs.
+  BaselineCompileTaskVector baselineWorklist_, baselineFinishedList_;
+
   // wasm worklists.
   wasm::CompileTaskPtrFifo wasmWorklist_tier1_;
   wasm::CompileTaskPtrFifo wasmWorklist_tier2_;
@@ -200,6 +206,7 @@ class GlobalHelperThreadState {
 
   size_t maxIonCompilationThreads() const;
   size_t maxWasmCompilationThreads() const;
+  size_t maxWasmTier2CompilationThreads() const;
   size_t maxWasmTier2GeneratorThreads() const;
   size_t maxPromiseHelperThreads() const;
   size_t maxParseThreads() const;
@@ -269,6 +276,15 @@ class GlobalHelperThreadState {
     return ionFreeList_;
   }
 
+  BaselineCompileTaskVector& baselineWorklist(
+      const AutoLockHelperThreadState&) {
+    return baselineWorklist_;
+  }
+  BaselineCompileTaskVector& baselineFinishedList(
+      const AutoLockHelperThreadState&) {
+    return baselineFinishedList_;
+  }
+
   wasm::CompileTaskPtrFifo& wasmWorklist(const AutoLockHelperThreadState&,
                                          wasm::CompileMode m) {
     switch (m) {
@@ -353,6 +369,7 @@ class GlobalHelperThreadState {
   bool canStartPromiseHelperTask(const AutoLockHelperThreadState& lock);
   bool canStartIonCompileTask(const AutoLockHelperThreadState& lock);
   bool canStartIonFreeTask(const AutoLockHelperThreadState& lock);
+  bool canStartBaselineCompileTask(const AutoLockHelperThreadState& lock);
   bool canStartParseTask(const AutoLockHelperThreadState& lock);
   bool canStartFreeDelazifyTask(const AutoLockHelperThreadState& lock);
   bool canStartDelazifyTask(const AutoLockHelperThreadState& lock);
@@ -375,6 +392,8 @@ class GlobalHelperThreadState {
   HelperThreadTask* maybeGetLowPrioIonCompileTask(
       const AutoLockHelperThreadState& lock);
   HelperThreadTask* maybeGetIonFreeTask(const AutoLockHelperThreadState& lock);
+  HelperThreadTask* maybeGetBaselineCompileTask(
+      const AutoLockHelperThreadState& lock);
   HelperThreadTask* maybeGetParseTask(const AutoLockHelperThreadState& lock);
   HelperThreadTask* maybeGetFreeDelazifyTask(
       const AutoLockHelperThreadState& lock);
@@ -448,6 +467,8 @@ class GlobalHelperThreadState {
                   const AutoLockHelperThreadState& lock);
   bool submitTask(jit::IonCompileTask* task,
                   const AutoLockHelperThreadState& locked);
+  bool submitTask(jit::BaselineCompileTask* task,
+                  const AutoLockHelperThreadState& locked);
   bool submitTask(UniquePtr<SourceCompressionTask> task,
                   const AutoLockHelperThreadState& locked);
   bool submitTask(JSRuntime* rt, UniquePtr<ParseTask> task,
@@ -559,6 +580,8 @@ struct ParseTask : public mozilla::LinkedListElement<ParseTask>,
   ThreadType threadType() override { return ThreadType::THREAD_TYPE_PARSE; }
 };
 
+struct DelazifyPartition;
+
 // Base class for implementing the various strategies to iterate over the
 // functions to be delazified, or to decide when to stop doing any
 // delazification.
@@ -595,9 +618,46 @@ struct DelazifyStrategy {
   // This function is called with the script index of:
   //  - top-level script, when starting the off-thread delazification.
   //  - functions added by `add` and delazified by `DelazifyTask`.
+  //
+  // When called with the top-level script, only the lazy functions which belong
+  // to |partition| are registered.
   [[nodiscard]] bool add(ErrorContext* ec,
                          const frontend::CompilationStencil& stencil,
                          ScriptIndex index);
+  [[nodiscard]] bool add(ErrorContext* ec,
+                         const frontend::CompilationStencil& stencil,
+                         ScriptIndex index, const DelazifyPartition& partition);
+
+ private:
+  [[nodiscard]] bool add(ErrorContext* ec,
+                         const frontend::CompilationStencil& stencil,
+                         ScriptIndex index, const DelazifyPartition& partition,
+                         uint32_t* rank);
+};
+
+// Large sources are delazified by multiple DelazifyTasks running concurrently,
+// each of which is responsible for a subset of the lazy functions reachable
+// from the top-level script without going through another lazy function. The
+// |rank| of such a function is its position in the traversal done by
+// DelazifyStrategy::add, and a task only delazifies the functions whose rank
+// is |index| modulo |count|, along with all their inner functions.
+//
+// Each task clones the initial stencil and merges its own delazifications.
+// All of them feed the same StencilCache, which the main thread consumes. As
+// the partitions are disjoint, no function is delazified twice.
+struct DelazifyPartition {
+  uint32_t index = 0;
+  uint32_t count = 1;
+
+  // Upper bound on the number of tasks used to delazify a single source, as
+  // each of them holds a copy of the stencil.
+  static constexpr uint32_t MaxCount = 4;
+
+  // Minimum number of scripts per task, below which splitting the work is not
+  // worth copying the stencil.
+  static constexpr size_t MinScriptsPerPartition = 256;
+
+  bool contains(uint32_t rank) const { return rank % count == index; }
 };
 
 // Delazify all functions using a Depth First traversal of the function-tree
@@ -672,18 +732,26 @@ struct DelazifyTask : public mozilla::LinkedListElement<DelazifyTask>,
   // In case of early failure, no errors are reported, as a DelazifyTask is an
   // optimization and the VM should remain working even without this
   // optimization in place.
+  //
+  // The first task of a partitioned delazification registers the source in the
+  // StencilCache, and must be created before the others.
   static UniquePtr<DelazifyTask> Create(
       JSContext* cx, JSRuntime* runtime,
       const JS::ContextOptions& contextOptions,
       const JS::ReadOnlyCompileOptions& options,
-      const frontend::CompilationStencil& stencil);
+      const frontend::CompilationStencil& stencil,
+      const DelazifyPartition& partition);
+
+  // Number of partitions to use to delazify |stencil|.
+  static uint32_t NumPartitions(const frontend::CompilationStencil& stencil);
 
   DelazifyTask(JSRuntime* runtime, const JS::ContextOptions& options);
   ~DelazifyTask();
 
   [[nodiscard]] bool init(
       const JS::ReadOnlyCompileOptions& options,
-      UniquePtr<frontend::ExtensibleCompilationStencil>&& initial);
+      UniquePtr<frontend::ExtensibleCompilationStencil>&& initial,
+      const DelazifyPartition& partition);
 
   // This function is called by delazify task thread to know whether the task
   // should be interrupted.
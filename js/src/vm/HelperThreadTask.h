@@ -18,6 +18,7 @@ struct FreeDelazifyTask;
 class SourceCompressionTask;
 
 namespace jit {
+class BaselineCompileTask;
 class IonCompileTask;
 class IonFreeTask;
 }  // namespace jit
@@ -33,6 +34,11 @@ struct MapTypeToThreadType<jit::IonCompileTask> {
   static const ThreadType threadType = THREAD_TYPE_ION;
 };
 
+template <>
+struct MapTypeToThreadType<jit::BaselineCompileTask> {
+  static const ThreadType threadType = THREAD_TYPE_BASELINE;
+};
+
 template <>
 struct MapTypeToThreadType<wasm::Tier2GeneratorTask> {
   static const ThreadType threadType = THREAD_TYPE_WASM_GENERATOR_TIER2;
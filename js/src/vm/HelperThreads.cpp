@@ -18,6 +18,7 @@
 #include "frontend/CompilationStencil.h"  // frontend::{CompilationStencil, ExtensibleCompilationStencil, CompilationInput, BorrowingCompilationStencil, ScriptStencilRef}
 #include "frontend/ScopeBindingCache.h"   // frontend::ScopeBindingCache
 #include "gc/GC.h"
+#include "jit/BaselineCompileTask.h"
 #include "jit/IonCompileTask.h"
 #include "jit/JitRuntime.h"
 #include "jit/JitScript.h"
@@ -122,6 +123,10 @@ size_t js::GetMaxWasmCompilationThreads() {
   return HelperThreadState().maxWasmCompilationThreads();
 }
 
+size_t js::GetMaxWasmTier2CompilationThreads() {
+  return HelperThreadState().maxWasmTier2CompilationThreads();
+}
+
 void JS::SetProfilingThreadCallbacks(
     JS::RegisterThreadCallback registerThread,
     JS::UnregisterThreadCallback unregisterThread) {
@@ -264,6 +269,7 @@ bool GlobalHelperThreadState::submitTask(
   if (!ionWorklist(locked).append(task)) {
     return false;
   }
+  task->script()->runtimeFromAnyThread()->incPendingOffThreadIonCompiles();
 
   // The build is moving off-thread. Freeze the LifoAlloc to prevent any
   // unwanted mutations.
@@ -313,6 +319,38 @@ void js::FinishOffThreadIonCompile(jit::IonCompileTask* task,
       ->numFinishedOffThreadTasksRef(lock)++;
 }
 
+bool js::StartOffThreadBaselineCompile(jit::BaselineCompileTask* task,
+                                       const AutoLockHelperThreadState& lock) {
+  return HelperThreadState().submitTask(task, lock);
+}
+
+bool GlobalHelperThreadState::submitTask(
+    jit::BaselineCompileTask* task, const AutoLockHelperThreadState& locked) {
+  MOZ_ASSERT(isInitialized(locked));
+
+  if (!baselineWorklist(locked).append(task)) {
+    return false;
+  }
+
+  dispatch(DispatchReason::NewTask, locked);
+  return true;
+}
+
+/*
+ * Move a BaselineCompileTask which has finished generating code into the
+ * global finished list, to be linked by the main thread.
+ */
+void js::FinishOffThreadBaselineCompile(jit::BaselineCompileTask* task,
+                                        const AutoLockHelperThreadState& lock) {
+  AutoEnterOOMUnsafeRegion oomUnsafe;
+  if (!HelperThreadState().baselineFinishedList(lock).append(task)) {
+    oomUnsafe.crash("FinishOffThreadBaselineCompile");
+  }
+  task->runtimeFromAnyThread()
+      ->jitRuntime()
+      ->numFinishedBaselineTasksRef(lock)++;
+}
+
 static JSRuntime* GetSelectorRuntime(const CompilationSelector& selector) {
   struct Matcher {
     JSRuntime* operator()(JSScript* script) {
@@ -363,6 +401,74 @@ static bool IonCompileTaskMatches(const CompilationSelector& selector,
   return selector.match(TaskMatches{task});
 }
 
+static bool BaselineCompileTaskMatches(const CompilationSelector& selector,
+                                       jit::BaselineCompileTask* task) {
+  struct TaskMatches {
+    jit::BaselineCompileTask* task_;
+
+    bool operator()(JSScript* script) { return task_->hasScript(script); }
+    bool operator()(Realm* realm) { return realm == task_->realm(); }
+    bool operator()(Zone* zone) { return zone == task_->zoneFromAnyThread(); }
+    bool operator()(JSRuntime* runtime) {
+      return runtime == task_->runtimeFromAnyThread();
+    }
+    bool operator()(ZonesInState zbs) {
+      return zbs.runtime == task_->runtimeFromAnyThread() &&
+             zbs.state == task_->zoneFromAnyThread()->gcState();
+    }
+  };
+
+  return selector.match(TaskMatches{task});
+}
+
+static void CancelOffThreadBaselineCompileLocked(
+    const CompilationSelector& selector, AutoLockHelperThreadState& lock) {
+  /* Cancel any pending entries for which processing hasn't started. */
+  GlobalHelperThreadState::BaselineCompileTaskVector& worklist =
+      HelperThreadState().baselineWorklist(lock);
+  for (size_t i = 0; i < worklist.length(); i++) {
+    jit::BaselineCompileTask* task = worklist[i];
+    if (BaselineCompileTaskMatches(selector, task)) {
+      js_delete(task);
+      HelperThreadState().remove(worklist, &i);
+    }
+  }
+
+  /* Wait for in progress entries to finish up. */
+  bool cancelled;
+  do {
+    cancelled = false;
+    for (auto* helper : HelperThreadState().helperTasks(lock)) {
+      if (!helper->is<jit::BaselineCompileTask>()) {
+        continue;
+      }
+
+      jit::BaselineCompileTask* task = helper->as<jit::BaselineCompileTask>();
+      if (BaselineCompileTaskMatches(selector, task)) {
+        task->cancel();
+        cancelled = true;
+      }
+    }
+    if (cancelled) {
+      HelperThreadState().wait(lock);
+    }
+  } while (cancelled);
+
+  /* Discard the code of any completed entries. */
+  GlobalHelperThreadState::BaselineCompileTaskVector& finished =
+      HelperThreadState().baselineFinishedList(lock);
+  for (size_t i = 0; i < finished.length(); i++) {
+    jit::BaselineCompileTask* task = finished[i];
+    if (BaselineCompileTaskMatches(selector, task)) {
+      task->runtimeFromAnyThread()
+          ->jitRuntime()
+          ->numFinishedBaselineTasksRef(lock)--;
+      js_delete(task);
+      HelperThreadState().remove(finished, &i);
+    }
+  }
+}
+
 static void CancelOffThreadIonCompileLocked(const CompilationSelector& selector,
                                             AutoLockHelperThreadState& lock) {
   if (!HelperThreadState().isInitialized(lock)) {
@@ -380,6 +486,7 @@ static void CancelOffThreadIonCompileLocked(const CompilationSelector& selector,
       // allocated in the LifoAlloc so we need the LifoAlloc to be mutable.
       worklist[i]->alloc().lifoAlloc()->setReadWrite();
 
+      task->script()->runtimeFromAnyThread()->decPendingOffThreadIonCompiles();
       FinishOffThreadIonCompile(task, lock);
       HelperThreadState().remove(worklist, &i);
     }
@@ -429,6 +536,8 @@ static void CancelOffThreadIonCompileLocked(const CompilationSelector& selector,
     }
     task = next;
   }
+
+  CancelOffThreadBaselineCompileLocked(selector, lock);
 }
 
 void js::CancelOffThreadIonCompile(const CompilationSelector& selector) {
@@ -440,6 +549,13 @@ void js::CancelOffThreadIonCompile(const CompilationSelector& selector) {
   CancelOffThreadIonCompileLocked(selector, lock);
 }
 
+size_t js::PendingOffThreadIonCompileCount(JSRuntime* rt) {
+  // This is called for every Ion compilation attempt, so it reads a counter
+  // kept up to date as tasks enter and leave the worklist instead of taking
+  // the lock and scanning it.
+  return rt->numPendingOffThreadIonCompiles();
+}
+
 #ifdef DEBUG
 bool js::HasOffThreadIonCompile(Realm* realm) {
   AutoLockHelperThreadState lock;
@@ -644,23 +760,26 @@ void ParseTask::scheduleDelazifyTask(AutoLockHelperThreadState& lock) {
     return;
   }
 
-  UniquePtr<DelazifyTask> task;
-  {
-    AutoSetHelperThreadContext usesContext(contextOptions, lock);
-    AutoUnlockHelperThreadState unlock(lock);
-    JSContext* cx = TlsContext.get();
-    AutoSetContextRuntime ascr(runtime);
-
-    task =
-        DelazifyTask::Create(cx, runtime, contextOptions, options, *stencil_);
-    if (!task) {
-      return;
+  uint32_t count = DelazifyTask::NumPartitions(*stencil_);
+  for (uint32_t i = 0; i < count; i++) {
+    UniquePtr<DelazifyTask> task;
+    {
+      AutoSetHelperThreadContext usesContext(contextOptions, lock);
+      AutoUnlockHelperThreadState unlock(lock);
+      JSContext* cx = TlsContext.get();
+      AutoSetContextRuntime ascr(runtime);
+
+      task = DelazifyTask::Create(cx, runtime, contextOptions, options,
+                                  *stencil_, DelazifyPartition{i, count});
+      if (!task) {
+        return;
+      }
     }
-  }
 
-  // Schedule delazification task if there is any function to delazify.
-  if (!task->strategy->done()) {
-    HelperThreadState().submitTask(task.release(), lock);
+    // Schedule delazification task if there is any function to delazify.
+    if (!task->strategy->done()) {
+      HelperThreadState().submitTask(task.release(), lock);
+    }
   }
 }
 
@@ -872,22 +991,45 @@ void js::StartOffThreadDelazification(
   AutoAssertNoPendingException aanpe(cx);
 
   JSRuntime* runtime = cx->runtime();
-  UniquePtr<DelazifyTask> task;
-  task = DelazifyTask::Create(cx, runtime, cx->options(), options, stencil);
-  if (!task) {
-    return;
-  }
+  uint32_t count = DelazifyTask::NumPartitions(stencil);
+  for (uint32_t i = 0; i < count; i++) {
+    UniquePtr<DelazifyTask> task;
+    task = DelazifyTask::Create(cx, runtime, cx->options(), options, stencil,
+                                DelazifyPartition{i, count});
+    if (!task) {
+      return;
+    }
 
-  // Schedule delazification task if there is any function to delazify.
-  if (!task->strategy->done()) {
-    AutoLockHelperThreadState lock;
-    HelperThreadState().submitTask(task.release(), lock);
+    // Schedule delazification task if there is any function to delazify.
+    if (!task->strategy->done()) {
+      AutoLockHelperThreadState lock;
+      HelperThreadState().submitTask(task.release(), lock);
+    }
   }
 }
 
 bool DelazifyStrategy::add(ErrorContext* ec,
                            const frontend::CompilationStencil& stencil,
                            ScriptIndex index) {
+  // Inner functions of delazified functions all belong to the partition of
+  // their enclosing function.
+  uint32_t rank = 0;
+  return add(ec, stencil, index, DelazifyPartition(), &rank);
+}
+
+bool DelazifyStrategy::add(ErrorContext* ec,
+                           const frontend::CompilationStencil& stencil,
+                           ScriptIndex index,
+                           const DelazifyPartition& partition) {
+  uint32_t rank = 0;
+  return add(ec, stencil, index, partition, &rank);
+}
+
+bool DelazifyStrategy::add(ErrorContext* ec,
+                           const frontend::CompilationStencil& stencil,
+                           ScriptIndex index,
+                           const DelazifyPartition& partition,
+                           uint32_t* rank) {
   using namespace js::frontend;
   ScriptStencilRef scriptRef{stencil, index};
 
@@ -915,12 +1057,17 @@ bool DelazifyStrategy::add(ErrorContext* ec,
     if (innerScriptRef.scriptData().hasSharedData()) {
       // The top-level parse decided to eagerly parse this function, thus we
       // should visit its inner function the same way.
-      if (!add(ec, stencil, innerScriptIndex)) {
+      if (!add(ec, stencil, innerScriptIndex, partition, rank)) {
         return false;
       }
       continue;
     }
 
+    // Leave functions of other partitions to their own DelazifyTask.
+    if (!partition.contains((*rank)++)) {
+      continue;
+    }
+
     // Maybe insert the new script index in the queue of functions to delazify.
     if (!insert(innerScriptIndex, innerScriptRef)) {
       ReportOutOfMemory(ec);
@@ -1003,7 +1150,8 @@ bool LargeFirstDelazification::insert(ScriptIndex index,
 UniquePtr<DelazifyTask> DelazifyTask::Create(
     JSContext* cx, JSRuntime* runtime, const JS::ContextOptions& contextOptions,
     const JS::ReadOnlyCompileOptions& options,
-    const frontend::CompilationStencil& stencil) {
+    const frontend::CompilationStencil& stencil,
+    const DelazifyPartition& partition) {
   UniquePtr<DelazifyTask> task;
   task.reset(js_new<DelazifyTask>(runtime, contextOptions));
   if (!task) {
@@ -1011,10 +1159,12 @@ UniquePtr<DelazifyTask> DelazifyTask::Create(
   }
 
   AutoSetContextOffThreadFrontendErrors recordErrors(&task->ec_);
-  RefPtr<ScriptSource> source(stencil.source);
-  StencilCache& cache = runtime->caches().delazificationCache;
-  if (!cache.startCaching(std::move(source))) {
-    return nullptr;
+  if (partition.index == 0) {
+    RefPtr<ScriptSource> source(stencil.source);
+    StencilCache& cache = runtime->caches().delazificationCache;
+    if (!cache.startCaching(std::move(source))) {
+      return nullptr;
+    }
   }
 
   // Clone the extensible stencil to be used for eager delazification.
@@ -1026,7 +1176,7 @@ UniquePtr<DelazifyTask> DelazifyTask::Create(
     return nullptr;
   }
 
-  if (!task->init(options, std::move(initial))) {
+  if (!task->init(options, std::move(initial), partition)) {
     // In case of errors, skip this and delazify on-demand.
     return nullptr;
   }
@@ -1034,6 +1184,16 @@ UniquePtr<DelazifyTask> DelazifyTask::Create(
   return task;
 }
 
+/* static */
+uint32_t DelazifyTask::NumPartitions(
+    const frontend::CompilationStencil& stencil) {
+  size_t count = std::min<size_t>(
+      {size_t(DelazifyPartition::MaxCount),
+       HelperThreadState().maxParseThreads(),
+       stencil.scriptData.size() / DelazifyPartition::MinScriptsPerPartition});
+  return std::max<uint32_t>(count, 1);
+}
+
 DelazifyTask::DelazifyTask(JSRuntime* runtime,
                            const JS::ContextOptions& options)
     : runtime(runtime), contextOptions(options), merger() {
@@ -1048,7 +1208,8 @@ DelazifyTask::~DelazifyTask() {
 
 bool DelazifyTask::init(
     const JS::ReadOnlyCompileOptions& options,
-    UniquePtr<frontend::ExtensibleCompilationStencil>&& initial) {
+    UniquePtr<frontend::ExtensibleCompilationStencil>&& initial,
+    const DelazifyPartition& partition) {
   using namespace js::frontend;
   if (!merger.setInitial(&ec_, std::move(initial))) {
     return false;
@@ -1085,7 +1246,7 @@ bool DelazifyTask::init(
   // Queue functions from the top-level to be delazify.
   BorrowingCompilationStencil borrow(merger.getResult());
   ScriptIndex topLevel{0};
-  return strategy->add(&ec_, borrow, topLevel);
+  return strategy->add(&ec_, borrow, topLevel, partition);
 }
 
 size_t DelazifyTask::sizeOfExcludingThis(
@@ -1763,6 +1924,7 @@ void GlobalHelperThreadState::waitForAllTasksLocked(
   MOZ_ASSERT(parseWorklist(lock).empty());
   MOZ_ASSERT(compressionWorklist(lock).empty());
   MOZ_ASSERT(ionFreeList(lock).empty());
+  MOZ_ASSERT(baselineWorklist(lock).empty());
   MOZ_ASSERT(wasmWorklist(lock, wasm::CompileMode::Tier2).empty());
   MOZ_ASSERT(wasmTier2GeneratorWorklist(lock).empty());
   MOZ_ASSERT(!tasksPending_);
@@ -1866,6 +2028,8 @@ void GlobalHelperThreadState::addSizeOfIncludingThis(
       ionWorklist_.sizeOfExcludingThis(mallocSizeOf) +
       ionFinishedList_.sizeOfExcludingThis(mallocSizeOf) +
       ionFreeList_.sizeOfExcludingThis(mallocSizeOf) +
+      baselineWorklist_.sizeOfExcludingThis(mallocSizeOf) +
+      baselineFinishedList_.sizeOfExcludingThis(mallocSizeOf) +
       wasmWorklist_tier1_.sizeOfExcludingThis(mallocSizeOf) +
       wasmWorklist_tier2_.sizeOfExcludingThis(mallocSizeOf) +
       wasmTier2GeneratorWorklist_.sizeOfExcludingThis(mallocSizeOf) +
@@ -1899,6 +2063,14 @@ void GlobalHelperThreadState::addSizeOfIncludingThis(
         task->compileTask()->sizeOfExcludingThis(mallocSizeOf);
   }
 
+  // Report BaselineCompileTasks on wait lists
+  for (auto task : baselineWorklist_) {
+    htStats.baselineCompileTask += task->sizeOfExcludingThis(mallocSizeOf);
+  }
+  for (auto task : baselineFinishedList_) {
+    htStats.baselineCompileTask += task->sizeOfExcludingThis(mallocSizeOf);
+  }
+
   // Report wasm::CompileTasks on wait lists
   for (auto task : wasmWorklist_tier1_) {
     htStats.wasmCompile += task->sizeOfExcludingThis(mallocSizeOf);
@@ -1940,6 +2112,17 @@ size_t GlobalHelperThreadState::maxWasmCompilationThreads() const {
   return std::min(cpuCount, threadCount);
 }
 
+size_t GlobalHelperThreadState::maxWasmTier2CompilationThreads() const {
+  // Tier2 compilation happens in the background while tier1 code is already
+  // running, so we need to allow other things to happen too. We do not allow
+  // all logical cores to be used for background work; instead we wish to use
+  // a fraction of the physical cores.  We can't directly compute the physical
+  // cores from the logical cores, but 1/3 of the logical cores is a safe
+  // estimate for the number of physical cores available for background work.
+  size_t physCoresAvailable = size_t(ceil(cpuCount / 3.0));
+  return std::min(physCoresAvailable, maxWasmCompilationThreads());
+}
+
 size_t GlobalHelperThreadState::maxWasmTier2GeneratorThreads() const {
   return MaxTier2GeneratorTasks;
 }
@@ -2026,14 +2209,8 @@ bool GlobalHelperThreadState::canStartWasmCompile(
   // For Tier1 and Once compilation, honor the maximum allowed threads to
   // compile wasm jobs at once, to avoid oversaturating the machine.
   //
-  // For Tier2 compilation we need to allow other things to happen too, so we
-  // do not allow all logical cores to be used for background work; instead we
-  // wish to use a fraction of the physical cores.  We can't directly compute
-  // the physical cores from the logical cores, but 1/3 of the logical cores
-  // is a safe estimate for the number of physical cores available for
-  // background work.
-
-  size_t physCoresAvailable = size_t(ceil(cpuCount / 3.0));
+  // For Tier2 compilation only use a fraction of the available cores, see
+  // maxWasmTier2CompilationThreads.
 
   size_t threads;
   ThreadType threadType;
@@ -2041,7 +2218,7 @@ bool GlobalHelperThreadState::canStartWasmCompile(
     if (tier2oversubscribed) {
       threads = maxWasmCompilationThreads();
     } else {
-      threads = physCoresAvailable;
+      threads = maxWasmTier2CompilationThreads();
     }
     threadType = THREAD_TYPE_WASM_COMPILE_TIER2;
   } else {
@@ -2149,6 +2326,25 @@ bool GlobalHelperThreadState::canStartIonFreeTask(
   return !ionFreeList(lock).empty();
 }
 
+HelperThreadTask* GlobalHelperThreadState::maybeGetBaselineCompileTask(
+    const AutoLockHelperThreadState& lock) {
+  if (!canStartBaselineCompileTask(lock)) {
+    return nullptr;
+  }
+
+  // Compile batches in the order they were queued.
+  jit::BaselineCompileTask* task = baselineWorklist(lock)[0];
+  baselineWorklist(lock).erase(baselineWorklist(lock).begin());
+  return task;
+}
+
+bool GlobalHelperThreadState::canStartBaselineCompileTask(
+    const AutoLockHelperThreadState& lock) {
+  return !baselineWorklist(lock).empty() &&
+         checkTaskThreadLimit(THREAD_TYPE_BASELINE, maxIonCompilationThreads(),
+                              lock);
+}
+
 jit::IonCompileTask* GlobalHelperThreadState::highestPriorityPendingIonCompile(
     const AutoLockHelperThreadState& lock, bool checkExecutionStatus) {
   auto& worklist = ionWorklist(lock);
@@ -2172,6 +2368,7 @@ jit::IonCompileTask* GlobalHelperThreadState::highestPriorityPendingIonCompile(
   }
   jit::IonCompileTask* task = worklist[index];
   worklist.erase(&worklist[index]);
+  task->script()->runtimeFromAnyThread()->decPendingOffThreadIonCompiles();
   return task;
 }
 
@@ -2663,9 +2860,18 @@ void GlobalHelperThreadState::trace(JSTracer* trc) {
   for (auto* helper : HelperThreadState().helperTasks(lock)) {
     if (helper->is<jit::IonCompileTask>()) {
       helper->as<jit::IonCompileTask>()->trace(trc);
+    } else if (helper->is<jit::BaselineCompileTask>()) {
+      helper->as<jit::BaselineCompileTask>()->trace(trc);
     }
   }
 
+  for (auto task : baselineWorklist(lock)) {
+    task->trace(trc);
+  }
+  for (auto task : baselineFinishedList(lock)) {
+    task->trace(trc);
+  }
+
   JSRuntime* rt = trc->runtime();
   if (auto* jitRuntime = rt->jitRuntime()) {
     jit::IonCompileTask* task = jitRuntime->ionLazyLinkList(rt).getFirst();
@@ -2688,6 +2894,7 @@ void GlobalHelperThreadState::trace(JSTracer* trc) {
 // Priority is determined by the order they're listed here.
 const GlobalHelperThreadState::Selector GlobalHelperThreadState::selectors[] = {
     &GlobalHelperThreadState::maybeGetGCParallelTask,
+    &GlobalHelperThreadState::maybeGetBaselineCompileTask,
     &GlobalHelperThreadState::maybeGetIonCompileTask,
     &GlobalHelperThreadState::maybeGetWasmTier1CompileTask,
     &GlobalHelperThreadState::maybeGetPromiseHelperTask,
@@ -2702,7 +2909,8 @@ const GlobalHelperThreadState::Selector GlobalHelperThreadState::selectors[] = {
 
 bool GlobalHelperThreadState::canStartTasks(
     const AutoLockHelperThreadState& lock) {
-  return canStartGCParallelTask(lock) || canStartIonCompileTask(lock) ||
+  return canStartGCParallelTask(lock) || canStartBaselineCompileTask(lock) ||
+         canStartIonCompileTask(lock) ||
          canStartWasmTier1CompileTask(lock) ||
          canStartPromiseHelperTask(lock) || canStartParseTask(lock) ||
          canStartFreeDelazifyTask(lock) || canStartDelazifyTask(lock) ||
@@ -49,6 +49,7 @@ class GCRuntime;
 }
 
 namespace jit {
+class BaselineCompileTask;
 class IonCompileTask;
 class IonFreeTask;
 }  // namespace jit
@@ -93,6 +94,7 @@ bool EnsureHelperThreadsInitialized();
 size_t GetHelperThreadCount();
 size_t GetHelperThreadCPUCount();
 size_t GetMaxWasmCompilationThreads();
+size_t GetMaxWasmTier2CompilationThreads();
 
 // This allows the JS shell to override GetCPUCount() when passed the
 // --thread-count=N option.
@@ -151,6 +153,15 @@ bool StartOffThreadIonFree(jit::IonCompileTask* task,
 void FinishOffThreadIonCompile(jit::IonCompileTask* task,
                                const AutoLockHelperThreadState& lock);
 
+/*
+ * Schedule an off-thread Baseline compilation for a batch of scripts.
+ */
+bool StartOffThreadBaselineCompile(jit::BaselineCompileTask* task,
+                                   const AutoLockHelperThreadState& lock);
+
+void FinishOffThreadBaselineCompile(jit::BaselineCompileTask* task,
+                                    const AutoLockHelperThreadState& lock);
+
 struct ZonesInState {
   JSRuntime* runtime;
   JS::shadow::Zone::GCState state;
@@ -160,7 +171,7 @@ using CompilationSelector = mozilla::Variant<JSScript*, JS::Realm*, JS::Zone*,
                                              ZonesInState, JSRuntime*>;
 
 /*
- * Cancel scheduled or in progress Ion compilations.
+ * Cancel scheduled or in progress Ion and Baseline compilations.
  */
 void CancelOffThreadIonCompile(const CompilationSelector& selector);
 
@@ -189,6 +200,12 @@ inline void CancelOffThreadIonCompile(JSRuntime* runtime) {
 bool HasOffThreadIonCompile(JS::Realm* realm);
 #endif
 
+/*
+ * Return the number of Ion compilations for scripts in |rt| that are waiting
+ * for a helper thread.
+ */
+size_t PendingOffThreadIonCompileCount(JSRuntime* rt);
+
 // True iff the current thread is a ParseTask or a DelazifyTask.
 bool CurrentThreadIsParseThread();
 
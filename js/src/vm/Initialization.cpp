@@ -29,6 +29,7 @@
 #include "vm/ArrayBufferObject.h"
 #include "vm/DateTime.h"
 #include "vm/HelperThreads.h"
+#include "vm/RegExpCodeCache.h"
 #include "vm/Runtime.h"
 #include "vm/Time.h"
 #ifdef MOZ_VTUNE
@@ -175,6 +176,8 @@ JS_PUBLIC_API const char* JS::detail::InitWithFailureDiagnostic(
 
   RETURN_IF_FAIL(js::InitDateTimeState());
 
+  RETURN_IF_FAIL(js::InitRegExpCodeCache());
+
 #ifdef MOZ_VTUNE
   RETURN_IF_FAIL(js::vtune::Initialize());
 #endif
@@ -284,6 +287,8 @@ JS_PUBLIC_API void JS_ShutDown(void) {
 
   js::FinishDateTimeState();
 
+  js::FinishRegExpCodeCache();
+
   js::jit::ShutdownJit();
 
   MOZ_ASSERT_IF(!JSRuntime::hasLiveRuntimes(), !js::LiveMappedBufferCount());
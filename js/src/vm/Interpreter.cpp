@@ -2017,6 +2017,23 @@ static MOZ_NEVER_INLINE JS_HAZ_JSNATIVE_CALLER bool Interpret(JSContext* cx,
    */
 #define END_CASE(OP) ADVANCE_AND_DISPATCH(JSOpLength_##OP);
 
+  /*
+   * Same as END_CASE, but branch directly to the case for NEXT if it is the
+   * following op. This turns frequent pairs of ops into superinstructions:
+   * the direct branch is much easier to predict than the indirect dispatch.
+   * Or'ing in activation.opMask() makes sure we still go through
+   * EnableInterruptsPseudoOpcode when interrupts are enabled.
+   */
+#define END_CASE_FUSED(OP, NEXT)                                   \
+  JS_BEGIN_MACRO                                                   \
+    REGS.pc += JSOpLength_##OP;                                    \
+    SANITY_CHECKS();                                               \
+    if ((*REGS.pc | activation.opMask()) == uint8_t(JSOp::NEXT)) { \
+      goto label_##NEXT;                                           \
+    }                                                              \
+    DISPATCH_TO(*REGS.pc | activation.opMask());                   \
+  JS_END_MACRO;
+
   /*
    * Prepare to call a user-supplied branch handler, and abort the script
    * if it returns false.
@@ -2667,6 +2684,8 @@ static MOZ_NEVER_INLINE JS_HAZ_JSNATIVE_CALLER bool Interpret(JSContext* cx,
       if (!LooseEqualityOp<true>(cx, REGS)) {
         goto error;
       }
+      bool cond = REGS.sp[-1].toBoolean();
+      TRY_BRANCH_AFTER_COND(cond, 1);
     }
     END_CASE(Eq)
 
@@ -2674,6 +2693,8 @@ static MOZ_NEVER_INLINE JS_HAZ_JSNATIVE_CALLER bool Interpret(JSContext* cx,
       if (!LooseEqualityOp<false>(cx, REGS)) {
         goto error;
       }
+      bool cond = REGS.sp[-1].toBoolean();
+      TRY_BRANCH_AFTER_COND(cond, 1);
     }
     END_CASE(Ne)
 
@@ -2692,6 +2713,7 @@ static MOZ_NEVER_INLINE JS_HAZ_JSNATIVE_CALLER bool Interpret(JSContext* cx,
     CASE(StrictEq) {
       bool cond;
       STRICT_EQUALITY_OP(==, cond);
+      TRY_BRANCH_AFTER_COND(cond, 1);
       REGS.sp[-1].setBoolean(cond);
     }
     END_CASE(StrictEq)
@@ -2699,6 +2721,7 @@ static MOZ_NEVER_INLINE JS_HAZ_JSNATIVE_CALLER bool Interpret(JSContext* cx,
     CASE(StrictNe) {
       bool cond;
       STRICT_EQUALITY_OP(!=, cond);
+      TRY_BRANCH_AFTER_COND(cond, 1);
       REGS.sp[-1].setBoolean(cond);
     }
     END_CASE(StrictNe)
@@ -3753,7 +3776,7 @@ static MOZ_NEVER_INLINE JS_HAZ_JSNATIVE_CALLER bool Interpret(JSContext* cx,
         PUSH_COPY(REGS.fp()->unaliasedFormal(i));
       }
     }
-    END_CASE(GetArg)
+    END_CASE_FUSED(GetArg, GetProp)
 
     CASE(SetArg) {
       unsigned i = GET_ARGNO(REGS.pc);
@@ -3787,7 +3810,7 @@ static MOZ_NEVER_INLINE JS_HAZ_JSNATIVE_CALLER bool Interpret(JSContext* cx,
       }
 #endif
     }
-    END_CASE(GetLocal)
+    END_CASE_FUSED(GetLocal, GetProp)
 
     CASE(SetLocal) {
       uint32_t i = GET_LOCALNO(REGS.pc);
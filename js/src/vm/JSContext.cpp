@@ -30,6 +30,7 @@
 #include "jsexn.h"
 #include "jstypes.h"
 
+#include "builtin/Promise.h"
 #include "gc/GC.h"
 #include "irregexp/RegExpAPI.h"
 #include "jit/Simulator.h"
@@ -784,7 +785,14 @@ JSObject* InternalJobQueue::copyJobs(JSContext* cx) {
 
   for (const JSObject* unwrappedJob : queue.get()) {
     RootedObject job(cx, const_cast<JSObject*>(unwrappedJob));
-    if (!cx->compartment()->wrap(cx, &job)) {
+    if (IsPromiseReactionRecord(job)) {
+      // Hand out a job function instead of the internal reaction record, see
+      // EnqueuePromiseReactionJob.
+      job = NewPromiseReactionJobFunction(cx, job);
+      if (!job) {
+        return nullptr;
+      }
+    } else if (!cx->compartment()->wrap(cx, &job)) {
       return nullptr;
     }
 
@@ -875,9 +883,17 @@ void InternalJobQueue::runJobs(JSContext* cx) {
         JS::JobQueueIsEmpty(cx);
       }
 
-      AutoRealm ar(cx, &job->as<JSFunction>());
+      // Same-realm promise reaction jobs are enqueued as their reaction
+      // record, see EnqueuePromiseReactionJob.
+      bool isReaction = IsPromiseReactionRecord(job);
+      MOZ_ASSERT_IF(!isReaction, job->is<JSFunction>());
+
+      AutoRealm ar(cx, job);
       {
-        if (!JS::Call(cx, UndefinedHandleValue, job, args, &rval)) {
+        bool ok = isReaction
+                      ? RunPromiseReactionJob(cx, job)
+                      : JS::Call(cx, UndefinedHandleValue, job, args, &rval);
+        if (!ok) {
           // Nothing we can do about uncatchable exceptions.
           if (!cx->isExceptionPending()) {
             continue;
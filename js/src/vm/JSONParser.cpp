@@ -8,6 +8,7 @@
 
 #include "mozilla/Range.h"
 #include "mozilla/RangedPtr.h"
+#include "mozilla/SIMD.h"
 #include "mozilla/Sprintf.h"
 #include "mozilla/TextUtils.h"
 
@@ -101,6 +102,23 @@ bool JSONParserBase::errorReturn() {
   return parseType == ParseType::AttemptForEval;
 }
 
+// Return a pointer to the first character in [ptr, end) which cannot be part of
+// a sequence of unescaped string characters, i.e. a quote, a backslash or a
+// control character, or |end| if there is no such character.
+static inline const Latin1Char* FindStringSpecialChar(const Latin1Char* ptr,
+                                                      const Latin1Char* end) {
+  const char* result = mozilla::SIMD::memchr2OrBelow8(
+      reinterpret_cast<const char*>(ptr), '"', '\\', 0x20, end - ptr);
+  return result ? reinterpret_cast<const Latin1Char*>(result) : end;
+}
+
+static inline const char16_t* FindStringSpecialChar(const char16_t* ptr,
+                                                    const char16_t* end) {
+  const char16_t* result =
+      mozilla::SIMD::memchr2OrBelow16(ptr, '"', '\\', 0x20, end - ptr);
+  return result ? result : end;
+}
+
 template <typename CharT>
 template <JSONParserBase::StringType ST>
 JSONParserBase::Token JSONParser<CharT>::readString() {
@@ -122,7 +140,8 @@ JSONParserBase::Token JSONParser<CharT>::readString() {
    * string directly from the source text.
    */
   CharPtr start = current;
-  for (; current < end; current++) {
+  current += FindStringSpecialChar(current.get(), end.get()) - current.get();
+  if (current < end) {
     if (*current == '"') {
       size_t length = current - start;
       current++;
@@ -136,14 +155,12 @@ JSONParserBase::Token JSONParser<CharT>::readString() {
       return stringToken(str);
     }
 
-    if (*current == '\\') {
-      break;
-    }
-
     if (*current <= 0x001F) {
       error("bad control character in string literal");
       return token(Error);
     }
+
+    MOZ_ASSERT(*current == '\\');
   }
 
   /*
@@ -246,11 +263,7 @@ JSONParserBase::Token JSONParser<CharT>::readString() {
     }
 
     start = current;
-    for (; current < end; current++) {
-      if (*current == '"' || *current == '\\' || *current <= 0x001F) {
-        break;
-      }
-    }
+    current += FindStringSpecialChar(current.get(), end.get()) - current.get();
   } while (current < end);
 
   error("unterminated string");
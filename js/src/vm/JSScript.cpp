@@ -72,6 +72,7 @@
 #include "vm/Printer.h"  // js::GenericPrinter, js::Fprinter, js::Sprinter, js::QuoteString
 #include "vm/Scope.h"  // Scope
 #include "vm/SharedImmutableStringsCache.h"
+#include "vm/StencilCache.h"  // js::StencilCache
 #include "vm/StencilEnums.h"  // TryNote, TryNoteKind, ScopeNote
 #include "vm/StringType.h"    // JSString, JSAtom
 #include "vm/Time.h"          // AutoIncrementalTimer
@@ -1790,6 +1791,29 @@ bool ScriptSource::xdrFinalizeEncoder(JSContext* cx,
 
   auto cleanup = mozilla::MakeScopeExit([&] { xdrEncoder_.reset(); });
 
+  // Functions delazified off-thread are only added to the encoder once they
+  // are instantiated. Add the ones which are still only in the delazification
+  // cache, so that they do not have to be delazified again when the encoded
+  // stencil is decoded.
+  {
+    Vector<RefPtr<frontend::CompilationStencil>, 0, SystemAllocPolicy>
+        delazifications;
+    {
+      StencilCache& cache = cx->runtime()->caches().delazificationCache;
+      auto guard = cache.isSourceCached(this);
+      if (guard && !cache.getAllForSource(guard, this, delazifications)) {
+        ReportOutOfMemory(cx);
+        return false;
+      }
+    }
+
+    for (const auto& delazification : delazifications) {
+      if (!xdrEncoder_.addDelazification(cx, *delazification)) {
+        return false;
+      }
+    }
+  }
+
   AutoReportFrontendContext ec(cx);
   XDRStencilEncoder encoder(cx, &ec, buffer);
 
@@ -24,6 +24,7 @@
 #include "vm/JSScript.h"
 #include "vm/PropMap.h"
 #include "vm/Realm.h"
+#include "vm/RegExpCodeCache.h"
 #include "vm/Runtime.h"
 #include "vm/Shape.h"
 #include "vm/StringType.h"
@@ -746,6 +747,8 @@ JS_PUBLIC_API bool JS::CollectGlobalStats(GlobalStats* gStats) {
     HelperThreadState().addSizeOfIncludingThis(gStats, lock);
   }
 
+  gStats->regExpCodeCache = SizeOfRegExpCodeCache(gStats->mallocSizeOf_);
+
   return true;
 }
 
@@ -323,7 +323,8 @@ static bool ModuleResolveExport(JSContext* cx, Handle<ModuleObject*> module,
                                 MutableHandle<ResolveSet> resolveSet,
                                 MutableHandle<Value> result);
 static ModuleNamespaceObject* ModuleNamespaceCreate(
-    JSContext* cx, Handle<ModuleObject*> module, Handle<ArrayObject*> exports);
+    JSContext* cx, Handle<ModuleObject*> module, Handle<ArrayObject*> exports,
+    Handle<ArrayObject*> bindings);
 static bool InnerModuleLinking(JSContext* cx, Handle<ModuleObject*> module,
                                MutableHandle<ModuleVector> stack, size_t index,
                                size_t* indexOut);
@@ -748,6 +749,13 @@ ModuleNamespaceObject* js::GetOrCreateModuleNamespace(
       return nullptr;
     }
 
+    // The resolved binding for each element of unambiguousNames, so that
+    // ModuleNamespaceCreate doesn't have to resolve every export again.
+    Rooted<ArrayObject*> bindings(cx, NewList(cx));
+    if (!bindings) {
+      return nullptr;
+    }
+
     // Step 3.c. For each element name of exportedNames, do:
     Rooted<JSAtom*> name(cx);
     Rooted<Value> resolution(cx);
@@ -762,14 +770,15 @@ ModuleNamespaceObject* js::GetOrCreateModuleNamespace(
       // Step 3.c.ii. If resolution is a ResolvedBinding Record, append name to
       //              unambiguousNames.
       if (resolution.isObject() &&
-          !NewbornArrayPush(cx, unambiguousNames, StringValue(name))) {
+          (!NewbornArrayPush(cx, unambiguousNames, StringValue(name)) ||
+           !NewbornArrayPush(cx, bindings, resolution))) {
         return nullptr;
       }
     }
 
     // Step 3.d. Set namespace to ModuleNamespaceCreate(module,
     //           unambiguousNames).
-    ns = ModuleNamespaceCreate(cx, module, unambiguousNames);
+    ns = ModuleNamespaceCreate(cx, module, unambiguousNames, bindings);
   }
 
   // Step 4. Return namespace.
@@ -797,9 +806,11 @@ static void InitNamespaceBinding(JSContext* cx,
 // https://tc39.es/ecma262/#sec-modulenamespacecreate
 // ES2023 10.4.6.12 ModuleNamespaceCreate
 static ModuleNamespaceObject* ModuleNamespaceCreate(
-    JSContext* cx, Handle<ModuleObject*> module, Handle<ArrayObject*> exports) {
+    JSContext* cx, Handle<ModuleObject*> module, Handle<ArrayObject*> exports,
+    Handle<ArrayObject*> bindings) {
   // Step 1. Assert: module.[[Namespace]] is empty.
   MOZ_ASSERT(!module->namespace_());
+  MOZ_ASSERT(bindings->length() == exports->length());
 
   // Steps 2 - 5.
   Rooted<ModuleNamespaceObject*> ns(
@@ -808,32 +819,22 @@ static ModuleNamespaceObject* ModuleNamespaceCreate(
     return nullptr;
   }
 
-  // Step 6. Let sortedExports be a List whose elements are the elements of
-  //         exports ordered as if an Array of the same values had been sorted
-  //         using %Array.prototype.sort% using undefined as comparefn.
-  if (!ArrayNativeSort(cx, exports)) {
-    return nullptr;
-  }
-
-  // Pre-compute all binding mappings now instead of on each access.
+  // Pre-compute all binding mappings now instead of on each access. This uses
+  // the resolutions the caller already computed, so it must happen before
+  // exports is sorted below.
   // See:
   // https://tc39.es/ecma262/#sec-module-namespace-exotic-objects-get-p-receiver
   // ES2023 10.4.6.8 Module Namespace Exotic Object [[Get]]
   Rooted<JSAtom*> name(cx);
-  Rooted<Value> resolution(cx);
   Rooted<ResolvedBindingObject*> binding(cx);
   Rooted<ModuleObject*> importedModule(cx);
   Rooted<ModuleNamespaceObject*> importedNamespace(cx);
   Rooted<JSAtom*> bindingName(cx);
   for (uint32_t i = 0; i != exports->length(); i++) {
     name = &exports->getDenseElement(i).toString()->asAtom();
-
-    if (!ModuleResolveExport(cx, module, name, &resolution)) {
-      return nullptr;
-    }
-
-    MOZ_ASSERT(IsResolvedBinding(cx, resolution));
-    binding = &resolution.toObject().as<ResolvedBindingObject>();
+    binding = &bindings->getDenseElement(i)
+                   .toObject()
+                   .as<ResolvedBindingObject>();
     importedModule = binding->module();
     bindingName = binding->bindingName();
 
@@ -856,6 +857,13 @@ static ModuleNamespaceObject* ModuleNamespaceCreate(
     }
   }
 
+  // Step 6. Let sortedExports be a List whose elements are the elements of
+  //         exports ordered as if an Array of the same values had been sorted
+  //         using %Array.prototype.sort% using undefined as comparefn.
+  if (!ArrayNativeSort(cx, exports)) {
+    return nullptr;
+  }
+
   // Step 10. Return M.
   return ns;
 }
@@ -42,6 +42,7 @@
   _(PerfSpewer, 500)                  \
   _(CacheIRSpewer, 500)               \
   _(DateTimeInfoMutex, 500)           \
+  _(RegExpCodeCache, 500)             \
   _(ProcessExecutableRegion, 500)     \
   _(BufferStreamState, 500)           \
   _(SharedArrayGrow, 500)             \
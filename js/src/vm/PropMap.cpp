@@ -929,7 +929,12 @@ uint32_t PropMap::approximateEntryCount() const {
 }
 
 bool PropMapTable::init(JSContext* cx, LinkedPropMap* map) {
-  if (!set_.reserve(map->approximateEntryCount())) {
+  uint32_t count = map->approximateEntryCount();
+  uint32_t capacityLog2 = MinCapacityLog2;
+  while (overloaded(count, 1u << capacityLog2)) {
+    capacityLog2++;
+  }
+  if (!rehash(capacityLog2)) {
     ReportOutOfMemory(cx);
     return false;
   }
@@ -939,7 +944,7 @@ bool PropMapTable::init(JSContext* cx, LinkedPropMap* map) {
     for (uint32_t i = 0; i < PropMap::Capacity; i++) {
       if (curMap->hasKey(i)) {
         PropertyKey key = curMap->getKey(i);
-        set_.putNewInfallible(key, PropMapAndIndex(curMap, i));
+        putNewInfallible(key, PropMapAndIndex(curMap, i));
       }
     }
     if (!curMap->hasPrevious()) {
@@ -951,30 +956,139 @@ bool PropMapTable::init(JSContext* cx, LinkedPropMap* map) {
   return true;
 }
 
+bool PropMapTable::rehash(uint32_t newCapacityLog2) {
+  MOZ_ASSERT(newCapacityLog2 >= MinCapacityLog2);
+  if (newCapacityLog2 > MaxCapacityLog2) {
+    return false;
+  }
+
+  size_t newCapacity = size_t(1) << newCapacityLog2;
+  MOZ_ASSERT(!overloaded(entryCount_, newCapacity));
+
+  static_assert(alignof(PropMapAndIndex) >= alignof(uint8_t));
+  size_t nbytes = newCapacity * (sizeof(PropMapAndIndex) + sizeof(uint8_t));
+  uint8_t* storage = js_pod_calloc<uint8_t>(nbytes);
+  if (!storage) {
+    return false;
+  }
+
+  PropMapAndIndex* oldEntries = entries_;
+  uint8_t* oldTags = tags_;
+  uint32_t oldCapacity = capacity();
+
+  // calloc'ed memory has the right initial state: FreeTag is zero, and so is
+  // an empty PropMapAndIndex.
+  static_assert(FreeTag == 0);
+  entries_ = reinterpret_cast<PropMapAndIndex*>(storage);
+  tags_ = storage + newCapacity * sizeof(PropMapAndIndex);
+  capacityLog2_ = newCapacityLog2;
+  entryCount_ = 0;
+  removedCount_ = 0;
+
+  for (uint32_t i = 0; i < oldCapacity; i++) {
+    if (oldTags[i] >= MinLiveTag) {
+      PropMapAndIndex entry = oldEntries[i];
+      putNewInfallible(entry.map()->getKey(entry.index()), entry);
+    }
+  }
+
+  js_free(oldEntries);
+  return true;
+}
+
+void PropMapTable::putNewInfallible(PropertyKey key, PropMapAndIndex entry) {
+  MOZ_ASSERT(!lookupRaw(key));
+  MOZ_ASSERT(!overloaded(entryCount_ + removedCount_ + 1, capacity()));
+
+  HashNumber hash = Hasher::hash(key);
+  uint32_t mask = capacity() - 1;
+  uint32_t i = indexForHash(hash);
+  while (tags_[i] >= MinLiveTag) {
+    i = (i + 1) & mask;
+  }
+
+  if (tags_[i] == RemovedTag) {
+    removedCount_--;
+  }
+  tags_[i] = tagForHash(hash);
+  entries_[i] = entry;
+  entryCount_++;
+}
+
+bool PropMapTable::add(JSContext* cx, PropertyKey key, PropMapAndIndex entry) {
+  if (overloaded(entryCount_ + removedCount_ + 1, capacity())) {
+    // Rehash in place if many buckets are taken by removed entries, else grow
+    // the table.
+    uint32_t newCapacityLog2 = removedCount_ >= capacity() / 4
+                                   ? capacityLog2_
+                                   : capacityLog2_ + 1;
+    if (!rehash(newCapacityLog2)) {
+      ReportOutOfMemory(cx);
+      return false;
+    }
+  }
+
+  putNewInfallible(key, entry);
+  setCacheEntry(key, entry);
+  return true;
+}
+
+void PropMapTable::remove(Ptr ptr) {
+  MOZ_ASSERT(ptr.found());
+
+  uint32_t i = ptr.entry_ - entries_;
+  MOZ_ASSERT(tags_[i] >= MinLiveTag);
+
+  // If the next bucket is free no lookup can probe past this bucket, so it can
+  // be marked free too.
+  uint32_t next = (i + 1) & (capacity() - 1);
+  if (tags_[next] == FreeTag) {
+    tags_[i] = FreeTag;
+  } else {
+    tags_[i] = RemovedTag;
+    removedCount_++;
+  }
+  entries_[i] = PropMapAndIndex();
+  entryCount_--;
+
+  purgeCache();
+
+  // Shrink the table if it is mostly empty. This is optional, so ignore OOM.
+  if (capacityLog2_ > MinCapacityLog2 && entryCount_ < capacity() / 8) {
+    (void)rehash(capacityLog2_ - 1);
+  }
+}
+
 void PropMapTable::trace(JSTracer* trc) {
   purgeCache();
 
-  for (Set::Enum e(set_); !e.empty(); e.popFront()) {
-    PropMap* map = e.front().map();
+  for (uint32_t i = 0; i < capacity(); i++) {
+    if (tags_[i] < MinLiveTag) {
+      continue;
+    }
+    PropMap* map = entries_[i].map();
     TraceManuallyBarrieredEdge(trc, &map, "PropMapTable map");
-    if (map != e.front().map()) {
-      e.mutableFront() = PropMapAndIndex(map, e.front().index());
+    if (map != entries_[i].map()) {
+      entries_[i] = PropMapAndIndex(map, entries_[i].index());
     }
   }
 }
 
 #ifdef JSGC_HASH_TABLE_CHECKS
 void PropMapTable::checkAfterMovingGC() {
-  for (Set::Enum e(set_); !e.empty(); e.popFront()) {
-    PropMap* map = e.front().map();
+  for (uint32_t i = 0; i < capacity(); i++) {
+    if (tags_[i] < MinLiveTag) {
+      continue;
+    }
+    PropMap* map = entries_[i].map();
     MOZ_ASSERT(map);
     CheckGCThingAfterMovingGC(map);
 
-    PropertyKey key = map->getKey(e.front().index());
+    PropertyKey key = map->getKey(entries_[i].index());
     MOZ_RELEASE_ASSERT(!key.isVoid());
 
     auto p = lookupRaw(key);
-    MOZ_RELEASE_ASSERT(p.found() && *p == e.front());
+    MOZ_RELEASE_ASSERT(p.found() && *p == entries_[i]);
   }
 }
 #endif
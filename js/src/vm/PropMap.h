@@ -7,6 +7,8 @@
 #ifndef vm_PropMap_h
 #define vm_PropMap_h
 
+#include "mozilla/HashFunctions.h"
+
 #include "gc/Barrier.h"
 #include "gc/Cell.h"
 #include "js/TypeDecls.h"
@@ -300,6 +302,14 @@ class MOZ_RAII AutoKeepPropMapTables {
 
 // Hash table to optimize property lookups on larger maps. This maps from
 // PropertyKey to PropMapAndIndex.
+//
+// Objects used as hash maps can have many thousands of properties, so the
+// table is kept compact: it's open-addressed with linear probing and each
+// bucket only stores a PropMapAndIndex, the key itself is stored in the map.
+// A one-byte tag per bucket holds some bits of the key's hash, so that most
+// mismatches are rejected without loading the key from the map. This uses 9
+// bytes per bucket on 64-bit platforms (a HashSet needs 12) and allows a
+// higher maximum load factor.
 class PropMapTable {
   struct Hasher {
     using Key = PropMapAndIndex;
@@ -309,7 +319,7 @@ class PropMapTable {
   };
 
   // Small lookup cache. This has a hit rate of 30-60% on most workloads and is
-  // a lot faster than the full HashSet lookup.
+  // a lot faster than the full table lookup.
   struct CacheEntry {
     PropertyKey key;
     PropMapAndIndex result;
@@ -317,8 +327,44 @@ class PropMapTable {
   static constexpr uint32_t NumCacheEntries = 2;
   CacheEntry cacheEntries_[NumCacheEntries];
 
-  using Set = HashSet<PropMapAndIndex, Hasher, SystemAllocPolicy>;
-  Set set_;
+  // Bucket tags. Buckets holding an entry have a tag >= MinLiveTag computed
+  // from the key's hash.
+  static constexpr uint8_t FreeTag = 0;
+  static constexpr uint8_t RemovedTag = 1;
+  static constexpr uint8_t MinLiveTag = 2;
+
+  static constexpr uint32_t MinCapacityLog2 = 4;
+  static constexpr uint32_t MaxCapacityLog2 = 30;
+
+  // The entries and tags arrays are stored in a single allocation, which is
+  // owned by |entries_|. Both have |1 << capacityLog2_| elements.
+  PropMapAndIndex* entries_ = nullptr;
+  uint8_t* tags_ = nullptr;
+  uint32_t capacityLog2_ = 0;
+
+  uint32_t entryCount_ = 0;
+  uint32_t removedCount_ = 0;
+
+  static uint8_t tagForHash(HashNumber hash) {
+    uint8_t tag = hash >> 24;
+    return tag < MinLiveTag ? tag + MinLiveTag : tag;
+  }
+  uint32_t indexForHash(HashNumber hash) const {
+    return mozilla::ScrambleHashCode(hash) >> (32 - capacityLog2_);
+  }
+  uint32_t capacity() const { return capacityLog2_ ? 1u << capacityLog2_ : 0; }
+
+  // Whether |used| live or removed buckets exceed the maximum load factor of
+  // 7/8. This ensures there's always a free bucket to end lookups.
+  static bool overloaded(uint32_t used, uint32_t capacity) {
+    return used > capacity - capacity / 8;
+  }
+
+  // Replace the storage with an empty table with |1 << newCapacityLog2|
+  // buckets and add all entries again. Returns false on OOM, without
+  // reporting it.
+  [[nodiscard]] bool rehash(uint32_t newCapacityLog2);
+  void putNewInfallible(PropertyKey key, PropMapAndIndex entry);
 
   void setCacheEntry(PropertyKey key, PropMapAndIndex entry) {
     for (uint32_t i = 0; i < NumCacheEntries; i++) {
@@ -341,7 +387,32 @@ class PropMapTable {
     }
     return false;
   }
-  void addToCache(PropertyKey key, Set::Ptr p) {
+
+ public:
+  class Ptr {
+    friend class PropMapTable;
+    PropMapAndIndex* entry_ = nullptr;
+
+    explicit Ptr(PropMapAndIndex* entry) : entry_(entry) {}
+
+   public:
+    Ptr() = default;
+
+    bool found() const { return entry_ != nullptr; }
+    explicit operator bool() const { return found(); }
+
+    PropMapAndIndex operator*() const {
+      MOZ_ASSERT(found());
+      return *entry_;
+    }
+    const PropMapAndIndex* operator->() const {
+      MOZ_ASSERT(found());
+      return entry_;
+    }
+  };
+
+ private:
+  void addToCache(PropertyKey key, Ptr p) {
     for (uint32_t i = NumCacheEntries - 1; i > 0; i--) {
       cacheEntries_[i] = cacheEntries_[i - 1];
       MOZ_ASSERT(cacheEntries_[i].key != key);
@@ -351,17 +422,18 @@ class PropMapTable {
   }
 
  public:
-  using Ptr = Set::Ptr;
-
   PropMapTable() = default;
-  ~PropMapTable() = default;
+  ~PropMapTable() { js_free(entries_); }
+
+  PropMapTable(const PropMapTable&) = delete;
+  void operator=(const PropMapTable&) = delete;
 
-  uint32_t entryCount() const { return set_.count(); }
+  uint32_t entryCount() const { return entryCount_; }
 
   // This counts the PropMapTable object itself (which must be heap-allocated)
-  // and its HashSet.
+  // and its storage.
   size_t sizeOfIncludingThis(mozilla::MallocSizeOf mallocSizeOf) const {
-    return mallocSizeOf(this) + set_.shallowSizeOfExcludingThis(mallocSizeOf);
+    return mallocSizeOf(this) + mallocSizeOf(entries_);
   }
 
   // init() is fallible and reports OOM to the context.
@@ -370,16 +442,9 @@ class PropMapTable {
   MOZ_ALWAYS_INLINE PropMap* lookup(PropMap* map, uint32_t mapLength,
                                     PropertyKey key, uint32_t* index);
 
-  Set::Ptr lookupRaw(PropertyKey key) const { return set_.lookup(key); }
+  MOZ_ALWAYS_INLINE Ptr lookupRaw(PropertyKey key) const;
 
-  bool add(JSContext* cx, PropertyKey key, PropMapAndIndex entry) {
-    if (!set_.putNew(key, entry)) {
-      ReportOutOfMemory(cx);
-      return false;
-    }
-    setCacheEntry(key, entry);
-    return true;
-  }
+  bool add(JSContext* cx, PropertyKey key, PropMapAndIndex entry);
 
   void purgeCache() {
     for (uint32_t i = 0; i < NumCacheEntries; i++) {
@@ -387,14 +452,12 @@ class PropMapTable {
     }
   }
 
-  void remove(Ptr ptr) {
-    set_.remove(ptr);
-    purgeCache();
-  }
+  void remove(Ptr ptr);
 
   void replaceEntry(Ptr ptr, PropertyKey key, PropMapAndIndex newEntry) {
     MOZ_ASSERT(*ptr != newEntry);
-    set_.replaceKey(ptr, key, newEntry);
+    MOZ_ASSERT(newEntry.map()->getKey(newEntry.index()) == key);
+    *ptr.entry_ = newEntry;
     setCacheEntry(key, newEntry);
   }
 
@@ -1106,6 +1169,25 @@ MOZ_ALWAYS_INLINE bool PropMapTable::Hasher::match(PropMapAndIndex entry,
   return entry.map()->getKey(entry.index()) == key;
 }
 
+MOZ_ALWAYS_INLINE PropMapTable::Ptr PropMapTable::lookupRaw(
+    PropertyKey key) const {
+  if (entryCount_ == 0) {
+    return Ptr();
+  }
+
+  HashNumber hash = Hasher::hash(key);
+  uint8_t tag = tagForHash(hash);
+  uint32_t mask = capacity() - 1;
+  for (uint32_t i = indexForHash(hash);; i = (i + 1) & mask) {
+    if (tags_[i] == tag && Hasher::match(entries_[i], key)) {
+      return Ptr(&entries_[i]);
+    }
+    if (tags_[i] == FreeTag) {
+      return Ptr();
+    }
+  }
+}
+
 // Hash policy for SharedPropMap children.
 struct SharedChildrenHasher {
   using Key = SharedPropMapAndIndex;
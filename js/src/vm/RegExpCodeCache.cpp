@@ -0,0 +1,272 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+ * vim: set ts=8 sts=2 et sw=2 tw=80:
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "vm/RegExpCodeCache.h"
+
+#include "mozilla/HashFunctions.h"
+#include "mozilla/PodOperations.h"
+#include "mozilla/UniquePtr.h"
+
+#include "gc/ZoneAllocator.h"
+#include "js/HashTable.h"
+#include "js/RegExpFlags.h"  // JS::RegExpFlags
+#include "js/Utility.h"
+#include "threading/ExclusiveData.h"
+#include "util/Text.h"
+#include "vm/MutexIDs.h"
+#include "vm/RegExpShared.h"
+#include "vm/StringType.h"
+
+#include "vm/StringType-inl.h"
+
+using namespace js;
+
+using mozilla::AddToHash;
+using mozilla::UniquePtr;
+
+namespace {
+
+// Regexps with larger bytecode are not cached.
+const size_t MaxEntryByteCodeSize = 64 * 1024;
+
+// When the cache grows past this size it is simply flushed.
+const size_t MaxCacheSize = 2 * 1024 * 1024;
+
+struct CachedByteCode {
+  HashNumber hash;
+  UniqueTwoByteChars source;
+  size_t sourceLength;
+  JS::RegExpFlags flags;
+  bool latin1;
+
+  // The ByteArrayData header, immediately followed by the bytecode.
+  UniquePtr<uint8_t[], JS::FreePolicy> byteCode;
+  size_t byteCodeSize;
+
+  uint32_t pairCount;
+  uint32_t maxRegisters;
+
+  size_t sizeOfIncludingThis() const {
+    return sizeof(*this) + sourceLength * sizeof(char16_t) + byteCodeSize;
+  }
+
+  size_t sizeOfIncludingThis(mozilla::MallocSizeOf mallocSizeOf) const {
+    return mallocSizeOf(this) + mallocSizeOf(source.get()) +
+           mallocSizeOf(byteCode.get());
+  }
+
+  struct Lookup {
+    JSAtom* source;
+    JS::RegExpFlags flags;
+    bool latin1;
+    HashNumber hash;
+
+    Lookup(JSAtom* source, JS::RegExpFlags flags, bool latin1)
+        : source(source),
+          flags(flags),
+          latin1(latin1),
+          hash(AddToHash(source->hash(), flags.value(), latin1)) {}
+  };
+
+  struct Hasher {
+    using Lookup = CachedByteCode::Lookup;
+
+    static HashNumber hash(const Lookup& l) { return l.hash; }
+
+    static bool match(const UniquePtr<CachedByteCode>& entry,
+                      const Lookup& l) {
+      if (entry->hash != l.hash || entry->flags != l.flags ||
+          entry->latin1 != l.latin1 ||
+          entry->sourceLength != l.source->length()) {
+        return false;
+      }
+
+      JS::AutoCheckCannotGC nogc;
+      return l.source->hasLatin1Chars()
+                 ? EqualChars(entry->source.get(),
+                              l.source->latin1Chars(nogc), entry->sourceLength)
+                 : EqualChars(entry->source.get(),
+                              l.source->twoByteChars(nogc),
+                              entry->sourceLength);
+    }
+  };
+};
+
+class RegExpCodeCache {
+  using EntrySet = HashSet<UniquePtr<CachedByteCode>, CachedByteCode::Hasher,
+                           SystemAllocPolicy>;
+
+  EntrySet entries_;
+  size_t size_ = 0;
+  size_t hitCount_ = 0;
+
+ public:
+  const CachedByteCode* lookup(const CachedByteCode::Lookup& l) {
+    auto p = entries_.lookup(l);
+    if (!p) {
+      return nullptr;
+    }
+    hitCount_++;
+    return p->get();
+  }
+
+  bool has(const CachedByteCode::Lookup& l) const {
+    return entries_.has(l);
+  }
+
+  void add(const CachedByteCode::Lookup& l,
+           UniquePtr<CachedByteCode> entry) {
+    size_t entrySize = entry->sizeOfIncludingThis();
+    if (size_ + entrySize > MaxCacheSize) {
+      clear();
+    }
+    if (entries_.putNew(l, std::move(entry))) {
+      size_ += entrySize;
+    }
+  }
+
+  void clear() {
+    entries_.clearAndCompact();
+    size_ = 0;
+  }
+
+  size_t hitCount() const { return hitCount_; }
+
+  size_t sizeOfExcludingThis(mozilla::MallocSizeOf mallocSizeOf) const {
+    size_t size = entries_.shallowSizeOfExcludingThis(mallocSizeOf);
+    for (auto r = entries_.all(); !r.empty(); r.popFront()) {
+      size += r.front()->sizeOfIncludingThis(mallocSizeOf);
+    }
+    return size;
+  }
+};
+
+}  // namespace
+
+static ExclusiveData<RegExpCodeCache>* gRegExpCodeCache = nullptr;
+
+bool js::InitRegExpCodeCache() {
+  MOZ_ASSERT(!gRegExpCodeCache, "we should be initializing only once");
+
+  gRegExpCodeCache =
+      js_new<ExclusiveData<RegExpCodeCache>>(mutexid::RegExpCodeCache);
+  return !!gRegExpCodeCache;
+}
+
+void js::FinishRegExpCodeCache() {
+  js_delete(gRegExpCodeCache);
+  gRegExpCodeCache = nullptr;
+}
+
+bool js::TakeCachedRegExpByteCode(RegExpShared* re, bool latin1) {
+  MOZ_ASSERT(!re->isCompiled(latin1, RegExpShared::CodeKind::Bytecode));
+  MOZ_ASSERT(re->kind() != RegExpShared::Kind::Atom);
+
+  CachedByteCode::Lookup l(re->getSource(), re->getFlags(), latin1);
+
+  uint8_t* byteCode;
+  uint32_t pairCount;
+  uint32_t maxRegisters;
+  {
+    auto cache = gRegExpCodeCache->lock();
+    const CachedByteCode* entry = cache->lookup(l);
+    if (!entry) {
+      return false;
+    }
+
+    byteCode = js_pod_malloc<uint8_t>(entry->byteCodeSize);
+    if (!byteCode) {
+      return false;
+    }
+    mozilla::PodCopy(byteCode, entry->byteCode.get(), entry->byteCodeSize);
+    pairCount = entry->pairCount;
+    maxRegisters = entry->maxRegisters;
+  }
+
+  if (re->kind() == RegExpShared::Kind::Unparsed) {
+    // The source already parsed successfully with these flags, and it didn't
+    // turn out to be a simple atom.
+    re->useRegExpMatch(pairCount);
+  }
+  MOZ_ASSERT(re->pairCount() == pairCount);
+
+  auto* code = reinterpret_cast<RegExpShared::ByteCode*>(byteCode);
+  re->updateMaxRegisters(maxRegisters);
+  re->setByteCode(code, latin1);
+  AddCellMemory(re, code->length, MemoryUse::RegExpSharedBytecode);
+  return true;
+}
+
+void js::AddCachedRegExpByteCode(RegExpShared* re, bool latin1) {
+  MOZ_ASSERT(re->kind() == RegExpShared::Kind::RegExp);
+
+  if (re->numNamedCaptures() != 0) {
+    return;
+  }
+
+  RegExpShared::ByteCode* code = re->getByteCode(latin1);
+  MOZ_ASSERT(code);
+
+  size_t byteCodeSize = sizeof(RegExpShared::ByteCode) + code->length;
+  if (byteCodeSize > MaxEntryByteCodeSize) {
+    return;
+  }
+
+  JSAtom* source = re->getSource();
+  CachedByteCode::Lookup l(source, re->getFlags(), latin1);
+
+  // Entries are built outside the lock, so another thread may add the same
+  // regexp in the meantime.
+  if (gRegExpCodeCache->lock()->has(l)) {
+    return;
+  }
+
+  auto entry = js::MakeUnique<CachedByteCode>();
+  if (!entry) {
+    return;
+  }
+
+  size_t sourceLength = source->length();
+  entry->source.reset(js_pod_malloc<char16_t>(sourceLength));
+  if (!entry->source) {
+    return;
+  }
+  CopyChars(entry->source.get(), *source);
+
+  entry->byteCode.reset(js_pod_malloc<uint8_t>(byteCodeSize));
+  if (!entry->byteCode) {
+    return;
+  }
+  mozilla::PodCopy(entry->byteCode.get(), reinterpret_cast<uint8_t*>(code),
+                   byteCodeSize);
+
+  entry->hash = l.hash;
+  entry->sourceLength = sourceLength;
+  entry->flags = re->getFlags();
+  entry->latin1 = latin1;
+  entry->byteCodeSize = byteCodeSize;
+  entry->pairCount = re->pairCount();
+  entry->maxRegisters = re->getMaxRegisters();
+
+  auto cache = gRegExpCodeCache->lock();
+  if (!cache->has(l)) {
+    cache->add(l, std::move(entry));
+  }
+}
+
+void js::PurgeRegExpCodeCache() { gRegExpCodeCache->lock()->clear(); }
+
+size_t js::SizeOfRegExpCodeCache(mozilla::MallocSizeOf mallocSizeOf) {
+  if (!gRegExpCodeCache) {
+    return 0;
+  }
+  return mallocSizeOf(gRegExpCodeCache) +
+         gRegExpCodeCache->lock()->sizeOfExcludingThis(mallocSizeOf);
+}
+
+size_t js::RegExpCodeCacheHitCount() {
+  return gRegExpCodeCache->lock()->hitCount();
+}
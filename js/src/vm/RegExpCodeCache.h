@@ -0,0 +1,55 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+ * vim: set ts=8 sts=2 et sw=2 tw=80:
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef vm_RegExpCodeCache_h
+#define vm_RegExpCodeCache_h
+
+#include "mozilla/MemoryReporting.h"
+
+#include <stddef.h>
+
+namespace js {
+
+class RegExpShared;
+
+/*
+ * Process-wide cache of irregexp bytecode, keyed by the regexp source, its
+ * flags and the kind of the input characters.
+ *
+ * RegExpShared instances live in a single zone, so the same library regexps
+ * would otherwise be compiled again in every zone which uses them. The
+ * interpreter bytecode doesn't contain any pointers, so it can be copied into
+ * a RegExpShared of any zone or runtime. Native code is still compiled per
+ * zone when the regexp tiers up.
+ *
+ * Regexps with named capture groups are not cached, because their groups
+ * template object has to be created by the parser.
+ */
+
+[[nodiscard]] bool InitRegExpCodeCache();
+void FinishRegExpCodeCache();
+
+// Install a copy of the cached bytecode for |re| and the given kind of input
+// characters. Returns false if there is no such bytecode, or if we ran out of
+// memory copying it, in which case the regexp must be compiled.
+bool TakeCachedRegExpByteCode(RegExpShared* re, bool latin1);
+
+// Add the bytecode of |re| which was just compiled for the given kind of input
+// characters to the cache. Failures are ignored.
+void AddCachedRegExpByteCode(RegExpShared* re, bool latin1);
+
+// Discard all cached bytecode.
+void PurgeRegExpCodeCache();
+
+// Memory used by the cache and its entries.
+size_t SizeOfRegExpCodeCache(mozilla::MallocSizeOf mallocSizeOf);
+
+// Number of successful lookups so far, for testing.
+size_t RegExpCodeCacheHitCount();
+
+} /* namespace js */
+
+#endif /* vm_RegExpCodeCache_h */
@@ -25,6 +25,7 @@
 #include "vm/ErrorContext.h"  // AutoReportFrontendContext
 #include "vm/MatchPairs.h"
 #include "vm/PlainObject.h"
+#include "vm/RegExpCodeCache.h"
 #include "vm/RegExpStatics.h"
 #include "vm/StringType.h"
 #include "vm/WellKnownAtom.h"  // js_*_str
@@ -615,8 +616,25 @@ bool RegExpShared::compileIfNecessary(JSContext* cx,
       needsCompile = true;
     }
   }
-  if (needsCompile) {
-    return irregexp::CompilePattern(cx, re, input, codeKind);
+  if (!needsCompile) {
+    return true;
+  }
+
+  // Bytecode doesn't depend on the zone, so try the process-wide cache before
+  // compiling it ourselves.
+  bool latin1 = input->hasLatin1Chars();
+  if (codeKind == RegExpShared::CodeKind::Bytecode &&
+      TakeCachedRegExpByteCode(re, latin1)) {
+    return true;
+  }
+
+  if (!irregexp::CompilePattern(cx, re, input, codeKind)) {
+    return false;
+  }
+
+  if (codeKind == RegExpShared::CodeKind::Bytecode &&
+      re->kind() == RegExpShared::Kind::RegExp) {
+    AddCachedRegExpByteCode(re, latin1);
   }
   return true;
 }
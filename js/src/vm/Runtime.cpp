@@ -23,6 +23,7 @@
 #include "frontend/CompilationStencil.h"
 #include "gc/GC.h"
 #include "gc/PublicIterators.h"
+#include "jit/BaselineCompileTask.h"
 #include "jit/IonCompileTask.h"
 #include "jit/JitRuntime.h"
 #include "jit/Simulator.h"
@@ -114,6 +115,7 @@ JSRuntime::JSRuntime(JSRuntime* parentRuntime)
       activeThreadHasScriptDataAccess(false),
 #endif
       numParseTasks(0),
+      numPendingOffThreadIonCompiles_(0),
       numRealms(0),
       numDebuggeeRealms_(0),
       numDebuggeeRealmsObservingCoverage_(0),
@@ -143,6 +145,7 @@ JSRuntime::JSRuntime(JSRuntime* parentRuntime)
       offthreadIonCompilationEnabled_(true),
       parallelParsingEnabled_(true),
       autoWritableJitCodeActive_(false),
+      autoWritableJitCodeBatch_(nullptr),
       oomCallback(nullptr),
       debuggerMallocSizeOf(ReturnZeroSize),
       stackFormat_(parentRuntime ? js::StackFormat::Default
@@ -378,8 +381,9 @@ static bool HandleInterrupt(JSContext* cx, bool invokeCallback) {
   cx->runtime()->gc.gcIfRequested();
 
   // A worker thread may have requested an interrupt after finishing an Ion
-  // compilation.
+  // or Baseline compilation.
   jit::AttachFinishedCompilations(cx);
+  jit::AttachFinishedBaselineCompilations(cx);
 
   // Don't call the interrupt callback if we only interrupted for GC or Ion.
   if (!invokeCallback) {
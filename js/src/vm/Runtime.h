@@ -94,6 +94,7 @@ class Shape;
 class SourceHook;
 
 namespace jit {
+class AutoWritableJitCodeBatch;
 class JitRuntime;
 class JitActivation;
 struct PcScriptCache;
@@ -612,6 +613,11 @@ struct JSRuntime {
   // protect access to the bytecode table;
   mozilla::Atomic<size_t, mozilla::SequentiallyConsistent> numParseTasks;
 
+  // Number of off-thread Ion compilations for this runtime which are waiting
+  // in the helper thread worklist. Only updated with the helper thread lock
+  // held, but can be read without it.
+  mozilla::Atomic<size_t, mozilla::Relaxed> numPendingOffThreadIonCompiles_;
+
   friend class js::AutoLockScriptData;
 
  public:
@@ -620,6 +626,15 @@ struct JSRuntime {
   void addParseTaskRef() { numParseTasks++; }
   void decParseTaskRef() { numParseTasks--; }
 
+  size_t numPendingOffThreadIonCompiles() const {
+    return numPendingOffThreadIonCompiles_;
+  }
+  void incPendingOffThreadIonCompiles() { numPendingOffThreadIonCompiles_++; }
+  void decPendingOffThreadIonCompiles() {
+    MOZ_ASSERT(numPendingOffThreadIonCompiles_ > 0);
+    numPendingOffThreadIonCompiles_--;
+  }
+
 #ifdef DEBUG
   void assertCurrentThreadHasScriptDataAccess() const {
     if (!hasParseTasks()) {
@@ -978,6 +993,8 @@ struct JSRuntime {
       parallelParsingEnabled_;
 
   js::MainThreadData<bool> autoWritableJitCodeActive_;
+  js::MainThreadData<js::jit::AutoWritableJitCodeBatch*>
+      autoWritableJitCodeBatch_;
 
  public:
   // Note: these values may be toggled dynamically (in response to about:config
@@ -999,6 +1016,13 @@ struct JSRuntime {
     autoWritableJitCodeActive_ = b;
   }
 
+  js::jit::AutoWritableJitCodeBatch* autoWritableJitCodeBatch() {
+    return autoWritableJitCodeBatch_;
+  }
+  void setAutoWritableJitCodeBatch(js::jit::AutoWritableJitCodeBatch* batch) {
+    autoWritableJitCodeBatch_ = batch;
+  }
+
   /* See comment for JS::SetOutOfMemoryCallback in js/MemoryCallbacks.h. */
   js::MainThreadData<JS::OutOfMemoryCallback> oomCallback;
   js::MainThreadData<void*> oomCallbackData;
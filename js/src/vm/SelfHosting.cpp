@@ -2423,6 +2423,12 @@ bool JSRuntime::initSelfHostingStencil(JSContext* cx,
   FillSelfHostingCompileOptions(options);
 
   // Try initializing from Stencil XDR.
+  //
+  // In Gecko the parent process serializes the stencil through |xdrWriter|
+  // and content processes receive it as read-only shared memory (see
+  // XPCSelfHostedShmem), so the decoded stencil borrows its data from memory
+  // shared by all processes. Functions are then instantiated from it lazily,
+  // see getSelfHostedValue and delazifySelfHostedFunction.
   bool decodeOk = false;
   AutoPrintSelfHostingFrontendContext ec(cx);
   if (xdrCache.Length() > 0) {
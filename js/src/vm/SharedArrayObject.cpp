@@ -185,6 +185,14 @@ bool SharedArrayRawBuffer::addReference() {
   }
 }
 
+bool SharedArrayRawBuffer::ensureWaiters() {
+  if (waiters_) {
+    return true;
+  }
+  waiters_.reset(js_pod_calloc<FutexWaiter*>(WaiterBuckets));
+  return !!waiters_;
+}
+
 void SharedArrayRawBuffer::dropReference() {
   // Normally if the refcount is zero then the memory will have been unmapped
   // and this test may just crash, but if the memory has been retained for any
@@ -12,6 +12,7 @@
 #include "jstypes.h"
 
 #include "gc/Memory.h"
+#include "js/UniquePtr.h"
 #include "vm/ArrayBufferObject.h"
 #include "wasm/WasmMemory.h"
 
@@ -59,9 +60,15 @@ class SharedArrayRawBuffer {
   mozilla::Atomic<uint32_t, mozilla::ReleaseAcquire> refcount_;
   mozilla::Atomic<size_t, mozilla::SequentiallyConsistent> length_;
 
-  // A list of structures representing tasks waiting on some
-  // location within this buffer.
-  FutexWaiter* waiters_ = nullptr;
+  // Lists of structures representing tasks waiting on some location within
+  // this buffer, hashed by byte offset into WaiterBuckets lists so notify only
+  // walks waiters that may be on its location. Allocated on the first wait.
+  static constexpr size_t WaiterBuckets = 64;
+  UniquePtr<FutexWaiter*[], JS::FreePolicy> waiters_;
+
+  static size_t waiterBucket(size_t byteOffset) {
+    return (byteOffset / sizeof(int32_t)) % WaiterBuckets;
+  }
 
  protected:
   SharedArrayRawBuffer(bool isWasm, uint8_t* buffer, size_t length)
@@ -76,11 +83,20 @@ class SharedArrayRawBuffer {
 
   // This may be called from multiple threads.  The caller must take
   // care of mutual exclusion.
-  FutexWaiter* waiters() const { return waiters_; }
+  [[nodiscard]] bool ensureWaiters();
 
   // This may be called from multiple threads.  The caller must take
   // care of mutual exclusion.
-  void setWaiters(FutexWaiter* waiters) { waiters_ = waiters; }
+  FutexWaiter* waiters(size_t byteOffset) const {
+    return waiters_ ? waiters_[waiterBucket(byteOffset)] : nullptr;
+  }
+
+  // This may be called from multiple threads.  The caller must take
+  // care of mutual exclusion.
+  void setWaiters(size_t byteOffset, FutexWaiter* waiters) {
+    MOZ_ASSERT(waiters_);
+    waiters_[waiterBucket(byteOffset)] = waiters;
+  }
 
   inline SharedMem<uint8_t*> dataPointerShared() const;
 
@@ -6,6 +6,8 @@
 
 #include "vm/StencilCache.h"
 
+#include <algorithm>  // std::sort
+
 #include "frontend/CompilationStencil.h"
 #include "js/experimental/JSStencil.h"
 #include "vm/MutexIDs.h"
@@ -57,6 +59,39 @@ bool js::StencilCache::putNew(AccessKey& guard, const StencilContext& key,
   return guard->functions.putNew(key, value);
 }
 
+bool js::StencilCache::getAllForSource(
+    AccessKey& guard, const ScriptSource* src,
+    Vector<RefPtr<frontend::CompilationStencil>, 0, SystemAllocPolicy>&
+        result) {
+  struct Entry {
+    SourceExtent::FunctionKey funKey;
+    frontend::CompilationStencil* stencil;
+  };
+  Vector<Entry, 0, SystemAllocPolicy> entries;
+  for (auto iter = guard->functions.iter(); !iter.done(); iter.next()) {
+    if (iter.get().key().source != src) {
+      continue;
+    }
+    if (!entries.append(Entry{iter.get().key().funKey, iter.get().value()})) {
+      return false;
+    }
+  }
+
+  // Hash table order is arbitrary. The function key is derived from the
+  // function's source start, and an enclosing function always starts before
+  // the functions nested in it, so this orders outer functions first.
+  std::sort(entries.begin(), entries.end(),
+            [](const Entry& a, const Entry& b) { return a.funKey < b.funKey; });
+
+  if (!result.reserve(result.length() + entries.length())) {
+    return false;
+  }
+  for (const Entry& entry : entries) {
+    result.infallibleAppend(entry.stencil);
+  }
+  return true;
+}
+
 // Important: This function should not be called within a scope checking for
 // isSourceCached, as this would cause a dead-lock.
 void js::StencilCache::clearAndDisable() {
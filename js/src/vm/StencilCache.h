@@ -12,6 +12,7 @@
 #include "mozilla/RefPtr.h"         // mozilla::RefPtr
 
 #include "js/HashTable.h"  // js::HashTable
+#include "js/Vector.h"     // js::Vector
 
 #include "threading/ExclusiveData.h"  // js::ExclusiveData
 
@@ -168,6 +169,17 @@ class StencilCache {
   [[nodiscard]] bool putNew(AccessKey& guard, const StencilContext& key,
                             frontend::CompilationStencil* value);
 
+  // Append all the stencils cached for the given source to |result|, ordered
+  // by source position so that enclosing functions come before the functions
+  // nested in them. This is used to include delazifications which have been
+  // computed off-thread, but not yet used, when finishing the incremental
+  // encoding of a source, such that the persisted bytecode does not have to be
+  // delazified again.
+  [[nodiscard]] bool getAllForSource(
+      AccessKey& guard, const ScriptSource* src,
+      Vector<RefPtr<frontend::CompilationStencil>, 0, SystemAllocPolicy>&
+          result);
+
   // Prevent any further stencil from being cached, and clear and reclaim the
   // memory of all stencil held by the cache.
   //
@@ -28,6 +28,7 @@
 
 #include "js/StructuredClone.h"
 
+#include "mozilla/Atomics.h"
 #include "mozilla/Casting.h"
 #include "mozilla/CheckedInt.h"
 #include "mozilla/EndianUtils.h"
@@ -72,6 +73,7 @@
 #include "vm/JSObject-inl.h"
 #include "vm/ObjectOperations-inl.h"
 #include "vm/Realm-inl.h"
+#include "vm/StringType-inl.h"
 
 using namespace js;
 
@@ -164,6 +166,10 @@ enum StructuredDataType : uint32_t {
   SCTAG_TRANSFER_MAP_STORED_ARRAY_BUFFER,
   SCTAG_TRANSFER_MAP_END_OF_BUILTIN_TYPES,
 
+  // Strings whose characters are shared with the writer. These only appear in
+  // same-process clones, so they don't need a persistent tag either.
+  SCTAG_SHARED_STRING,
+
   SCTAG_END_OF_BUILTIN_TYPES
 };
 
@@ -314,6 +320,125 @@ void SharedArrayRawBufferRefs::releaseAll() {
   refs_.clear();
 }
 
+SharedExternalStringRefs& SharedExternalStringRefs::operator=(
+    SharedExternalStringRefs&& other) {
+  releaseAll();
+  refs_ = std::move(other.refs_);
+  return *this;
+}
+
+SharedExternalStringRefs::~SharedExternalStringRefs() { releaseAll(); }
+
+bool SharedExternalStringRefs::adopt(JSContext* cx,
+                                     const JSExternalStringCallbacks* callbacks,
+                                     const char16_t* chars) {
+  if (!refs_.append(Ref{callbacks, chars})) {
+    callbacks->finalize(const_cast<char16_t*>(chars));
+    ReportOutOfMemory(cx);
+    return false;
+  }
+
+  return true;
+}
+
+bool SharedExternalStringRefs::acquireAll(
+    const SharedExternalStringRefs& that) {
+  if (!refs_.reserve(refs_.length() + that.refs_.length())) {
+    return false;
+  }
+
+  for (const Ref& ref : that.refs_) {
+    if (!ref.callbacks->addSharedReference(ref.chars)) {
+      return false;
+    }
+    refs_.infallibleAppend(ref);
+  }
+
+  return true;
+}
+
+void SharedExternalStringRefs::takeOwnership(
+    SharedExternalStringRefs&& other) {
+  MOZ_ASSERT(refs_.empty());
+  refs_ = std::move(other.refs_);
+}
+
+void SharedExternalStringRefs::releaseAll() {
+  for (const Ref& ref : refs_) {
+    ref.callbacks->finalize(const_cast<char16_t*>(ref.chars));
+  }
+  refs_.clear();
+}
+
+// Strings at least this long are shared rather than copied by same-process
+// clones.
+static const size_t SharedStringMinLength = 64 * 1024;
+
+// Immutable, reference counted characters for large strings which are sent to
+// other threads by same-process clones. The characters follow the header and
+// are used by external strings in every runtime which received them.
+class SharedStringChars {
+  mozilla::Atomic<size_t> refCount_;
+
+  SharedStringChars() : refCount_(1) {}
+
+ public:
+  static const char16_t* create(const char16_t* chars, size_t length) {
+    size_t nbytes = sizeof(SharedStringChars) + length * sizeof(char16_t);
+    void* mem = js_malloc(nbytes);
+    if (!mem) {
+      return nullptr;
+    }
+
+    auto* buffer = new (mem) SharedStringChars();
+    char16_t* data = buffer->chars();
+    std::copy_n(chars, length, data);
+    return data;
+  }
+
+  static SharedStringChars* fromChars(const char16_t* chars) {
+    return reinterpret_cast<SharedStringChars*>(
+               const_cast<char16_t*>(chars)) -
+           1;
+  }
+
+  char16_t* chars() { return reinterpret_cast<char16_t*>(this + 1); }
+
+  bool isShared() const { return refCount_ > 1; }
+
+  void addRef() { refCount_++; }
+
+  void release() {
+    MOZ_ASSERT(refCount_ != 0);
+    if (--refCount_ == 0) {
+      this->~SharedStringChars();
+      js_free(this);
+    }
+  }
+};
+
+static_assert(sizeof(SharedStringChars) % sizeof(char16_t) == 0);
+
+struct SharedStringCharsExternalString : public JSExternalStringCallbacks {
+  void finalize(char16_t* chars) const override {
+    SharedStringChars::fromChars(chars)->release();
+  }
+
+  size_t sizeOfBuffer(const char16_t* chars,
+                      mozilla::MallocSizeOf mallocSizeOf) const override {
+    // Only report the characters if no other string shares them.
+    SharedStringChars* buffer = SharedStringChars::fromChars(chars);
+    return buffer->isShared() ? 0 : mallocSizeOf(buffer);
+  }
+
+  bool addSharedReference(const char16_t* chars) const override {
+    SharedStringChars::fromChars(chars)->addRef();
+    return true;
+  }
+};
+
+static const SharedStringCharsExternalString SharedStringCharsCallbacks;
+
 // SCOutput provides an interface to write raw data -- eg uint64_ts, doubles,
 // arrays of bytes -- into a structured clone data output stream. It also knows
 // how to free any transferable data within that stream.
@@ -447,6 +572,7 @@ struct JSStructuredCloneReader {
   template <typename CharT>
   JSString* readStringImpl(uint32_t nchars, gc::InitialHeap heap);
   JSString* readString(uint32_t data, gc::InitialHeap heap = gc::DefaultHeap);
+  JSString* readSharedString(uint32_t length);
 
   BigInt* readBigInt(uint32_t data);
 
@@ -590,6 +716,7 @@ struct JSStructuredCloneWriter {
   bool writeTransferMap();
 
   bool writeString(uint32_t tag, JSString* str);
+  bool writeSharedString(JSLinearString* str, bool* shared);
   bool writeBigInt(uint32_t tag, BigInt* bi);
   bool writeArrayBuffer(HandleObject obj);
   bool writeTypedArray(HandleObject obj);
@@ -1023,6 +1150,19 @@ void SCOutput::discardTransferables() { buf.discardTransferables(); }
 
 JSStructuredCloneData::~JSStructuredCloneData() { discardTransferables(); }
 
+bool JSStructuredCloneData::Append(const JSStructuredCloneData& other) {
+  MOZ_ASSERT(scope() == other.scope());
+  if (!other.ForEachDataChunk([&](const char* data, size_t size) {
+        return AppendBytes(data, size);
+      })) {
+    return false;
+  }
+
+  // The appended data refers to the other buffer's shared strings, which must
+  // stay alive for as long as this buffer does.
+  return stringRefsHeld_.acquireAll(other.stringRefsHeld_);
+}
+
 // If the buffer contains Transferables, free them. Note that custom
 // Transferables will use the JSStructuredCloneCallbacks::freeTransfer() to
 // delete their transferables.
@@ -1279,6 +1419,55 @@ bool JSStructuredCloneWriter::writeString(uint32_t tag, JSString* str) {
              : out.writeChars(linear->twoByteChars(nogc), length);
 }
 
+// Write a pointer to the characters of a large two-byte string instead of the
+// characters themselves, if the clone stays in this process. External strings
+// whose embedder allows it are shared as they are; other strings are copied
+// once into a buffer which the reader shares.
+bool JSStructuredCloneWriter::writeSharedString(JSLinearString* str,
+                                                bool* shared) {
+  *shared = false;
+
+  if (output().scope() != JS::StructuredCloneScope::SameProcess ||
+      str->length() < SharedStringMinLength || str->hasLatin1Chars()) {
+    return true;
+  }
+
+  const JSExternalStringCallbacks* callbacks = nullptr;
+  const char16_t* chars = nullptr;
+  if (str->isExternal()) {
+    callbacks = str->asExternal().callbacks();
+    chars = str->asExternal().twoByteChars();
+    if (!callbacks->addSharedReference(chars)) {
+      callbacks = nullptr;
+    }
+  }
+
+  if (!callbacks) {
+    JS::AutoCheckCannotGC nogc;
+    chars = SharedStringChars::create(str->twoByteChars(nogc), str->length());
+    if (!chars) {
+      ReportOutOfMemory(context());
+      return false;
+    }
+    callbacks = &SharedStringCharsCallbacks;
+  }
+
+  if (!out.buf.stringRefsHeld_.adopt(context(), callbacks, chars)) {
+    return false;
+  }
+
+  intptr_t callbacksPtr = reinterpret_cast<intptr_t>(callbacks);
+  intptr_t charsPtr = reinterpret_cast<intptr_t>(chars);
+  if (!(out.writePair(SCTAG_SHARED_STRING, str->length()) &&
+        out.writeBytes(&callbacksPtr, sizeof(callbacksPtr)) &&
+        out.writeBytes(&charsPtr, sizeof(charsPtr)))) {
+    return false;
+  }
+
+  *shared = true;
+  return true;
+}
+
 bool JSStructuredCloneWriter::writeBigInt(uint32_t tag, BigInt* bi) {
   bool signBit = bi->isNegative();
   size_t length = bi->digitLength();
@@ -1979,6 +2168,15 @@ bool JSStructuredCloneWriter::writePrimitive(HandleValue v) {
   context()->check(v);
 
   if (v.isString()) {
+    if (v.toString()->isLinear()) {
+      bool shared;
+      if (!writeSharedString(&v.toString()->asLinear(), &shared)) {
+        return false;
+      }
+      if (shared) {
+        return true;
+      }
+    }
     return writeString(SCTAG_STRING, v.toString());
   } else if (v.isInt32()) {
     return out.writePair(SCTAG_INT32, v.toInt32());
@@ -2446,6 +2644,47 @@ JSString* JSStructuredCloneReader::readString(uint32_t data,
                 : readStringImpl<char16_t>(nchars, heap);
 }
 
+JSString* JSStructuredCloneReader::readSharedString(uint32_t length) {
+  // The clone holds pointers, so it must not have come from another process.
+  if (allowedScope > JS::StructuredCloneScope::SameProcess) {
+    JS_ReportErrorNumberASCII(context(), GetErrorMessage, nullptr,
+                              JSMSG_SC_BAD_SERIALIZED_DATA,
+                              "shared string in cross-process clone");
+    return nullptr;
+  }
+
+  if (length > JSString::MAX_LENGTH) {
+    JS_ReportErrorNumberASCII(context(), GetErrorMessage, nullptr,
+                              JSMSG_SC_BAD_SERIALIZED_DATA, "string length");
+    return nullptr;
+  }
+
+  intptr_t callbacksPtr;
+  intptr_t charsPtr;
+  if (!in.readBytes(&callbacksPtr, sizeof(callbacksPtr)) ||
+      !in.readBytes(&charsPtr, sizeof(charsPtr))) {
+    in.reportTruncated();
+    return nullptr;
+  }
+
+  auto* callbacks =
+      reinterpret_cast<const JSExternalStringCallbacks*>(callbacksPtr);
+  auto* chars = reinterpret_cast<const char16_t*>(charsPtr);
+
+  // The clone keeps its own reference until it's discarded, so it can be read
+  // more than once. The new string needs another one.
+  if (!callbacks->addSharedReference(chars)) {
+    return NewStringCopyN<CanGC>(context(), chars, length);
+  }
+
+  JSString* str = JSExternalString::new_(context(), chars, length, callbacks);
+  if (!str) {
+    callbacks->finalize(const_cast<char16_t*>(chars));
+    return nullptr;
+  }
+  return str;
+}
+
 [[nodiscard]] bool JSStructuredCloneReader::readUint32(uint32_t* num) {
   Rooted<Value> lineVal(context());
   if (!startRead(&lineVal)) {
@@ -2876,6 +3115,15 @@ bool JSStructuredCloneReader::startRead(MutableHandleValue vp,
       break;
     }
 
+    case SCTAG_SHARED_STRING: {
+      JSString* str = readSharedString(data);
+      if (!str) {
+        return false;
+      }
+      vp.setString(str);
+      break;
+    }
+
     case SCTAG_NUMBER_OBJECT: {
       double d;
       if (!in.readDouble(&d)) {
@@ -3911,6 +4159,7 @@ void JSAutoStructuredCloneBuffer::clear() {
   data_.discardTransferables();
   data_.ownTransferables_ = OwnTransferablePolicy::NoTransferables;
   data_.refsHeld_.releaseAll();
+  data_.stringRefsHeld_.releaseAll();
   data_.Clear();
   version_ = 0;
 }
@@ -22,6 +22,7 @@
 #  include <sys/mman.h>
 #endif
 #include <type_traits>
+#include <utility>
 
 #include "jsnum.h"
 #include "jstypes.h"
@@ -2625,15 +2626,25 @@ static bool TypedArrayCountingSort(JSContext* cx,
   return true;
 }
 
+// Number of distinct keys per radix sort column.
+static constexpr size_t RadixSortRadix = 256;
+
+template <typename T, typename U>
+static uint8_t RadixSortByteAtCol(U x, uint8_t col) {
+  U y = UnsignedSortValue<T, U>(x);
+  return static_cast<uint8_t>(y >> (col * 8));
+}
+
 template <typename T, typename U, typename Ops>
 static void SortByColumn(SharedMem<U*> data, size_t length, SharedMem<U*> aux,
-                         uint8_t col) {
+                         size_t* counts, uint8_t col) {
   static_assert(std::is_unsigned_v<U>, "SortByColumn sorts on unsigned values");
   static_assert(std::is_same_v<Ops, UnsharedOps>,
                 "SortByColumn only works on unshared data");
 
-  // |counts| is used to compute the starting index position for each key.
-  // Letting counts[0] always be 0, simplifies the transform step below.
+  // |counts| holds the frequency counts for this column, shifted by one, and
+  // is used to compute the starting index position for each key. Letting
+  // counts[0] always be 0, simplifies the transform step below.
   // Example:
   //
   // Computing frequency counts for the input [1 2 1] gives:
@@ -2644,38 +2655,18 @@ static void SortByColumn(SharedMem<U*> data, size_t length, SharedMem<U*> aux,
   //      0 1 2 3 ... (keys)
   //      0 0 2 3     (indexes)
 
-  constexpr size_t R = 256;
-
-  // Initialize all entries to zero.
-  size_t counts[R + 1] = {};
-
-  const auto ByteAtCol = [col](U x) {
-    U y = UnsignedSortValue<T, U>(x);
-    return static_cast<uint8_t>(y >> (col * 8));
-  };
-
-  // Compute frequency counts.
-  for (size_t i = 0; i < length; i++) {
-    U val = Ops::load(data + i);
-    uint8_t b = ByteAtCol(val);
-    counts[b + 1]++;
-  }
-
   // Transform counts to indices.
-  std::partial_sum(std::begin(counts), std::end(counts), std::begin(counts));
+  std::partial_sum(counts, counts + RadixSortRadix + 1, counts);
 
-  // Distribute
+  // Distribute from |data| into |aux|.
   for (size_t i = 0; i < length; i++) {
     U val = Ops::load(data + i);
-    uint8_t b = ByteAtCol(val);
+    uint8_t b = RadixSortByteAtCol<T, U>(val, col);
     size_t j = counts[b]++;
     MOZ_ASSERT(j < length,
                "index is in bounds when |data| can't be modified concurrently");
     UnsharedOps::store(aux + j, val);
   }
-
-  // Copy back
-  Ops::podCopy(data, aux, length);
 }
 
 template <typename T, typename Ops>
@@ -2683,7 +2674,9 @@ static bool TypedArrayRadixSort(JSContext* cx, TypedArrayObject* typedArray) {
   size_t length = typedArray->length();
 
   // Determined by performance testing.
-  constexpr size_t StdSortMinCutoff = sizeof(T) == 2 ? 64 : 256;
+  constexpr size_t StdSortMinCutoff = sizeof(T) == 2   ? 64
+                                      : sizeof(T) == 4 ? 256
+                                                       : 512;
 
   // Radix sort uses O(n) additional space, limit this space to 64 MB.
   constexpr size_t StdSortMaxCutoff = (64 * 1024 * 1024) / sizeof(T);
@@ -2732,8 +2725,38 @@ static bool TypedArrayRadixSort(JSContext* cx, TypedArrayObject* typedArray) {
     data = unshared;
   }
 
-  for (uint8_t col = 0; col < sizeof(UnsignedT); col++) {
-    SortByColumn<T, UnsignedT, UnsharedOps>(data, length, aux, col);
+  // Compute the frequency counts for all columns in a single pass. The counts
+  // don't depend on the order of the elements, so they stay valid while the
+  // elements are redistributed column by column.
+  constexpr size_t NumCols = sizeof(UnsignedT);
+  size_t counts[NumCols][RadixSortRadix + 1] = {};
+  for (size_t i = 0; i < length; i++) {
+    UnsignedT val = UnsharedOps::load(data + i);
+    for (uint8_t col = 0; col < NumCols; col++) {
+      counts[col][RadixSortByteAtCol<T, UnsignedT>(val, col) + 1]++;
+    }
+  }
+
+  // Sort column by column, alternating between |data| and |aux| as the source.
+  // Columns where all elements share the same key don't change the order and
+  // are skipped. This is common for the high bytes of small integers and the
+  // exponent bytes of floating point values of similar magnitude.
+  SharedMem<UnsignedT*> src = data;
+  SharedMem<UnsignedT*> dest = aux;
+  for (uint8_t col = 0; col < NumCols; col++) {
+    size_t* colCounts = counts[col];
+    if (std::any_of(colCounts + 1, colCounts + RadixSortRadix + 1,
+                    [length](size_t n) { return n == length; })) {
+      continue;
+    }
+
+    SortByColumn<T, UnsignedT, UnsharedOps>(src, length, dest, colCounts, col);
+    std::swap(src, dest);
+  }
+
+  // Copy back if the sorted elements ended up in |aux|.
+  if (src != data) {
+    UnsharedOps::podCopy(data, src, length);
   }
 
   if constexpr (std::is_same_v<Ops, SharedOps>) {
@@ -2752,18 +2775,13 @@ TypedArraySort() {
 }
 
 template <typename T, typename Ops>
-static constexpr typename std::enable_if_t<sizeof(T) == 2 || sizeof(T) == 4,
+static constexpr typename std::enable_if_t<sizeof(T) == 2 || sizeof(T) == 4 ||
+                                               sizeof(T) == 8,
                                            TypedArraySortFn>
 TypedArraySort() {
   return TypedArrayRadixSort<T, Ops>;
 }
 
-template <typename T, typename Ops>
-static constexpr typename std::enable_if_t<sizeof(T) == 8, TypedArraySortFn>
-TypedArraySort() {
-  return TypedArrayStdSort<T, Ops>;
-}
-
 bool js::intrinsic_TypedArrayNativeSort(JSContext* cx, unsigned argc,
                                         Value* vp) {
   CallArgs args = CallArgsFromVp(argc, vp);
@@ -79,6 +79,7 @@ RttValue* RttValue::create(JSContext* cx, TypeHandle handle) {
   rtt->initReservedSlot(RttValue::TypeDef, PrivateValue((void*)&handle.def()));
   rtt->initReservedSlot(RttValue::Parent, NullValue());
   rtt->initReservedSlot(RttValue::Children, PrivateValue(nullptr));
+  rtt->initReservedSlot(RttValue::ObjectShape, UndefinedValue());
 
   MOZ_ASSERT(!rtt->isNewborn());
 
@@ -136,6 +137,31 @@ bool RttValue::ensureChildren(JSContext* cx) {
   return true;
 }
 
+/* static */
+SharedShape* RttValue::getObjectShape(JSContext* cx, Handle<RttValue*> rtt,
+                                      const JSClass* clasp) {
+  MOZ_ASSERT(rtt->zone() == cx->zone());
+
+  Value cached = rtt->getReservedSlot(Slot::ObjectShape);
+  if (cached.isPrivateGCThing()) {
+    SharedShape* shape = &cached.toGCThing()->as<Shape>()->asShared();
+    if (shape->realm() == cx->realm()) {
+      MOZ_ASSERT(shape->getObjectClass() == clasp);
+      return shape;
+    }
+  }
+
+  SharedShape* shape =
+      SharedShape::getInitialShape(cx, clasp, cx->realm(), TaggedProto(),
+                                   /* nfixed = */ 0, ObjectFlags());
+  if (!shape) {
+    return nullptr;
+  }
+
+  rtt->setReservedSlot(Slot::ObjectShape, PrivateGCThingValue(shape));
+  return shape;
+}
+
 bool RttValue::lookupProperty(JSContext* cx, Handle<WasmGcObject*> object,
                               jsid id, PropOffset* offset, FieldType* type) {
   const auto& typeDef = this->typeDef();
@@ -364,8 +390,8 @@ bool WasmGcObject::obj_deleteProperty(JSContext* cx, HandleObject obj,
 
 /* static */
 template <typename T>
-T* WasmGcObject::create(JSContext* cx, js::gc::AllocKind allocKind,
-                        js::gc::InitialHeap heap) {
+T* WasmGcObject::create(JSContext* cx, Handle<RttValue*> rtt,
+                        js::gc::AllocKind allocKind, js::gc::InitialHeap heap) {
   const JSClass* clasp = &T::class_;
   MOZ_ASSERT(IsWasmGcObjectClass(clasp));
   MOZ_ASSERT(!clasp->isNativeObject());
@@ -374,9 +400,7 @@ T* WasmGcObject::create(JSContext* cx, js::gc::AllocKind allocKind,
     allocKind = ForegroundToBackgroundAllocKind(allocKind);
   }
 
-  Rooted<Shape*> shape(
-      cx, SharedShape::getInitialShape(cx, clasp, cx->realm(), TaggedProto(),
-                                       /* nfixed = */ 0, ObjectFlags()));
+  Rooted<Shape*> shape(cx, RttValue::getObjectShape(cx, rtt, clasp));
   if (!shape) {
     return nullptr;
   }
@@ -606,7 +630,7 @@ WasmArrayObject* WasmArrayObject::createArray(JSContext* cx,
   Rooted<WasmArrayObject*> arrayObj(cx);
   AutoSetNewObjectMetadata metadata(cx);
   arrayObj = WasmGcObject::create<WasmArrayObject>(
-      cx, WasmArrayObject::allocKind(), heap);
+      cx, rtt, WasmArrayObject::allocKind(), heap);
   if (!arrayObj) {
     ReportOutOfMemory(cx);
     js_free(outlineData);
@@ -720,7 +744,7 @@ WasmStructObject* WasmStructObject::createStruct(JSContext* cx,
   Rooted<WasmStructObject*> structObj(cx);
   AutoSetNewObjectMetadata metadata(cx);
   structObj = WasmGcObject::create<WasmStructObject>(
-      cx, WasmStructObject::allocKindForRttValue(rtt), heap);
+      cx, rtt, WasmStructObject::allocKindForRttValue(rtt), heap);
   if (!structObj) {
     ReportOutOfMemory(cx);
     if (outlineData) {
@@ -38,8 +38,9 @@ class RttValue : public NativeObject {
     TypeDef = 1,      // Raw pointer to TypeDef owned by TypeContext
     Parent = 2,       // Parent rtt for runtime casting
     Children = 3,     // Child rtts for rtt.sub caching
+    ObjectShape = 4,  // Cached initial shape of objects of this type
     // Maximum number of slots
-    SlotCount = 4,
+    SlotCount = 5,
   };
 
   static RttValue* rttCanon(JSContext* cx, wasm::TypeHandle handle);
@@ -73,6 +74,12 @@ class RttValue : public NativeObject {
   ObjectWeakMap& children() const { return *maybeChildren(); }
   bool ensureChildren(JSContext* cx);
 
+  // Returns the initial shape for objects of this type in the current realm.
+  // The shape of the most recently used realm is cached, so that allocating
+  // objects in the common single-realm case doesn't need a shape table lookup.
+  static SharedShape* getObjectShape(JSContext* cx, Handle<RttValue*> rtt,
+                                     const JSClass* clasp);
+
   // PropOffset is a uint32_t that is used to carry information about the
   // location of an value from RttValue::lookupProperty to
   // WasmGcObject::loadValue.  It is distinct from a normal uint32_t to
@@ -153,8 +160,8 @@ class WasmGcObject : public JSObject {
                                                ObjectOpResult& result);
 
   template <typename T>
-  static T* create(JSContext* cx, gc::AllocKind allocKind,
-                   gc::InitialHeap heap);
+  static T* create(JSContext* cx, Handle<RttValue*> rtt,
+                   gc::AllocKind allocKind, gc::InitialHeap heap);
 
   bool loadValue(JSContext* cx, const RttValue::PropOffset& offset,
                  wasm::FieldType type, MutableHandleValue vp);
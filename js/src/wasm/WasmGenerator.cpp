@@ -358,7 +358,14 @@ bool ModuleGenerator::init(Metadata* maybeAsmJSMetadata) {
   uint32_t numTasks;
   if (CanUseExtraThreads() && GetHelperThreadCPUCount() > 1) {
     parallel_ = true;
-    numTasks = 2 * GetMaxWasmCompilationThreads();
+    // Tier2 compilation runs on a reduced number of helper threads, so keep
+    // fewer batches in flight. Every task retains its LifoAlloc and compiled
+    // code until the batch is linked, which dominates the memory used by
+    // background compilation of large modules.
+    size_t threads = compilerEnv_->mode() == CompileMode::Tier2
+                         ? GetMaxWasmTier2CompilationThreads()
+                         : GetMaxWasmCompilationThreads();
+    numTasks = 2 * threads;
   } else {
     numTasks = 1;
   }
@@ -2530,6 +2530,11 @@ void JSReporter::CollectReports(WindowPaths* windowPaths,
       gStats.helperThread.ionCompileTask,
       "The memory used by IonCompileTasks waiting in HelperThreadState.");
 
+  REPORT_BYTES(
+      "explicit/js-non-window/helper-thread/baseline-compile-task"_ns,
+      KIND_HEAP, gStats.helperThread.baselineCompileTask,
+      "The memory used by BaselineCompileTasks waiting in HelperThreadState.");
+
   REPORT_BYTES(
       "explicit/js-non-window/helper-thread/wasm-compile"_ns, KIND_HEAP,
       gStats.helperThread.wasmCompile,
@@ -2538,6 +2543,10 @@ void JSReporter::CollectReports(WindowPaths* windowPaths,
   REPORT_BYTES("explicit/js-non-window/helper-thread/contexts"_ns, KIND_HEAP,
                gStats.helperThread.contexts,
                "The memory used by the JSContexts in HelperThreadState.");
+
+  REPORT_BYTES("explicit/js-non-window/regexp-code-cache"_ns, KIND_HEAP,
+               gStats.regExpCodeCache,
+               "Regular expression bytecode shared across all JSRuntimes.");
 }
 
 static nsresult JSSizeOfTab(JSObject* objArg, size_t* jsObjectsSize,
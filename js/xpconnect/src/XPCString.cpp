@@ -45,6 +45,12 @@ size_t XPCStringConvert::LiteralExternalString::sizeOfBuffer(
   return 0;
 }
 
+bool XPCStringConvert::LiteralExternalString::addSharedReference(
+    const char16_t* aChars) const {
+  // Literals live forever, so they can be shared with any thread.
+  return true;
+}
+
 void XPCStringConvert::DOMStringExternalString::finalize(
     char16_t* aChars) const {
   nsStringBuffer* buf = nsStringBuffer::FromData(aChars);
@@ -64,6 +70,16 @@ size_t XPCStringConvert::DOMStringExternalString::sizeOfBuffer(
   return buf->SizeOfIncludingThisIfUnshared(aMallocSizeOf);
 }
 
+bool XPCStringConvert::DOMStringExternalString::addSharedReference(
+    const char16_t* aChars) const {
+  // The buffer is shared with the string, so it's read-only, and its
+  // reference count is thread-safe.
+  nsStringBuffer* buf =
+      nsStringBuffer::FromData(const_cast<char16_t*>(aChars));
+  buf->AddRef();
+  return true;
+}
+
 void XPCStringConvert::DynamicAtomExternalString::finalize(
     char16_t* aChars) const {
   nsDynamicAtom* atom = nsDynamicAtom::FromChars(aChars);
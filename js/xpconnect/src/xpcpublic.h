@@ -318,11 +318,13 @@ class XPCStringConvert {
     void finalize(char16_t* aChars) const override;
     size_t sizeOfBuffer(const char16_t* aChars,
                         mozilla::MallocSizeOf aMallocSizeOf) const override;
+    bool addSharedReference(const char16_t* aChars) const override;
   };
   struct DOMStringExternalString : public JSExternalStringCallbacks {
     void finalize(char16_t* aChars) const override;
     size_t sizeOfBuffer(const char16_t* aChars,
                         mozilla::MallocSizeOf aMallocSizeOf) const override;
+    bool addSharedReference(const char16_t* aChars) const override;
   };
   struct DynamicAtomExternalString : public JSExternalStringCallbacks {
     void finalize(char16_t* aChars) const override;
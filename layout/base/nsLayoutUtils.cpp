@@ -3368,6 +3368,12 @@ void nsLayoutUtils::PaintFrame(gfxContext* aRenderingContext, nsIFrame* aFrame,
       // viewport.
       updateState = retainedBuilder->AttemptPartialUpdate(aBackstop);
       metrics->EndPartialBuild(updateState);
+      DL_LOGI(
+          "Partial build: new %u, reused %u, rebuilt %u, removed %u, total %u, "
+          "build %.3fms, merge %.3fms",
+          metrics->mNewItems, metrics->mReusedItems, metrics->mRebuiltItems,
+          metrics->mRemovedItems, metrics->mTotalItems,
+          metrics->mPartialBuildDuration, metrics->mMergeDuration);
     } else {
       // Partial updates are disabled.
       DL_LOGI("Partial updates are disabled");
@@ -3526,9 +3532,11 @@ void nsLayoutUtils::PaintFrame(gfxContext* aRenderingContext, nsIFrame* aFrame,
     } else {
       printf(
           "DL partial build success!"
-          " new: %d, reused: %d, rebuilt: %d, removed: %d, total: %d\n",
+          " new: %d, reused: %d, rebuilt: %d, removed: %d, total: %d,"
+          " merge: %.3fms\n",
           metrics->mNewItems, metrics->mReusedItems, metrics->mRebuiltItems,
-          metrics->mRemovedItems, metrics->mTotalItems);
+          metrics->mRemovedItems, metrics->mTotalItems,
+          metrics->mMergeDuration);
     }
   }
 #endif
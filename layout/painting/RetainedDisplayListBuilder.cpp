@@ -1678,9 +1678,12 @@ PartialUpdateResult RetainedDisplayListBuilder::AttemptPartialUpdate(
   // move it to the correct inner clip.
   if (!simpleUpdate) {
     Maybe<const ActiveScrolledRoot*> dummy;
+    TimeStamp mergeStart = TimeStamp::Now();
     if (MergeDisplayLists(&modifiedDL, &mList, &mList, dummy)) {
       result = PartialUpdateResult::Updated;
     }
+    Metrics()->mMergeDuration =
+        (TimeStamp::Now() - mergeStart).ToMilliseconds();
   } else {
     MOZ_ASSERT(mList.IsEmpty());
     mList = std::move(modifiedDL);
@@ -110,6 +110,7 @@ struct RetainedDisplayListMetrics {
     mTotalItems = 0;
     mPartialBuildDuration = 0;
     mFullBuildDuration = 0;
+    mMergeDuration = 0;
     mPartialUpdateFailReason = PartialUpdateFailReason::NA;
     mPartialUpdateResult = PartialUpdateResult::NoChange;
   }
@@ -157,6 +158,9 @@ struct RetainedDisplayListMetrics {
   mozilla::TimeStamp mStartTime;
   double mPartialBuildDuration;
   double mFullBuildDuration;
+  // Time spent in MergeDisplayLists during the partial build, included in
+  // mPartialBuildDuration.
+  double mMergeDuration;
   PartialUpdateFailReason mPartialUpdateFailReason;
   PartialUpdateResult mPartialUpdateResult;
 };
@@ -47,7 +47,7 @@ void nsPagePrintTimer::Disconnect() {
 
 nsresult nsPagePrintTimer::StartTimer(bool aUseDelay) {
   uint32_t delay = 0;
-  if (aUseDelay) {
+  if (aUseDelay && mDelay) {
     if (mFiringCount < 10) {
       // Longer delay for the few first pages.
       delay = mDelay + ((10 - mFiringCount) * 100);
@@ -2016,6 +2016,13 @@ nsresult nsPrintJob::StartPagePrintTimer(const UniquePtr<nsPrintObject>& aPO) {
     // Get the delay time in between the printing of each page
     // this gives the user more time to press cancel
     int32_t printPageDelay = mPrintSettings->GetPrintPageDelay();
+    // When printing to a file (e.g. save to PDF) there is no printer spooling
+    // pages we'd want to hold back, so don't pace the sheets at all; for long
+    // documents the delay otherwise dominates the total print time.
+    if (mPrintSettings->GetOutputDestination() ==
+        nsIPrintSettings::kOutputDestinationFile) {
+      printPageDelay = 0;
+    }
 
     nsCOMPtr<nsIContentViewer> cv = do_QueryInterface(mDocViewerPrint);
     NS_ENSURE_TRUE(cv, NS_ERROR_FAILURE);
@@ -7,9 +7,13 @@
 #include "mozilla/css/StreamLoader.h"
 
 #include "mozilla/Encoding.h"
+#include "mozilla/Unused.h"
 #include "nsContentUtils.h"
 #include "nsIChannel.h"
 #include "nsIInputStream.h"
+#include "nsIThreadRetargetableRequest.h"
+#include "nsProxyRelease.h"
+#include "nsThreadUtils.h"
 
 #include <limits>
 
@@ -25,9 +29,13 @@ StreamLoader::~StreamLoader() {
 #ifdef NIGHTLY_BUILD
   MOZ_RELEASE_ASSERT(mOnStopRequestCalled || mChannelOpenFailed);
 #endif
+  // We may be released on the thread data was delivered to.
+  NS_ReleaseOnMainThread("StreamLoader::mSheetLoadData",
+                         mSheetLoadData.forget());
 }
 
-NS_IMPL_ISUPPORTS(StreamLoader, nsIStreamListener)
+NS_IMPL_ISUPPORTS(StreamLoader, nsIStreamListener,
+                  nsIThreadRetargetableStreamListener)
 
 /* nsIRequestObserver implementation */
 NS_IMETHODIMP
@@ -52,6 +60,20 @@ StreamLoader::OnStartRequest(nsIRequest* aRequest) {
       }
     }
   }
+
+  // OnDataAvailable only buffers the bytes, so it doesn't need to run on the
+  // main thread. The sheet is still decoded and parsed from OnStopRequest,
+  // which is always delivered on the main thread.
+  if (!mSheetLoadData->mSyncLoad) {
+    if (nsCOMPtr<nsIThreadRetargetableRequest> req =
+            do_QueryInterface(aRequest)) {
+      nsCOMPtr<nsISerialEventTarget> queue;
+      if (NS_SUCCEEDED(NS_CreateBackgroundTaskQueue("CSSStreamLoader",
+                                                    getter_AddRefs(queue)))) {
+        Unused << NS_WARN_IF(NS_FAILED(req->RetargetDeliveryTo(queue)));
+      }
+    }
+  }
   return NS_OK;
 }
 
@@ -147,6 +169,13 @@ StreamLoader::OnDataAvailable(nsIRequest*, nsIInputStream* aInputStream,
   return aInputStream->ReadSegments(WriteSegmentFun, this, aCount, &dummy);
 }
 
+/* nsIThreadRetargetableStreamListener implementation */
+NS_IMETHODIMP
+StreamLoader::CheckListenerChain() {
+  MOZ_ASSERT(NS_IsMainThread());
+  return NS_OK;
+}
+
 void StreamLoader::HandleBOM() {
   MOZ_ASSERT(mEncodingFromBOM.isNothing());
   MOZ_ASSERT(mBytes.IsEmpty());
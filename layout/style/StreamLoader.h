@@ -8,6 +8,7 @@
 #define mozilla_css_StreamLoader_h
 
 #include "nsIStreamListener.h"
+#include "nsIThreadRetargetableStreamListener.h"
 #include "nsString.h"
 #include "mozilla/css/SheetLoadData.h"
 #include "mozilla/Assertions.h"
@@ -17,11 +18,13 @@ class nsIInputStream;
 namespace mozilla {
 namespace css {
 
-class StreamLoader : public nsIStreamListener {
+class StreamLoader : public nsIStreamListener,
+                     public nsIThreadRetargetableStreamListener {
  public:
-  NS_DECL_ISUPPORTS
+  NS_DECL_THREADSAFE_ISUPPORTS
   NS_DECL_NSIREQUESTOBSERVER
   NS_DECL_NSISTREAMLISTENER
+  NS_DECL_NSITHREADRETARGETABLESTREAMLISTENER
 
   explicit StreamLoader(SheetLoadData&);
 
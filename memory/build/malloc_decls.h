@@ -108,6 +108,17 @@ MALLOC_DECL(jemalloc_thread_local_arena, void, bool)
 
 // Provide information about any allocation enclosing the given address.
 MALLOC_DECL(jemalloc_ptr_info, void, const void*, jemalloc_ptr_info_t*)
+
+// Enable or disable deferred purging, and return the previous setting. When
+// enabled, arenas exceeding their dirty page limit are only flagged on free,
+// and the embedder is expected to call moz_may_purge_one_now when idle.
+// Arenas far exceeding their limit are still purged immediately.
+MALLOC_DECL(moz_enable_deferred_purge, bool, bool)
+
+// Purge the dirty pages of one arena that has a deferred purge pending. If
+// the argument is true, only check whether there is such an arena. Returns
+// whether (more) arenas with a pending purge remain.
+MALLOC_DECL(moz_may_purge_one_now, bool, bool)
 #  endif
 
 #  if MALLOC_FUNCS & MALLOC_FUNCS_ARENA_BASE
@@ -584,6 +584,10 @@ static Atomic<size_t, ReleaseAcquire> gRecycledSize;
 
 static size_t opt_dirty_max = DIRTY_MAX_DEFAULT;
 
+// When deferred purging is enabled, an arena is still purged synchronously
+// once its dirty page count reaches this multiple of its mMaxDirty.
+static const size_t kDeferredPurgeMaxDirtyFactor = 4;
+
 // Return the smallest chunk multiple that is >= s.
 #define CHUNK_CEILING(s) (((s) + kChunkSizeMask) & ~kChunkSizeMask)
 
@@ -1028,6 +1032,11 @@ struct arena_t {
   // Maximum value allowed for mNumDirty.
   size_t mMaxDirty;
 
+  // Set when mNumDirty exceeded mMaxDirty while deferred purging was enabled,
+  // and cleared when the purge is actually performed (see
+  // moz_may_purge_one_now).
+  Atomic<bool, Relaxed> mIsPurgePending;
+
  private:
   // Size/address-ordered tree of this arena's available runs.  This tree
   // is used for first-best-fit run allocation.
@@ -1202,6 +1211,14 @@ class ArenaCollection {
 
   inline arena_t* GetDefault() { return mDefaultArena; }
 
+  // Whether purging dirty pages above an arena's mMaxDirty is left to
+  // moz_may_purge_one_now() rather than done on the freeing thread.
+  bool IsDeferredPurgeEnabled() { return mIsDeferredPurgeEnabled; }
+
+  bool SetDeferredPurge(bool aEnable) {
+    return mIsDeferredPurgeEnabled.exchange(aEnable);
+  }
+
   Mutex mLock MOZ_UNANNOTATED;
 
  private:
@@ -1211,6 +1228,7 @@ class ArenaCollection {
   arena_id_t mLastPublicArenaId;
   Tree mArenas;
   Tree mPrivateArenas;
+  Atomic<bool, Relaxed> mIsDeferredPurgeEnabled;
 };
 
 static ArenaCollection gArenas;
@@ -2875,9 +2893,17 @@ void arena_t::DallocRun(arena_run_t* aRun, bool aDirty) {
     DeallocChunk(chunk);
   }
 
-  // Enforce mMaxDirty.
+  // Enforce mMaxDirty. With deferred purging, only flag the arena and let
+  // the embedder purge it when idle, unless the arena has gone so far over
+  // its limit that waiting would be unreasonable.
   if (mNumDirty > mMaxDirty) {
-    Purge(false);
+    if (gArenas.IsDeferredPurgeEnabled() &&
+        mNumDirty <= mMaxDirty * kDeferredPurgeMaxDirtyFactor) {
+      mIsPurgePending = true;
+    } else {
+      mIsPurgePending = false;
+      Purge(false);
+    }
   }
 }
 
@@ -3793,6 +3819,7 @@ arena_t::arena_t(arena_params_t* aParams, bool aIsPrivate) {
   mIsPrivate = aIsPrivate;
 
   mNumDirty = 0;
+  mIsPurgePending = false;
   // The default maximum amount of dirty pages allowed on arenas is a fraction
   // of opt_dirty_max.
   mMaxDirty = (aParams && aParams->mMaxDirty) ? aParams->mMaxDirty
@@ -4695,6 +4722,37 @@ inline void MozJemalloc::jemalloc_free_dirty_pages(void) {
   }
 }
 
+template <>
+inline bool MozJemalloc::moz_enable_deferred_purge(bool aEnable) {
+  return gArenas.SetDeferredPurge(aEnable);
+}
+
+template <>
+inline bool MozJemalloc::moz_may_purge_one_now(bool aPeekOnly) {
+  if (!malloc_initialized) {
+    return false;
+  }
+
+  bool purged = false;
+  MutexAutoLock lock(gArenas.mLock);
+  for (auto arena : gArenas.iter()) {
+    if (!arena->mIsPurgePending) {
+      continue;
+    }
+    if (aPeekOnly || purged) {
+      return true;
+    }
+    MutexAutoLock arena_lock(arena->mLock);
+    arena->mIsPurgePending = false;
+    // The arena may have been purged or reused since it was flagged.
+    if (arena->mNumDirty > arena->mMaxDirty) {
+      arena->Purge(false);
+    }
+    purged = true;
+  }
+  return false;
+}
+
 inline arena_t* ArenaCollection::GetByIdInternal(arena_id_t aArenaId,
                                                  bool aIsPrivate) {
   // Use AlignedStorage2 to avoid running the arena_t constructor, while
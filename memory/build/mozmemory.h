@@ -16,6 +16,8 @@
 //   - jemalloc_free_dirty_pages
 //   - jemalloc_thread_local_arena
 //   - jemalloc_ptr_info
+//   - moz_enable_deferred_purge
+//   - moz_may_purge_one_now
 
 #ifdef MALLOC_H
 #  include MALLOC_H
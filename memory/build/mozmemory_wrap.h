@@ -40,6 +40,8 @@
 //   - jemalloc_free_dirty_pages
 //   - jemalloc_thread_local_arena
 //   - jemalloc_ptr_info
+//   - moz_enable_deferred_purge
+//   - moz_may_purge_one_now
 //   (these functions are native to mozjemalloc)
 //
 // These functions are all exported as part of libmozglue (see
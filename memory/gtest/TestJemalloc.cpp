@@ -452,6 +452,74 @@ TEST(Jemalloc, InPlace)
   moz_dispose_arena(arena);
 }
 
+TEST(Jemalloc, DeferredPurge)
+{
+  AutoDisablePHCOnCurrentThread disable;
+
+  jemalloc_stats_t stats;
+  jemalloc_stats(&stats);
+
+  // Each allocation frees kMaxDirty pages, so the arena goes over its limit
+  // with the second free and over the hard cap (4 times the limit) with the
+  // fifth.
+  const size_t kMaxDirty = 8;
+  const size_t kAllocSize = kMaxDirty * stats.page_size;
+  const size_t kNumAllocs = 5;
+
+  arena_params_t params;
+  params.mMaxDirty = kMaxDirty;
+  arena_id_t arena = moz_create_arena_with_params(&params);
+  // Keeps the chunk alive, so that freeing the others doesn't release it.
+  void* keep = moz_arena_malloc(arena, kAllocSize);
+  void* ptrs[kNumAllocs];
+  for (void*& ptr : ptrs) {
+    ptr = moz_arena_malloc(arena, kAllocSize);
+    ASSERT_TRUE(ptr);
+  }
+
+  bool wasEnabled = moz_enable_deferred_purge(true);
+  // Start from a clean slate: other arenas may have a purge pending.
+  while (moz_may_purge_one_now(/* aPeekOnly */ false)) {
+  }
+
+  // Going over the limit only flags the arena.
+  moz_arena_free(arena, ptrs[0]);
+  EXPECT_FALSE(moz_may_purge_one_now(/* aPeekOnly */ true));
+  moz_arena_free(arena, ptrs[1]);
+  EXPECT_TRUE(moz_may_purge_one_now(/* aPeekOnly */ true));
+  moz_arena_free(arena, ptrs[2]);
+  moz_arena_free(arena, ptrs[3]);
+  EXPECT_TRUE(moz_may_purge_one_now(/* aPeekOnly */ true));
+
+  // Going over the hard cap purges right away.
+  moz_arena_free(arena, ptrs[4]);
+  EXPECT_FALSE(moz_may_purge_one_now(/* aPeekOnly */ true));
+
+  // A deferred purge is performed by moz_may_purge_one_now.
+  for (void*& ptr : ptrs) {
+    ptr = moz_arena_malloc(arena, kAllocSize);
+    ASSERT_TRUE(ptr);
+  }
+  moz_arena_free(arena, ptrs[0]);
+  moz_arena_free(arena, ptrs[1]);
+  EXPECT_TRUE(moz_may_purge_one_now(/* aPeekOnly */ true));
+  while (moz_may_purge_one_now(/* aPeekOnly */ false)) {
+  }
+  EXPECT_FALSE(moz_may_purge_one_now(/* aPeekOnly */ true));
+
+  // Without deferred purging, e.g. under memory pressure, going over the
+  // limit purges right away.
+  EXPECT_TRUE(moz_enable_deferred_purge(false));
+  moz_arena_free(arena, ptrs[2]);
+  moz_arena_free(arena, ptrs[3]);
+  moz_arena_free(arena, ptrs[4]);
+  EXPECT_FALSE(moz_may_purge_one_now(/* aPeekOnly */ true));
+
+  moz_arena_free(arena, keep);
+  moz_enable_deferred_purge(wasEnabled);
+  moz_dispose_arena(arena);
+}
+
 // Bug 1474254: disable this test for windows ccov builds because it leads to
 // timeout.
 #if !defined(XP_WIN) || !defined(MOZ_CODE_COVERAGE)
@@ -1572,6 +1572,8 @@ void replace_init(malloc_table_t* aMallocTable, ReplaceMallocBridge** aBridge) {
   // jemalloc_free_dirty_pages: the default suffices.
   // jemalloc_thread_local_arena: the default suffices.
   aMallocTable->jemalloc_ptr_info = replace_jemalloc_ptr_info;
+  // moz_enable_deferred_purge: the default suffices.
+  // moz_may_purge_one_now: the default suffices.
 
   aMallocTable->moz_create_arena_with_params =
       replace_moz_create_arena_with_params;
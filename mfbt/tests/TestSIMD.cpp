@@ -7,6 +7,8 @@
 #include "mozilla/Assertions.h"
 #include "mozilla/SIMD.h"
 
+#include <string.h>
+
 using mozilla::SIMD;
 
 void TestTinyString() {
@@ -591,6 +593,153 @@ void TestSpecialCases() {
   MOZ_RELEASE_ASSERT(SIMD::memchr2x16(test2wide, 'a', 'b', 26) == nullptr);
 }
 
+void TestTwoOrBelow8() {
+  const char* test = "abc\"de\\f\n";
+  MOZ_RELEASE_ASSERT(SIMD::memchr2OrBelow8(test, '"', '\\', 0x20, 9) ==
+                     test + 3);
+  MOZ_RELEASE_ASSERT(SIMD::memchr2OrBelow8(test, 'x', '\\', 0x20, 9) ==
+                     test + 6);
+  MOZ_RELEASE_ASSERT(SIMD::memchr2OrBelow8(test, 'x', 'y', 0x20, 9) ==
+                     test + 8);
+  MOZ_RELEASE_ASSERT(SIMD::memchr2OrBelow8(test, 'x', 'y', 0x20, 8) ==
+                     nullptr);
+
+  // Check every position of each kind of match in buffers which need both
+  // whole chunks and an overlapping tail, including values >= 0x80 which must
+  // not be considered as being below the bound.
+  const char matches[] = {'"', '\\', '\0', '\x1f'};
+  const size_t count = 100;
+  char buffer[count];
+  for (size_t length = 1; length < count; ++length) {
+    for (size_t i = 0; i < length; ++i) {
+      for (char c : matches) {
+        memset(buffer, '\x80', length);
+        if (i > 0) {
+          buffer[i - 1] = ' ';
+        }
+        buffer[i] = c;
+        MOZ_RELEASE_ASSERT(SIMD::memchr2OrBelow8(buffer, '"', '\\', 0x20,
+                                                 length) == buffer + i);
+      }
+    }
+    memset(buffer, ' ', length);
+    MOZ_RELEASE_ASSERT(
+        SIMD::memchr2OrBelow8(buffer, '"', '\\', 0x20, length) == nullptr);
+  }
+}
+
+void TestTwoOrBelow16() {
+  const char16_t* test = u"abc\"de\\f\n";
+  MOZ_RELEASE_ASSERT(SIMD::memchr2OrBelow16(test, '"', '\\', 0x20, 9) ==
+                     test + 3);
+  MOZ_RELEASE_ASSERT(SIMD::memchr2OrBelow16(test, 'x', '\\', 0x20, 9) ==
+                     test + 6);
+  MOZ_RELEASE_ASSERT(SIMD::memchr2OrBelow16(test, 'x', 'y', 0x20, 9) ==
+                     test + 8);
+  MOZ_RELEASE_ASSERT(SIMD::memchr2OrBelow16(test, 'x', 'y', 0x20, 8) ==
+                     nullptr);
+
+  const char16_t matches[] = {u'"', u'\\', u'\0', u'\x1f'};
+  const size_t count = 100;
+  char16_t buffer[count];
+  for (size_t length = 1; length < count; ++length) {
+    for (size_t i = 0; i < length; ++i) {
+      for (char16_t c : matches) {
+        for (size_t j = 0; j < length; ++j) {
+          buffer[j] = 0x2022;
+        }
+        if (i > 0) {
+          buffer[i - 1] = 0x0120;
+        }
+        buffer[i] = c;
+        MOZ_RELEASE_ASSERT(SIMD::memchr2OrBelow16(buffer, '"', '\\', 0x20,
+                                                  length) == buffer + i);
+      }
+    }
+    for (size_t j = 0; j < length; ++j) {
+      buffer[j] = 0x8020;
+    }
+    MOZ_RELEASE_ASSERT(
+        SIMD::memchr2OrBelow16(buffer, '"', '\\', 0x20, length) == nullptr);
+  }
+}
+
+void TestThreeOrOutside8() {
+  const char* test = "ab*c@d#e\t\xc3";
+  MOZ_RELEASE_ASSERT(SIMD::memchr3OrOutside8(test, '*', '@', '#', 0x20, 0x7f,
+                                             11) == test + 2);
+  MOZ_RELEASE_ASSERT(SIMD::memchr3OrOutside8(test, 'x', '@', '#', 0x20, 0x7f,
+                                             11) == test + 4);
+  MOZ_RELEASE_ASSERT(SIMD::memchr3OrOutside8(test, 'x', 'y', '#', 0x20, 0x7f,
+                                             11) == test + 6);
+  MOZ_RELEASE_ASSERT(SIMD::memchr3OrOutside8(test, 'x', 'y', 'z', 0x20, 0x7f,
+                                             11) == test + 8);
+  MOZ_RELEASE_ASSERT(SIMD::memchr3OrOutside8(test, 'x', 'y', 'z', 0x09, 0x7f,
+                                             11) == test + 9);
+  MOZ_RELEASE_ASSERT(SIMD::memchr3OrOutside8(test, 'x', 'y', 'z', 0x09, 0x7f,
+                                             9) == nullptr);
+
+  // Check every position of each kind of match in buffers which need both
+  // whole chunks and an overlapping tail.
+  const char matches[] = {'*', '@', '#', '\0', '\x1f', '\x7f', '\x80', '\xff'};
+  const size_t count = 100;
+  char buffer[count];
+  for (size_t length = 1; length < count; ++length) {
+    for (size_t i = 0; i < length; ++i) {
+      for (char c : matches) {
+        memset(buffer, 'a', length);
+        if (i > 0) {
+          buffer[i - 1] = ' ';
+        }
+        buffer[i] = c;
+        MOZ_RELEASE_ASSERT(SIMD::memchr3OrOutside8(buffer, '*', '@', '#', 0x20,
+                                                   0x7f, length) == buffer + i);
+      }
+    }
+    memset(buffer, '~', length);
+    MOZ_RELEASE_ASSERT(SIMD::memchr3OrOutside8(buffer, '*', '@', '#', 0x20,
+                                               0x7f, length) == nullptr);
+  }
+}
+
+void TestThreeOrOutside16() {
+  const char16_t* test = u"ab*c@d#e\t\u2028";
+  MOZ_RELEASE_ASSERT(SIMD::memchr3OrOutside16(test, '*', '@', '#', 0x20, 0x80,
+                                              11) == test + 2);
+  MOZ_RELEASE_ASSERT(SIMD::memchr3OrOutside16(test, 'x', 'y', 'z', 0x20, 0x80,
+                                              11) == test + 8);
+  MOZ_RELEASE_ASSERT(SIMD::memchr3OrOutside16(test, 'x', 'y', 'z', 0x09, 0x80,
+                                              11) == test + 9);
+  MOZ_RELEASE_ASSERT(SIMD::memchr3OrOutside16(test, 'x', 'y', 'z', 0x09, 0x80,
+                                              9) == nullptr);
+
+  const char16_t matches[] = {u'*',    u'@',    u'#',    u'\0',
+                              u'\x1f', u'\x80', 0x2028, 0xffff};
+  const size_t count = 100;
+  char16_t buffer[count];
+  for (size_t length = 1; length < count; ++length) {
+    for (size_t i = 0; i < length; ++i) {
+      for (char16_t c : matches) {
+        for (size_t j = 0; j < length; ++j) {
+          buffer[j] = u'a';
+        }
+        if (i > 0) {
+          buffer[i - 1] = u' ';
+        }
+        buffer[i] = c;
+        MOZ_RELEASE_ASSERT(SIMD::memchr3OrOutside16(buffer, '*', '@', '#', 0x20,
+                                                    0x80,
+                                                    length) == buffer + i);
+      }
+    }
+    for (size_t j = 0; j < length; ++j) {
+      buffer[j] = u'\x7f';
+    }
+    MOZ_RELEASE_ASSERT(SIMD::memchr3OrOutside16(buffer, '*', '@', '#', 0x20,
+                                                0x80, length) == nullptr);
+  }
+}
+
 int main(void) {
   TestTinyString();
   TestShortString();
@@ -622,6 +771,12 @@ int main(void) {
 
   TestSpecialCases();
 
+  TestTwoOrBelow8();
+  TestTwoOrBelow16();
+
+  TestThreeOrOutside8();
+  TestThreeOrOutside16();
+
   // These are too slow to run all the time, but they should be run when making
   // meaningful changes just to be sure.
   // TestGauntlet2x8();
@@ -8,7 +8,7 @@
 
 #include "mozilla/dom/ipc/MemMapSnapshot.h"
 
-#include "mozilla/BinarySearch.h"
+#include "mozilla/PerfectHash.h"
 #include "mozilla/ResultExtensions.h"
 #include "mozilla/ipc/FileDescriptor.h"
 
@@ -60,14 +60,28 @@ Maybe<const SharedPrefMap::Pref> SharedPrefMap::Get(const char* aKey) const {
 }
 
 bool SharedPrefMap::Find(const char* aKey, size_t* aIndex) const {
-  const auto& keys = KeyTable();
-
-  return BinarySearchIf(
-      Entries(), 0, EntryCount(),
-      [&](const Entry& aEntry) {
-        return strcmp(aKey, keys.GetBare(aEntry.mKey));
-      },
-      aIndex);
+  using namespace perfecthash;
+
+  const Header& header = GetHeader();
+  uint32_t numBases = header.mHashBases.mSize / sizeof(uint32_t);
+  if (!numBases) {
+    return false;
+  }
+
+  size_t length = strlen(aKey);
+  uint32_t basis = HashBases()[Hash(FNV_OFFSET_BASIS, aKey, length) % numBases];
+  uint32_t index = HashSlots()[Hash(basis, aKey, length) % EntryCount()];
+
+  // Every key hashes to some entry, so we still need to check that it's the
+  // one we're looking for.
+  const Entry& entry = Entries()[index];
+  if (entry.mKey.mLength != length ||
+      memcmp(aKey, KeyTable().GetBare(entry.mKey), length) != 0) {
+    return false;
+  }
+
+  *aIndex = index;
+  return true;
 }
 
 void SharedPrefMapBuilder::Add(const nsCString& aKey, const Flags& aFlags,
@@ -135,12 +149,86 @@ void SharedPrefMapBuilder::Add(const nsCString& aKey, const Flags& aFlags,
   });
 }
 
+/* static */
+void SharedPrefMapBuilder::BuildPerfectHash(const nsTArray<Entry*>& aEntries,
+                                            nsTArray<uint32_t>& aBases,
+                                            nsTArray<uint32_t>& aSlots) {
+  using namespace perfecthash;
+
+  // This follows the generator for xpcom/ds/PerfectHash.h tables: sort the
+  // keys into buckets by their first hash, then, starting with the largest
+  // buckets, search for a basis which maps every key in the bucket to a
+  // distinct free slot.
+  uint32_t count = aEntries.Length();
+  aBases.SetLength(count);
+  aSlots.SetLength(count);
+  if (!count) {
+    return;
+  }
+
+  auto hashEntry = [&](uint32_t aBasis, uint32_t aIndex) {
+    const char* key = aEntries[aIndex]->mKeyString;
+    return Hash(aBasis, key, strlen(key));
+  };
+
+  nsTArray<nsTArray<uint32_t>> buckets;
+  buckets.SetLength(count);
+  for (uint32_t i = 0; i < count; i++) {
+    buckets[hashEntry(FNV_OFFSET_BASIS, i) % count].AppendElement(i);
+  }
+
+  nsTArray<uint32_t> bucketOrder(count);
+  for (uint32_t i = 0; i < count; i++) {
+    bucketOrder.AppendElement(i);
+  }
+  bucketOrder.Sort([&](uint32_t aA, uint32_t aB) {
+    return int32_t(buckets[aB].Length()) - int32_t(buckets[aA].Length());
+  });
+
+  nsTArray<bool> used;
+  used.InsertElementsAt(0, count, false);
+
+  AutoTArray<uint32_t, 8> slots;
+  for (uint32_t bucketIndex : bucketOrder) {
+    const auto& bucket = buckets[bucketIndex];
+    if (bucket.IsEmpty()) {
+      aBases[bucketIndex] = 0;
+      continue;
+    }
+
+    for (uint32_t basis = 1;; basis++) {
+      MOZ_RELEASE_ASSERT(basis, "Couldn't build a perfect hash");
+
+      slots.ClearAndRetainStorage();
+      bool ok = true;
+      for (uint32_t index : bucket) {
+        uint32_t slot = hashEntry(basis, index) % count;
+        if (used[slot] || slots.Contains(slot)) {
+          ok = false;
+          break;
+        }
+        slots.AppendElement(slot);
+      }
+      if (!ok) {
+        continue;
+      }
+
+      aBases[bucketIndex] = basis;
+      for (uint32_t i = 0; i < bucket.Length(); i++) {
+        used[slots[i]] = true;
+        aSlots[slots[i]] = bucket[i];
+      }
+      break;
+    }
+  }
+}
+
 Result<Ok, nsresult> SharedPrefMapBuilder::Finalize(loader::AutoMemMap& aMap) {
   using Header = SharedPrefMap::Header;
 
   // Create an array of entry pointers for the entry array, and sort it by
-  // preference name prior to serialization, so that entries can be looked up
-  // using binary search.
+  // preference name prior to serialization, so that iteration is in name
+  // order.
   nsTArray<Entry*> entries(mEntries.Length());
   for (auto& entry : mEntries) {
     entries.AppendElement(&entry);
@@ -149,6 +237,10 @@ Result<Ok, nsresult> SharedPrefMapBuilder::Finalize(loader::AutoMemMap& aMap) {
     return strcmp(aA->mKeyString, aB->mKeyString);
   });
 
+  nsTArray<uint32_t> hashBases;
+  nsTArray<uint32_t> hashSlots;
+  BuildPerfectHash(entries, hashBases, hashSlots);
+
   Header header = {uint32_t(entries.Length())};
 
   size_t offset = sizeof(header);
@@ -184,6 +276,15 @@ Result<Ok, nsresult> SharedPrefMapBuilder::Finalize(loader::AutoMemMap& aMap) {
   header.mValueStrings.mSize = mValueStringTable.Size();
   offset += header.mValueStrings.mSize;
 
+  offset += GetAlignmentOffset(offset, alignof(uint32_t));
+  header.mHashBases.mOffset = offset;
+  header.mHashBases.mSize = hashBases.Length() * sizeof(uint32_t);
+  offset += header.mHashBases.mSize;
+
+  header.mHashSlots.mOffset = offset;
+  header.mHashSlots.mSize = hashSlots.Length() * sizeof(uint32_t);
+  offset += header.mHashSlots.mSize;
+
   MemMapSnapshot mem;
   MOZ_TRY(mem.Init(offset));
 
@@ -224,6 +325,13 @@ Result<Ok, nsresult> SharedPrefMapBuilder::Finalize(loader::AutoMemMap& aMap) {
   mStringValueTable.WriteUserValues(
       {&ptr[header.mUserStringValues.mOffset], header.mUserStringValues.mSize});
 
+  if (!hashBases.IsEmpty()) {
+    memcpy(&ptr[header.mHashBases.mOffset], hashBases.Elements(),
+           header.mHashBases.mSize);
+    memcpy(&ptr[header.mHashSlots.mOffset], hashSlots.Elements(),
+           header.mHashSlots.mSize);
+  }
+
   mKeyTable.Clear();
   mValueStringTable.Clear();
   mIntValueTable.Clear();
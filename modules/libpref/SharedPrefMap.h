@@ -43,10 +43,10 @@ class SharedPrefMapBuilder;
 // whereas if we returned a nsDependentCString or a dynamically allocated
 // nsCString, it would.
 //
-// The set of entries is stored in sorted order by preference name, so look-ups
-// are done by binary search. This means that look-ups have O(log n) complexity,
-// rather than the O(1) complexity of a dynamic hashtable. Consumers should keep
-// this in mind when planning their accesses.
+// The set of entries is stored in sorted order by preference name. Look-ups go
+// through a minimal perfect hash generated when the map is built (using the
+// same scheme as xpcom/ds/PerfectHash.h), so they cost two hashes of the key
+// and a single string comparison.
 //
 // Important: The mapped memory created by this class is persistent. Once an
 // instance has been initialized, the memory that it allocates can never be
@@ -74,6 +74,8 @@ class SharedPrefMap {
   // - An array of Entry structs with mEntryCount elements, lexicographically
   //   sorted by preference name.
   //
+  // - The perfect hash tables used to look up entries by name (see Find()).
+  //
   // - A set of data blocks, with offsets and sizes described by the DataBlock
   //   entries in the header, described below.
   //
@@ -256,6 +258,13 @@ class SharedPrefMap {
     // The StringTable data block for string preference values, referenced by
     // the above two data blocks.
     DataBlock mValueStrings;
+
+    // The uint32_t arrays of the perfect hash over preference names. A name is
+    // first hashed into one of the mHashBases buckets, which gives the basis
+    // for a second hash into mHashSlots. Each slot holds the index of the
+    // entry that hashes to it.
+    DataBlock mHashBases;
+    DataBlock mHashSlots;
   };
 
   using StringTableEntry = mozilla::dom::ipc::StringTableEntry;
@@ -526,6 +535,13 @@ class SharedPrefMap {
 
   uint32_t EntryCount() const { return GetHeader().mEntryCount; }
 
+  RangedPtr<const uint32_t> HashBases() const {
+    return GetBlock<uint32_t>(GetHeader().mHashBases);
+  }
+  RangedPtr<const uint32_t> HashSlots() const {
+    return GetBlock<uint32_t>(GetHeader().mHashSlots);
+  }
+
   template <typename T>
   RangedPtr<const T> GetBlock(const DataBlock& aBlock) const {
     return RangedPtr<uint8_t>(&mMap.get<uint8_t>()[aBlock.mOffset],
@@ -816,6 +832,13 @@ class MOZ_RAII SharedPrefMapBuilder {
     uint8_t mIsSkippedByIteration : 1;
   };
 
+  // Computes the perfect hash tables for the given (sorted) entries. aBases
+  // receives the basis of each bucket, and aSlots the index into aEntries of
+  // the entry which hashes to each slot.
+  static void BuildPerfectHash(const nsTArray<Entry*>& aEntries,
+                               nsTArray<uint32_t>& aBases,
+                               nsTArray<uint32_t>& aSlots);
+
   // Converts a builder Value struct to a SharedPrefMap::Value struct for
   // serialization. This must not be called before callers have finished adding
   // entries to the value array builders.
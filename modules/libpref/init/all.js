@@ -1049,6 +1049,9 @@ pref("javascript.options.mem.gc_balanced_heap_limits", false);
 // JSGC_HEAP_GROWTH_FACTOR
 pref("javascript.options.mem.gc_heap_growth_factor", 50);
 
+// JSGC_TARGET_GC_OVERHEAD_PERCENT
+pref("javascript.options.mem.gc_target_overhead_percent", 0);
+
 // JSGC_ALLOCATION_THRESHOLD
 pref("javascript.options.mem.gc_allocation_threshold_mb", 27);
 
@@ -1064,6 +1067,9 @@ pref("javascript.options.mem.gc_large_heap_incremental_limit", 110);
 // JSGC_URGENT_THRESHOLD_MB
 pref("javascript.options.mem.gc_urgent_threshold_mb", 16);
 
+// JSGC_PARALLEL_MINOR_GC_SWEEPING_ENABLED
+pref("javascript.options.mem.gc_parallel_minor_sweeping", true);
+
 // JSGC_MIN_EMPTY_CHUNK_COUNT
 pref("javascript.options.mem.gc_min_empty_chunk_count", 1);
 
@@ -17,6 +17,11 @@
 
 #  include <immintrin.h>
 
+#elif defined(__ARM_NEON) && MOZ_LITTLE_ENDIAN()
+
+#  include <arm_neon.h>
+#  define MOZILLA_SIMD_NEON 1
+
 #endif
 
 namespace mozilla {
@@ -34,6 +39,38 @@ const TValue* FindInBufferNaive(const TValue* ptr, TValue value,
   return nullptr;
 }
 
+template <typename TValue>
+const TValue* FindTwoOrBelowInBufferNaive(const TValue* ptr, TValue v1,
+                                          TValue v2, TValue below,
+                                          size_t length) {
+  MOZ_ASSERT(below > 0);
+  const TValue* end = ptr + length;
+  while (ptr < end) {
+    if (*ptr == v1 || *ptr == v2 || *ptr < below) {
+      return ptr;
+    }
+    ptr++;
+  }
+  return nullptr;
+}
+
+template <typename TValue>
+const TValue* FindThreeOrOutsideInBufferNaive(const TValue* ptr, TValue v1,
+                                              TValue v2, TValue v3,
+                                              TValue low, TValue high,
+                                              size_t length) {
+  MOZ_ASSERT(low > 0 && low < high);
+  const TValue* end = ptr + length;
+  while (ptr < end) {
+    if (*ptr == v1 || *ptr == v2 || *ptr == v3 || *ptr < low ||
+        *ptr >= high) {
+      return ptr;
+    }
+    ptr++;
+  }
+  return nullptr;
+}
+
 #ifdef MOZILLA_PRESUME_SSE2
 
 const __m128i* Cast128(uintptr_t ptr) {
@@ -429,6 +466,150 @@ const TValue* FindTwoInBuffer(const TValue* ptr, TValue v1, TValue v2,
                                   nullptr, HaystackOverlap::Overlapping);
 }
 
+template <typename TValue>
+__m128i Splat128(TValue value) {
+  static_assert(sizeof(TValue) == 1 || sizeof(TValue) == 2);
+  if (sizeof(TValue) == 1) {
+    return _mm_set1_epi8(static_cast<char>(value));
+  }
+  return _mm_set1_epi16(static_cast<short>(value));
+}
+
+template <typename TValue>
+__m128i SubSaturated128(__m128i a, __m128i b) {
+  static_assert(sizeof(TValue) == 1 || sizeof(TValue) == 2);
+  if (sizeof(TValue) == 1) {
+    return _mm_subs_epu8(a, b);
+  }
+  return _mm_subs_epu16(a, b);
+}
+
+// Return the movemask of the elements of the 16-byte chunk at `ptr` which are
+// equal to needle1 or needle2, or which are less than or equal to maxLow. An
+// unsigned saturated subtraction of maxLow yields zero exactly for the
+// elements which are less than or equal to it, which saves us from needing
+// unsigned comparisons that SSE2 doesn't have.
+template <typename TValue>
+int Check16BytesForTwoOrBelow(__m128i needle1, __m128i needle2, __m128i maxLow,
+                              uintptr_t ptr) {
+  __m128i haystack = _mm_loadu_si128(Cast128(ptr));
+  __m128i cmp1 = CmpEq128<TValue>(needle1, haystack);
+  __m128i cmp2 = CmpEq128<TValue>(needle2, haystack);
+  __m128i cmpLow = CmpEq128<TValue>(SubSaturated128<TValue>(haystack, maxLow),
+                                    _mm_setzero_si128());
+  return _mm_movemask_epi8(_mm_or_si128(_mm_or_si128(cmp1, cmp2), cmpLow));
+}
+
+template <typename TValue>
+const TValue* FindTwoOrBelowInBuffer(const TValue* ptr, TValue v1, TValue v2,
+                                     TValue below, size_t length) {
+  static_assert(sizeof(TValue) == 1 || sizeof(TValue) == 2);
+  static_assert(std::is_unsigned<TValue>::value);
+  MOZ_ASSERT(below > 0);
+
+  size_t numBytes = length * sizeof(TValue);
+  if (numBytes < 16) {
+    return FindTwoOrBelowInBufferNaive<TValue>(ptr, v1, v2, below, length);
+  }
+
+  __m128i needle1 = Splat128<TValue>(v1);
+  __m128i needle2 = Splat128<TValue>(v2);
+  __m128i maxLow = Splat128<TValue>(below - 1);
+
+  uintptr_t cur = reinterpret_cast<uintptr_t>(ptr);
+  uintptr_t end = cur + numBytes;
+
+  // The returned characters are usually found quickly (e.g. the end of a short
+  // string), so we don't bother aligning or unrolling this loop.
+  while (cur + 16 <= end) {
+    int cmpMask = Check16BytesForTwoOrBelow<TValue>(needle1, needle2, maxLow,
+                                                    cur);
+    if (cmpMask) {
+      return reinterpret_cast<const TValue*>(cur + __builtin_ctz(cmpMask));
+    }
+    cur += 16;
+  }
+
+  // Check the remaining bytes with a final load overlapping what we already
+  // checked, which contained no match.
+  if (cur < end) {
+    uintptr_t tail = end - 16;
+    int cmpMask = Check16BytesForTwoOrBelow<TValue>(needle1, needle2, maxLow,
+                                                    tail);
+    if (cmpMask) {
+      return reinterpret_cast<const TValue*>(tail + __builtin_ctz(cmpMask));
+    }
+  }
+
+  return nullptr;
+}
+
+// Return the movemask of the elements of the 16-byte chunk at `ptr` which are
+// equal to one of the needles, or which are not in the range
+// [maxLow + 1, maxHigh]. See Check16BytesForTwoOrBelow for how the saturated
+// subtractions implement the unsigned comparisons.
+template <typename TValue>
+int Check16BytesForThreeOrOutside(__m128i needle1, __m128i needle2,
+                                  __m128i needle3, __m128i maxLow,
+                                  __m128i maxHigh, uintptr_t ptr) {
+  __m128i haystack = _mm_loadu_si128(Cast128(ptr));
+  __m128i zero = _mm_setzero_si128();
+  __m128i cmp1 = CmpEq128<TValue>(needle1, haystack);
+  __m128i cmp2 = CmpEq128<TValue>(needle2, haystack);
+  __m128i cmp3 = CmpEq128<TValue>(needle3, haystack);
+  __m128i cmpLow =
+      CmpEq128<TValue>(SubSaturated128<TValue>(haystack, maxLow), zero);
+  __m128i notHigh =
+      CmpEq128<TValue>(SubSaturated128<TValue>(haystack, maxHigh), zero);
+  __m128i matches =
+      _mm_or_si128(_mm_or_si128(cmp1, cmp2), _mm_or_si128(cmp3, cmpLow));
+  return _mm_movemask_epi8(matches) | (_mm_movemask_epi8(notHigh) ^ 0xffff);
+}
+
+template <typename TValue>
+const TValue* FindThreeOrOutsideInBuffer(const TValue* ptr, TValue v1,
+                                         TValue v2, TValue v3, TValue low,
+                                         TValue high, size_t length) {
+  static_assert(sizeof(TValue) == 1 || sizeof(TValue) == 2);
+  static_assert(std::is_unsigned<TValue>::value);
+  MOZ_ASSERT(low > 0 && low < high);
+
+  size_t numBytes = length * sizeof(TValue);
+  if (numBytes < 16) {
+    return FindThreeOrOutsideInBufferNaive<TValue>(ptr, v1, v2, v3, low, high,
+                                                   length);
+  }
+
+  __m128i needle1 = Splat128<TValue>(v1);
+  __m128i needle2 = Splat128<TValue>(v2);
+  __m128i needle3 = Splat128<TValue>(v3);
+  __m128i maxLow = Splat128<TValue>(low - 1);
+  __m128i maxHigh = Splat128<TValue>(high - 1);
+
+  uintptr_t cur = reinterpret_cast<uintptr_t>(ptr);
+  uintptr_t end = cur + numBytes;
+
+  while (cur + 16 <= end) {
+    int cmpMask = Check16BytesForThreeOrOutside<TValue>(
+        needle1, needle2, needle3, maxLow, maxHigh, cur);
+    if (cmpMask) {
+      return reinterpret_cast<const TValue*>(cur + __builtin_ctz(cmpMask));
+    }
+    cur += 16;
+  }
+
+  if (cur < end) {
+    uintptr_t tail = end - 16;
+    int cmpMask = Check16BytesForThreeOrOutside<TValue>(
+        needle1, needle2, needle3, maxLow, maxHigh, tail);
+    if (cmpMask) {
+      return reinterpret_cast<const TValue*>(tail + __builtin_ctz(cmpMask));
+    }
+  }
+
+  return nullptr;
+}
+
 const char* SIMD::memchr8SSE2(const char* ptr, char value, size_t length) {
   // Signed chars are just really annoying to do bit logic with. Convert to
   // unsigned at the outermost scope so we don't have to worry about it.
@@ -502,8 +683,116 @@ const char16_t* SIMD::memchr2x16(const char16_t* ptr, char16_t v1, char16_t v2,
   return FindTwoInBuffer<char16_t>(ptr, v1, v2, length);
 }
 
+const char* SIMD::memchr2OrBelow8(const char* ptr, char v1, char v2,
+                                  char below, size_t length) {
+  const unsigned char* uptr = reinterpret_cast<const unsigned char*>(ptr);
+  const unsigned char* uresult = FindTwoOrBelowInBuffer<unsigned char>(
+      uptr, static_cast<unsigned char>(v1), static_cast<unsigned char>(v2),
+      static_cast<unsigned char>(below), length);
+  return reinterpret_cast<const char*>(uresult);
+}
+
+const char16_t* SIMD::memchr2OrBelow16(const char16_t* ptr, char16_t v1,
+                                       char16_t v2, char16_t below,
+                                       size_t length) {
+  return FindTwoOrBelowInBuffer<char16_t>(ptr, v1, v2, below, length);
+}
+
+const char* SIMD::memchr3OrOutside8(const char* ptr, char v1, char v2,
+                                    char v3, char low, char high,
+                                    size_t length) {
+  const unsigned char* uptr = reinterpret_cast<const unsigned char*>(ptr);
+  const unsigned char* uresult = FindThreeOrOutsideInBuffer<unsigned char>(
+      uptr, static_cast<unsigned char>(v1), static_cast<unsigned char>(v2),
+      static_cast<unsigned char>(v3), static_cast<unsigned char>(low),
+      static_cast<unsigned char>(high), length);
+  return reinterpret_cast<const char*>(uresult);
+}
+
+const char16_t* SIMD::memchr3OrOutside16(const char16_t* ptr, char16_t v1,
+                                         char16_t v2, char16_t v3,
+                                         char16_t low, char16_t high,
+                                         size_t length) {
+  return FindThreeOrOutsideInBuffer<char16_t>(ptr, v1, v2, v3, low, high,
+                                              length);
+}
+
 #else
 
+#  ifdef MOZILLA_SIMD_NEON
+
+// NEON has no movemask instruction. Narrowing a comparison result with a
+// right shift by 4 leaves one nibble per byte lane in a 64-bit value, so the
+// number of trailing zero bits divided by 4 is the index of the first
+// matching byte.
+uint64_t NibbleMask(uint8x16_t cmp) {
+  return vget_lane_u64(
+      vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(cmp), 4)), 0);
+}
+
+const char16_t* FindInBufferNeon(const char16_t* ptr, char16_t value,
+                                 size_t length) {
+  const char16_t* end = ptr + length;
+  uint16x8_t needle = vdupq_n_u16(value);
+  for (; end - ptr >= 8; ptr += 8) {
+    uint16x8_t haystack = vld1q_u16(reinterpret_cast<const uint16_t*>(ptr));
+    uint64_t mask =
+        NibbleMask(vreinterpretq_u8_u16(vceqq_u16(haystack, needle)));
+    if (mask) {
+      return ptr + __builtin_ctzll(mask) / 8;
+    }
+  }
+  return FindInBufferNaive<char16_t>(ptr, value, end - ptr);
+}
+
+// A match can start at most at length - 2, and each vector iteration also
+// reads the element after the ones it checks.
+const char* FindTwoInBufferNeon(const char* ptr, char v1, char v2,
+                                size_t length) {
+  const char* end = ptr + length - 1;
+  uint8x16_t needle1 = vdupq_n_u8(static_cast<uint8_t>(v1));
+  uint8x16_t needle2 = vdupq_n_u8(static_cast<uint8_t>(v2));
+  for (; end - ptr >= 16; ptr += 16) {
+    const uint8_t* cur = reinterpret_cast<const uint8_t*>(ptr);
+    uint8x16_t cmp = vandq_u8(vceqq_u8(vld1q_u8(cur), needle1),
+                              vceqq_u8(vld1q_u8(cur + 1), needle2));
+    uint64_t mask = NibbleMask(cmp);
+    if (mask) {
+      return ptr + __builtin_ctzll(mask) / 4;
+    }
+  }
+  for (; ptr < end; ptr++) {
+    if (ptr[0] == v1 && ptr[1] == v2) {
+      return ptr;
+    }
+  }
+  return nullptr;
+}
+
+const char16_t* FindTwoInBufferNeon(const char16_t* ptr, char16_t v1,
+                                    char16_t v2, size_t length) {
+  const char16_t* end = ptr + length - 1;
+  uint16x8_t needle1 = vdupq_n_u16(v1);
+  uint16x8_t needle2 = vdupq_n_u16(v2);
+  for (; end - ptr >= 8; ptr += 8) {
+    const uint16_t* cur = reinterpret_cast<const uint16_t*>(ptr);
+    uint16x8_t cmp = vandq_u16(vceqq_u16(vld1q_u16(cur), needle1),
+                               vceqq_u16(vld1q_u16(cur + 1), needle2));
+    uint64_t mask = NibbleMask(vreinterpretq_u8_u16(cmp));
+    if (mask) {
+      return ptr + __builtin_ctzll(mask) / 8;
+    }
+  }
+  for (; ptr < end; ptr++) {
+    if (ptr[0] == v1 && ptr[1] == v2) {
+      return ptr;
+    }
+  }
+  return nullptr;
+}
+
+#  endif
+
 const char* SIMD::memchr8(const char* ptr, char value, size_t length) {
   const void* result = ::memchr(reinterpret_cast<const void*>(ptr),
                                 static_cast<int>(value), length);
@@ -516,7 +805,11 @@ const char* SIMD::memchr8SSE2(const char* ptr, char value, size_t length) {
 
 const char16_t* SIMD::memchr16(const char16_t* ptr, char16_t value,
                                size_t length) {
+#  ifdef MOZILLA_SIMD_NEON
+  return FindInBufferNeon(ptr, value, length);
+#  else
   return FindInBufferNaive<char16_t>(ptr, value, length);
+#  endif
 }
 
 const char16_t* SIMD::memchr16SSE2(const char16_t* ptr, char16_t value,
@@ -530,6 +823,9 @@ const uint64_t* SIMD::memchr64(const uint64_t* ptr, uint64_t value,
 }
 
 const char* SIMD::memchr2x8(const char* ptr, char v1, char v2, size_t length) {
+#  ifdef MOZILLA_SIMD_NEON
+  return FindTwoInBufferNeon(ptr, v1, v2, length);
+#  else
   const char* end = ptr + length - 1;
   while (ptr < end) {
     ptr = memchr8(ptr, v1, end - ptr);
@@ -542,10 +838,14 @@ const char* SIMD::memchr2x8(const char* ptr, char v1, char v2, size_t length) {
     ptr++;
   }
   return nullptr;
+#  endif
 }
 
 const char16_t* SIMD::memchr2x16(const char16_t* ptr, char16_t v1, char16_t v2,
                                  size_t length) {
+#  ifdef MOZILLA_SIMD_NEON
+  return FindTwoInBufferNeon(ptr, v1, v2, length);
+#  else
   const char16_t* end = ptr + length - 1;
   while (ptr < end) {
     ptr = memchr16(ptr, v1, end - ptr);
@@ -558,6 +858,42 @@ const char16_t* SIMD::memchr2x16(const char16_t* ptr, char16_t v1, char16_t v2,
     ptr++;
   }
   return nullptr;
+#  endif
+}
+
+const char* SIMD::memchr2OrBelow8(const char* ptr, char v1, char v2,
+                                  char below, size_t length) {
+  const unsigned char* uptr = reinterpret_cast<const unsigned char*>(ptr);
+  const unsigned char* uresult = FindTwoOrBelowInBufferNaive<unsigned char>(
+      uptr, static_cast<unsigned char>(v1), static_cast<unsigned char>(v2),
+      static_cast<unsigned char>(below), length);
+  return reinterpret_cast<const char*>(uresult);
+}
+
+const char16_t* SIMD::memchr2OrBelow16(const char16_t* ptr, char16_t v1,
+                                       char16_t v2, char16_t below,
+                                       size_t length) {
+  return FindTwoOrBelowInBufferNaive<char16_t>(ptr, v1, v2, below, length);
+}
+
+const char* SIMD::memchr3OrOutside8(const char* ptr, char v1, char v2,
+                                    char v3, char low, char high,
+                                    size_t length) {
+  const unsigned char* uptr = reinterpret_cast<const unsigned char*>(ptr);
+  const unsigned char* uresult =
+      FindThreeOrOutsideInBufferNaive<unsigned char>(
+          uptr, static_cast<unsigned char>(v1), static_cast<unsigned char>(v2),
+          static_cast<unsigned char>(v3), static_cast<unsigned char>(low),
+          static_cast<unsigned char>(high), length);
+  return reinterpret_cast<const char*>(uresult);
+}
+
+const char16_t* SIMD::memchr3OrOutside16(const char16_t* ptr, char16_t v1,
+                                         char16_t v2, char16_t v3,
+                                         char16_t low, char16_t high,
+                                         size_t length) {
+  return FindThreeOrOutsideInBufferNaive<char16_t>(ptr, v1, v2, v3, low, high,
+                                                   length);
 }
 
 #endif
@@ -74,6 +74,38 @@ class SIMD {
   // `v1`.
   static MFBT_API const char16_t* memchr2x16(const char16_t* ptr, char16_t v1,
                                              char16_t v2, size_t length);
+
+  // Search through `ptr[0..length]` for the first occurrence of either `v1` or
+  // `v2`, or of any value (compared as unsigned) less than `below`, and return
+  // the pointer to it, or nullptr if it cannot be found. `below` must be
+  // non-zero.
+  static MFBT_API const char* memchr2OrBelow8(const char* ptr, char v1,
+                                              char v2, char below,
+                                              size_t length);
+
+  // Search through `ptr[0..length]` for the first occurrence of either `v1` or
+  // `v2`, or of any value less than `below`, and return the pointer to it, or
+  // nullptr if it cannot be found. `below` must be non-zero.
+  static MFBT_API const char16_t* memchr2OrBelow16(const char16_t* ptr,
+                                                   char16_t v1, char16_t v2,
+                                                   char16_t below,
+                                                   size_t length);
+
+  // Search through `ptr[0..length]` for the first occurrence of `v1`, `v2` or
+  // `v3`, or of any value (compared as unsigned) outside of the range
+  // `[low, high)`, and return the pointer to it, or nullptr if it cannot be
+  // found. `low` must be non-zero and less than `high`.
+  static MFBT_API const char* memchr3OrOutside8(const char* ptr, char v1,
+                                                char v2, char v3, char low,
+                                                char high, size_t length);
+
+  // Search through `ptr[0..length]` for the first occurrence of `v1`, `v2` or
+  // `v3`, or of any value outside of the range `[low, high)`, and return the
+  // pointer to it, or nullptr if it cannot be found. `low` must be non-zero
+  // and less than `high`.
+  static MFBT_API const char16_t* memchr3OrOutside16(
+      const char16_t* ptr, char16_t v1, char16_t v2, char16_t v3, char16_t low,
+      char16_t high, size_t length);
 };
 
 }  // namespace mozilla
@@ -271,6 +271,9 @@ class ExecutePACThreadAction final : public Runnable {
     if (mSetupPAC) {
       mSetupPAC = false;
 
+      // Results of the old script must not be returned for the new one.
+      mPACMan->mResultCache.Clear();
+
       nsCOMPtr<nsIEventTarget> target = mPACMan->GetNeckoTarget();
       mPACMan->mPAC->ConfigurePAC(mSetupPACURI, mSetupPACData,
                                   mPACMan->mIncludePath, mExtraHeapSize,
@@ -847,10 +850,34 @@ bool nsPACMan::ProcessPending() {
   }
 
   // the systemproxysettings didn't complete the resolution. try via PAC
+  nsAutoCString cacheKey;
+  if (!completed && !mIncludePath &&
+      StaticPrefs::network_proxy_pac_result_cache_ttl()) {
+    // ProxyAutoConfig cuts off everything after the authority, so that is
+    // all the script gets to see.
+    cacheKey = query->mSpec;
+    int32_t authority = cacheKey.Find("://");
+    if (authority != kNotFound) {
+      int32_t path = cacheKey.FindChar('/', authority + 3);
+      if (path != kNotFound) {
+        cacheKey.Truncate(path);
+      }
+    }
+    if (GetCachedPACResult(cacheKey, pacString)) {
+      LOG(("Use cached proxy from PAC: %s\n", pacString.get()));
+      query->Complete(NS_OK, pacString);
+      completed = true;
+    }
+  }
+
   if (!completed) {
-    auto callback = [query(query)](nsresult aStatus,
-                                   const nsACString& aResult) {
+    auto callback = [self = RefPtr{this}, query(query),
+                     cacheKey(nsCString(cacheKey))](nsresult aStatus,
+                                                    const nsACString& aResult) {
       LOG(("Use proxy from PAC: %s\n", PromiseFlatCString(aResult).get()));
+      if (NS_SUCCEEDED(aStatus) && !cacheKey.IsEmpty()) {
+        self->CachePACResult(cacheKey, aResult);
+      }
       query->Complete(aStatus, aResult);
     };
     mPAC->GetProxyForURIWithCallback(query->mSpec, query->mHost,
@@ -861,6 +888,36 @@ bool nsPACMan::ProcessPending() {
   return true;
 }
 
+bool nsPACMan::GetCachedPACResult(const nsACString& aKey,
+                                  nsACString& aResult) {
+  MOZ_ASSERT(!NS_IsMainThread(), "wrong thread");
+  auto entry = mResultCache.Lookup(aKey);
+  if (!entry) {
+    return false;
+  }
+  if (TimeStamp::Now() > entry->mExpires) {
+    entry.Remove();
+    return false;
+  }
+  aResult = entry->mResult;
+  return true;
+}
+
+void nsPACMan::CachePACResult(const nsACString& aKey,
+                              const nsACString& aResult) {
+  MOZ_ASSERT(!NS_IsMainThread(), "wrong thread");
+  // Keep the cache bounded. Hosts are looked up in bursts, so starting over
+  // is good enough.
+  static const uint32_t kMaxCachedPACResults = 512;
+  if (mResultCache.Count() >= kMaxCachedPACResults) {
+    mResultCache.Clear();
+  }
+  TimeDuration ttl = TimeDuration::FromSeconds(
+      StaticPrefs::network_proxy_pac_result_cache_ttl());
+  mResultCache.InsertOrUpdate(
+      aKey, CachedPACResult{nsCString(aResult), TimeStamp::Now() + ttl});
+}
+
 NS_IMPL_ISUPPORTS(nsPACMan, nsIStreamLoaderObserver, nsIInterfaceRequestor,
                   nsIChannelEventSink)
 
@@ -21,6 +21,7 @@
 #include "nsThreadUtils.h"
 #include "nsIURI.h"
 #include "nsString.h"
+#include "nsTHashMap.h"
 #include "ProxyAutoConfig.h"
 
 class nsISystemProxySettings;
@@ -249,6 +250,12 @@ class nsPACMan final : public nsIStreamLoaderObserver,
   nsresult GetPACFromDHCP(nsACString& aSpec);
   nsresult ConfigureWPAD(nsACString& aSpec);
 
+  // PAC thread operations only. The cache is only used when the PAC script
+  // doesn't see the path of the URI, so its result only depends on the
+  // scheme and authority. See network.proxy.pac_result_cache_ttl.
+  bool GetCachedPACResult(const nsACString& aKey, nsACString& aResult);
+  void CachePACResult(const nsACString& aKey, const nsACString& aResult);
+
  private:
   /**
    * Dispatches a runnable to the PAC processing thread. Handles lazy
@@ -267,6 +274,12 @@ class nsPACMan final : public nsIStreamLoaderObserver,
 
   LinkedList<PendingPACQuery> mPendingQ; /* pac thread only */
 
+  struct CachedPACResult {
+    nsCString mResult;
+    TimeStamp mExpires;
+  };
+  nsTHashMap<nsCStringHashKey, CachedPACResult> mResultCache; /* pac thread */
+
   // These specs are not nsIURI so that they can be used off the main thread.
   // The non-normalized versions are directly from the configuration, the
   // normalized version has been extracted from an nsIURI
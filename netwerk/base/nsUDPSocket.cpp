@@ -34,6 +34,12 @@
 #include "HttpConnectionUDP.h"
 #include "mozilla/StaticPrefs_network.h"
 
+#if defined(XP_LINUX) && !defined(FUZZING)
+#  include <errno.h>
+#  include <netinet/in.h>
+#  include <sys/socket.h>
+#endif
+
 #if defined(FUZZING)
 #  include "FuzzyLayer.h"
 #  include "mozilla/StaticPrefs_fuzzing.h"
@@ -1233,6 +1239,125 @@ nsUDPSocket::RecvWithAddr(NetAddr* addr, nsTArray<uint8_t>& aData) {
   return NS_OK;
 }
 
+#if defined(XP_LINUX) && !defined(FUZZING)
+static const uint32_t kRecvBatchSize = 16;
+static const uint32_t kRecvBatchDatagramSize = 9216;
+
+static bool SockAddrToNetAddr(const struct sockaddr_storage* aSockAddr,
+                              NetAddr* aAddr) {
+  if (aSockAddr->ss_family == AF_INET) {
+    const auto* sin = reinterpret_cast<const struct sockaddr_in*>(aSockAddr);
+    aAddr->inet.family = AF_INET;
+    aAddr->inet.port = sin->sin_port;
+    aAddr->inet.ip = sin->sin_addr.s_addr;
+    return true;
+  }
+  if (aSockAddr->ss_family == AF_INET6) {
+    const auto* sin6 = reinterpret_cast<const struct sockaddr_in6*>(aSockAddr);
+    aAddr->inet6.family = AF_INET6;
+    aAddr->inet6.port = sin6->sin6_port;
+    aAddr->inet6.flowinfo = sin6->sin6_flowinfo;
+    memcpy(&aAddr->inet6.ip, &sin6->sin6_addr, sizeof(aAddr->inet6.ip.u8));
+    aAddr->inet6.scope_id = sin6->sin6_scope_id;
+    return true;
+  }
+  return false;
+}
+#endif
+
+NS_IMETHODIMP
+nsUDPSocket::RecvBatchWithAddr(uint32_t aMaxCount, nsTArray<NetAddr>& aAddrs,
+                               nsTArray<nsTArray<uint8_t>>& aData) {
+  MOZ_ASSERT(OnSocketThread(), "not on socket thread");
+
+#if defined(XP_LINUX) && !defined(FUZZING)
+  // Use recvmmsg() to receive the whole batch with one system call. The
+  // socket is non-blocking, so it returns as soon as no datagram is pending.
+  if (!mFD) {
+    return NS_OK;
+  }
+  if (!mRecvBatchBuffer) {
+    mRecvBatchBuffer =
+        MakeUnique<char[]>(kRecvBatchSize * kRecvBatchDatagramSize);
+  }
+
+  int fd = PR_FileDesc2NativeHandle(mFD);
+  while (aData.Length() < aMaxCount) {
+    uint32_t count = std::min(aMaxCount - uint32_t(aData.Length()),
+                              kRecvBatchSize);
+
+    struct mmsghdr msgs[kRecvBatchSize];
+    struct iovec iovs[kRecvBatchSize];
+    struct sockaddr_storage addrs[kRecvBatchSize];
+    memset(msgs, 0, sizeof(msgs));
+    for (uint32_t i = 0; i < count; i++) {
+      iovs[i].iov_base = mRecvBatchBuffer.get() + i * kRecvBatchDatagramSize;
+      iovs[i].iov_len = kRecvBatchDatagramSize;
+      msgs[i].msg_hdr.msg_iov = &iovs[i];
+      msgs[i].msg_hdr.msg_iovlen = 1;
+      msgs[i].msg_hdr.msg_name = &addrs[i];
+      msgs[i].msg_hdr.msg_namelen = sizeof(addrs[i]);
+    }
+
+    int received = recvmmsg(fd, msgs, count, MSG_DONTWAIT, nullptr);
+    if (received <= 0) {
+      if (received < 0 && errno == EINTR) {
+        continue;
+      }
+      UDPSOCKET_LOG(
+          ("nsUDPSocket::RecvBatchWithAddr: recvmmsg failed [this=%p, "
+           "errno=%d]\n",
+           this, errno));
+      return NS_OK;
+    }
+
+    for (int i = 0; i < received; i++) {
+      NetAddr addr;
+      if (!SockAddrToNetAddr(&addrs[i], &addr)) {
+        continue;
+      }
+      uint32_t length = msgs[i].msg_len;
+      mByteReadCount += length;
+      nsTArray<uint8_t>* datagram = aData.AppendElement(fallible);
+      if (!datagram ||
+          !datagram->AppendElements(
+              reinterpret_cast<uint8_t*>(iovs[i].iov_base), length,
+              fallible) ||
+          !aAddrs.AppendElement(addr, fallible)) {
+        UDPSOCKET_LOG(
+            ("nsUDPSocket::RecvBatchWithAddr: AppendElements FAILED "
+             "[this=%p]\n",
+             this));
+        mCondition = NS_ERROR_UNEXPECTED;
+        aData.TruncateLength(aAddrs.Length());
+        return NS_OK;
+      }
+    }
+
+    if (uint32_t(received) < count) {
+      break;
+    }
+  }
+  return NS_OK;
+#else
+  while (aData.Length() < aMaxCount) {
+    NetAddr addr;
+    nsTArray<uint8_t> datagram;
+    MOZ_ALWAYS_SUCCEEDS(RecvWithAddr(&addr, datagram));
+    if (datagram.IsEmpty() || NS_FAILED(mCondition)) {
+      break;
+    }
+    if (!aData.AppendElement(std::move(datagram), fallible) ||
+        !aAddrs.AppendElement(addr, fallible)) {
+      mCondition = NS_ERROR_UNEXPECTED;
+      aData.TruncateLength(aAddrs.Length());
+      break;
+    }
+  }
+  return NS_OK;
+#endif
+}
+
 nsresult nsUDPSocket::SetSocketOption(const PRSocketOptionData& aOpt) {
   bool onSTSThread = false;
   mSts->IsOnCurrentThread(&onSTSThread);
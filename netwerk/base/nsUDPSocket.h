@@ -8,6 +8,7 @@
 
 #include "nsIUDPSocket.h"
 #include "mozilla/Mutex.h"
+#include "mozilla/UniquePtr.h"
 #include "mozilla/net/DNS.h"
 #include "nsIOutputStream.h"
 #include "nsASocketHandler.h"
@@ -71,6 +72,11 @@ class nsUDPSocket final : public nsASocketHandler, public nsIUDPSocket {
 
   uint64_t mByteReadCount{0};
   uint64_t mByteWriteCount{0};
+
+#if defined(XP_LINUX) && !defined(FUZZING)
+  // Receive buffers for RecvBatchWithAddr(), allocated on first use.
+  UniquePtr<char[]> mRecvBatchBuffer;
+#endif
 };
 
 //-----------------------------------------------------------------------------
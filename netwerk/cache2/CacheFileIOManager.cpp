@@ -36,8 +36,9 @@
 #include "nsNetUtil.h"
 #include "prproces.h"
 
-// include files for ftruncate (or equivalent)
+// include files for ftruncate and pread (or equivalent)
 #if defined(XP_UNIX)
+#  include <errno.h>
 #  include <unistd.h>
 #elif defined(XP_WIN)
 #  include <windows.h>
@@ -1852,6 +1853,62 @@ nsresult CacheFileIOManager::Read(CacheFileHandle* aHandle, int64_t aOffset,
   return NS_OK;
 }
 
+// Positional reads and writes. On Unix they need a single syscall instead of
+// a seek followed by the transfer, which matters since all cache I/O is
+// serialized on the IO thread. The file position is left unspecified, all
+// other users of the descriptors seek before reading or writing.
+static int32_t ReadAt(PRFileDesc* aFD, int64_t aOffset, char* aBuf,
+                      int32_t aCount) {
+#if defined(XP_UNIX)
+  int fd = PR_FileDesc2NativeHandle(aFD);
+  int32_t total = 0;
+  while (total < aCount) {
+    ssize_t n = pread(fd, aBuf + total, aCount - total, aOffset + total);
+    if (n < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return -1;
+    }
+    if (n == 0) {
+      break;
+    }
+    total += n;
+  }
+  return total;
+#else
+  if (PR_Seek64(aFD, aOffset, PR_SEEK_SET) == -1) {
+    return -1;
+  }
+  return PR_Read(aFD, aBuf, aCount);
+#endif
+}
+
+static int32_t WriteAt(PRFileDesc* aFD, int64_t aOffset, const char* aBuf,
+                       int32_t aCount) {
+#if defined(XP_UNIX)
+  int fd = PR_FileDesc2NativeHandle(aFD);
+  int32_t total = 0;
+  while (total < aCount) {
+    ssize_t n = pwrite(fd, aBuf + total, aCount - total, aOffset + total);
+    if (n < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      // Report the data written so far, so that the file size stays in sync.
+      return total ? total : -1;
+    }
+    total += n;
+  }
+  return total;
+#else
+  if (PR_Seek64(aFD, aOffset, PR_SEEK_SET) == -1) {
+    return -1;
+  }
+  return PR_Write(aFD, aBuf, aCount);
+#endif
+}
+
 nsresult CacheFileIOManager::ReadInternal(CacheFileHandle* aHandle,
                                           int64_t aOffset, char* aBuf,
                                           int32_t aCount) {
@@ -1886,12 +1943,7 @@ nsresult CacheFileIOManager::ReadInternal(CacheFileHandle* aHandle,
     return NS_ERROR_NOT_AVAILABLE;
   }
 
-  int64_t offset = PR_Seek64(aHandle->mFD, aOffset, PR_SEEK_SET);
-  if (offset == -1) {
-    return NS_ERROR_FAILURE;
-  }
-
-  int32_t bytesRead = PR_Read(aHandle->mFD, aBuf, aCount);
+  int32_t bytesRead = ReadAt(aHandle->mFD, aOffset, aBuf, aCount);
   if (bytesRead != aCount) {
     return NS_ERROR_FAILURE;
   }
@@ -2035,12 +2087,7 @@ nsresult CacheFileIOManager::WriteInternal(CacheFileHandle* aHandle,
   // Write invalidates the entry by default
   aHandle->mInvalid = true;
 
-  int64_t offset = PR_Seek64(aHandle->mFD, aOffset, PR_SEEK_SET);
-  if (offset == -1) {
-    return NS_ERROR_FAILURE;
-  }
-
-  int32_t bytesWritten = PR_Write(aHandle->mFD, aBuf, aCount);
+  int32_t bytesWritten = WriteAt(aHandle->mFD, aOffset, aBuf, aCount);
 
   if (bytesWritten != -1) {
     uint32_t oldSizeInK = aHandle->FileSizeInK();
@@ -280,6 +280,81 @@ NS_IMPL_ISUPPORTS(FileOpenHelper, CacheFileIOListener);
 
 StaticRefPtr<CacheIndex> CacheIndex::gInstance;
 StaticMutex CacheIndex::sLock;
+Atomic<uint32_t> CacheIndex::sLockFreeLookupState(0);
+
+Atomic<uint32_t> CacheIndexEntryFilter::sWords[(1 << kCounterBits) /
+                                                 kCountersPerWord];
+
+// static
+void CacheIndexEntryFilter::GetCounters(const SHA1Sum::Hash* aHash,
+                                        uint32_t (&aIndexes)[2]) {
+  // The hash is uniformly distributed. The first word is already used by
+  // CacheIndexEntry::HashKey(), so use the following ones.
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(aHash);
+  aIndexes[0] = NetworkEndian::readUint32(bytes + 4) >> (32 - kCounterBits);
+  aIndexes[1] = NetworkEndian::readUint32(bytes + 8) >> (32 - kCounterBits);
+}
+
+// static
+uint32_t CacheIndexEntryFilter::Count(uint32_t aIndex) {
+  uint32_t shift = (aIndex % kCountersPerWord) * 8;
+  return (sWords[aIndex / kCountersPerWord] >> shift) & kCounterMax;
+}
+
+// static
+void CacheIndexEntryFilter::Increment(uint32_t aIndex) {
+  Atomic<uint32_t>& word = sWords[aIndex / kCountersPerWord];
+  uint32_t shift = (aIndex % kCountersPerWord) * 8;
+
+  uint32_t old = word;
+  while (((old >> shift) & kCounterMax) != kCounterMax) {
+    if (word.compareExchange(old, old + (1 << shift))) {
+      return;
+    }
+    old = word;
+  }
+
+  // A saturated counter is never decremented again, so it can't get back to
+  // zero while entries are still counted by it.
+}
+
+// static
+void CacheIndexEntryFilter::Decrement(uint32_t aIndex) {
+  Atomic<uint32_t>& word = sWords[aIndex / kCountersPerWord];
+  uint32_t shift = (aIndex % kCountersPerWord) * 8;
+
+  uint32_t old = word;
+  while (((old >> shift) & kCounterMax) != kCounterMax) {
+    MOZ_ASSERT((old >> shift) & kCounterMax);
+    if (word.compareExchange(old, old - (1 << shift))) {
+      return;
+    }
+    old = word;
+  }
+}
+
+// static
+void CacheIndexEntryFilter::Add(const SHA1Sum::Hash* aHash) {
+  uint32_t indexes[2];
+  GetCounters(aHash, indexes);
+  Increment(indexes[0]);
+  Increment(indexes[1]);
+}
+
+// static
+void CacheIndexEntryFilter::Remove(const SHA1Sum::Hash* aHash) {
+  uint32_t indexes[2];
+  GetCounters(aHash, indexes);
+  Decrement(indexes[0]);
+  Decrement(indexes[1]);
+}
+
+// static
+bool CacheIndexEntryFilter::MightContain(const SHA1Sum::Hash* aHash) {
+  uint32_t indexes[2];
+  GetCounters(aHash, indexes);
+  return Count(indexes[0]) && Count(indexes[1]);
+}
 
 NS_IMPL_ADDREF(CacheIndex)
 NS_IMPL_RELEASE(CacheIndex)
@@ -1202,6 +1277,17 @@ nsresult CacheIndex::HasEntry(
 nsresult CacheIndex::HasEntry(
     const SHA1Sum::Hash& hash, EntryStatus* _retval,
     const std::function<void(const CacheIndexEntry*)>& aCB) {
+  // In READY and WRITING states a missing entry doesn't exist, see below. The
+  // state must not change while we query the filter, otherwise we take the
+  // lock and look again.
+  uint32_t lookupState = sLockFreeLookupState;
+  if ((lookupState & 1) && !CacheIndexEntryFilter::MightContain(&hash) &&
+      lookupState == sLockFreeLookupState) {
+    *_retval = DOES_NOT_EXIST;
+    LOG(("CacheIndex::HasEntry() - result is %u (lock-free)", *_retval));
+    return NS_OK;
+  }
+
   StaticMutexAutoLock lock(sLock);
 
   RefPtr<CacheIndex> index = gInstance;
@@ -3288,6 +3374,7 @@ void CacheIndex::ChangeState(EState aNewState,
   }
 
   mState = aNewState;
+  UpdateLockFreeLookupState();
 
   if (mState != SHUTDOWN) {
     CacheFileIOManager::CacheIndexStateChanged();
@@ -3296,6 +3383,13 @@ void CacheIndex::ChangeState(EState aNewState,
   NotifyAsyncGetDiskConsumptionCallbacks();
 }
 
+void CacheIndex::UpdateLockFreeLookupState() {
+  sLock.AssertCurrentThreadOwns();
+
+  uint32_t canLookup = mState == READY || mState == WRITING;
+  sLockFreeLookupState = ((sLockFreeLookupState >> 1) + 1) << 1 | canLookup;
+}
+
 void CacheIndex::NotifyAsyncGetDiskConsumptionCallbacks() {
   if ((mState == READY || mState == WRITING) &&
       !mAsyncGetDiskConsumptionBlocked && mDiskConsumptionObservers.Length()) {
@@ -15,6 +15,7 @@
 #include "nsIWeakReferenceUtils.h"
 #include "nsTHashtable.h"
 #include "nsThreadUtils.h"
+#include "mozilla/Atomics.h"
 #include "mozilla/IntegerPrintfMacros.h"
 #include "mozilla/SHA1.h"
 #include "mozilla/StaticMutex.h"
@@ -123,6 +124,37 @@ class CacheIndexRecordWrapper final {
   friend class DeleteCacheIndexRecordWrapper;
 };
 
+/**
+ * Counting Bloom filter of the hashes of all living CacheIndexEntry objects,
+ * i.e. of every entry in CacheIndex::mIndex and CacheIndex::mPendingUpdates.
+ * The counters are atomic, so the filter can be queried without holding
+ * CacheIndex::sLock. This lets CacheIndex::HasEntry() answer lookups of
+ * entries which are not in the index, the common case when loading new
+ * resources, without contending on the lock with the IO thread.
+ */
+class CacheIndexEntryFilter final {
+ public:
+  static void Add(const SHA1Sum::Hash* aHash);
+  static void Remove(const SHA1Sum::Hash* aHash);
+
+  // Returns false only if no living entry has this hash.
+  static bool MightContain(const SHA1Sum::Hash* aHash);
+
+ private:
+  // 2^20 saturating 8-bit counters, packed in 32-bit words. Two counters are
+  // used per hash.
+  static const uint32_t kCounterBits = 20;
+  static const uint32_t kCountersPerWord = 4;
+  static const uint32_t kCounterMax = 0xFF;
+
+  static void GetCounters(const SHA1Sum::Hash* aHash, uint32_t (&aIndexes)[2]);
+  static void Increment(uint32_t aIndex);
+  static void Decrement(uint32_t aIndex);
+  static uint32_t Count(uint32_t aIndex);
+
+  static Atomic<uint32_t> sWords[(1 << kCounterBits) / kCountersPerWord];
+};
+
 class CacheIndexEntry : public PLDHashEntryHdr {
  public:
   using KeyType = const SHA1Sum::Hash&;
@@ -134,12 +166,14 @@ class CacheIndexEntry : public PLDHashEntryHdr {
     LOG(("CacheIndexEntry::CacheIndexEntry() - Created record [rec=%p]",
          mRec->Get()));
     memcpy(&mRec->Get()->mHash, aKey, sizeof(SHA1Sum::Hash));
+    CacheIndexEntryFilter::Add(aKey);
   }
   CacheIndexEntry(const CacheIndexEntry& aOther) {
     MOZ_ASSERT_UNREACHABLE("CacheIndexEntry copy constructor is forbidden!");
   }
   ~CacheIndexEntry() {
     MOZ_COUNT_DTOR(CacheIndexEntry);
+    CacheIndexEntryFilter::Remove(&mRec->Get()->mHash);
     LOG(("CacheIndexEntry::~CacheIndexEntry() - Deleting record [rec=%p]",
          mRec->Get()));
   }
@@ -1053,8 +1087,15 @@ class CacheIndex final : public CacheFileIOListener, public nsIRunnable {
   // stats.
   void DoTelemetryReport();
 
+  // Publishes whether HasEntry() may report DOES_NOT_EXIST for entries which
+  // are not in CacheIndexEntryFilter without taking sLock. The lowest bit is
+  // set in READY and WRITING states, the other bits count the state changes
+  // so that readers can detect a change while they query the filter.
+  void UpdateLockFreeLookupState();
+
   static mozilla::StaticRefPtr<CacheIndex> gInstance;
   static StaticMutex sLock MOZ_UNANNOTATED;
+  static Atomic<uint32_t> sLockFreeLookupState;
 
   nsCOMPtr<nsIFile> mCacheDirectory;
 
@@ -463,10 +463,8 @@ CookieService::GetCookieStringFromDocument(Document* aDocument,
     storage->StaleCookies(cookieList, currentTimeInUsec);
   }
 
-  // return cookies in order of path length; longest to shortest.
-  // this is required per RFC2109.  if cookies match in length,
-  // then sort by creation time (see bug 236772).
-  cookieList.Sort(CompareCookiesForSending());
+  // The storage keeps cookies ordered by path length, longest to shortest,
+  // and then by creation time, so cookieList is already in that order.
   ComposeCookieString(cookieList, aCookie);
 
   return NS_OK;
@@ -1129,10 +1127,9 @@ void CookieService::GetCookiesForURI(
     storage->StaleCookies(aCookieList, currentTimeInUsec);
   }
 
-  // return cookies in order of path length; longest to shortest.
-  // this is required per RFC2109.  if cookies match in length,
-  // then sort by creation time (see bug 236772).
-  aCookieList.Sort(CompareCookiesForSending());
+  // The storage keeps cookies ordered by path length, longest to shortest,
+  // as required by RFC2109, and then by creation time (see bug 236772). So
+  // aCookieList is already in the order they must be sent in.
 }
 
 // processes a single cookie, and returns true if there are more cookies
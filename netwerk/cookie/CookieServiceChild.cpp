@@ -314,7 +314,7 @@ void CookieServiceChild::RecordDocumentCookie(Cookie* aCookie,
     return;
   }
 
-  cookiesList->AppendElement(aCookie);
+  cookiesList->InsertElementSorted(aCookie, CompareCookiesForSending());
 }
 
 NS_IMETHODIMP
@@ -396,7 +396,7 @@ CookieServiceChild::GetCookieStringFromDocument(dom::Document* aDocument,
   int64_t currentTimeInUsec = PR_Now();
   int64_t currentTime = currentTimeInUsec / PR_USEC_PER_SEC;
 
-  cookiesList->Sort(CompareCookiesForSending());
+  // RecordDocumentCookie() keeps the list in sending order.
   for (uint32_t i = 0; i < cookiesList->Length(); i++) {
     Cookie* cookie = cookiesList->ElementAt(i);
     // check the host, since the base domain lookup is conservative.
@@ -639,7 +639,9 @@ void CookieStorage::AddCookieToList(const nsACString& aBaseDomain,
   CookieEntry* entry = mHostTable.PutEntry(key);
   NS_ASSERTION(entry, "can't insert element into a null entry!");
 
-  entry->GetCookies().AppendElement(aCookie);
+  // Keep the list in the order in which cookies are sent to servers, so that
+  // readers don't have to sort what they pick out of it.
+  entry->GetCookies().InsertElementSorted(aCookie, CompareCookiesForSending());
   ++mCookieCount;
 
   // keep track of the oldest cookie, for when it comes time to purge
@@ -13,6 +13,7 @@
 #endif
 
 #include <stdlib.h>
+#include <algorithm>
 #include <ctime>
 #include "nsHostResolver.h"
 #include "nsError.h"
@@ -1259,7 +1260,8 @@ void nsHostResolver::PrepareRecordExpirationAddrRecord(
       ttl = rec->addr_info->TTL();
     }
     lifetime = ttl;
-    grace = 0;
+    // Past the TTL the record may still be served while it is refreshed.
+    grace = StaticPrefs::network_dns_stale_while_revalidate_addr_record();
   }
 
   rec->SetExpiration(TimeStamp::NowLoRes(), lifetime, grace);
@@ -1619,7 +1621,10 @@ nsHostResolver::LookupStatus nsHostResolver::CompleteLookupByTypeLocked(
          typeRec.get(), typeRec->host.get(), recordCount));
     MutexAutoLock typeLock(typeRec->mResultsLock);
     typeRec->mResults = aResult;
-    typeRec->SetExpiration(TimeStamp::NowLoRes(), aTtl, mDefaultGracePeriod);
+    typeRec->SetExpiration(
+        TimeStamp::NowLoRes(), aTtl,
+        std::max(mDefaultGracePeriod,
+                 StaticPrefs::network_dns_stale_while_revalidate_type_record()));
     typeRec->negative = false;
     Telemetry::Accumulate(Telemetry::DNS_BY_TYPE_SUCCEEDED_LOOKUP_TIME,
                           duration);
@@ -590,6 +590,20 @@ nsresult DnsAndConnectSocket::SetupConn(bool isPrimary, nsresult status) {
     return rv;
   }
 
+  // Speculative connections are opened ahead of the transactions that will
+  // use them, so give them longer in the idle pool than the default 5 seconds.
+  if (mSpeculative) {
+    RefPtr<nsHttpConnection> connTCP = do_QueryObject(conn);
+    if (connTCP) {
+      PRIntervalTime timeout = PR_SecondsToInterval(
+          StaticPrefs::network_http_speculative_connection_idle_timeout());
+      if (timeout > gHttpHandler->IdleTimeout()) {
+        timeout = gHttpHandler->IdleTimeout();
+      }
+      connTCP->SetInitialIdleTimeout(timeout);
+    }
+  }
+
   // This half-open socket has created a connection.  This flag excludes it
   // from counter of actual connections used for checking limits.
   mHasConnected = true;
@@ -14,6 +14,7 @@
 #define LOG_ENABLED() LOG5_ENABLED()
 
 #include "Http2Compression.h"
+#include "Http2HuffmanFastIncoming.h"
 #include "Http2HuffmanIncoming.h"
 #include "Http2HuffmanOutgoing.h"
 #include "mozilla/StaticPtr.h"
@@ -648,113 +649,37 @@ nsresult Http2Decompressor::CopyStringFromInput(uint32_t bytes,
   return NS_OK;
 }
 
-nsresult Http2Decompressor::DecodeFinalHuffmanCharacter(
-    const HuffmanIncomingTable* table, uint8_t& c, uint8_t& bitsLeft) {
-  MOZ_ASSERT(mOffset <= mDataLen);
-  if (mOffset > mDataLen) {
-    NS_WARNING("DecodeFinalHuffmanCharacter would read beyond end of buffer");
-    return NS_ERROR_FAILURE;
-  }
-  uint8_t mask = (1 << bitsLeft) - 1;
-  uint8_t idx = mData[mOffset - 1] & mask;
-  idx <<= (8 - bitsLeft);
-  // Don't update bitsLeft yet, because we need to check that value against the
-  // number of bits used by our encoding later on. We'll update when we are sure
-  // how many bits we've actually used.
-
-  if (table->IndexHasANextTable(idx)) {
-    // Can't chain to another table when we're all out of bits in the encoding
-    LOG(("DecodeFinalHuffmanCharacter trying to chain when we're out of bits"));
-    return NS_ERROR_FAILURE;
-  }
-
-  const HuffmanIncomingEntry* entry = table->Entry(idx);
-
-  if (bitsLeft < entry->mPrefixLen) {
-    // We don't have enough bits to actually make a match, this is some sort of
-    // invalid coding
-    LOG(("DecodeFinalHuffmanCharacter does't have enough bits to match"));
-    return NS_ERROR_FAILURE;
-  }
-
-  // This is a character!
-  if (entry->mValue == 256) {
-    // EOS
-    LOG(("DecodeFinalHuffmanCharacter actually decoded an EOS"));
-    return NS_ERROR_FAILURE;
-  }
-  c = static_cast<uint8_t>(entry->mValue & 0xFF);
-  bitsLeft -= entry->mPrefixLen;
-
-  return NS_OK;
-}
-
-uint8_t Http2Decompressor::ExtractByte(uint8_t bitsLeft,
-                                       uint32_t& bytesConsumed) {
-  MOZ_DIAGNOSTIC_ASSERT(mOffset < mDataLen);
-  uint8_t rv;
-
-  if (bitsLeft) {
-    // Need to extract bitsLeft bits from the previous byte, and 8 - bitsLeft
-    // bits from the current byte
-    uint8_t mask = (1 << bitsLeft) - 1;
-    rv = (mData[mOffset - 1] & mask) << (8 - bitsLeft);
-    rv |= (mData[mOffset] & ~mask) >> bitsLeft;
-  } else {
-    rv = mData[mOffset];
-  }
-
-  // We always update these here, under the assumption that all 8 bits we got
-  // here will be used. These may be re-adjusted later in the case that we don't
-  // use up all 8 bits of the byte.
-  ++mOffset;
-  ++bytesConsumed;
-
-  return rv;
-}
-
-nsresult Http2Decompressor::DecodeHuffmanCharacter(
-    const HuffmanIncomingTable* table, uint8_t& c, uint32_t& bytesConsumed,
-    uint8_t& bitsLeft) {
-  uint8_t idx = ExtractByte(bitsLeft, bytesConsumed);
+// Decodes one character from the top |bitsLeft| bits of |bits| by walking the
+// HuffmanIncoming tables, which handle codes of any length. Returns false if
+// the remaining bits don't hold a complete code.
+static bool DecodeHuffmanCharacter(uint64_t bits, uint8_t& bitsLeft,
+                                   uint16_t& value) {
+  const HuffmanIncomingTable* table = &HuffmanIncomingRoot;
+  uint8_t avail = bitsLeft;
 
-  if (table->IndexHasANextTable(idx)) {
-    if (mOffset >= mDataLen) {
-      if (!bitsLeft || (mOffset > mDataLen)) {
-        // TODO - does this get me into trouble in the new world?
-        // No info left in input to try to consume, we're done
-        LOG(("DecodeHuffmanCharacter all out of bits to consume, can't chain"));
-        return NS_ERROR_FAILURE;
+  while (true) {
+    // Past the end of the input the index is padded with zeros, which is fine
+    // as long as we check that the code we find fits in the available bits.
+    uint8_t idx = avail >= 8 ? static_cast<uint8_t>(bits >> (avail - 8))
+                             : static_cast<uint8_t>(bits << (8 - avail));
+
+    if (table->IndexHasANextTable(idx)) {
+      if (avail <= 8) {
+        return false;
       }
-
-      // We might get lucky here!
-      return DecodeFinalHuffmanCharacter(table->NextTable(idx), c, bitsLeft);
+      table = table->NextTable(idx);
+      avail -= 8;
+      continue;
     }
 
-    // We're sorry, Mario, but your princess is in another castle
-    return DecodeHuffmanCharacter(table->NextTable(idx), c, bytesConsumed,
-                                  bitsLeft);
-  }
-
-  const HuffmanIncomingEntry* entry = table->Entry(idx);
-  if (entry->mValue == 256) {
-    LOG(("DecodeHuffmanCharacter found an actual EOS"));
-    return NS_ERROR_FAILURE;
-  }
-  c = static_cast<uint8_t>(entry->mValue & 0xFF);
-
-  // Need to adjust bitsLeft (and possibly other values) because we may not have
-  // consumed all of the bits of the byte we extracted.
-  if (entry->mPrefixLen <= bitsLeft) {
-    bitsLeft -= entry->mPrefixLen;
-    --mOffset;
-    --bytesConsumed;
-  } else {
-    bitsLeft = 8 - (entry->mPrefixLen - bitsLeft);
+    const HuffmanIncomingEntry* entry = table->Entry(idx);
+    if (avail < entry->mPrefixLen) {
+      return false;
+    }
+    value = entry->mValue;
+    bitsLeft = avail - entry->mPrefixLen;
+    return true;
   }
-  MOZ_ASSERT(bitsLeft < 8);
-
-  return NS_OK;
 }
 
 nsresult Http2Decompressor::CopyHuffmanStringFromInput(uint32_t bytes,
@@ -764,38 +689,54 @@ nsresult Http2Decompressor::CopyHuffmanStringFromInput(uint32_t bytes,
     return NS_ERROR_FAILURE;
   }
 
-  uint32_t bytesRead = 0;
+  // The shortest code is 5 bits, which bounds the length of the output. The
+  // fast path always stores two characters, so leave room for one more.
+  uint32_t maxLength = static_cast<uint32_t>(uint64_t(bytes) * 8 / 5) + 1;
+  if (!val.SetLength(maxLength, fallible)) {
+    return NS_ERROR_OUT_OF_MEMORY;
+  }
+  char* start = val.BeginWriting();
+  char* out = start;
+
+  const uint8_t* in = mData + mOffset;
+  const uint8_t* end = in + bytes;
+
+  // The low |bitsLeft| bits of |bits| are the next bits of the input, most
+  // significant first. Anything above them has already been consumed.
+  uint64_t bits = 0;
   uint8_t bitsLeft = 0;
-  nsAutoCString buf;
-  nsresult rv;
-  uint8_t c;
-
-  while (bytesRead < bytes) {
-    uint32_t bytesConsumed = 0;
-    rv = DecodeHuffmanCharacter(&HuffmanIncomingRoot, c, bytesConsumed,
-                                bitsLeft);
-    if (NS_FAILED(rv)) {
-      LOG(("CopyHuffmanStringFromInput failed to decode a character"));
-      return rv;
-    }
 
-    bytesRead += bytesConsumed;
-    buf.Append(c);
-  }
+  while (true) {
+    while (bitsLeft <= 56 && in < end) {
+      bits = (bits << 8) | *in++;
+      bitsLeft += 8;
+    }
 
-  if (bytesRead > bytes) {
-    LOG(("CopyHuffmanStringFromInput read more bytes than was allowed!"));
-    return NS_ERROR_FAILURE;
-  }
+    if (bitsLeft >= kHuffmanFastBits) {
+      const HuffmanFastIncomingEntry& entry =
+          HuffmanFastIncoming[(bits >> (bitsLeft - kHuffmanFastBits)) &
+                              ((1 << kHuffmanFastBits) - 1)];
+      if (entry.mCount) {
+        out[0] = static_cast<char>(entry.mSymbols[0]);
+        out[1] = static_cast<char>(entry.mSymbols[1]);
+        out += entry.mCount;
+        bitsLeft -= entry.mBits;
+        continue;
+      }
+    }
 
-  if (bitsLeft) {
-    // The shortest valid code is 4 bits, so we know there can be at most one
-    // character left that our loop didn't decode. Check to see if that's the
-    // case, and if so, add it to our output.
-    rv = DecodeFinalHuffmanCharacter(&HuffmanIncomingRoot, c, bitsLeft);
-    if (NS_SUCCEEDED(rv)) {
-      buf.Append(c);
+    // Codes longer than kHuffmanFastBits, and whatever is left at the end of
+    // the input. Since we refill up to at least 57 bits and codes are at most
+    // 30 bits long, failing to decode means we have reached the padding.
+    uint16_t value;
+    if (!bitsLeft || !DecodeHuffmanCharacter(bits, bitsLeft, value)) {
+      break;
     }
+    if (value == 256) {
+      LOG(("CopyHuffmanStringFromInput found an actual EOS"));
+      return NS_ERROR_FAILURE;
+    }
+    *out++ = static_cast<char>(value);
   }
 
   if (bitsLeft > 7) {
@@ -807,8 +748,7 @@ nsresult Http2Decompressor::CopyHuffmanStringFromInput(uint32_t bytes,
     // Any bits left at this point must belong to the EOS symbol, so make sure
     // they make sense (ie, are all ones)
     uint8_t mask = (1 << bitsLeft) - 1;
-    uint8_t bits = mData[mOffset - 1] & mask;
-    if (bits != mask) {
+    if ((bits & mask) != mask) {
       LOG(
           ("CopyHuffmanStringFromInput ran out of data but found possible "
            "non-EOS symbol"));
@@ -816,7 +756,8 @@ nsresult Http2Decompressor::CopyHuffmanStringFromInput(uint32_t bytes,
     }
   }
 
-  val = buf;
+  val.Truncate(out - start);
+  mOffset += bytes;
   LOG(("CopyHuffmanStringFromInput decoded a full string!"));
   return NS_OK;
 }
@@ -1295,74 +1236,49 @@ void Http2Compressor::EncodeInteger(uint32_t prefixLen, uint32_t val) {
 }
 
 void Http2Compressor::HuffmanAppend(const nsCString& value) {
-  nsAutoCString buf;
-  uint8_t bitsLeft = 8;
   uint32_t length = value.Length();
-  uint32_t offset;
-  uint8_t* startByte;
+  const uint8_t* in = reinterpret_cast<const uint8_t*>(value.BeginReading());
 
+  // Size the encoded string up front so it can be written straight into the
+  // output after its length.
+  uint64_t totalBits = 0;
   for (uint32_t i = 0; i < length; ++i) {
-    uint8_t idx = static_cast<uint8_t>(value[i]);
-    uint8_t huffLength = HuffmanOutgoing[idx].mLength;
-    uint32_t huffValue = HuffmanOutgoing[idx].mValue;
-
-    if (bitsLeft < 8) {
-      // Fill in the least significant <bitsLeft> bits of the previous byte
-      // first
-      uint32_t val;
-      if (huffLength >= bitsLeft) {
-        val = huffValue & ~((1 << (huffLength - bitsLeft)) - 1);
-        val >>= (huffLength - bitsLeft);
-      } else {
-        val = huffValue << (bitsLeft - huffLength);
-      }
-      val &= ((1 << bitsLeft) - 1);
-      offset = buf.Length() - 1;
-      startByte = reinterpret_cast<unsigned char*>(buf.BeginWriting()) + offset;
-      *startByte = *startByte | static_cast<uint8_t>(val & 0xFF);
-      if (huffLength >= bitsLeft) {
-        huffLength -= bitsLeft;
-        bitsLeft = 8;
-      } else {
-        bitsLeft -= huffLength;
-        huffLength = 0;
-      }
-    }
+    totalBits += HuffmanOutgoing[in[i]].mLength;
+  }
+  uint32_t bufLength = static_cast<uint32_t>((totalBits + 7) / 8);
 
-    while (huffLength >= 8) {
-      uint32_t mask = ~((1 << (huffLength - 8)) - 1);
-      uint8_t val = ((huffValue & mask) >> (huffLength - 8)) & 0xFF;
-      buf.Append(reinterpret_cast<char*>(&val), 1);
-      huffLength -= 8;
-    }
+  uint32_t offset = mOutput->Length();
+  EncodeInteger(7, bufLength);
+  uint8_t* startByte =
+      reinterpret_cast<unsigned char*>(mOutput->BeginWriting()) + offset;
+  *startByte = *startByte | 0x80;
 
-    if (huffLength) {
-      // Fill in the most significant <huffLength> bits of the next byte
-      bitsLeft = 8 - huffLength;
-      uint8_t val = (huffValue & ((1 << huffLength) - 1)) << bitsLeft;
-      buf.Append(reinterpret_cast<char*>(&val), 1);
+  offset = mOutput->Length();
+  mOutput->SetLength(offset + bufLength);
+  uint8_t* out =
+      reinterpret_cast<unsigned char*>(mOutput->BeginWriting()) + offset;
+
+  // Codes are at most 30 bits long, so there is always room for the next one
+  // once whole bytes have been flushed out of the accumulator.
+  uint64_t bits = 0;
+  uint8_t bitsUsed = 0;
+  for (uint32_t i = 0; i < length; ++i) {
+    const HuffmanOutgoingEntry& entry = HuffmanOutgoing[in[i]];
+    bits = (bits << entry.mLength) | entry.mValue;
+    bitsUsed += entry.mLength;
+    while (bitsUsed >= 8) {
+      bitsUsed -= 8;
+      *out++ = static_cast<uint8_t>(bits >> bitsUsed);
     }
   }
 
-  if (bitsLeft != 8) {
-    // Pad the last <bitsLeft> bits with ones, which corresponds to the EOS
-    // encoding
-    uint8_t val = (1 << bitsLeft) - 1;
-    offset = buf.Length() - 1;
-    startByte = reinterpret_cast<unsigned char*>(buf.BeginWriting()) + offset;
-    *startByte = *startByte | val;
+  if (bitsUsed) {
+    // Pad the last bits with ones, which corresponds to the EOS encoding
+    uint8_t pad = 8 - bitsUsed;
+    *out++ = static_cast<uint8_t>((bits << pad) | ((1 << pad) - 1));
   }
+  MOZ_ASSERT(out == reinterpret_cast<const uint8_t*>(mOutput->EndReading()));
 
-  // Now we know how long our encoded string is, we can fill in our length
-  uint32_t bufLength = buf.Length();
-  offset = mOutput->Length();
-  EncodeInteger(7, bufLength);
-  startByte =
-      reinterpret_cast<unsigned char*>(mOutput->BeginWriting()) + offset;
-  *startByte = *startByte | 0x80;
-
-  // Finally, we can add our REAL data!
-  mOutput->Append(buf);
   LOG(
       ("Http2Compressor::HuffmanAppend %p encoded %d byte original on %d "
        "bytes.\n",
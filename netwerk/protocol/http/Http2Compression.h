@@ -17,8 +17,6 @@
 namespace mozilla {
 namespace net {
 
-struct HuffmanIncomingTable;
-
 void Http2CompressionCleanup();
 
 class nvPair {
@@ -127,14 +125,8 @@ class Http2Decompressor final : public Http2BaseCompressor {
 
   [[nodiscard]] nsresult CopyHeaderString(uint32_t index, nsACString& name);
   [[nodiscard]] nsresult CopyStringFromInput(uint32_t bytes, nsACString& val);
-  uint8_t ExtractByte(uint8_t bitsLeft, uint32_t& bytesConsumed);
   [[nodiscard]] nsresult CopyHuffmanStringFromInput(uint32_t bytes,
                                                     nsACString& val);
-  [[nodiscard]] nsresult DecodeHuffmanCharacter(
-      const HuffmanIncomingTable* table, uint8_t& c, uint32_t& bytesConsumed,
-      uint8_t& bitsLeft);
-  [[nodiscard]] nsresult DecodeFinalHuffmanCharacter(
-      const HuffmanIncomingTable* table, uint8_t& c, uint8_t& bitsLeft);
 
   nsCString mHeaderStatus;
   nsCString mHeaderHost;
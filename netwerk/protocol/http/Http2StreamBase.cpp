@@ -614,20 +614,6 @@ nsresult Http2StreamBase::TransmitFrame(const char* buf, uint32_t* countUsed,
   nsresult rv;
   RefPtr<Http2Session> session = Session();
 
-  // In the (relatively common) event that we have a small amount of data
-  // split between the inlineframe and the streamframe, then move the stream
-  // data into the inlineframe via copy in order to coalesce into one write.
-  // Given the interaction with ssl this is worth the small copy cost.
-  if (mTxStreamFrameSize && mTxInlineFrameUsed &&
-      mTxStreamFrameSize < Http2Session::kDefaultBufferSize &&
-      mTxInlineFrameUsed + mTxStreamFrameSize < mTxInlineFrameSize) {
-    LOG3(("Coalesce Transmit"));
-    memcpy(&mTxInlineFrame[mTxInlineFrameUsed], buf, mTxStreamFrameSize);
-    if (countUsed) *countUsed += mTxStreamFrameSize;
-    mTxInlineFrameUsed += mTxStreamFrameSize;
-    mTxStreamFrameSize = 0;
-  }
-
   rv = mSegmentReader->CommitToSegmentSize(
       mTxStreamFrameSize + mTxInlineFrameUsed, forceCommitment);
 
@@ -673,13 +659,12 @@ nsresult Http2StreamBase::TransmitFrame(const char* buf, uint32_t* countUsed,
       return NS_ERROR_UNEXPECTED;
     }
 
-    // If there is already data buffered, just add to that to form
-    // a single TLS Application Data Record - otherwise skip the memcpy
-    if (session->AmountOfOutputBuffered()) {
-      rv = session->BufferOutput(buf, mTxStreamFrameSize, &transmittedCount);
-    } else {
-      rv = session->OnReadSegment(buf, mTxStreamFrameSize, &transmittedCount);
-    }
+    // The inline frame is always buffered by now, so queue the stream data
+    // right behind it. Both are then written out together by
+    // FlushOutputQueue() as a single TLS Application Data Record, and the
+    // stream data is copied only once on the way.
+    MOZ_ASSERT(session->AmountOfOutputBuffered());
+    rv = session->BufferOutput(buf, mTxStreamFrameSize, &transmittedCount);
 
     LOG3(
         ("Http2StreamBase::TransmitFrame for regular session=%p "
@@ -51,6 +51,9 @@ const uint32_t MAX_PTO_COUNTS = 16;
 
 const uint32_t TRANSPORT_ERROR_STATELESS_RESET = 20;
 
+// The number of datagrams ProcessInput() receives from the socket at once.
+const uint32_t kRecvBatchSize = 32;
+
 NS_IMPL_ADDREF(Http3Session)
 NS_IMPL_RELEASE(Http3Session)
 NS_INTERFACE_MAP_BEGIN(Http3Session)
@@ -294,22 +297,30 @@ void Http3Session::ProcessInput(nsIUDPSocket* socket) {
        mUdpConn.get(), this, mState));
 
   while (true) {
-    nsTArray<uint8_t> data;
-    NetAddr addr{};
-    // RecvWithAddr actually does not return an error.
-    nsresult rv = socket->RecvWithAddr(&addr, data);
+    nsTArray<NetAddr> addrs;
+    nsTArray<nsTArray<uint8_t>> datagrams;
+    // RecvBatchWithAddr actually does not return an error.
+    nsresult rv = socket->RecvBatchWithAddr(kRecvBatchSize, addrs, datagrams);
     MOZ_ALWAYS_SUCCEEDS(rv);
-    if (NS_FAILED(rv) || data.IsEmpty()) {
+    if (NS_FAILED(rv) || datagrams.IsEmpty()) {
       break;
     }
-    rv = mHttp3Connection->ProcessInput(addr, data);
-    MOZ_ALWAYS_SUCCEEDS(rv);
-    if (NS_FAILED(rv)) {
-      break;
+
+    for (size_t i = 0; i < datagrams.Length(); i++) {
+      rv = mHttp3Connection->ProcessInput(addrs[i], datagrams[i]);
+      MOZ_ALWAYS_SUCCEEDS(rv);
+      if (NS_FAILED(rv)) {
+        return;
+      }
+
+      LOG(("Http3Session::ProcessInput received=%zu", datagrams[i].Length()));
+      mTotalBytesRead += datagrams[i].Length();
     }
 
-    LOG(("Http3Session::ProcessInput received=%zu", data.Length()));
-    mTotalBytesRead += data.Length();
+    // A short batch means the socket has been drained.
+    if (datagrams.Length() < kRecvBatchSize) {
+      break;
+    }
   }
 }
 
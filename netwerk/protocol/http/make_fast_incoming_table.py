@@ -0,0 +1,92 @@
+# This script exists to auto-generate Http2HuffmanFastIncoming.h from the table
+# contained in the HPACK spec. It's run the same way as the other scripts:
+#   python make_fast_incoming_table.py < http2_huffman_table.txt > Http2HuffmanFastIncoming.h
+# The generated table is indexed by the next FAST_BITS bits of the input, and
+# holds every character whose code fits completely in those bits.
+import sys
+
+FAST_BITS = 12
+MAX_SYMBOLS = 2
+
+codes = {}
+for line in sys.stdin:
+    line = line.rstrip()
+    obracket = line.rfind("[")
+    nbits = int(line[obracket + 1 : -1])
+
+    oparen = line.find(" (")
+    ascii = int(line[oparen + 2 : oparen + 5].strip())
+
+    bar = line.find("|", oparen)
+    space = line.find(" ", bar)
+    bpat = line[bar + 1 : space].strip().replace("|", "")
+    assert len(bpat) == nbits
+
+    codes[bpat] = ascii
+
+
+def decode(bits):
+    symbols = []
+    used = 0
+    while len(symbols) < MAX_SYMBOLS:
+        for nbits in range(1, len(bits) - used + 1):
+            value = codes.get(bits[used : used + nbits])
+            if value is not None:
+                break
+        else:
+            break
+        # EOS is 30 bits long, so it can never be found here.
+        assert value < 256
+        symbols.append(value)
+        used += nbits
+    return symbols, used
+
+
+entries = []
+for i in range(1 << FAST_BITS):
+    entries.append(decode(format(i, "0%db" % FAST_BITS)))
+
+sys.stdout.write(
+    """/*
+ * THIS FILE IS AUTO-GENERATED. DO NOT EDIT!
+ */
+#ifndef mozilla__net__Http2HuffmanFastIncoming_h
+#define mozilla__net__Http2HuffmanFastIncoming_h
+
+namespace mozilla {
+namespace net {
+
+static const uint8_t kHuffmanFastBits = %d;
+
+// Up to two characters decoded from the next kHuffmanFastBits bits of input.
+// mCount is 0 when the first code is longer than kHuffmanFastBits, in which
+// case the HuffmanIncoming tables must be used instead.
+struct HuffmanFastIncomingEntry {
+  uint8_t mSymbols[2];
+  uint8_t mCount;
+  uint8_t mBits;
+};
+
+static const HuffmanFastIncomingEntry HuffmanFastIncoming[] = {
+"""
+    % FAST_BITS
+)
+
+for i, (symbols, used) in enumerate(entries):
+    padded = symbols + [0] * (MAX_SYMBOLS - len(symbols))
+    sys.stdout.write(
+        "  { { %s, %s }, %s, %s }" % (padded[0], padded[1], len(symbols), used)
+    )
+    if i < (len(entries) - 1):
+        sys.stdout.write(",")
+    sys.stdout.write("\n")
+
+sys.stdout.write(
+    """};
+
+} // namespace net
+} // namespace mozilla
+
+#endif // mozilla__net__Http2HuffmanFastIncoming_h
+"""
+)
@@ -116,6 +116,11 @@ class nsHttpConnection final : public HttpConnectionBase,
 
   void SetIsReusedAfter(uint32_t afterMilliseconds);
 
+  // Overrides the idle timeout until the first response tells us otherwise.
+  void SetInitialIdleTimeout(PRIntervalTime aTimeout) {
+    mIdleTimeout = aTimeout;
+  }
+
   int64_t MaxBytesRead() { return mMaxBytesRead; }
   HttpVersion GetLastHttpResponseVersion() { return mLastHttpResponseVersion; }
 
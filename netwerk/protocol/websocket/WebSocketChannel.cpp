@@ -1883,28 +1883,31 @@ nsresult WebSocketChannel::ProcessInput(uint8_t* buffer, uint32_t count) {
 void WebSocketChannel::ApplyMask(uint32_t mask, uint8_t* data, uint64_t len) {
   if (!data || len == 0) return;
 
-  // Optimally we want to apply the mask 32 bits at a time,
+  // Optimally we want to apply the mask 64 bits at a time,
   // but the buffer might not be alligned. So we first deal with
-  // 0 to 3 bytes of preamble individually
+  // 0 to 7 bytes of preamble individually
 
-  while (len && (reinterpret_cast<uintptr_t>(data) & 3)) {
+  while (len && (reinterpret_cast<uintptr_t>(data) & 7)) {
     *data ^= mask >> 24;
     mask = RotateLeft(mask, 8);
     data++;
     len--;
   }
 
-  // perform mask on full words of data
+  // perform mask on full words of data. Both halves of the 64 bit mask are
+  // the same 4 bytes in network order, so this doesn't depend on endianness
+  // and the compiler is free to vectorize the loop.
 
-  uint32_t* iData = (uint32_t*)data;
-  uint32_t* end = iData + (len / 4);
-  NetworkEndian::writeUint32(&mask, mask);
-  for (; iData < end; iData++) *iData ^= mask;
-  mask = NetworkEndian::readUint32(&mask);
+  uint32_t netMask;
+  NetworkEndian::writeUint32(&netMask, mask);
+  uint64_t wideMask = (uint64_t(netMask) << 32) | netMask;
+  uint64_t* iData = (uint64_t*)data;
+  uint64_t* end = iData + (len / 8);
+  for (; iData < end; iData++) *iData ^= wideMask;
   data = (uint8_t*)iData;
-  len = len % 4;
+  len = len % 8;
 
-  // There maybe up to 3 trailing bytes that need to be dealt with
+  // There maybe up to 7 trailing bytes that need to be dealt with
   // individually
 
   while (len) {
@@ -0,0 +1,79 @@
+#include "gtest/gtest.h"
+
+#include "Http2Compression.h"
+#include "nsString.h"
+
+namespace mozilla {
+namespace net {
+
+// RFC 7541, Appendix C.6.1: a response with Huffman coded strings.
+TEST(TestHttp2Compression, DecodeHuffmanResponse)
+{
+  static const uint8_t kBlock[] = {
+      0x48, 0x82, 0x64, 0x02, 0x58, 0x85, 0xae, 0xc3, 0x77, 0x1a, 0x4b,
+      0x61, 0x96, 0xd0, 0x7a, 0xbe, 0x94, 0x10, 0x54, 0xd4, 0x44, 0xa8,
+      0x20, 0x05, 0x95, 0x04, 0x0b, 0x81, 0x66, 0xe0, 0x82, 0xa6, 0x2d,
+      0x1b, 0xff, 0x6e, 0x91, 0x9d, 0x29, 0xad, 0x17, 0x18, 0x63, 0xc7,
+      0x8f, 0x0b, 0x97, 0xc8, 0xe9, 0xae, 0x82, 0xae, 0x43, 0xd3};
+
+  Http2Decompressor decompressor;
+  nsAutoCString output;
+  ASSERT_EQ(NS_OK, decompressor.DecodeHeaderBlock(kBlock, sizeof(kBlock),
+                                                  output, false));
+  ASSERT_TRUE(output.EqualsLiteral(
+      "HTTP/2 302\r\n"
+      "cache-control: private\r\n"
+      "date: Mon, 21 Oct 2013 20:13:21 GMT\r\n"
+      "location: https://www.example.com\r\n"));
+}
+
+TEST(TestHttp2Compression, DecodeHuffmanPadding)
+{
+  Http2Decompressor decompressor;
+  nsAutoCString output;
+
+  // ":status: 2" followed by three bits of padding which are not all ones.
+  static const uint8_t kBadPadding[] = {0x48, 0x81, 0x10};
+  ASSERT_NE(NS_OK, decompressor.DecodeHeaderBlock(
+                       kBadPadding, sizeof(kBadPadding), output, false));
+
+  // A whole byte of padding after the ":status" value.
+  static const uint8_t kLongPadding[] = {0x48, 0x82, 0x17, 0xff};
+  ASSERT_NE(NS_OK, decompressor.DecodeHeaderBlock(
+                       kLongPadding, sizeof(kLongPadding), output, false));
+}
+
+// Every octet value, which covers codes of each length, survives the round
+// trip through the Huffman encoder and decoder.
+TEST(TestHttp2Compression, HuffmanRoundTrip)
+{
+  nsAutoCString path("/");
+  for (uint32_t i = 1; i < 256; ++i) {
+    if (i != '\r' && i != '\n') {
+      path.Append(static_cast<char>(i));
+    }
+  }
+
+  Http2Compressor compressor;
+  nsAutoCString block;
+  ASSERT_EQ(NS_OK,
+            compressor.EncodeHeaderBlock(
+                "GET / HTTP/1.1\r\nx-test: abc~|{}^\r\n\r\n"_ns, "GET"_ns,
+                path, "www.example.com"_ns, "https"_ns, ""_ns, false, block));
+
+  Http2Decompressor decompressor;
+  nsAutoCString output;
+  ASSERT_EQ(NS_OK, decompressor.DecodeHeaderBlock(
+                       reinterpret_cast<const uint8_t*>(block.BeginReading()),
+                       block.Length(), output, true));
+
+  nsAutoCString value;
+  decompressor.GetPath(value);
+  ASSERT_TRUE(value.Equals(path));
+  decompressor.GetHost(value);
+  ASSERT_TRUE(value.EqualsLiteral("www.example.com"));
+  ASSERT_TRUE(output.EqualsLiteral("x-test: abc~|{}^\r\n"));
+}
+
+}  // namespace net
+}  // namespace mozilla
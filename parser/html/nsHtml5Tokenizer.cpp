@@ -506,6 +506,7 @@ stateloop:
               [[fallthrough]];
             }
             default: {
+              pos = LastOrdinaryDataChar(buf, pos, endPos);
               continue;
             }
           }
@@ -4,6 +4,7 @@
 
 #include "mozilla/CheckedInt.h"
 #include "mozilla/Likely.h"
+#include "mozilla/SSE.h"
 
 // INT32_MAX is (2^31)-1. Therefore, the highest power-of-two that fits
 // is 2^30. Note that this is counting char16_t units. The underlying
@@ -12,6 +13,24 @@
 // be available on a 32-bit system.
 #define MAX_POWER_OF_TWO_IN_INT32 0x40000000
 
+#ifdef MOZILLA_MAY_SUPPORT_SSE2
+namespace mozilla::SSE2 {
+int32_t LastOrdinaryDataChar(const char16_t* buf, int32_t pos, int32_t endPos);
+}  // namespace mozilla::SSE2
+#endif
+
+/* static */
+int32_t nsHtml5Tokenizer::LastOrdinaryDataChar(const char16_t* aBuf,
+                                               int32_t aPos, int32_t aEndPos) {
+#ifdef MOZILLA_MAY_SUPPORT_SSE2
+  if (mozilla::supports_sse2()) {
+    return mozilla::SSE2::LastOrdinaryDataChar(aBuf, aPos, aEndPos);
+  }
+#endif
+  // Without SIMD this wouldn't be any faster than the state loop itself.
+  return aPos;
+}
+
 bool nsHtml5Tokenizer::EnsureBufferSpace(int32_t aLength) {
   MOZ_RELEASE_ASSERT(aLength >= 0, "Negative length.");
   if (aLength > MAX_POWER_OF_TWO_IN_INT32) {
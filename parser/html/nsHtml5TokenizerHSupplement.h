@@ -24,6 +24,19 @@ bool IsInTokenStartedAtKilobyteBoundary() {
   return suspensionAfterCurrentNonTextTokenPending();
 }
 
+/**
+ * Returns the index of the last code unit after aPos that the data state
+ * doesn't need to look at individually, i.e. the code unit before the next
+ * '&', '<', CR, LF or U+0000, or aEndPos - 1 if there is none.
+ *
+ * Called from the default case of the data state in stateLoop(), which
+ * Tokenizer.java emits with
+ *   // CPPONLY: pos = LastOrdinaryDataChar(buf, pos, endPos);
+ * like the other C++-only hooks in this file.
+ */
+static int32_t LastOrdinaryDataChar(const char16_t* aBuf, int32_t aPos,
+                                    int32_t aEndPos);
+
 mozilla::UniquePtr<nsHtml5Highlighter> mViewSource;
 
 /**
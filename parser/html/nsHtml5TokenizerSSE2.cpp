@@ -0,0 +1,55 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/* vim: set ts=8 sts=2 et sw=2 tw=80: */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+// This file should only be compiled if you're on x86 or x86_64.  Additionally,
+// you'll need to compile this file with -msse2 if you're using gcc.
+
+#include <emmintrin.h>
+#include "nscore.h"
+#include "mozilla/MathAlgorithms.h"
+
+namespace mozilla::SSE2 {
+
+int32_t LastOrdinaryDataChar(const char16_t* buf, int32_t pos,
+                             int32_t endPos) {
+  const __m128i amp = _mm_set1_epi16('&');
+  const __m128i lt = _mm_set1_epi16('<');
+  const __m128i cr = _mm_set1_epi16('\r');
+  const __m128i lf = _mm_set1_epi16('\n');
+  const __m128i nul = _mm_setzero_si128();
+
+  int32_t i = pos + 1;
+  // Check eight UTF-16 code units at a time.
+  for (; i + 8 <= endPos; i += 8) {
+    const __m128i vect =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(buf + i));
+    __m128i special = _mm_or_si128(_mm_cmpeq_epi16(vect, amp),
+                                   _mm_cmpeq_epi16(vect, lt));
+    special = _mm_or_si128(special, _mm_cmpeq_epi16(vect, cr));
+    special = _mm_or_si128(special, _mm_cmpeq_epi16(vect, lf));
+    special = _mm_or_si128(special, _mm_cmpeq_epi16(vect, nul));
+    int mask = _mm_movemask_epi8(special);
+    if (mask) {
+      // Two mask bits per code unit.
+      return i + int32_t(CountTrailingZeroes32(mask) / 2) - 1;
+    }
+  }
+
+  // Take care of the remainder one code unit at a time.
+  for (; i < endPos; i++) {
+    switch (buf[i]) {
+      case '&':
+      case '<':
+      case '\r':
+      case '\n':
+      case '\0':
+        return i - 1;
+    }
+  }
+  return endPos - 1;
+}
+
+}  // namespace mozilla::SSE2
@@ -935,7 +935,13 @@ class InsertVisitedURIs final : public Runnable {
       FetchReferrerInfo(place);
       UpdateVisitSource(place, mHistory);
 
-      nsresult rv = DoDatabaseInserts(known, place);
+      // Frecency is calculated from all the visits to a page, so if the next
+      // visit is to the same page, only calculate it for that one.
+      bool deferFrecency = i + 1 < mPlaces.Length() &&
+                           mPlaces[i + 1].spec.Equals(place.spec) &&
+                           mPlaces[i + 1].shouldUpdateFrecency;
+
+      nsresult rv = DoDatabaseInserts(known, place, deferFrecency);
       if (!!mCallback) {
         // Check if consumers wanted to be notified about success/failure,
         // depending on whether this action succeeded or not.
@@ -1039,8 +1045,12 @@ class InsertVisitedURIs final : public Runnable {
    *        otherwise.
    * @param aPlace
    *        The place we are adding a visit for.
+   * @param aDeferFrecency
+   *        True if a later visit in the same batch will update the frecency of
+   *        this place, so it doesn't need to be updated for this visit.
    */
-  nsresult DoDatabaseInserts(bool aKnown, VisitData& aPlace) {
+  nsresult DoDatabaseInserts(bool aKnown, VisitData& aPlace,
+                             bool aDeferFrecency) {
     MOZ_ASSERT(!NS_IsMainThread(),
                "This should not be called on the main thread");
 
@@ -1061,11 +1071,11 @@ class InsertVisitedURIs final : public Runnable {
     rv = AddVisit(aPlace);
     NS_ENSURE_SUCCESS(rv, rv);
 
-    // TODO (bug 623969) we shouldn't update this after each visit, but
-    // rather only for each unique place to save disk I/O.
-
     // Don't update frecency if the page should not appear in autocomplete.
-    if (aPlace.shouldUpdateFrecency) {
+    // Unhiding the page depends on the updated frecency, so that can't be
+    // deferred.
+    bool shouldUnhide = !aPlace.hidden && aPlace.shouldUpdateHidden;
+    if (aPlace.shouldUpdateFrecency && (!aDeferFrecency || shouldUnhide)) {
       rv = UpdateFrecency(aPlace);
       NS_ENSURE_SUCCESS(rv, rv);
     }
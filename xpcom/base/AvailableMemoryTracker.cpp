@@ -19,8 +19,10 @@
 #include "nsXULAppAPI.h"
 
 #include "mozilla/Mutex.h"
+#include "mozilla/Preferences.h"
 #include "mozilla/ResultExtensions.h"
 #include "mozilla/Services.h"
+#include "mozilla/StaticPrefs_memory.h"
 
 #if defined(MOZ_MEMORY)
 #  include "mozmemory.h"
@@ -128,6 +130,25 @@ void nsJemallocFreeDirtyPagesRunnable::OptimizeSystemHeap() {
 }
 #endif  // defined(XP_WIN)
 
+#if defined(MOZ_MEMORY)
+// Whether we're between a memory-pressure and a memory-pressure-stop
+// notification. Only used on the main thread.
+static bool sUnderMemoryPressure = false;
+
+/**
+ * Deferred purging lets arenas go up to a multiple of their dirty page limit
+ * until the main thread is idle. Under memory pressure, purge right away.
+ */
+static void UpdateDeferredPurge() {
+  moz_enable_deferred_purge(StaticPrefs::memory_deferred_purge_enabled() &&
+                            !sUnderMemoryPressure);
+}
+
+static void DeferredPurgePrefChanged(const char* aPref, void* aClosure) {
+  UpdateDeferredPurge();
+}
+#endif  // defined(MOZ_MEMORY)
+
 /**
  * The memory pressure watcher is used for listening to memory-pressure events
  * and reacting upon them. We use one instance per process currently only for
@@ -155,17 +176,30 @@ void nsMemoryPressureWatcher::Init() {
 
   if (os) {
     os->AddObserver(this, "memory-pressure", /* ownsWeak */ false);
+    os->AddObserver(this, "memory-pressure-stop", /* ownsWeak */ false);
   }
 }
 
 /**
  * Reacts to all types of memory-pressure events, launches a runnable to
- * free dirty pages held by jemalloc.
+ * free dirty pages held by jemalloc, and stops deferring purges until the
+ * matching memory-pressure-stop.
  */
 NS_IMETHODIMP
 nsMemoryPressureWatcher::Observe(nsISupports* aSubject, const char* aTopic,
                                  const char16_t* aData) {
-  MOZ_ASSERT(!strcmp(aTopic, "memory-pressure"), "Unknown topic");
+  MOZ_ASSERT(!strcmp(aTopic, "memory-pressure") ||
+                 !strcmp(aTopic, "memory-pressure-stop"),
+             "Unknown topic");
+
+#if defined(MOZ_MEMORY)
+  sUnderMemoryPressure = !strcmp(aTopic, "memory-pressure");
+  UpdateDeferredPurge();
+#endif
+
+  if (!strcmp(aTopic, "memory-pressure-stop")) {
+    return NS_OK;
+  }
 
   nsCOMPtr<nsIRunnable> runnable = new nsJemallocFreeDirtyPagesRunnable();
 
@@ -184,6 +218,13 @@ void Init() {
   RefPtr<nsMemoryPressureWatcher> watcher = new nsMemoryPressureWatcher();
   watcher->Init();
 
+#if defined(MOZ_MEMORY)
+  Preferences::RegisterCallbackAndCall(
+      DeferredPurgePrefChanged,
+      nsDependentCString(
+          StaticPrefs::GetPrefName_memory_deferred_purge_enabled()));
+#endif
+
 #if defined(XP_WIN)
   RegisterLowMemoryEventsPhysicalDistinguishedAmount(
       LowMemoryEventsPhysicalDistinguishedAmount);
@@ -702,6 +702,7 @@ CycleCollectedJSRuntime::CycleCollectedJSRuntime(JSContext* aCx)
   JS_SetGrayGCRootsTracer(aCx, TraceGrayJS, this);
   JS_SetGCCallback(aCx, GCCallback, this);
   mPrevGCSliceCallback = JS::SetGCSliceCallback(aCx, GCSliceCallback);
+  JS::SetGCSliceRecordCallback(aCx, GCSliceRecordCallback, this);
 
   if (NS_IsMainThread()) {
     // We would like to support all threads here, but the way timeline consumers
@@ -1116,6 +1117,13 @@ void CycleCollectedJSRuntime::GCSliceCallback(JSContext* aContext,
     }
   }
 
+  // While profiling, report the slice records after each major GC so that
+  // they show up next to the other GC markers.
+  if (aProgress == JS::GC_CYCLE_END &&
+      profiler_thread_is_being_profiled_for_markers()) {
+    JS::FlushGCSliceRecords(aContext);
+  }
+
   if (aProgress == JS::GC_CYCLE_END &&
       JS::dbg::FireOnGarbageCollectionHookRequired(aContext)) {
     JS::GCReason reason = aDesc.reason_;
@@ -1234,6 +1242,81 @@ void CycleCollectedJSRuntime::GCNurseryCollectionCallback(
   }
 }
 
+/* static */
+void CycleCollectedJSRuntime::GCSliceRecordCallback(
+    JSContext* aContext, const JS::GCSliceRecord* aRecords, size_t aLength,
+    void* aData) {
+  MOZ_ASSERT(CycleCollectedJSContext::Get()->Context() == aContext);
+
+  // Records which arrive while we're not profiling are dropped.
+  if (!profiler_thread_is_being_profiled_for_markers()) {
+    return;
+  }
+
+  struct GCSliceRecordMarker {
+    static constexpr mozilla::Span<const char> MarkerTypeName() {
+      return mozilla::MakeStringSpan("GCSliceRecord");
+    }
+    static void StreamJSONMarkerData(
+        mozilla::baseprofiler::SpliceableJSONWriter& aWriter,
+        const mozilla::ProfilerString8View& aReason, uint64_t aMajorGCNumber,
+        uint32_t aCollectedZones, uint32_t aZones, double aMarkMs,
+        double aSweepMs, double aCompactMs, int64_t aHeapBytesBefore,
+        int64_t aHeapBytesAfter, double aPromotionRate,
+        double aHelperUtilization) {
+      aWriter.StringProperty("reason", aReason);
+      aWriter.IntProperty("majorGCNumber", int64_t(aMajorGCNumber));
+      aWriter.IntProperty("collectedZones", aCollectedZones);
+      aWriter.IntProperty("zones", aZones);
+      aWriter.DoubleProperty("mark", aMarkMs);
+      aWriter.DoubleProperty("sweep", aSweepMs);
+      aWriter.DoubleProperty("compact", aCompactMs);
+      aWriter.IntProperty("heapBefore", aHeapBytesBefore);
+      aWriter.IntProperty("heapAfter", aHeapBytesAfter);
+      aWriter.DoubleProperty("promotionRate", aPromotionRate);
+      aWriter.DoubleProperty("helperUtilization", aHelperUtilization);
+    }
+    static mozilla::MarkerSchema MarkerTypeDisplay() {
+      using MS = mozilla::MarkerSchema;
+      MS schema{MS::Location::MarkerChart, MS::Location::MarkerTable};
+      schema.SetTableLabel("{marker.data.reason}");
+      schema.AddKeyLabelFormat("reason", "Reason", MS::Format::String);
+      schema.AddKeyLabelFormat("majorGCNumber", "Major GC",
+                               MS::Format::Integer);
+      schema.AddKeyLabelFormat("collectedZones", "Zones collected",
+                               MS::Format::Integer);
+      schema.AddKeyLabelFormat("zones", "Zones", MS::Format::Integer);
+      schema.AddKeyLabelFormat("mark", "Mark", MS::Format::Milliseconds);
+      schema.AddKeyLabelFormat("sweep", "Sweep", MS::Format::Milliseconds);
+      schema.AddKeyLabelFormat("compact", "Compact",
+                               MS::Format::Milliseconds);
+      schema.AddKeyLabelFormat("heapBefore", "Heap before", MS::Format::Bytes);
+      schema.AddKeyLabelFormat("heapAfter", "Heap after", MS::Format::Bytes);
+      schema.AddKeyLabelFormat("promotionRate", "Nursery promotion rate",
+                               MS::Format::Percentage);
+      schema.AddKeyLabelFormat("helperUtilization",
+                               "Helper thread utilization",
+                               MS::Format::Percentage);
+      return schema;
+    }
+  };
+
+  for (size_t i = 0; i < aLength; i++) {
+    const JS::GCSliceRecord& record = aRecords[i];
+    profiler_add_marker(
+        "GCSliceRecord", baseprofiler::category::GCCC,
+        MarkerTiming::Interval(record.start, record.end),
+        GCSliceRecordMarker{},
+        ProfilerString8View::WrapNullTerminatedString(
+            JS::ExplainGCReason(record.reason)),
+        record.majorGCNumber, record.collectedZoneCount, record.zoneCount,
+        record.markTime.ToMilliseconds(), record.sweepTime.ToMilliseconds(),
+        record.compactTime.ToMilliseconds(), int64_t(record.heapBytesBefore),
+        int64_t(record.heapBytesAfter), record.nurseryPromotionRate,
+        record.helperThreadUtilization);
+  }
+}
+
 /* static */
 void CycleCollectedJSRuntime::OutOfMemoryCallback(JSContext* aContext,
                                                   void* aData) {
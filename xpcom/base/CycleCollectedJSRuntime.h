@@ -282,6 +282,9 @@ class CycleCollectedJSRuntime {
   static void GCNurseryCollectionCallback(JSContext* aContext,
                                           JS::GCNurseryProgress aProgress,
                                           JS::GCReason aReason);
+  static void GCSliceRecordCallback(JSContext* aContext,
+                                    const JS::GCSliceRecord* aRecords,
+                                    size_t aLength, void* aData);
   static void OutOfMemoryCallback(JSContext* aContext, void* aData);
 
   static bool ContextCallback(JSContext* aCx, unsigned aOperation, void* aData);
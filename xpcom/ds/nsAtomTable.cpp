@@ -9,7 +9,7 @@
 #include "mozilla/HashFunctions.h"
 #include "mozilla/MemoryReporting.h"
 #include "mozilla/MruCache.h"
-#include "mozilla/Mutex.h"
+#include "mozilla/RWLock.h"
 #include "mozilla/DebugOnly.h"
 #include "mozilla/Sprintf.h"
 #include "mozilla/TextUtils.h"
@@ -182,26 +182,44 @@ static AtomCache sRecentlyUsedMainThreadAtoms;
 // values we use to select the subtable are evenly distributed, this reduces the
 // probability of contention by a factor of N. See bug 1440824.
 //
+// The lock is a reader-writer lock. Most atomizations are for atoms that
+// already exist, and those only need the read lock, so they don't serialize
+// with each other. Inserting new atoms and GC take the write lock.
+//
 // NB: This is somewhat similar to the technique used by Java's
 // ConcurrentHashTable.
 class nsAtomSubTable {
   friend class nsAtomTable;
-  Mutex mLock;
+  RWLock mLock;
   PLDHashTable mTable;
   nsAtomSubTable();
   void GCLocked(GCKind aKind) MOZ_REQUIRES(mLock);
   void AddSizeOfExcludingThisLocked(MallocSizeOf aMallocSizeOf,
-                                    AtomsSizes& aSizes) MOZ_REQUIRES(mLock);
+                                    AtomsSizes& aSizes)
+      MOZ_REQUIRES_SHARED(mLock);
 
-  AtomTableEntry* Search(AtomTableKey& aKey) const MOZ_REQUIRES(mLock) {
-    mLock.AssertCurrentThreadOwns();
+  AtomTableEntry* Search(AtomTableKey& aKey) const MOZ_REQUIRES_SHARED(mLock) {
     return static_cast<AtomTableEntry*>(mTable.Search(&aKey));
   }
 
   AtomTableEntry* Add(AtomTableKey& aKey) MOZ_REQUIRES(mLock) {
-    mLock.AssertCurrentThreadOwns();
+    MOZ_ASSERT(mLock.LockedForWritingByCurrentThread());
     return static_cast<AtomTableEntry*>(mTable.Add(&aKey));  // Infallible
   }
+
+  // Returns the atom for aKey if it's already in the table, holding only the
+  // read lock. The atom is addrefed before the lock is released so that a
+  // concurrent GC can't remove it.
+  already_AddRefed<nsAtom> LookupExisting(AtomTableKey& aKey)
+      MOZ_EXCLUDES(mLock) {
+    AutoReadLock lock(mLock);
+    AtomTableEntry* he = Search(aKey);
+    if (!he) {
+      return nullptr;
+    }
+    RefPtr<nsAtom> atom = he->mAtom;
+    return atom.forget();
+  }
 };
 
 // The outer atom table, which coordinates access to the inner array of
@@ -344,7 +362,7 @@ void nsAtomTable::AddSizeOfIncludingThis(MallocSizeOf aMallocSizeOf,
   MOZ_ASSERT(NS_IsMainThread());
   aSizes.mTable += aMallocSizeOf(this);
   for (auto& table : mSubTables) {
-    MutexAutoLock lock(table.mLock);
+    AutoReadLock lock(table.mLock);
     table.AddSizeOfExcludingThisLocked(aMallocSizeOf, aSizes);
   }
 }
@@ -356,7 +374,7 @@ void nsAtomTable::GC(GCKind aKind) {
   // Note that this is effectively an incremental GC, since only one subtable
   // is locked at a time.
   for (auto& table : mSubTables) {
-    MutexAutoLock lock(table.mLock);
+    AutoWriteLock lock(table.mLock);
     table.GCLocked(aKind);
   }
 
@@ -376,9 +394,9 @@ void nsAtomTable::GC(GCKind aKind) {
   // shutdown.
   //
   // Note that, barring refcounting bugs, an atom can only go from a zero
-  // refcount to a non-zero refcount while the atom table lock is held, so
-  // so we won't try to resurrect a zero refcount atom while trying to delete
-  // it.
+  // refcount to a non-zero refcount while the atom table lock is held (for
+  // reading or writing), and GC holds it for writing, so we won't try to
+  // resurrect a zero refcount atom while trying to delete it.
 
   MOZ_ASSERT_IF(aKind == GCKind::Shutdown,
                 nsDynamicAtom::gUnusedAtomCount == 0);
@@ -389,7 +407,7 @@ size_t nsAtomTable::RacySlowCount() {
   GC(GCKind::RegularOperation);
   size_t count = 0;
   for (auto& table : mSubTables) {
-    MutexAutoLock lock(table.mLock);
+    AutoReadLock lock(table.mLock);
     count += table.mTable.EntryCount();
   }
 
@@ -402,7 +420,7 @@ nsAtomSubTable::nsAtomSubTable()
 
 void nsAtomSubTable::GCLocked(GCKind aKind) {
   MOZ_ASSERT(NS_IsMainThread());
-  mLock.AssertCurrentThreadOwns();
+  MOZ_ASSERT(mLock.LockedForWritingByCurrentThread());
 
   int32_t removedCount = 0;  // A non-atomic temporary for cheaper increments.
   nsAutoCString nonZeroRefcountAtoms;
@@ -491,7 +509,6 @@ void NS_AddSizeOfAtoms(MallocSizeOf aMallocSizeOf, AtomsSizes& aSizes) {
 
 void nsAtomSubTable::AddSizeOfExcludingThisLocked(MallocSizeOf aMallocSizeOf,
                                                   AtomsSizes& aSizes) {
-  mLock.AssertCurrentThreadOwns();
   aSizes.mTable += mTable.ShallowSizeOfExcludingThis(aMallocSizeOf);
   for (auto iter = mTable.Iter(); !iter.Done(); iter.Next()) {
     auto entry = static_cast<AtomTableEntry*>(iter.Get());
@@ -518,7 +535,7 @@ void nsAtomTable::RegisterStaticAtoms(const nsStaticAtom* aAtoms,
 
     AtomTableKey key(atom);
     nsAtomSubTable& table = SelectSubTable(key);
-    MutexAutoLock lock(table.mLock);
+    AutoWriteLock lock(table.mLock);
     AtomTableEntry* he = table.Add(key);
 
     if (he->mAtom) {
@@ -553,7 +570,11 @@ already_AddRefed<nsAtom> nsAtomTable::Atomize(const nsACString& aUTF8String) {
     return Atomize(str);
   }
   nsAtomSubTable& table = SelectSubTable(key);
-  MutexAutoLock lock(table.mLock);
+  if (RefPtr<nsAtom> atom = table.LookupExisting(key)) {
+    return atom.forget();
+  }
+
+  AutoWriteLock lock(table.mLock);
   AtomTableEntry* he = table.Add(key);
 
   if (he->mAtom) {
@@ -583,7 +604,11 @@ already_AddRefed<nsAtom> NS_Atomize(const char16_t* aUTF16String) {
 already_AddRefed<nsAtom> nsAtomTable::Atomize(const nsAString& aUTF16String) {
   AtomTableKey key(aUTF16String.Data(), aUTF16String.Length());
   nsAtomSubTable& table = SelectSubTable(key);
-  MutexAutoLock lock(table.mLock);
+  if (RefPtr<nsAtom> atom = table.LookupExisting(key)) {
+    return atom.forget();
+  }
+
+  AutoWriteLock lock(table.mLock);
   AtomTableEntry* he = table.Add(key);
 
   if (he->mAtom) {
@@ -615,7 +640,13 @@ already_AddRefed<nsAtom> nsAtomTable::AtomizeMainThread(
   }
 
   nsAtomSubTable& table = SelectSubTable(key);
-  MutexAutoLock lock(table.mLock);
+  retVal = table.LookupExisting(key);
+  if (retVal) {
+    p.Set(retVal);
+    return retVal.forget();
+  }
+
+  AutoWriteLock lock(table.mLock);
   AtomTableEntry* he = table.Add(key);
 
   if (he->mAtom) {
@@ -652,7 +683,7 @@ nsStaticAtom* NS_GetStaticAtom(const nsAString& aUTF16String) {
 nsStaticAtom* nsAtomTable::GetStaticAtom(const nsAString& aUTF16String) {
   AtomTableKey key(aUTF16String.Data(), aUTF16String.Length());
   nsAtomSubTable& table = SelectSubTable(key);
-  MutexAutoLock lock(table.mLock);
+  AutoReadLock lock(table.mLock);
   AtomTableEntry* he = table.Search(key);
   return he && he->mAtom->IsStatic() ? static_cast<nsStaticAtom*>(he->mAtom)
                                      : nullptr;
@@ -7,6 +7,7 @@
 #include "Base64.h"
 
 #include "mozilla/ArrayUtils.h"
+#include "mozilla/SSE.h"
 #include "mozilla/UniquePtrExtensions.h"
 #include "nsIInputStream.h"
 #include "nsString.h"
@@ -14,8 +15,32 @@
 
 #include "plbase64.h"
 
+#include <type_traits>
+
+#ifdef MOZILLA_MAY_SUPPORT_SSSE3
+namespace mozilla {
+template <typename SrcT, typename DestT>
+size_t Base64EncodeSSSE3(const SrcT* aSrc, size_t aSrcLen, DestT* aDest);
+template <typename SrcT, typename DestT>
+size_t Base64DecodeSSSE3(const SrcT* aSrc, size_t aSrcLen, DestT* aDest);
+}  // namespace mozilla
+#endif
+
 namespace {
 
+// The character type combinations that Base64SSSE3.cpp instantiates.
+template <typename SrcT, typename DestT>
+constexpr bool kHasSSSE3Encoder =
+    (std::is_same_v<SrcT, char> &&
+     (std::is_same_v<DestT, char> || std::is_same_v<DestT, char16_t>)) ||
+    (std::is_same_v<SrcT, char16_t> && std::is_same_v<DestT, char16_t>);
+
+template <typename SrcT, typename DestT>
+constexpr bool kHasSSSE3Decoder =
+    (std::is_same_v<SrcT, char> && std::is_same_v<DestT, char>) ||
+    (std::is_same_v<SrcT, char16_t> &&
+     (std::is_same_v<DestT, char> || std::is_same_v<DestT, char16_t>));
+
 // BEGIN base64 encode code copied and modified from NSPR
 const unsigned char* const base =
   (unsigned char*)"ABCDEFGHIJKLMNOPQRSTUVWXYZ"
@@ -67,6 +92,17 @@ static void Encode1to4(const SrcT* aSrc, DestT* aDest) {
 
 template <typename SrcT, typename DestT>
 static void Encode(const SrcT* aSrc, uint32_t aSrcLen, DestT* aDest) {
+#ifdef MOZILLA_MAY_SUPPORT_SSSE3
+  if constexpr (kHasSSSE3Encoder<SrcT, DestT>) {
+    if (mozilla::supports_ssse3()) {
+      uint32_t consumed = mozilla::Base64EncodeSSSE3(aSrc, aSrcLen, aDest);
+      aSrc += consumed;
+      aDest += consumed / 3 * 4;
+      aSrcLen -= consumed;
+    }
+  }
+#endif
+
   while (aSrcLen >= 3) {
     Encode3to4(aSrc, aDest);
     aSrc += 3;
@@ -501,6 +537,20 @@ static nsresult Base64DecodeHelper(const SrcT* aBase64, uint32_t aBase64Len,
     }
   }
 
+#ifdef MOZILLA_MAY_SUPPORT_SSSE3
+  // Bulk-decode whole blocks; anything invalid is left for the scalar loop
+  // below to reject.
+  if constexpr (kHasSSSE3Decoder<SrcT, DestT>) {
+    if (supports_ssse3()) {
+      uint32_t consumed = Base64DecodeSSSE3(input, inputLength, binary);
+      input += consumed;
+      inputLength -= consumed;
+      binary += consumed / 4 * 3;
+      binaryLength += consumed / 4 * 3;
+    }
+  }
+#endif
+
   while (inputLength >= 4) {
     if (!Decode4to3(input, binary, Base64CharToValue<SrcT>)) {
       return NS_ERROR_INVALID_ARG;
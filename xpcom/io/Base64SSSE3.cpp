@@ -0,0 +1,184 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/* vim: set ts=8 sts=2 et sw=2 tw=80: */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+// SSSE3 Base64 kernels, after Wojciech Muła's "Base64 encoding and decoding
+// with SIMD instructions". These only handle whole 16-character blocks; the
+// scalar code in Base64.cpp takes care of the tail, of padding, and of
+// reporting errors.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <emmintrin.h>
+#include <tmmintrin.h>
+
+namespace mozilla {
+
+// Loads 16 code units, truncated to 8 bits as the scalar encoder does.
+static inline __m128i LoadTruncated(const char* aSrc) {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(aSrc));
+}
+
+static inline __m128i LoadTruncated(const char16_t* aSrc) {
+  const __m128i mask = _mm_set1_epi16(0x00FF);
+  __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(aSrc));
+  __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(aSrc + 8));
+  return _mm_packus_epi16(_mm_and_si128(lo, mask), _mm_and_si128(hi, mask));
+}
+
+// Loads 16 code units, saturating anything above 0xFF so that it is rejected
+// by the decoder's range check.
+static inline __m128i LoadSaturated(const char* aSrc) {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(aSrc));
+}
+
+static inline __m128i LoadSaturated(const char16_t* aSrc) {
+  __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(aSrc));
+  __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(aSrc + 8));
+  return _mm_packus_epi16(lo, hi);
+}
+
+static inline void Store16(char* aDest, __m128i aBytes) {
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(aDest), aBytes);
+}
+
+static inline void Store16(char16_t* aDest, __m128i aBytes) {
+  const __m128i zero = _mm_setzero_si128();
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(aDest),
+                   _mm_unpacklo_epi8(aBytes, zero));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(aDest + 8),
+                   _mm_unpackhi_epi8(aBytes, zero));
+}
+
+// Stores the low 12 bytes only, so we never write past the decoded output.
+static inline void Store12(char* aDest, __m128i aBytes) {
+  _mm_storel_epi64(reinterpret_cast<__m128i*>(aDest), aBytes);
+  uint32_t tail = _mm_cvtsi128_si32(_mm_srli_si128(aBytes, 8));
+  memcpy(aDest + 8, &tail, sizeof(tail));
+}
+
+static inline void Store12(char16_t* aDest, __m128i aBytes) {
+  const __m128i zero = _mm_setzero_si128();
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(aDest),
+                   _mm_unpacklo_epi8(aBytes, zero));
+  _mm_storel_epi64(reinterpret_cast<__m128i*>(aDest + 8),
+                   _mm_unpackhi_epi8(aBytes, zero));
+}
+
+// Turns 12 input bytes (in the low lanes) into 16 Base64 characters.
+static inline __m128i EncodeBlock(__m128i aInput) {
+  // Spread each 3-byte group over a 32-bit lane as [b1, b0, b2, b1].
+  __m128i in = _mm_shuffle_epi8(
+      aInput, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+
+  // Move each 6-bit index into its own byte.
+  __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0FC0FC00));
+  __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+  __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003F03F0));
+  __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+  __m128i indices = _mm_or_si128(t1, t3);
+
+  // Map each index onto the offset that takes it to its ASCII character:
+  // 0..25 -> 13, 26..51 -> 0, 52..61 -> 1..10, 62 -> 11, 63 -> 12.
+  __m128i reduced = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+  __m128i isUpper = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+  reduced = _mm_or_si128(reduced, _mm_and_si128(isUpper, _mm_set1_epi8(13)));
+
+  const __m128i shiftLUT = _mm_setr_epi8(
+      'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+      '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+  return _mm_add_epi8(_mm_shuffle_epi8(shiftLUT, reduced), indices);
+}
+
+// Turns 16 Base64 characters into 12 bytes (in the low lanes). Returns false
+// if any of the characters is outside the standard alphabet.
+static inline bool DecodeBlock(__m128i aInput, __m128i* aOutput) {
+  const __m128i nibbleMask = _mm_set1_epi8(0x0F);
+  __m128i hiNibbles = _mm_and_si128(_mm_srli_epi32(aInput, 4), nibbleMask);
+  __m128i loNibbles = _mm_and_si128(aInput, nibbleMask);
+
+  // For each low nibble, the set of high nibbles that make a valid character.
+  const __m128i maskLUT = _mm_setr_epi8(
+      int8_t(0xA8), int8_t(0xF8), int8_t(0xF8), int8_t(0xF8), int8_t(0xF8),
+      int8_t(0xF8), int8_t(0xF8), int8_t(0xF8), int8_t(0xF8), int8_t(0xF8),
+      int8_t(0xF0), 0x54, 0x50, 0x50, 0x50, 0x54);
+  const __m128i bitposLUT = _mm_setr_epi8(0x01, 0x02, 0x04, 0x08, 0x10, 0x20,
+                                          0x40, int8_t(0x80), 0, 0, 0, 0, 0, 0,
+                                          0, 0);
+  __m128i validMask = _mm_shuffle_epi8(maskLUT, loNibbles);
+  __m128i bit = _mm_shuffle_epi8(bitposLUT, hiNibbles);
+  __m128i invalid =
+      _mm_cmpeq_epi8(_mm_and_si128(validMask, bit), _mm_setzero_si128());
+  if (_mm_movemask_epi8(invalid)) {
+    return false;
+  }
+
+  // Map each character to its 6-bit value by the offset for its high nibble;
+  // '/' shares a high nibble with '+' but needs its own offset.
+  const __m128i shiftLUT =
+      _mm_setr_epi8(0, 0, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+  __m128i shift = _mm_shuffle_epi8(shiftLUT, hiNibbles);
+  __m128i isSlash = _mm_cmpeq_epi8(aInput, _mm_set1_epi8('/'));
+  shift = _mm_or_si128(_mm_andnot_si128(isSlash, shift),
+                       _mm_and_si128(isSlash, _mm_set1_epi8(16)));
+  __m128i values = _mm_add_epi8(aInput, shift);
+
+  // Pack four 6-bit values per lane into 24 bits, then gather the bytes.
+  __m128i merged =
+      _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+  merged = _mm_madd_epi16(merged, _mm_set1_epi32(0x00011000));
+  *aOutput = _mm_shuffle_epi8(
+      merged, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1,
+                            -1));
+  return true;
+}
+
+// Encodes whole 12-byte groups while at least 16 source units remain, and
+// returns the number of source units consumed (always a multiple of 3).
+template <typename SrcT, typename DestT>
+size_t Base64EncodeSSSE3(const SrcT* aSrc, size_t aSrcLen, DestT* aDest) {
+  size_t consumed = 0;
+  while (aSrcLen - consumed >= 16) {
+    Store16(aDest, EncodeBlock(LoadTruncated(aSrc + consumed)));
+    consumed += 12;
+    aDest += 16;
+  }
+  return consumed;
+}
+
+// Decodes whole 16-character groups and returns the number of characters
+// consumed (always a multiple of 4). Stops early at a group containing
+// anything but the standard alphabet, leaving it for the scalar decoder to
+// reject.
+template <typename SrcT, typename DestT>
+size_t Base64DecodeSSSE3(const SrcT* aSrc, size_t aSrcLen, DestT* aDest) {
+  size_t consumed = 0;
+  while (aSrcLen - consumed >= 16) {
+    __m128i output;
+    if (!DecodeBlock(LoadSaturated(aSrc + consumed), &output)) {
+      break;
+    }
+    Store12(aDest, output);
+    consumed += 16;
+    aDest += 12;
+  }
+  return consumed;
+}
+
+template size_t Base64EncodeSSSE3<char, char>(const char*, size_t, char*);
+template size_t Base64EncodeSSSE3<char, char16_t>(const char*, size_t,
+                                                  char16_t*);
+template size_t Base64EncodeSSSE3<char16_t, char16_t>(const char16_t*, size_t,
+                                                      char16_t*);
+
+template size_t Base64DecodeSSSE3<char, char>(const char*, size_t, char*);
+template size_t Base64DecodeSSSE3<char16_t, char>(const char16_t*, size_t,
+                                                  char*);
+template size_t Base64DecodeSSSE3<char16_t, char16_t>(const char16_t*, size_t,
+                                                      char16_t*);
+
+}  // namespace mozilla
@@ -31,6 +31,10 @@
 #  include <sys/xattr.h>
 #endif
 
+#if defined(XP_LINUX)
+#  include <sys/sendfile.h>
+#endif
+
 #if defined(USE_LINUX_QUOTACTL)
 #  include <sys/mount.h>
 #  include <sys/quota.h>
@@ -961,6 +965,21 @@ nsLocalFile::CopyToNative(nsIFile* aNewParent, const nsACString& aNewName) {
     // looking at saved_write_error value. If PR_Write error occurs (and not
     // PR_Read() error), save_write_error is not NS_OK.
 
+#if defined(XP_LINUX)
+    // Let the kernel move the data between the two files without copying it
+    // through our buffer. sendfile() advances the offsets of both files, so
+    // if it fails part way, e.g. because the file system doesn't support it,
+    // the loop below picks up where it stopped and reports any real error.
+    {
+      int oldNative = PR_FileDesc2NativeHandle(oldFD);
+      int newNative = PR_FileDesc2NativeHandle(newFD);
+      ssize_t bytesSent;
+      do {
+        bytesSent = sendfile(newNative, oldNative, nullptr, 0x7ffff000);
+      } while (bytesSent > 0 || (bytesSent < 0 && errno == EINTR));
+    }
+#endif
+
     while ((bytesRead = PR_Read(oldFD, buf, BUFSIZ)) > 0) {
 #ifdef DEBUG_blizzard
       totalRead += bytesRead;
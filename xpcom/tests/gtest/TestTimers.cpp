@@ -249,6 +249,41 @@ TEST_F(SimpleTimerTest, SlackRepeating) {
   ASSERT_GT(*delay, 145U * kSlowdownFactor);
 }
 
+TEST_F(SimpleTimerTest, LowPriorityCoalescedWithNextTimer) {
+  // The low priority timer may be deferred until the next timer is due, but
+  // must not fire before its own deadline.
+  auto lowPriority =
+      MakeTimer(100 * kSlowdownFactor, nsITimer::TYPE_ONE_SHOT_LOW_PRIORITY);
+  auto next = MakeTimer(150 * kSlowdownFactor, nsITimer::TYPE_ONE_SHOT);
+
+  auto delay = lowPriority->Wait(250 * kSlowdownFactor);
+  ASSERT_TRUE(delay.isSome());
+  ASSERT_GT(*delay, 95U * kSlowdownFactor);
+  ASSERT_LT(*delay, 160U * kSlowdownFactor);
+
+  delay = next->Wait(250 * kSlowdownFactor);
+  ASSERT_TRUE(delay.isSome());
+  ASSERT_GT(*delay, 145U * kSlowdownFactor);
+  ASSERT_LT(*delay, 160U * kSlowdownFactor);
+}
+
+TEST_F(SimpleTimerTest, LowPriorityNotCoalescedPastTolerance) {
+  // A low priority timer fires on time when the next timer is due later than
+  // the coalescing tolerance allows.
+  uint32_t nextDelay =
+      100 * kSlowdownFactor +
+      StaticPrefs::timer_low_priority_coalescing_tolerance_ms() +
+      100 * kSlowdownFactor;
+  auto lowPriority =
+      MakeTimer(100 * kSlowdownFactor, nsITimer::TYPE_ONE_SHOT_LOW_PRIORITY);
+  auto next = MakeTimer(nextDelay, nsITimer::TYPE_ONE_SHOT);
+
+  auto delay = lowPriority->Wait(110 * kSlowdownFactor);
+  ASSERT_TRUE(delay.isSome());
+  ASSERT_GT(*delay, 95U * kSlowdownFactor);
+  ASSERT_LT(*delay, 110U * kSlowdownFactor);
+}
+
 TEST_F(SimpleTimerTest, RepeatingPrecise) {
   auto timer = MakeTimer(100 * kSlowdownFactor,
                          nsITimer::TYPE_REPEATING_PRECISE_CAN_SKIP);
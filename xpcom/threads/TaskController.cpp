@@ -13,6 +13,7 @@
 #include "GeckoProfiler.h"
 #include "mozilla/EventQueue.h"
 #include "mozilla/BackgroundHangMonitor.h"
+#include "mozilla/IdleTaskRunner.h"
 #include "mozilla/InputTaskManager.h"
 #include "mozilla/VsyncTaskManager.h"
 #include "mozilla/IOInterposer.h"
@@ -25,6 +26,9 @@
 #include "nsThread.h"
 #include "prenv.h"
 #include "prsystem.h"
+#ifdef MOZ_MEMORY
+#  include "mozmemory.h"
+#endif
 
 namespace mozilla {
 
@@ -54,9 +58,17 @@ struct TaskMarker {
     return MakeStringSpan("Task");
   }
   static void StreamJSONMarkerData(baseprofiler::SpliceableJSONWriter& aWriter,
-                                   const nsCString& aName, uint32_t aPriority) {
+                                   const nsCString& aName, uint32_t aPriority,
+                                   const TimeStamp& aInsertionTime,
+                                   const TimeStamp& aStartTime) {
     aWriter.StringProperty("name", aName);
     aWriter.IntProperty("priority", aPriority);
+    // The time the task spent in the queue, including waiting for its
+    // dependencies, before it started running.
+    if (!aInsertionTime.IsNull() && !aStartTime.IsNull()) {
+      aWriter.DoubleProperty(
+          "queueDelay", (aStartTime - aInsertionTime).ToMilliseconds());
+    }
 
 #  define EVENT_PRIORITY(NAME, VALUE)                \
     if (aPriority == (VALUE)) {                      \
@@ -79,14 +91,17 @@ struct TaskMarker {
     schema.AddKeyLabelFormat("priorityName", "Priority Name",
                              MS::Format::String);
     schema.AddKeyLabelFormat("priority", "Priority level", MS::Format::Integer);
+    schema.AddKeyLabelFormat("queueDelay", "Queue Delay",
+                             MS::Format::Duration);
     return schema;
   }
 };
 
 class MOZ_RAII AutoProfileTask {
  public:
-  explicit AutoProfileTask(nsACString& aName, uint64_t aPriority)
-      : mName(aName), mPriority(aPriority) {
+  AutoProfileTask(nsACString& aName, uint64_t aPriority,
+                  const TimeStamp& aInsertionTime)
+      : mName(aName), mPriority(aPriority), mInsertionTime(aInsertionTime) {
     if (profiler_is_active()) {
       mStartTime = TimeStamp::Now();
     }
@@ -103,20 +118,23 @@ class MOZ_RAII AutoProfileTask {
                         mStartTime.IsNull()
                             ? MarkerTiming::IntervalEnd()
                             : MarkerTiming::IntervalUntilNowFrom(mStartTime),
-                        TaskMarker{}, mName, mPriority);
+                        TaskMarker{}, mName, mPriority, mInsertionTime,
+                        mStartTime);
   }
 
  private:
   TimeStamp mStartTime;
   nsAutoCString mName;
   uint32_t mPriority;
+  TimeStamp mInsertionTime;
 };
 
 #  define AUTO_PROFILE_FOLLOWING_TASK(task)                                  \
     nsAutoCString name;                                                      \
     (task)->GetName(name);                                                   \
     AUTO_PROFILER_LABEL_DYNAMIC_NSCSTRING_NONSENSITIVE("Task", OTHER, name); \
-    mozilla::AutoProfileTask PROFILER_RAII(name, (task)->GetPriority());
+    mozilla::AutoProfileTask PROFILER_RAII(name, (task)->GetPriority(),      \
+                                           (task)->mInsertionTime);
 #else
 #  define AUTO_PROFILE_FOLLOWING_TASK(task)
 #endif
@@ -243,6 +261,10 @@ void TaskController::Shutdown() {
   InputTaskManager::Cleanup();
   VsyncTaskManager::Cleanup();
   if (sSingleton) {
+    if (sSingleton->mIdleMemoryCleanupRunner) {
+      sSingleton->mIdleMemoryCleanupRunner->Cancel();
+      sSingleton->mIdleMemoryCleanupRunner = nullptr;
+    }
     sSingleton->ShutdownThreadPoolInternal();
     sSingleton->ShutdownInternal();
   }
@@ -582,6 +604,18 @@ nsIRunnable* TaskController::GetRunnableForMTTask(bool aReallyWait) {
       return nullptr;
     }
 
+#ifdef MOZ_MEMORY
+    // With deferred purging, arenas exceeding their dirty page limit are
+    // purged in idle time instead of on the thread freeing memory. Scheduling
+    // the idle task adds a task, so check for tasks again before waiting.
+    if (!mIdleMemoryCleanupScheduled &&
+        moz_may_purge_one_now(/* aPeekOnly */ true)) {
+      MutexAutoUnlock unlock(mGraphMutex);
+      MayScheduleIdleMemoryCleanup();
+      continue;
+    }
+#endif
+
     AUTO_PROFILER_LABEL("TaskController::GetRunnableForMTTask::Wait", IDLE);
     mMainThreadCV.Wait();
   }
@@ -589,6 +623,48 @@ nsIRunnable* TaskController::GetRunnableForMTTask(bool aReallyWait) {
   return aReallyWait ? mMTBlockingProcessingRunnable : mMTProcessingRunnable;
 }
 
+#ifdef MOZ_MEMORY
+void TaskController::MayScheduleIdleMemoryCleanup() {
+  MOZ_ASSERT(NS_IsMainThread());
+
+  if (mIdleMemoryCleanupScheduled || mShuttingDown) {
+    return;
+  }
+  mIdleMemoryCleanupScheduled = true;
+
+  if (mIdleMemoryCleanupRunner) {
+    mIdleMemoryCleanupRunner->Cancel();
+  }
+  mIdleMemoryCleanupRunner = IdleTaskRunner::Create(
+      [](TimeStamp aDeadline) {
+        // Purge one arena at a time, and stop once the idle period is over.
+        // Without a deadline the runner is overdue, so only purge one arena
+        // before letting other tasks run.
+        bool purged = false;
+        while (moz_may_purge_one_now(/* aPeekOnly */ false)) {
+          purged = true;
+          if (aDeadline.IsNull() || TimeStamp::Now() >= aDeadline) {
+            break;
+          }
+        }
+        return purged;
+      },
+      "TaskController::IdleMemoryCleanup",
+      TimeDuration(),                        // Start looking for idle time
+                                             // immediately.
+      TimeDuration::FromMilliseconds(1000),  // The hard deadline.
+      TimeDuration::FromMilliseconds(1),     // Required budget.
+      true,                                  // repeating
+      [this] {                               // MayStopProcessing
+        if (moz_may_purge_one_now(/* aPeekOnly */ true)) {
+          return false;
+        }
+        mIdleMemoryCleanupScheduled = false;
+        return true;
+      });
+}
+#endif
+
 bool TaskController::HasMainThreadPendingTasks() {
   auto resetIdleState = MakeScopeExit([&idleManager = mIdleTaskManager] {
     if (idleManager) {
@@ -30,6 +30,7 @@ class nsIThreadObserver;
 namespace mozilla {
 
 class Task;
+class IdleTaskRunner;
 class TaskController;
 class PerformanceCounter;
 class PerformanceCounterState;
@@ -366,6 +367,10 @@ class TaskController {
 
   void EnsureMainThreadTasksScheduled();
 
+  // Schedules an idle task purging the mozjemalloc arenas which deferred
+  // purging their dirty pages, unless one is already scheduled.
+  void MayScheduleIdleMemoryCleanup();
+
   void ProcessUpdatedPriorityModifier(TaskManager* aManager);
 
   void ShutdownThreadPoolInternal();
@@ -418,6 +423,11 @@ class TaskController {
   RefPtr<nsIRunnable> mMTProcessingRunnable;
   RefPtr<nsIRunnable> mMTBlockingProcessingRunnable;
 
+  // Purges arenas with a deferred purge in idle time, see
+  // MayScheduleIdleMemoryCleanup. Only used on the main thread.
+  RefPtr<IdleTaskRunner> mIdleMemoryCleanupRunner;
+  bool mIdleMemoryCleanupScheduled = false;
+
   // XXX - Thread observer to notify when a new event has been dispatched
   nsIThreadObserver* mObserver = nullptr;
   // XXX - External condvar to notify when we have received an event
@@ -543,7 +543,7 @@ TimerThread::Run() {
       RemoveLeadingCanceledTimersInternal();
 
       if (!mTimers.IsEmpty()) {
-        TimeStamp timeout = mTimers[0]->Value()->mTimeout;
+        TimeStamp timeout = ComputeWakeupTimeFromTimers();
 
         // Don't wait at all (even for PR_INTERVAL_NO_WAIT) if the next timer
         // is due now or overdue.
@@ -587,6 +587,9 @@ TimerThread::Run() {
 
     mWaiting = true;
     mNotified = false;
+    mIntendedWakeupTime = mSleeping || waitFor == TimeDuration::Forever()
+                              ? TimeStamp()
+                              : TimeStamp::Now() + waitFor;
     {
       AUTO_PROFILER_TRACING_MARKER("TimerThread", "Wait", OTHER);
       mMonitor.Wait(waitFor);
@@ -595,6 +598,7 @@ TimerThread::Run() {
       forceRunNextTimer = false;
     }
     mWaiting = false;
+    mIntendedWakeupTime = TimeStamp();
   }
 
   return NS_OK;
@@ -622,12 +626,18 @@ nsresult TimerThread::AddTimer(nsTimerImpl* aTimer,
   // Awaken the timer thread if:
   // - This is the new front timer, which may require the TimerThread to wake up
   //   earlier than previously planned. AND/OR
+  // - The timer is due before the TimerThread planned to wake up, which can
+  //   happen when a low priority front timer was deferred, see
+  //   ComputeWakeupTimeFromTimers. AND/OR
   // - The delay is 0, which is usually meant to be run as soon as possible.
   //   Note: Even if the thread is scheduled to wake up now/soon, on some
   //   systems there could be a significant delay compared to notifying, which
   //   is almost immediate; and some users of 0-delay depend on it being this
   //   fast!
-  if (mWaiting && (mTimers[0]->Value() == aTimer || aTimer->mDelay.IsZero())) {
+  if (mWaiting &&
+      (mTimers[0]->Value() == aTimer || aTimer->mDelay.IsZero() ||
+       (!mIntendedWakeupTime.IsNull() &&
+        aTimer->mTimeout < mIntendedWakeupTime))) {
     mNotified = true;
     mMonitor.Notify();
   }
@@ -868,6 +878,48 @@ void TimerThread::RemoveFirstTimerInternal() {
   mTimers.RemoveLastElement();
 }
 
+TimeStamp TimerThread::ComputeWakeupTimeFromTimers() const {
+  mMonitor.AssertCurrentThreadOwns();
+  MOZ_ASSERT(!mTimers.IsEmpty());
+  MOZ_ASSERT(mTimers[0]->Value());
+
+  const TimeStamp frontTimeout = mTimers[0]->Value()->mTimeout;
+  if (!mTimers[0]->IsLowPriority() || mTimers.Length() < 2) {
+    return frontTimeout;
+  }
+
+  const uint32_t toleranceMs =
+      StaticPrefs::timer_low_priority_coalescing_tolerance_ms();
+  if (!toleranceMs) {
+    return frontTimeout;
+  }
+
+  // mTimers is a heap, so the next timer is one of the front's children. If
+  // either child was canceled, the next timer may be further down the heap;
+  // don't bother looking for it and just fire the front timer on time.
+  TimeStamp nextTimeout;
+  for (size_t i = 1; i < std::min<size_t>(3, mTimers.Length()); ++i) {
+    if (!mTimers[i]->Value()) {
+      return frontTimeout;
+    }
+    if (nextTimeout.IsNull() || mTimers[i]->Timeout() < nextTimeout) {
+      nextTimeout = mTimers[i]->Timeout();
+    }
+  }
+
+  // Defer the front timer until the next one is due if that is within the
+  // tolerance, so that both fire on the same wakeup.
+  if (nextTimeout <=
+      frontTimeout + TimeDuration::FromMilliseconds(toleranceMs)) {
+    MOZ_LOG(GetTimerLog(), LogLevel::Debug,
+            ("Deferring low priority timer by %fms to coalesce wakeups\n",
+             (nextTimeout - frontTimeout).ToMilliseconds()));
+    return std::max(frontTimeout, nextTimeout);
+  }
+
+  return frontTimeout;
+}
+
 void TimerThread::PostTimerEvent(already_AddRefed<nsTimerImpl> aTimerRef) {
   mMonitor.AssertCurrentThreadOwns();
   AUTO_TIMERS_STATS(TimerThread_PostTimerEvent);
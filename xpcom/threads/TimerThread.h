@@ -76,6 +76,11 @@ class TimerThread final : public mozilla::Runnable, public nsIObserver {
   void PostTimerEvent(already_AddRefed<nsTimerImpl> aTimerRef)
       MOZ_REQUIRES(mMonitor);
 
+  // Returns when the thread should wake up next to fire the front timer. This
+  // is the front timer's timeout, unless it is low priority and can be
+  // deferred a little to fire together with the next timer.
+  TimeStamp ComputeWakeupTimeFromTimers() const MOZ_REQUIRES(mMonitor);
+
   nsCOMPtr<nsIThread> mThread;
   // Lock ordering requirements:
   // (optional) ThreadWrapper::sMutex ->
@@ -87,9 +92,13 @@ class TimerThread final : public mozilla::Runnable, public nsIObserver {
   bool mWaiting MOZ_GUARDED_BY(mMonitor);
   bool mNotified MOZ_GUARDED_BY(mMonitor);
   bool mSleeping MOZ_GUARDED_BY(mMonitor);
+  // When the thread intends to wake up while waiting, or null if it waits
+  // forever. Timers added before this time must notify the thread.
+  TimeStamp mIntendedWakeupTime MOZ_GUARDED_BY(mMonitor);
 
   class Entry final : public nsTimerImplHolder {
     const TimeStamp mTimeout;
+    const bool mLowPriority;
 
    public:
     // Entries are created with the TimerImpl's mutex held.
@@ -97,10 +106,13 @@ class TimerThread final : public mozilla::Runnable, public nsIObserver {
     Entry(const TimeStamp& aMinTimeout, const TimeStamp& aTimeout,
           nsTimerImpl* aTimerImpl)
         : nsTimerImplHolder(aTimerImpl),
-          mTimeout(std::max(aMinTimeout, aTimeout)) {}
+          mTimeout(std::max(aMinTimeout, aTimeout)),
+          mLowPriority(aTimerImpl->IsLowPriority()) {}
 
     nsTimerImpl* Value() const { return mTimerImpl; }
 
+    bool IsLowPriority() const { return mLowPriority; }
+
     // Called with the Monitor held, but not the TimerImpl's mutex
     already_AddRefed<nsTimerImpl> Take() {
       if (mTimerImpl) {